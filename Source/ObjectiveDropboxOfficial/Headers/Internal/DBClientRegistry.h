@@ -0,0 +1,62 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+@class DBAccessToken;
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// Authorized clients by token uid, as kept by `DBClientsManager`.
+///
+/// A client is only created when it is first looked up, from the token registered for its uid. Lookups of clients
+/// already created don't take a lock: they read an immutable snapshot of the registry, which registering and
+/// removing tokens replace. With `maxActiveClients` set, the clients looked up least recently beyond that number are
+/// released, and created again on their next lookup. A released client that is still in use elsewhere is handed out
+/// again instead, so that there is only ever one client, and one token refresher, per token. The default client is
+/// never released.
+///
+@interface DBClientRegistry<ClientType> : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+///
+/// Creates an empty registry.
+///
+/// @param clientFactory Creates the client for a registered token. Called under the registry's lock, at most once
+/// per token at a time.
+///
+- (instancetype)initWithClientFactory:(ClientType (^)(DBAccessToken *token))clientFactory NS_DESIGNATED_INITIALIZER;
+
+/// The most clients kept at a time, other than the default client, or 0 for no limit. Defaults to 0.
+@property (atomic) NSUInteger maxActiveClients;
+
+/// The uid of the client returned by `defaultClient`. Not released by `maxActiveClients`.
+@property (atomic, copy, nullable) NSString *defaultTokenUid;
+
+/// The uids of all registered tokens.
+@property (nonatomic, readonly) NSArray<NSString *> *tokenUids;
+
+/// Registers `token` under its uid, replacing the token and dropping the client previously registered there.
+- (void)registerToken:(DBAccessToken *)token;
+
+/// Removes the token and client registered under `tokenUid`, if any.
+- (void)removeTokenUid:(NSString *)tokenUid;
+
+/// Removes all tokens and clients.
+- (void)removeAllTokens;
+
+/// The client for `tokenUid`, created if need be, or `nil` if no token is registered under `tokenUid`.
+- (nullable ClientType)clientForTokenUid:(NSString *)tokenUid;
+
+/// The client for `defaultTokenUid`, created if need be.
+- (nullable ClientType)defaultClient;
+
+/// The clients of all registered tokens, all of which are created if need be.
+- (NSDictionary<NSString *, ClientType> *)allClients;
+
+@end
+
+NS_ASSUME_NONNULL_END
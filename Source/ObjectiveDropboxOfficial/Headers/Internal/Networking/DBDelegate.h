@@ -10,6 +10,7 @@
 @class DBRpcData;
 @class DBUploadData;
 @class DBDownloadData;
+@class DBProgressCoalescer;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -18,6 +19,12 @@ NS_ASSUME_NONNULL_BEGIN
 ///
 /// @note This delegate forces all supplied delegate queues to be serial.
 ///
+/// The per-task state is spread across a fixed number of serial shards, so that the callbacks of independent sessions
+/// are processed concurrently while those of a single task stay in order. Sessions created with `sessionDelegateQueue`
+/// deliver their callbacks straight onto the queue of their shard; the tasks of any other session are hashed across the
+/// shards by session and task identifier. When a delegate queue is supplied, it is the only shard and the state of all
+/// tasks is serialized on it.
+///
 /// By default, this delegate is instantiated in the constructor of the `DBTransportDefaultClient` class, and uses the
 /// main delegate queue, so all handler code will be executed serially and on the main thread.
 ///
@@ -37,29 +44,57 @@ NS_ASSUME_NONNULL_BEGIN
 ///
 /// @note The supplied queue must be serial.
 ///
-/// @param delegateQueue The queue used to execute handler code. By defaut, this is the main queue, so all handler code
-/// will be executed on the main thread.
+/// @param delegateQueue The queue on which the state of all tasks is accessed. If nil, the state is sharded across
+/// internal serial queues.
 ///
 /// @return An initialized `DBDelegate` instance.
 ///
 - (instancetype)initWithQueue:(nullable NSOperationQueue *)delegateQueue;
 
 ///
-/// Enqueues a handler to be executed periodically to retrieve information on the progress of the
-/// `NSURLSessionTask` identified by the supplied task identifier for the corresponding Upload-style request.
+/// Returns the queue a new `NSURLSession` with this delegate should deliver its callbacks on.
+///
+/// @return The queue of one of the internal shards, assigned round-robin, on which the callbacks of the session are
+/// handled in place. Nil if a delegate queue was supplied, in which case the session should use a private serial queue,
+/// from which its callbacks are handed to the supplied queue.
+///
+- (nullable NSOperationQueue *)sessionDelegateQueue;
+
+///
+/// Installs the progress coalescer of the `NSURLSessionTask` identified by the supplied task identifier, to which
+/// progress updates of the task are reported. Progress reported before the installation is handed over right away.
 ///
 /// @param identifier The identifier of the `NSURLSessionTask` task associated with the API request.
 /// @param session The `NSURLSession` session associated with the API request.
-/// @param handler The progress block to be executed in the event of a request update. The first argument is the number
-/// of bytes downloaded. The second argument is the number of total bytes downloaded. And the third argument is the
-/// number of total bytes expected to be downloaded.
-/// @param handlerQueue The operation queue on which to execute progress handler code. If nil, then the progress queue
-/// is the queue with which the delegate object was instantiated.
+/// @param progressCoalescer The progress coalescer that rate limits the updates handed to the progress block of the
+/// request.
 ///
-- (void)addProgressHandlerForTaskWithIdentifier:(NSUInteger)identifier
-                                        session:(NSURLSession *)session
-                                progressHandler:(DBProgressBlock)handler
-                           progressHandlerQueue:(nullable NSOperationQueue *)handlerQueue;
+- (void)addProgressCoalescerForTaskWithIdentifier:(NSUInteger)identifier
+                                          session:(NSURLSession *)session
+                                progressCoalescer:(DBProgressCoalescer *)progressCoalescer;
+
+#pragma mark - Add stream consumers
+
+///
+/// Installs the consumer of the response body of the `NSURLSessionDataTask` identified by the supplied task identifier
+/// for the corresponding streaming Download-style request.
+///
+/// The successful response body is handed to the consumer as it arrives, instead of being collected in memory, and the
+/// task is suspended while the consumer falls behind. The response handler of the task, installed like an RPC-style
+/// handler, is executed once the consumer has consumed the whole body, with the response body only if it is an error.
+///
+/// @note Must be called before the task is resumed.
+///
+/// @param identifier The identifier of the `NSURLSessionDataTask` task associated with the API request.
+/// @param session The `NSURLSession` session associated with the API request.
+/// @param consumerBlock The block to which the response body is handed.
+/// @param consumerQueue The operation queue on which to execute the consumer block. It is forced to be serial. If nil,
+/// a private serial queue is used.
+///
+- (void)addStreamConsumerForTaskWithIdentifier:(NSUInteger)identifier
+                                       session:(NSURLSession *)session
+                                 consumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+                                 consumerQueue:(nullable NSOperationQueue *)consumerQueue;
 
 #pragma mark - Add RPC-style handlers
 
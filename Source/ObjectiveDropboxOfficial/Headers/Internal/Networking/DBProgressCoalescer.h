@@ -0,0 +1,62 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+#import "DBHandlerTypes.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// Rate limiter for progress updates.
+///
+/// Transfers report progress far more often than a consumer can make use of it, and every update handed over costs an
+/// operation on the progress queue. Updates are therefore coalesced: one is handed to the progress block once at least
+/// `minimumInterval` has elapsed since the previous one, or once at least `minimumByteDelta` bytes have accumulated,
+/// or once the transfer is complete. The bytes of coalesced updates are summed up, and the latest update is always
+/// handed over eventually, so no progress is lost. When the total size is unknown, completion can't be told from the
+/// updates, so the owner of the transfer calls `flush` once it completes.
+///
+/// Updates may be reported from any thread.
+///
+@interface DBProgressCoalescer : NSObject
+
+///
+/// `DBProgressCoalescer` full constructor.
+///
+/// @param progressBlock The progress block to which coalesced updates are handed.
+/// @param queue The operation queue on which to execute the progress block. If nil, the main queue is used.
+/// @param minimumInterval The minimum time between two updates. If 0, no update is held back.
+/// @param minimumByteDelta The number of accumulated bytes that lets an update through before `minimumInterval` has
+/// elapsed. If 0, only the interval applies.
+///
+/// @return An initialized `DBProgressCoalescer` instance.
+///
+- (instancetype)initWithProgressBlock:(DBProgressBlock)progressBlock
+                                queue:(nullable NSOperationQueue *)queue
+                      minimumInterval:(NSTimeInterval)minimumInterval
+                     minimumByteDelta:(int64_t)minimumByteDelta;
+
+///
+/// Reports a progress update.
+///
+/// @param committed Bytes committed since the previous update.
+/// @param totalCommitted Total bytes committed.
+/// @param expectedToCommit Total bytes expected to commit, or a negative value if unknown.
+///
+- (void)reportProgress:(int64_t)committed
+        totalCommitted:(int64_t)totalCommitted
+      expectedToCommit:(int64_t)expectedToCommit;
+
+///
+/// Hands the held back update, if any, to the progress block right away.
+///
+/// Called once the transfer is complete, before its response is handed over, so that the last update is never queued
+/// after the response.
+///
+- (void)flush;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -7,6 +7,8 @@
 #import "DBHandlerTypes.h"
 #import "DBHandlerTypesInternal.h"
 
+@class DBProgressCoalescer;
+
 NS_ASSUME_NONNULL_BEGIN
 
 #pragma mark - Progress data
@@ -87,47 +89,110 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
-#pragma mark - Session data
+#pragma mark - Stream consumer
 
 ///
-/// Session data storage.
+/// Stream consumer storage.
 ///
-/// All response data and handler data for a given session id is stored in this class. `DBDelegate` maintains a map of
-/// session ids to `DBSessionData` objects to manage response handling.
+/// Hands the response body of a streaming download to its consumer block, piece by piece, as it arrives. The task is
+/// suspended while more than `maxPendingBytes` bytes are waiting to be consumed, and resumed once the consumer has
+/// worked through half of that backlog, so that a slow consumer bounds the memory used by the download.
 ///
-@interface DBSessionData : NSObject
+@interface DBDownloadStreamConsumer : NSObject
 
-/// The unique identifier of the session. Data is stored by session (rather than task id, because task ids are not
-/// unique across sessions.
-@property (nonatomic, copy) NSString *sessionId;
+/// The serial queue on which the consumer block is executed.
+@property (nonatomic, readonly) NSOperationQueue *queue;
+
+/// Whether the response was rejected with `rejectResponseOfTask:`. Only accessed on `queue`.
+@property (nonatomic, readonly) BOOL responseRejected;
+
+///
+/// `DBDownloadStreamConsumer` full constructor.
+///
+/// @param consumerBlock The block to which the response body is handed.
+/// @param queue The operation queue on which to execute the consumer block. It is forced to be serial. If nil, a
+/// private queue is used.
+/// @param maxPendingBytes The number of handed over but not yet consumed bytes above which the task is suspended.
+///
+/// @return An initialized `DBDownloadStreamConsumer` instance.
+///
+- (instancetype)initWithConsumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+                                queue:(nullable NSOperationQueue *)queue
+                      maxPendingBytes:(NSUInteger)maxPendingBytes;
+
+///
+/// Enqueues a piece of the response body for the consumer block.
+///
+/// @param data The piece of the response body.
+/// @param task The task receiving the response body. It is suspended if the consumer falls behind, and cancelled if
+/// the consumer block rejects the data.
+///
+- (void)consumeData:(NSData *)data task:(NSURLSessionTask *)task;
+
+///
+/// Cancels `task` without handing any more of its response body to the consumer block, because the response isn't the
+/// one requested.
+///
+/// @param task The task receiving the response body.
+///
+- (void)rejectResponseOfTask:(NSURLSessionTask *)task;
+
+@end
+
+#pragma mark - Task data
+
+///
+/// Task data storage.
+///
+/// All response data and handler data of a single task is stored in one record, so that a callback needs a single
+/// lookup to reach it, and completing the task releases all of it at once.
+///
+@interface DBTaskData : NSObject
 
-/// Map from task id to response body data (for RPC and Upload style requests).
-@property (nonatomic, strong) NSMutableDictionary<NSNumber *, NSMutableData *> *responsesData;
+/// Response body data (for RPC and Upload style requests).
+@property (nonatomic, strong, nullable) NSMutableData *responseData;
 
-/// Map from task id to progress handler. Progress handlers are of the same type for all different styles of API
-/// requests.
-@property (nonatomic, strong) NSMutableDictionary<NSNumber *, DBProgressBlock> *progressHandlers;
+/// Progress coalescer, to which progress updates are reported. Progress handlers are of the same type for all
+/// different styles of API requests.
+@property (nonatomic, strong, nullable) DBProgressCoalescer *progressCoalescer;
 
-/// Map from task id to RPC-style response handler.
-@property (nonatomic, strong) NSMutableDictionary<NSNumber *, DBRpcResponseBlockStorage> *rpcHandlers;
+/// RPC-style response handler.
+@property (nonatomic, copy, nullable) DBRpcResponseBlockStorage rpcHandler;
 
-/// Map from task id to Upload-style response handler.
-@property (nonatomic, strong) NSMutableDictionary<NSNumber *, DBUploadResponseBlockStorage> *uploadHandlers;
+/// Upload-style response handler.
+@property (nonatomic, copy, nullable) DBUploadResponseBlockStorage uploadHandler;
 
-/// Map from task id to Download-style response handler.
-@property (nonatomic, strong) NSMutableDictionary<NSNumber *, DBDownloadResponseBlockStorage> *downloadHandlers;
+/// Download-style response handler.
+@property (nonatomic, copy, nullable) DBDownloadResponseBlockStorage downloadHandler;
 
-/// Map from task id to completion data object. Stores completion data for all styles of API requests.
-@property (nonatomic, strong) NSMutableDictionary<NSNumber *, DBCompletionData *> *completionData;
+/// Stream consumer (for streaming Download-style requests). Present from the creation of the task until its
+/// completion.
+@property (nonatomic, strong, nullable) DBDownloadStreamConsumer *streamConsumer;
 
-/// Map from task id to progress data object. Stores progress data for all styles of API requests.
-@property (nonatomic, strong) NSMutableDictionary<NSNumber *, DBProgressData *> *progressData;
+/// Completion data, saved until a response handler is installed.
+@property (nonatomic, strong, nullable) DBCompletionData *completionData;
 
-/// Map from task id to progress handler queue. Stores handler queues for all styles of API requests.
-@property (nonatomic, strong) NSMutableDictionary<NSNumber *, NSOperationQueue *> *progressHandlerQueues;
+/// Progress data, saved until a progress handler is installed.
+@property (nonatomic, strong, nullable) DBProgressData *progressData;
 
-/// Map from task id to response handler queue. Stores handler queues for all styles of API requests.
-@property (nonatomic, strong) NSMutableDictionary<NSNumber *, NSOperationQueue *> *responseHandlerQueues;
+/// Response handler queue. If nil, response handlers are executed on the main queue.
+@property (nonatomic, strong, nullable) NSOperationQueue *responseHandlerQueue;
+
+@end
+
+#pragma mark - Session data
+
+///
+/// Session data storage.
+///
+/// All response data and handler data for a given session id is stored in this class. `DBDelegate` maintains a map of
+/// session ids to `DBSessionData` objects to manage response handling.
+///
+@interface DBSessionData : NSObject
+
+/// The unique identifier of the session. Data is stored by session (rather than task id, because task ids are not
+/// unique across sessions.
+@property (nonatomic, copy) NSString *sessionId;
 
 ///
 /// `DBSessionData` full constructor.
@@ -138,6 +203,31 @@ NS_ASSUME_NONNULL_BEGIN
 ///
 - (instancetype)initWithSessionId:(NSString *)sessionid;
 
+///
+/// Returns the data of a task.
+///
+/// @param taskId The identifier of the task.
+///
+/// @return The data of the task, or nil if nothing is stored for it.
+///
+- (nullable DBTaskData *)taskDataForTaskId:(NSUInteger)taskId;
+
+///
+/// Returns the data of a task, storing an empty record for it first if there is none.
+///
+/// @param taskId The identifier of the task.
+///
+/// @return The data of the task.
+///
+- (DBTaskData *)ensureTaskDataForTaskId:(NSUInteger)taskId;
+
+///
+/// Removes all data of a task.
+///
+/// @param taskId The identifier of the task.
+///
+- (void)removeTaskDataForTaskId:(NSUInteger)taskId;
+
 @end
 
 NS_ASSUME_NONNULL_END
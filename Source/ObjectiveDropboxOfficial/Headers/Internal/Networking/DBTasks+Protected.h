@@ -8,8 +8,16 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+@class DBProgressCoalescer;
 @class DBRoute;
 
+@interface DBTask (Protected)
+
+- (DBProgressCoalescer *)progressCoalescerWithProgressBlock:(DBProgressBlock)progressBlock
+                                                      queue:(nullable NSOperationQueue *)queue;
+
+@end
+
 @interface DBRpcTask (Protected)
 
 - (DBRpcResponseBlockStorage)storageBlockWithResponseBlock:(DBRpcResponseBlockImpl)responseBlock
@@ -36,6 +44,9 @@ NS_ASSUME_NONNULL_BEGIN
 - (DBDownloadResponseBlockStorage)storageBlockWithResponseBlock:(DBDownloadDataResponseBlockImpl)responseBlock
                                                    cleanupBlock:(DBCleanupBlock)cleanupBlock;
 
+- (DBRpcResponseBlockStorage)streamStorageBlockWithResponseBlock:(DBDownloadDataResponseBlockImpl)responseBlock
+                                                     cleanupBlock:(DBCleanupBlock)cleanupBlock;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -111,6 +111,24 @@ NS_ASSUME_NONNULL_BEGIN
 /// @return An initialized instance.
 ///
 - (instancetype)initWithTask:(id<DBURLSessionTask>)task tokenUid:(nullable NSString *)tokenUid route:(DBRoute *)route;
+
+///
+/// DBDownloadDataTask constructor for streaming downloads.
+///
+/// @param task The `NSURLSessionDataTask` task that initialized the network request.
+/// @param tokenUid Identifies a unique Dropbox account. Used for the multi Dropbox account case where client objects
+/// are each associated with a particular Dropbox account.
+/// @param route The static `DBRoute` instance associated with the route to which the request was made. Contains
+/// information like route host, response type, etc.). This is used in the deserialization process.
+/// @param streaming Whether the file content is handed to a stream consumer as it arrives, rather than downloaded to a
+/// file. If so, the response block receives `nil` file data.
+///
+/// @return An initialized instance.
+///
+- (instancetype)initWithTask:(id<DBURLSessionTask>)task
+                    tokenUid:(nullable NSString *)tokenUid
+                       route:(DBRoute *)route
+                   streaming:(BOOL)streaming;
 @end
 
 NS_ASSUME_NONNULL_END
@@ -15,13 +15,12 @@ NS_ASSUME_NONNULL_BEGIN
 /// Used by internal classes of `DBTransportBaseClient`
 @interface DBTransportBaseClient (Internal)
 
-- (NSDictionary *)headersWithRouteInfo:(NSDictionary<NSString *, NSString *> *)routeAttributes
-                         serializedArg:(nullable NSString *)serializedArg;
+- (NSDictionary *)headersWithRoute:(DBRoute *)route serializedArg:(nullable NSString *)serializedArg;
 
-- (NSDictionary *)headersWithRouteInfo:(NSDictionary<NSString *, NSString *> *)routeAttributes
-                         serializedArg:(nullable NSString *)serializedArg
-                       byteOffsetStart:(nullable NSNumber *)byteOffsetStart
-                         byteOffsetEnd:(nullable NSNumber *)byteOffsetEnd;
+- (NSDictionary *)headersWithRoute:(DBRoute *)route
+                     serializedArg:(nullable NSString *)serializedArg
+                   byteOffsetStart:(nullable NSNumber *)byteOffsetStart
+                     byteOffsetEnd:(nullable NSNumber *)byteOffsetEnd;
 
 + (NSMutableURLRequest *)requestWithHeaders:(NSDictionary *)httpHeaders
                                         url:(NSURL *)url
@@ -34,6 +33,10 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (nullable NSString *)serializeStringWithRoute:(DBRoute *)route routeArg:(nullable id<DBSerializable>)arg;
 
+/// Returns the header-safe string form of data returned by `serializeDataWithRoute:routeArg:`, without serializing
+/// the argument again.
++ (nullable NSString *)serializedStringWithData:(nullable NSData *)serializedData;
+
 + (NSString *)asciiEscapeWithString:(NSString *)string;
 
 + (nullable DBRequestError *)dBRequestErrorWithErrorData:(nullable NSData *)errorData
@@ -41,6 +44,15 @@ NS_ASSUME_NONNULL_BEGIN
                                               statusCode:(int)statusCode
                                              httpHeaders:(nullable NSDictionary *)httpHeaders;
 
+/// Reads the body of a failed download from the file it was saved to, in a single bounded pass. Only the start of the
+/// body is kept: enough for any API error when it looks like JSON, and a short prefix otherwise, so that a large error
+/// page from a proxy is never loaded in full. Returns `nil` if the file can't be read.
++ (nullable NSData *)errorDataWithContentsOfFile:(nullable NSURL *)location;
+
+/// Appends the next part of an error body to `errorData`, with the same bound as `errorDataWithContentsOfFile:`.
+/// Returns `NO` once the bound is reached and any further parts would be dropped.
++ (BOOL)appendErrorData:(NSData *)data toErrorData:(NSMutableData *)errorData;
+
 + (nullable id)routeErrorWithRoute:(nullable DBRoute *)route data:(nullable NSData *)data statusCode:(int)statusCode;
 
 + (nullable id)routeResultWithRoute:(nullable DBRoute *)route
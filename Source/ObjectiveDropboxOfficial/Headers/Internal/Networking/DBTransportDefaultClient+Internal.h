@@ -0,0 +1,40 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+#import "DBTransportDefaultClient.h"
+
+@class DBTransportDefaultConfig;
+@protocol DBAccessTokenProvider;
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface DBTransportDefaultClient ()
+
+///
+/// Creates a client that makes its requests through the sessions, session delegate and delegate queue of `client`,
+/// rather than setting up its own.
+///
+/// Requests of both clients then share one connection pool, and only differ in the headers built from
+/// `transportConfig`, e.g. `Dropbox-Api-Select-User`. Session, delegate queue and foreground settings of
+/// `transportConfig` are ignored in favor of those of `client`.
+///
+- (instancetype)initSharingSessionsOfClient:(DBTransportDefaultClient *)client
+                            transportConfig:(DBTransportDefaultConfig *)transportConfig;
+
+///
+/// Creates a client that makes its requests through the sessions of `client`, as above, but authorizes them with
+/// `accessTokenProvider`, e.g. to make requests on behalf of another account over the same connection pool.
+///
+/// `client` is kept alive, and its sessions valid, for as long as the new client.
+///
+- (instancetype)initSharingSessionsOfClient:(DBTransportDefaultClient *)client
+                        accessTokenProvider:(nullable id<DBAccessTokenProvider>)accessTokenProvider
+                                   tokenUid:(nullable NSString *)tokenUid
+                            transportConfig:(DBTransportDefaultConfig *)transportConfig;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -5,6 +5,7 @@
 #import "DBHandlerTypes.h"
 #import <Foundation/Foundation.h>
 
+@class DBProgressCoalescer;
 @class DBURLSessionTaskResponseBlockWrapper;
 
 NS_ASSUME_NONNULL_BEGIN
@@ -31,10 +32,9 @@ typedef NSURLSessionTask *_Nonnull (^DBURLSessionTaskCreationBlock)(void);
 - (void)resume;
 
 /// Sets progress handler for the task.
-/// @param progressBlock The `DBProgressBlock` that handles task progress.
-/// @param queue An optional operation queue on which to execute progress handler code. If not provided, the handler
-/// may be executed on any queue.
-- (void)setProgressBlock:(DBProgressBlock)progressBlock queue:(nullable NSOperationQueue *)queue;
+/// @param progressCoalescer The `DBProgressCoalescer` to which task progress is reported, and which hands it to the
+/// progress block at a bounded rate.
+- (void)setProgressCoalescer:(DBProgressCoalescer *)progressCoalescer;
 
 /// Sets response/completion handler for the task.
 /// @param responseBlock The `DBURLSessionTaskResponseBlock` that handles task response.
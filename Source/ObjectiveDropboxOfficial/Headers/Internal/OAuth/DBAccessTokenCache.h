@@ -0,0 +1,45 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+#import "DBAccessTokenStore.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// In-memory, write-through copy of the tokens in a `DBAccessTokenStore`.
+///
+/// The store is read in full on first use, and changes are written to it before the copy is updated. Tokens that other
+/// code adds to the store directly are still found, on a lookup of their uid; tokens it deletes directly are not
+/// noticed until the copy is reloaded after a failed write.
+///
+@interface DBAccessTokenCache : NSObject <DBAccessTokenStore>
+
+/// The backing store.
+@property (nonatomic, readonly) id<DBAccessTokenStore> store;
+
+///
+/// The cache of the keychain tokens under `service`, shared by everything in the process that reads or writes them.
+///
+/// The cache is per process. Another process sharing the keychain, such as an app extension, can write a token that
+/// this cache won't see until it is reloaded after a failed write, e.g. a refreshed token under a uid cached here.
+///
+/// @param service The keychain service. Defaults to the main bundle's identifier when `nil`, as in `DBOAuthManager`.
+///
++ (DBAccessTokenCache *)cacheWithKeychainService:(nullable NSString *)service;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Designated initializer.
+///
+/// @param store The store to cache, which should not be written to other than through the cache.
+- (instancetype)initWithStore:(id<DBAccessTokenStore>)store NS_DESIGNATED_INITIALIZER;
+
+/// Whether any tokens are stored.
+- (BOOL)hasAccessTokens;
+
+@end
+
+NS_ASSUME_NONNULL_END
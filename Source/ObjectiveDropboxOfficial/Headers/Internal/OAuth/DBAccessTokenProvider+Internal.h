@@ -31,6 +31,12 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initWithToken:(DBAccessToken *)token
                tokenRefresher:(id<DBAccessTokenRefreshing>)tokenRefresher NS_DESIGNATED_INITIALIZER;
 
+/// Starts refreshing the token in the background shortly before it would be refreshed for a request, and again for
+/// every token after that, so that requests don't wait on a refresh. Each refresh happens at a random point in the 10
+/// minutes before the last 5 minutes of the token's lifetime, which spreads out the refreshes of many providers.
+/// Stops when the provider is deallocated.
+- (void)startProactiveRefresh;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,128 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+@class DBFILESCommitInfo;
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// The state of a single file of a batch upload, as read back from a `DBBatchUploadJournal`.
+///
+@interface DBBatchUploadJournalEntry : NSObject
+
+/// The url of the file.
+@property (nonatomic, readonly) NSURL *fileUrl;
+
+/// The size of the file when the batch was started.
+@property (nonatomic, readonly) NSUInteger fileSize;
+
+/// The modification date of the file when the batch was started, or `nil` if it wasn't journaled.
+@property (nonatomic, readonly, nullable) NSDate *modificationDate;
+
+/// The commit info of the file.
+@property (nonatomic, readonly) DBFILESCommitInfo *commitInfo;
+
+/// The id of the upload session most recently opened for the file, or `nil` if none was opened.
+@property (nonatomic, readonly, copy, nullable) NSString *sessionId;
+
+/// Whether `sessionId` refers to a concurrent upload session.
+@property (nonatomic, readonly) BOOL concurrent;
+
+/// The byte ranges of the file the server acknowledged for `sessionId`.
+@property (nonatomic, readonly) NSIndexSet *committedRanges;
+
+/// Whether `sessionId` was closed, so that the file only awaits `upload_session/finish_batch`.
+@property (nonatomic, readonly) BOOL closed;
+
+/// Whether the file was passed to a successful `upload_session/finish_batch` call, so that nothing is left to do.
+@property (nonatomic, readonly) BOOL finished;
+
+///
+/// Whether the upload of the file can be picked up from `sessionId`, which is only the case if a session was opened and
+/// the file is unchanged since: its size alone misses an edit that keeps it, which would mix old and new bytes in the
+/// committed file.
+///
+/// @param fileSize The current size of the file.
+/// @param modificationDate The current modification date of the file.
+///
+- (BOOL)isResumableWithFileSize:(NSUInteger)fileSize modificationDate:(nullable NSDate *)modificationDate;
+
+@end
+
+///
+/// Append-only, on-disk record of the progress of a batch upload, from which the batch can be resumed after the process
+/// was terminated.
+///
+/// Every record is a JSON object on its own line. Records are only ever appended, so a partially written last line left
+/// behind by a crash is skipped when the journal is read back. Records are written asynchronously, in order, on a
+/// private serial queue.
+///
+@interface DBBatchUploadJournal : NSObject
+
+/// The url of the journal file.
+@property (nonatomic, readonly) NSURL *journalUrl;
+
+/// The state of every file of the batch, as read back from disk. Empty for a new journal.
+@property (nonatomic, readonly) NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *entries;
+
+///
+/// Creates a new, empty journal, replacing any existing file at `journalUrl`.
+///
+/// @param journalUrl The url of the journal file.
+/// @param error On failure, the reason the file could not be created.
+///
+/// @return An initialized instance, or `nil` if the file could not be created.
+///
+- (nullable instancetype)initWithNewJournalUrl:(NSURL *)journalUrl error:(NSError *_Nullable *_Nullable)error;
+
+///
+/// Opens an existing journal and reads back its entries. New records are appended to the same file.
+///
+/// @param journalUrl The url of the journal file.
+/// @param error On failure, the reason the file could not be read.
+///
+/// @return An initialized instance, or `nil` if the file could not be read.
+///
+- (nullable instancetype)initWithExistingJournalUrl:(NSURL *)journalUrl error:(NSError *_Nullable *_Nullable)error;
+
+///
+/// Records a file of the batch, resetting any previous state of that file.
+///
+- (void)recordFileUrl:(NSURL *)fileUrl
+             fileSize:(NSUInteger)fileSize
+     modificationDate:(nullable NSDate *)modificationDate
+           commitInfo:(DBFILESCommitInfo *)commitInfo;
+
+///
+/// Records an upload session opened for a file, resetting the acknowledged ranges of that file.
+///
+- (void)recordSessionId:(NSString *)sessionId concurrent:(BOOL)concurrent fileUrl:(NSURL *)fileUrl;
+
+///
+/// Records a byte range of a file the server acknowledged.
+///
+- (void)recordCommittedRangeWithStartBytes:(NSUInteger)startBytes
+                                  endBytes:(NSUInteger)endBytes
+                                   fileUrl:(NSURL *)fileUrl;
+
+///
+/// Records that the upload session of a file was closed.
+///
+- (void)recordSessionClosedForFileUrl:(NSURL *)fileUrl;
+
+///
+/// Records that the upload session of a file was passed to a successful `upload_session/finish_batch` call.
+///
+- (void)recordSessionFinishedForFileUrl:(NSURL *)fileUrl;
+
+///
+/// Deletes the journal file once the batch is committed. Later records are dropped.
+///
+- (void)remove;
+
+@end
+
+NS_ASSUME_NONNULL_END
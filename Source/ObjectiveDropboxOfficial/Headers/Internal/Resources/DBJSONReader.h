@@ -0,0 +1,137 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+@class DBJSONReader;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The kind of the next JSON value or structural token in a `DBJSONReader`.
+typedef NS_ENUM(NSInteger, DBJSONToken) {
+  /// The input is malformed, or reading already failed.
+  DBJSONTokenInvalid,
+  /// There is no more input.
+  DBJSONTokenEnd,
+  DBJSONTokenBeginObject,
+  DBJSONTokenEndObject,
+  DBJSONTokenBeginArray,
+  DBJSONTokenEndArray,
+  DBJSONTokenString,
+  DBJSONTokenNumber,
+  DBJSONTokenTrue,
+  DBJSONTokenFalse,
+  DBJSONTokenNull,
+};
+
+///
+/// Protocol for API objects that can be built directly from a `DBJSONReader`, without going through an intermediate
+/// `NSDictionary` tree.
+///
+/// Generated serializers may implement this next to `+deserialize:`. When a route's result type responds to
+/// `deserializeFromReader:`, the SDK decodes responses with it instead of `NSJSONSerialization`.
+///
+@protocol DBStreamDeserializable <NSObject>
+
+///
+/// Class method which returns an instantiation of the object as represented by the next JSON value of the reader.
+///
+/// Implementations must consume exactly one value, and skip (with `skipValue`) object keys they do not know, so that
+/// fields added to the API later do not break decoding.
+///
+/// @param reader The reader, positioned before the value to be deserialized.
+///
+/// @return A deserialized instantiation of the API object, or `nil` if the reader failed.
+///
++ (nullable id)deserializeFromReader:(DBJSONReader *)reader;
+
+@end
+
+///
+/// Pull-style JSON tokenizer which reads values straight out of UTF-8 encoded bytes.
+///
+/// Unlike `NSJSONSerialization`, the reader doesn't build containers for the whole document: callers walk objects
+/// with `beginObject` / `nextKey` and arrays with `beginArray` / `nextElement`, and only materialize the leaf values
+/// they need. Object keys can be matched with `keyEquals:` without allocating a string.
+///
+/// Errors are sticky: after the first malformed token `error` is set, and every subsequent read fails.
+///
+/// A reader is not thread-safe, and must only be used from one thread at a time.
+///
+@interface DBJSONReader : NSObject
+
+/// The first error encountered while reading, in the `NSCocoaErrorDomain` like `NSJSONSerialization` errors.
+@property (nonatomic, readonly, nullable) NSError *error;
+
+/// The key most recently read by `nextKey`. Unlike `keyEquals:`, this allocates a string.
+@property (nonatomic, readonly, nullable) NSString *key;
+
+///
+/// DBJSONReader full constructor.
+///
+/// @param data The UTF-8 encoded JSON document to read. The data is not copied, and must not be mutated while
+/// reading.
+///
+/// @return An initialized instance.
+///
+- (instancetype)initWithData:(NSData *)data;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Returns the kind of the next token, without consuming it.
+- (DBJSONToken)peek;
+
+/// Consumes the `{` which starts an object. Returns `NO` if the next value isn't an object.
+- (BOOL)beginObject;
+
+///
+/// Advances to the next key of the current object and consumes it along with its `:`.
+///
+/// @return `YES` if a key was read and the reader is positioned before its value, or `NO` once the closing `}` has
+/// been consumed (or on error).
+///
+- (BOOL)nextKey;
+
+/// Returns whether the key most recently read by `nextKey` is the given NUL-terminated UTF-8 string.
+- (BOOL)keyEquals:(const char *)key;
+
+/// Consumes the `[` which starts an array. Returns `NO` if the next value isn't an array.
+- (BOOL)beginArray;
+
+///
+/// Advances to the next element of the current array.
+///
+/// @return `YES` if the reader is positioned before an element, or `NO` once the closing `]` has been consumed (or
+/// on error).
+///
+- (BOOL)nextElement;
+
+/// Reads a string value, or returns `nil` if the next value isn't a string.
+- (nullable NSString *)readString;
+
+/// Reads a number value, or returns `nil` if the next value isn't a number.
+- (nullable NSNumber *)readNumber;
+
+/// Reads a boolean value as an `NSNumber`, or returns `nil` if the next value isn't `true` or `false`.
+- (nullable NSNumber *)readBool;
+
+/// Consumes a `null` value and returns `YES`, or returns `NO` and consumes nothing if the next value isn't `null`.
+- (BOOL)readNull;
+
+///
+/// Reads the next value, whatever its type, into the same Foundation objects `NSJSONSerialization` produces.
+///
+/// This lets streaming deserializers hand sub-values to existing `+deserialize:` implementations.
+///
+- (nullable id)readValue;
+
+/// Consumes the next value, whatever its type, without materializing it.
+- (void)skipValue;
+
+/// Returns `YES` if the whole input has been consumed without error, apart from trailing whitespace.
+- (BOOL)finish;
+
+@end
+
+NS_ASSUME_NONNULL_END
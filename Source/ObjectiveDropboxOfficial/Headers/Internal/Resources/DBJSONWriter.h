@@ -0,0 +1,33 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// Single-pass JSON writer for request arguments.
+///
+/// The output only contains printable ASCII: non-ASCII characters are written as `\u` escapes of their UTF-16 code
+/// units, and `/` is not escaped. That makes the same bytes usable both as an RPC request body and as a
+/// `Dropbox-API-Arg` header value, without the separate escaping passes `NSJSONSerialization` output needs.
+///
+@interface DBJSONWriter : NSObject
+
+///
+/// Serializes a JSON-compatible object tree, as produced by the generated serializers.
+///
+/// @param jsonObject An `NSDictionary`, `NSArray`, `NSString`, `NSNumber` or `NSNull`, and nested containers of
+/// those.
+///
+/// @return The ASCII-encoded JSON, or `nil` if the tree contains a value JSON can't represent, such as a non-string
+/// dictionary key or a non-finite number.
+///
++ (nullable NSData *)asciiDataWithJSONObject:(id)jsonObject;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,40 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+#import "DBStoneSerializers.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// Date conversion used by the generated `DBNSDateSerializer`, none of which takes a lock, so that dates can be
+/// serialized concurrently from any thread.
+///
+/// The API timestamp format `%Y-%m-%dT%H:%M:%SZ` is parsed and printed without a date formatter. Every other format,
+/// and input the fast path doesn't accept, goes through a formatter cached per thread and per format.
+///
+@interface DBNSDateSerializer (Internal)
+
+///
+/// Prints a date in the API timestamp format, without a date formatter.
+///
+/// @return The timestamp, or `nil` if `dateFormat` isn't the API timestamp format or the year doesn't fit four digits.
+///
++ (nullable NSString *)timestampStringWithDate:(NSDate *)value dateFormat:(NSString *)dateFormat;
+
+///
+/// Parses a string in the API timestamp format, without a date formatter.
+///
+/// @return The date, or `nil` if `dateFormat` isn't the API timestamp format or `value` isn't a valid date of exactly
+/// that shape.
+///
++ (nullable NSDate *)timestampDateWithString:(NSString *)value dateFormat:(NSString *)dateFormat;
+
+/// Returns the formatter of the calling thread for `dateFormat`, a format in `strftime` notation.
++ (NSDateFormatter *)formatterWithDateFormat:(NSString *)dateFormat;
+
+@end
+
+NS_ASSUME_NONNULL_END
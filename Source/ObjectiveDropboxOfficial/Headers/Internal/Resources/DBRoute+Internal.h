@@ -0,0 +1,39 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+#import "DBStoneBase.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Authentication types a route accepts, from its `auth` attribute.
+typedef NS_OPTIONS(NSUInteger, DBRouteAuth) {
+  DBRouteAuthNoAuth = 1 << 0,
+  DBRouteAuthUser = 1 << 1,
+  DBRouteAuthTeam = 1 << 2,
+  DBRouteAuthApp = 1 << 3,
+};
+
+/// Request style of a route, from its `style` attribute.
+typedef NS_ENUM(NSUInteger, DBRouteStyle) {
+  DBRouteStyleUnknown = 0,
+  DBRouteStyleRpc,
+  DBRouteStyleUpload,
+  DBRouteStyleDownload,
+};
+
+///
+/// Route attributes parsed once, on first use, rather than for every request made to the route. Kept out of the
+/// generated `DBRoute` so that they survive regenerating it.
+///
+@interface DBRoute (Internal)
+
+@property (nonatomic, readonly) DBRouteAuth auth;
+
+@property (nonatomic, readonly) DBRouteStyle style;
+
+@end
+
+NS_ASSUME_NONNULL_END
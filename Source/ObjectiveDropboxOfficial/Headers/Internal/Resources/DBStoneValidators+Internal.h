@@ -0,0 +1,25 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+#import "DBStoneValidators.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// Helpers of the generated validators, which are safe to call concurrently from any thread.
+///
+@interface DBStoneValidators (Internal)
+
+/// Whether the calling thread is inside `deserializeTrustedValue:` with checks turned off, in which case validators
+/// return without checking anything.
++ (BOOL)checksSuspended;
+
+/// Returns the compiled expression of `pattern`, which is only compiled once, or `nil` if the pattern is invalid.
++ (nullable NSRegularExpression *)regularExpressionWithPattern:(NSString *)pattern;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -2,46 +2,26 @@
 /// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
 ///
 
+#import "DBNSDateSerializer+Internal.h"
 #import "DBStoneSerializers.h"
 #import "DBStoneValidators.h"
 
-static NSDateFormatter *sFormatter = nil;
-static NSString *sDateFormat = nil;
-
 @implementation DBNSDateSerializer
 
-+ (void)initialize {
-  if (self == [DBNSDateSerializer class]) {
-    sFormatter = [[NSDateFormatter alloc] init];
-    [sFormatter setTimeZone:[NSTimeZone timeZoneWithName:@"UTC"]];
-    [sFormatter setLocale:[NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"]];
-  }
-}
-
 + (NSString *)serialize:(NSDate *)value dateFormat:(NSString *)dateFormat {
   if (value == nil) {
     [DBStoneValidators raiseIllegalStateErrorWithMessage:@"Value must not be `nil`"];
   }
-  @synchronized(sFormatter) {
-    if (![dateFormat isEqualToString:sDateFormat]) {
-      [sFormatter setDateFormat:[self convertFormat:dateFormat]];
-      sDateFormat = [dateFormat copy];
-    }
-    return [sFormatter stringFromDate:value];
-  }
+  return [self timestampStringWithDate:value dateFormat:dateFormat]
+             ?: [[self formatterWithDateFormat:dateFormat] stringFromDate:value];
 }
 
 + (NSDate *)deserialize:(NSString *)value dateFormat:(NSString *)dateFormat {
   if (value == nil) {
     [DBStoneValidators raiseIllegalStateErrorWithMessage:@"Value must not be `nil`"];
   }
-  @synchronized(sFormatter) {
-    if (![dateFormat isEqualToString:sDateFormat]) {
-      [sFormatter setDateFormat:[self convertFormat:dateFormat]];
-      sDateFormat = [dateFormat copy];
-    }
-    return [sFormatter dateFromString:value];
-  }
+  return [self timestampDateWithString:value dateFormat:dateFormat]
+             ?: [[self formatterWithDateFormat:dateFormat] dateFromString:value];
 }
 
 + (NSString *)formatDateToken:(NSString *)token {
@@ -2,6 +2,7 @@
 /// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
 ///
 
+#import "DBStoneValidators+Internal.h"
 #import "DBStoneValidators.h"
 
 @implementation DBStoneValidators
@@ -11,6 +12,10 @@
                                 pattern:(NSString *)pattern {
 
   void (^validator)(NSString *) = ^(NSString *value) {
+    if ([[self class] checksSuspended]) {
+      return;
+    }
+
     if (minLength != nil) {
       if ([value length] < [minLength unsignedIntegerValue]) {
         NSString *exceptionMessage =
@@ -28,11 +33,11 @@
     }
 
     if (pattern != nil && pattern.length != 0) {
-      NSError *error;
-      NSRegularExpression *re = [NSRegularExpression regularExpressionWithPattern:pattern options:0 error:&error];
-      NSArray *matches = [re matchesInString:value options:0 range:NSMakeRange(0, [value length])];
-      if ([matches count] == 0) {
-        NSString *exceptionMessage = [NSString stringWithFormat:@"value must match pattern \"%@\"", [re pattern]];
+      NSRegularExpression *re = [[self class] regularExpressionWithPattern:pattern];
+      NSRange range = re ? [re rangeOfFirstMatchInString:value options:0 range:NSMakeRange(0, [value length])]
+                         : NSMakeRange(NSNotFound, 0);
+      if (range.location == NSNotFound) {
+        NSString *exceptionMessage = [NSString stringWithFormat:@"value must match pattern \"%@\"", pattern];
         [[self class] raiseIllegalStateErrorWithMessage:exceptionMessage];
       }
     }
@@ -43,6 +48,10 @@
 
 + (void (^)(NSNumber *))numericValidator:(NSNumber *)minValue maxValue:(NSNumber *)maxValue {
   void (^validator)(NSNumber *) = ^(NSNumber *value) {
+    if ([[self class] checksSuspended]) {
+      return;
+    }
+
     if (minValue != nil) {
       if ([value unsignedIntegerValue] < [minValue unsignedIntegerValue]) {
         NSString *exceptionMessage = [NSString stringWithFormat:@"value must be at least %@", [minValue stringValue]];
@@ -65,6 +74,10 @@
                                  maxItems:(NSNumber *)maxItems
                             itemValidator:(void (^)(id))itemValidator {
   void (^validator)(NSArray<id> *) = ^(NSArray<id> *value) {
+    if ([[self class] checksSuspended]) {
+      return;
+    }
+
     if (minItems != nil) {
       if ([value count] < [minItems unsignedIntegerValue]) {
         NSString *exceptionMessage =
@@ -93,6 +106,10 @@
 
 + (void (^)(NSDictionary<NSString *, id> *))mapValidator:(void (^)(id))itemValidator {
   void (^validator)(NSDictionary<NSString *, id> *) = ^(NSDictionary<NSString *, id> *value) {
+    if ([[self class] checksSuspended]) {
+      return;
+    }
+
     if (itemValidator != nil) {
       for (id key in value) {
         itemValidator(value[key]);
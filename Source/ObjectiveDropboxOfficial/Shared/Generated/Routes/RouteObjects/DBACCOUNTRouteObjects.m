@@ -15,32 +15,23 @@
 
 static DBRoute *DBACCOUNTSetProfilePhoto;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBACCOUNTSetProfilePhoto {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBACCOUNTSetProfilePhoto = [[DBRoute alloc] init:@"set_profile_photo"
+                                          namespace_:@"account"
+                                          deprecated:@NO
+                                          resultType:[DBACCOUNTSetProfilePhotoResult class]
+                                           errorType:[DBACCOUNTSetProfilePhotoError class]
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
   });
-}
-
-+ (DBRoute *)DBACCOUNTSetProfilePhoto {
-  @synchronized(lockObj) {
-    if (!DBACCOUNTSetProfilePhoto) {
-      DBACCOUNTSetProfilePhoto = [[DBRoute alloc] init:@"set_profile_photo"
-                                            namespace_:@"account"
-                                            deprecated:@NO
-                                            resultType:[DBACCOUNTSetProfilePhotoResult class]
-                                             errorType:[DBACCOUNTSetProfilePhotoError class]
-                                                 attrs:@{
-                                                   @"auth" : @"user",
-                                                   @"host" : @"api",
-                                                   @"style" : @"rpc"
-                                                 }
-                                 dataStructSerialBlock:nil
-                               dataStructDeserialBlock:nil];
-    }
-    return DBACCOUNTSetProfilePhoto;
-  }
+  return DBACCOUNTSetProfilePhoto;
 }
 
 @end
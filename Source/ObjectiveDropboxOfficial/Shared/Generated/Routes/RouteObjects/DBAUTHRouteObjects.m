@@ -17,52 +17,42 @@
 static DBRoute *DBAUTHTokenFromOauth1;
 static DBRoute *DBAUTHTokenRevoke;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBAUTHTokenFromOauth1 {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBAUTHTokenFromOauth1 = [[DBRoute alloc] init:@"token/from_oauth1"
+                                       namespace_:@"auth"
+                                       deprecated:@NO
+                                       resultType:[DBAUTHTokenFromOAuth1Result class]
+                                        errorType:[DBAUTHTokenFromOAuth1Error class]
+                                            attrs:@{
+                                              @"auth" : @"app",
+                                              @"host" : @"api",
+                                              @"style" : @"rpc"
+                                            }
+                            dataStructSerialBlock:nil
+                          dataStructDeserialBlock:nil];
   });
-}
-
-+ (DBRoute *)DBAUTHTokenFromOauth1 {
-  @synchronized(lockObj) {
-    if (!DBAUTHTokenFromOauth1) {
-      DBAUTHTokenFromOauth1 = [[DBRoute alloc] init:@"token/from_oauth1"
-                                         namespace_:@"auth"
-                                         deprecated:@NO
-                                         resultType:[DBAUTHTokenFromOAuth1Result class]
-                                          errorType:[DBAUTHTokenFromOAuth1Error class]
-                                              attrs:@{
-                                                @"auth" : @"app",
-                                                @"host" : @"api",
-                                                @"style" : @"rpc"
-                                              }
-                              dataStructSerialBlock:nil
-                            dataStructDeserialBlock:nil];
-    }
-    return DBAUTHTokenFromOauth1;
-  }
+  return DBAUTHTokenFromOauth1;
 }
 
 + (DBRoute *)DBAUTHTokenRevoke {
-  @synchronized(lockObj) {
-    if (!DBAUTHTokenRevoke) {
-      DBAUTHTokenRevoke = [[DBRoute alloc] init:@"token/revoke"
-                                     namespace_:@"auth"
-                                     deprecated:@NO
-                                     resultType:nil
-                                      errorType:nil
-                                          attrs:@{
-                                            @"auth" : @"user",
-                                            @"host" : @"api",
-                                            @"style" : @"rpc"
-                                          }
-                          dataStructSerialBlock:nil
-                        dataStructDeserialBlock:nil];
-    }
-    return DBAUTHTokenRevoke;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBAUTHTokenRevoke = [[DBRoute alloc] init:@"token/revoke"
+                                   namespace_:@"auth"
+                                   deprecated:@NO
+                                   resultType:nil
+                                    errorType:nil
+                                        attrs:@{
+                                          @"auth" : @"user",
+                                          @"host" : @"api",
+                                          @"style" : @"rpc"
+                                        }
+                        dataStructSerialBlock:nil
+                      dataStructDeserialBlock:nil];
+  });
+  return DBAUTHTokenRevoke;
 }
 
 @end
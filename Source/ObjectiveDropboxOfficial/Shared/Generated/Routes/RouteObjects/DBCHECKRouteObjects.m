@@ -16,52 +16,42 @@
 static DBRoute *DBCHECKApp;
 static DBRoute *DBCHECKUser;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBCHECKApp {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBCHECKApp = [[DBRoute alloc] init:@"app"
+                            namespace_:@"check"
+                            deprecated:@NO
+                            resultType:[DBCHECKEchoResult class]
+                             errorType:nil
+                                 attrs:@{
+                                   @"auth" : @"app",
+                                   @"host" : @"api",
+                                   @"style" : @"rpc"
+                                 }
+                 dataStructSerialBlock:nil
+               dataStructDeserialBlock:nil];
   });
-}
-
-+ (DBRoute *)DBCHECKApp {
-  @synchronized(lockObj) {
-    if (!DBCHECKApp) {
-      DBCHECKApp = [[DBRoute alloc] init:@"app"
-                              namespace_:@"check"
-                              deprecated:@NO
-                              resultType:[DBCHECKEchoResult class]
-                               errorType:nil
-                                   attrs:@{
-                                     @"auth" : @"app",
-                                     @"host" : @"api",
-                                     @"style" : @"rpc"
-                                   }
-                   dataStructSerialBlock:nil
-                 dataStructDeserialBlock:nil];
-    }
-    return DBCHECKApp;
-  }
+  return DBCHECKApp;
 }
 
 + (DBRoute *)DBCHECKUser {
-  @synchronized(lockObj) {
-    if (!DBCHECKUser) {
-      DBCHECKUser = [[DBRoute alloc] init:@"user"
-                               namespace_:@"check"
-                               deprecated:@NO
-                               resultType:[DBCHECKEchoResult class]
-                                errorType:nil
-                                    attrs:@{
-                                      @"auth" : @"user",
-                                      @"host" : @"api",
-                                      @"style" : @"rpc"
-                                    }
-                    dataStructSerialBlock:nil
-                  dataStructDeserialBlock:nil];
-    }
-    return DBCHECKUser;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBCHECKUser = [[DBRoute alloc] init:@"user"
+                             namespace_:@"check"
+                             deprecated:@NO
+                             resultType:[DBCHECKEchoResult class]
+                              errorType:nil
+                                  attrs:@{
+                                    @"auth" : @"user",
+                                    @"host" : @"api",
+                                    @"style" : @"rpc"
+                                  }
+                  dataStructSerialBlock:nil
+                dataStructDeserialBlock:nil];
+  });
+  return DBCHECKUser;
 }
 
 @end
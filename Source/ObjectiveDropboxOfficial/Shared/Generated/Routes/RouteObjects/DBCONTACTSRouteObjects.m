@@ -15,52 +15,42 @@
 static DBRoute *DBCONTACTSDeleteManualContacts;
 static DBRoute *DBCONTACTSDeleteManualContactsBatch;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBCONTACTSDeleteManualContacts {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBCONTACTSDeleteManualContacts = [[DBRoute alloc] init:@"delete_manual_contacts"
+                                                namespace_:@"contacts"
+                                                deprecated:@NO
+                                                resultType:nil
+                                                 errorType:nil
+                                                     attrs:@{
+                                                       @"auth" : @"user",
+                                                       @"host" : @"api",
+                                                       @"style" : @"rpc"
+                                                     }
+                                     dataStructSerialBlock:nil
+                                   dataStructDeserialBlock:nil];
   });
-}
-
-+ (DBRoute *)DBCONTACTSDeleteManualContacts {
-  @synchronized(lockObj) {
-    if (!DBCONTACTSDeleteManualContacts) {
-      DBCONTACTSDeleteManualContacts = [[DBRoute alloc] init:@"delete_manual_contacts"
-                                                  namespace_:@"contacts"
-                                                  deprecated:@NO
-                                                  resultType:nil
-                                                   errorType:nil
-                                                       attrs:@{
-                                                         @"auth" : @"user",
-                                                         @"host" : @"api",
-                                                         @"style" : @"rpc"
-                                                       }
-                                       dataStructSerialBlock:nil
-                                     dataStructDeserialBlock:nil];
-    }
-    return DBCONTACTSDeleteManualContacts;
-  }
+  return DBCONTACTSDeleteManualContacts;
 }
 
 + (DBRoute *)DBCONTACTSDeleteManualContactsBatch {
-  @synchronized(lockObj) {
-    if (!DBCONTACTSDeleteManualContactsBatch) {
-      DBCONTACTSDeleteManualContactsBatch = [[DBRoute alloc] init:@"delete_manual_contacts_batch"
-                                                       namespace_:@"contacts"
-                                                       deprecated:@NO
-                                                       resultType:nil
-                                                        errorType:[DBCONTACTSDeleteManualContactsError class]
-                                                            attrs:@{
-                                                              @"auth" : @"user",
-                                                              @"host" : @"api",
-                                                              @"style" : @"rpc"
-                                                            }
-                                            dataStructSerialBlock:nil
-                                          dataStructDeserialBlock:nil];
-    }
-    return DBCONTACTSDeleteManualContactsBatch;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBCONTACTSDeleteManualContactsBatch = [[DBRoute alloc] init:@"delete_manual_contacts_batch"
+                                                     namespace_:@"contacts"
+                                                     deprecated:@NO
+                                                     resultType:nil
+                                                      errorType:[DBCONTACTSDeleteManualContactsError class]
+                                                          attrs:@{
+                                                            @"auth" : @"user",
+                                                            @"host" : @"api",
+                                                            @"style" : @"rpc"
+                                                          }
+                                          dataStructSerialBlock:nil
+                                        dataStructDeserialBlock:nil];
+  });
+  return DBCONTACTSDeleteManualContactsBatch;
 }
 
 @end
@@ -38,22 +38,52 @@ static DBRoute *DBFILEREQUESTSList;
 static DBRoute *DBFILEREQUESTSListContinue;
 static DBRoute *DBFILEREQUESTSUpdate;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBFILEREQUESTSCount {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBFILEREQUESTSCount = [[DBRoute alloc] init:@"count"
+                                     namespace_:@"file_requests"
+                                     deprecated:@NO
+                                     resultType:[DBFILEREQUESTSCountFileRequestsResult class]
+                                      errorType:[DBFILEREQUESTSCountFileRequestsError class]
+                                          attrs:@{
+                                            @"auth" : @"user",
+                                            @"host" : @"api",
+                                            @"style" : @"rpc"
+                                          }
+                          dataStructSerialBlock:nil
+                        dataStructDeserialBlock:nil];
   });
+  return DBFILEREQUESTSCount;
 }
 
-+ (DBRoute *)DBFILEREQUESTSCount {
-  @synchronized(lockObj) {
-    if (!DBFILEREQUESTSCount) {
-      DBFILEREQUESTSCount = [[DBRoute alloc] init:@"count"
++ (DBRoute *)DBFILEREQUESTSCreate {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILEREQUESTSCreate = [[DBRoute alloc] init:@"create"
+                                      namespace_:@"file_requests"
+                                      deprecated:@NO
+                                      resultType:[DBFILEREQUESTSFileRequest class]
+                                       errorType:[DBFILEREQUESTSCreateFileRequestError class]
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBFILEREQUESTSCreate;
+}
+
++ (DBRoute *)DBFILEREQUESTSDelete_ {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILEREQUESTSDelete_ = [[DBRoute alloc] init:@"delete"
                                        namespace_:@"file_requests"
                                        deprecated:@NO
-                                       resultType:[DBFILEREQUESTSCountFileRequestsResult class]
-                                        errorType:[DBFILEREQUESTSCountFileRequestsError class]
+                                       resultType:[DBFILEREQUESTSDeleteFileRequestsResult class]
+                                        errorType:[DBFILEREQUESTSDeleteFileRequestError class]
                                             attrs:@{
                                               @"auth" : @"user",
                                               @"host" : @"api",
@@ -61,118 +91,55 @@ static NSObject *lockObj = nil;
                                             }
                             dataStructSerialBlock:nil
                           dataStructDeserialBlock:nil];
-    }
-    return DBFILEREQUESTSCount;
-  }
-}
-
-+ (DBRoute *)DBFILEREQUESTSCreate {
-  @synchronized(lockObj) {
-    if (!DBFILEREQUESTSCreate) {
-      DBFILEREQUESTSCreate = [[DBRoute alloc] init:@"create"
-                                        namespace_:@"file_requests"
-                                        deprecated:@NO
-                                        resultType:[DBFILEREQUESTSFileRequest class]
-                                         errorType:[DBFILEREQUESTSCreateFileRequestError class]
-                                             attrs:@{
-                                               @"auth" : @"user",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBFILEREQUESTSCreate;
-  }
-}
-
-+ (DBRoute *)DBFILEREQUESTSDelete_ {
-  @synchronized(lockObj) {
-    if (!DBFILEREQUESTSDelete_) {
-      DBFILEREQUESTSDelete_ = [[DBRoute alloc] init:@"delete"
-                                         namespace_:@"file_requests"
-                                         deprecated:@NO
-                                         resultType:[DBFILEREQUESTSDeleteFileRequestsResult class]
-                                          errorType:[DBFILEREQUESTSDeleteFileRequestError class]
-                                              attrs:@{
-                                                @"auth" : @"user",
-                                                @"host" : @"api",
-                                                @"style" : @"rpc"
-                                              }
-                              dataStructSerialBlock:nil
-                            dataStructDeserialBlock:nil];
-    }
-    return DBFILEREQUESTSDelete_;
-  }
+  });
+  return DBFILEREQUESTSDelete_;
 }
 
 + (DBRoute *)DBFILEREQUESTSDeleteAllClosed {
-  @synchronized(lockObj) {
-    if (!DBFILEREQUESTSDeleteAllClosed) {
-      DBFILEREQUESTSDeleteAllClosed = [[DBRoute alloc] init:@"delete_all_closed"
-                                                 namespace_:@"file_requests"
-                                                 deprecated:@NO
-                                                 resultType:[DBFILEREQUESTSDeleteAllClosedFileRequestsResult class]
-                                                  errorType:[DBFILEREQUESTSDeleteAllClosedFileRequestsError class]
-                                                      attrs:@{
-                                                        @"auth" : @"user",
-                                                        @"host" : @"api",
-                                                        @"style" : @"rpc"
-                                                      }
-                                      dataStructSerialBlock:nil
-                                    dataStructDeserialBlock:nil];
-    }
-    return DBFILEREQUESTSDeleteAllClosed;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILEREQUESTSDeleteAllClosed = [[DBRoute alloc] init:@"delete_all_closed"
+                                               namespace_:@"file_requests"
+                                               deprecated:@NO
+                                               resultType:[DBFILEREQUESTSDeleteAllClosedFileRequestsResult class]
+                                                errorType:[DBFILEREQUESTSDeleteAllClosedFileRequestsError class]
+                                                    attrs:@{
+                                                      @"auth" : @"user",
+                                                      @"host" : @"api",
+                                                      @"style" : @"rpc"
+                                                    }
+                                    dataStructSerialBlock:nil
+                                  dataStructDeserialBlock:nil];
+  });
+  return DBFILEREQUESTSDeleteAllClosed;
 }
 
 + (DBRoute *)DBFILEREQUESTSGet {
-  @synchronized(lockObj) {
-    if (!DBFILEREQUESTSGet) {
-      DBFILEREQUESTSGet = [[DBRoute alloc] init:@"get"
-                                     namespace_:@"file_requests"
-                                     deprecated:@NO
-                                     resultType:[DBFILEREQUESTSFileRequest class]
-                                      errorType:[DBFILEREQUESTSGetFileRequestError class]
-                                          attrs:@{
-                                            @"auth" : @"user",
-                                            @"host" : @"api",
-                                            @"style" : @"rpc"
-                                          }
-                          dataStructSerialBlock:nil
-                        dataStructDeserialBlock:nil];
-    }
-    return DBFILEREQUESTSGet;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILEREQUESTSGet = [[DBRoute alloc] init:@"get"
+                                   namespace_:@"file_requests"
+                                   deprecated:@NO
+                                   resultType:[DBFILEREQUESTSFileRequest class]
+                                    errorType:[DBFILEREQUESTSGetFileRequestError class]
+                                        attrs:@{
+                                          @"auth" : @"user",
+                                          @"host" : @"api",
+                                          @"style" : @"rpc"
+                                        }
+                        dataStructSerialBlock:nil
+                      dataStructDeserialBlock:nil];
+  });
+  return DBFILEREQUESTSGet;
 }
 
 + (DBRoute *)DBFILEREQUESTSListV2 {
-  @synchronized(lockObj) {
-    if (!DBFILEREQUESTSListV2) {
-      DBFILEREQUESTSListV2 = [[DBRoute alloc] init:@"list_v2"
-                                        namespace_:@"file_requests"
-                                        deprecated:@NO
-                                        resultType:[DBFILEREQUESTSListFileRequestsV2Result class]
-                                         errorType:[DBFILEREQUESTSListFileRequestsError class]
-                                             attrs:@{
-                                               @"auth" : @"user",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBFILEREQUESTSListV2;
-  }
-}
-
-+ (DBRoute *)DBFILEREQUESTSList {
-  @synchronized(lockObj) {
-    if (!DBFILEREQUESTSList) {
-      DBFILEREQUESTSList = [[DBRoute alloc] init:@"list"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILEREQUESTSListV2 = [[DBRoute alloc] init:@"list_v2"
                                       namespace_:@"file_requests"
                                       deprecated:@NO
-                                      resultType:[DBFILEREQUESTSListFileRequestsResult class]
+                                      resultType:[DBFILEREQUESTSListFileRequestsV2Result class]
                                        errorType:[DBFILEREQUESTSListFileRequestsError class]
                                            attrs:@{
                                              @"auth" : @"user",
@@ -181,49 +148,65 @@ static NSObject *lockObj = nil;
                                            }
                            dataStructSerialBlock:nil
                          dataStructDeserialBlock:nil];
-    }
-    return DBFILEREQUESTSList;
-  }
+  });
+  return DBFILEREQUESTSListV2;
+}
+
++ (DBRoute *)DBFILEREQUESTSList {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILEREQUESTSList = [[DBRoute alloc] init:@"list"
+                                    namespace_:@"file_requests"
+                                    deprecated:@NO
+                                    resultType:[DBFILEREQUESTSListFileRequestsResult class]
+                                     errorType:[DBFILEREQUESTSListFileRequestsError class]
+                                         attrs:@{
+                                           @"auth" : @"user",
+                                           @"host" : @"api",
+                                           @"style" : @"rpc"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
+  });
+  return DBFILEREQUESTSList;
 }
 
 + (DBRoute *)DBFILEREQUESTSListContinue {
-  @synchronized(lockObj) {
-    if (!DBFILEREQUESTSListContinue) {
-      DBFILEREQUESTSListContinue = [[DBRoute alloc] init:@"list/continue"
-                                              namespace_:@"file_requests"
-                                              deprecated:@NO
-                                              resultType:[DBFILEREQUESTSListFileRequestsV2Result class]
-                                               errorType:[DBFILEREQUESTSListFileRequestsContinueError class]
-                                                   attrs:@{
-                                                     @"auth" : @"user",
-                                                     @"host" : @"api",
-                                                     @"style" : @"rpc"
-                                                   }
-                                   dataStructSerialBlock:nil
-                                 dataStructDeserialBlock:nil];
-    }
-    return DBFILEREQUESTSListContinue;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILEREQUESTSListContinue = [[DBRoute alloc] init:@"list/continue"
+                                            namespace_:@"file_requests"
+                                            deprecated:@NO
+                                            resultType:[DBFILEREQUESTSListFileRequestsV2Result class]
+                                             errorType:[DBFILEREQUESTSListFileRequestsContinueError class]
+                                                 attrs:@{
+                                                   @"auth" : @"user",
+                                                   @"host" : @"api",
+                                                   @"style" : @"rpc"
+                                                 }
+                                 dataStructSerialBlock:nil
+                               dataStructDeserialBlock:nil];
+  });
+  return DBFILEREQUESTSListContinue;
 }
 
 + (DBRoute *)DBFILEREQUESTSUpdate {
-  @synchronized(lockObj) {
-    if (!DBFILEREQUESTSUpdate) {
-      DBFILEREQUESTSUpdate = [[DBRoute alloc] init:@"update"
-                                        namespace_:@"file_requests"
-                                        deprecated:@NO
-                                        resultType:[DBFILEREQUESTSFileRequest class]
-                                         errorType:[DBFILEREQUESTSUpdateFileRequestError class]
-                                             attrs:@{
-                                               @"auth" : @"user",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBFILEREQUESTSUpdate;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILEREQUESTSUpdate = [[DBRoute alloc] init:@"update"
+                                      namespace_:@"file_requests"
+                                      deprecated:@NO
+                                      resultType:[DBFILEREQUESTSFileRequest class]
+                                       errorType:[DBFILEREQUESTSUpdateFileRequestError class]
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBFILEREQUESTSUpdate;
 }
 
 @end
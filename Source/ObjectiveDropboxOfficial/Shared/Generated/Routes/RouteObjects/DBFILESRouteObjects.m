@@ -201,81 +201,51 @@ static DBRoute *DBFILESUploadSessionFinishBatchCheck;
 static DBRoute *DBFILESUploadSessionStart;
 static DBRoute *DBFILESUploadSessionStartBatch;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBFILESAlphaGetMetadata {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBFILESAlphaGetMetadata = [[DBRoute alloc] init:@"alpha/get_metadata"
+                                         namespace_:@"files"
+                                         deprecated:@YES
+                                         resultType:[DBFILESMetadata class]
+                                          errorType:[DBFILESAlphaGetMetadataError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
   });
-}
-
-+ (DBRoute *)DBFILESAlphaGetMetadata {
-  @synchronized(lockObj) {
-    if (!DBFILESAlphaGetMetadata) {
-      DBFILESAlphaGetMetadata = [[DBRoute alloc] init:@"alpha/get_metadata"
-                                           namespace_:@"files"
-                                           deprecated:@YES
-                                           resultType:[DBFILESMetadata class]
-                                            errorType:[DBFILESAlphaGetMetadataError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBFILESAlphaGetMetadata;
-  }
+  return DBFILESAlphaGetMetadata;
 }
 
 + (DBRoute *)DBFILESAlphaUpload {
-  @synchronized(lockObj) {
-    if (!DBFILESAlphaUpload) {
-      DBFILESAlphaUpload = [[DBRoute alloc] init:@"alpha/upload"
-                                      namespace_:@"files"
-                                      deprecated:@YES
-                                      resultType:[DBFILESFileMetadata class]
-                                       errorType:[DBFILESUploadError class]
-                                           attrs:@{
-                                             @"auth" : @"user",
-                                             @"host" : @"content",
-                                             @"style" : @"upload"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBFILESAlphaUpload;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESAlphaUpload = [[DBRoute alloc] init:@"alpha/upload"
+                                    namespace_:@"files"
+                                    deprecated:@YES
+                                    resultType:[DBFILESFileMetadata class]
+                                     errorType:[DBFILESUploadError class]
+                                         attrs:@{
+                                           @"auth" : @"user",
+                                           @"host" : @"content",
+                                           @"style" : @"upload"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
+  });
+  return DBFILESAlphaUpload;
 }
 
 + (DBRoute *)DBFILESDCopyV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESDCopyV2) {
-      DBFILESDCopyV2 = [[DBRoute alloc] init:@"copy_v2"
-                                  namespace_:@"files"
-                                  deprecated:@NO
-                                  resultType:[DBFILESRelocationResult class]
-                                   errorType:[DBFILESRelocationError class]
-                                       attrs:@{
-                                         @"auth" : @"user",
-                                         @"host" : @"api",
-                                         @"style" : @"rpc"
-                                       }
-                       dataStructSerialBlock:nil
-                     dataStructDeserialBlock:nil];
-    }
-    return DBFILESDCopyV2;
-  }
-}
-
-+ (DBRoute *)DBFILESDCopy {
-  @synchronized(lockObj) {
-    if (!DBFILESDCopy) {
-      DBFILESDCopy = [[DBRoute alloc] init:@"copy"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDCopyV2 = [[DBRoute alloc] init:@"copy_v2"
                                 namespace_:@"files"
-                                deprecated:@YES
-                                resultType:[DBFILESMetadata class]
+                                deprecated:@NO
+                                resultType:[DBFILESRelocationResult class]
                                  errorType:[DBFILESRelocationError class]
                                      attrs:@{
                                        @"auth" : @"user",
@@ -284,38 +254,36 @@ static NSObject *lockObj = nil;
                                      }
                      dataStructSerialBlock:nil
                    dataStructDeserialBlock:nil];
-    }
-    return DBFILESDCopy;
-  }
+  });
+  return DBFILESDCopyV2;
 }
 
-+ (DBRoute *)DBFILESDCopyBatchV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESDCopyBatchV2) {
-      DBFILESDCopyBatchV2 = [[DBRoute alloc] init:@"copy_batch_v2"
-                                       namespace_:@"files"
-                                       deprecated:@NO
-                                       resultType:[DBFILESRelocationBatchV2Launch class]
-                                        errorType:nil
-                                            attrs:@{
-                                              @"auth" : @"user",
-                                              @"host" : @"api",
-                                              @"style" : @"rpc"
-                                            }
-                            dataStructSerialBlock:nil
-                          dataStructDeserialBlock:nil];
-    }
-    return DBFILESDCopyBatchV2;
-  }
++ (DBRoute *)DBFILESDCopy {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDCopy = [[DBRoute alloc] init:@"copy"
+                              namespace_:@"files"
+                              deprecated:@YES
+                              resultType:[DBFILESMetadata class]
+                               errorType:[DBFILESRelocationError class]
+                                   attrs:@{
+                                     @"auth" : @"user",
+                                     @"host" : @"api",
+                                     @"style" : @"rpc"
+                                   }
+                   dataStructSerialBlock:nil
+                 dataStructDeserialBlock:nil];
+  });
+  return DBFILESDCopy;
 }
 
-+ (DBRoute *)DBFILESDCopyBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESDCopyBatch) {
-      DBFILESDCopyBatch = [[DBRoute alloc] init:@"copy_batch"
++ (DBRoute *)DBFILESDCopyBatchV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDCopyBatchV2 = [[DBRoute alloc] init:@"copy_batch_v2"
                                      namespace_:@"files"
-                                     deprecated:@YES
-                                     resultType:[DBFILESRelocationBatchLaunch class]
+                                     deprecated:@NO
+                                     resultType:[DBFILESRelocationBatchV2Launch class]
                                       errorType:nil
                                           attrs:@{
                                             @"auth" : @"user",
@@ -324,38 +292,36 @@ static NSObject *lockObj = nil;
                                           }
                           dataStructSerialBlock:nil
                         dataStructDeserialBlock:nil];
-    }
-    return DBFILESDCopyBatch;
-  }
+  });
+  return DBFILESDCopyBatchV2;
 }
 
-+ (DBRoute *)DBFILESDCopyBatchCheckV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESDCopyBatchCheckV2) {
-      DBFILESDCopyBatchCheckV2 = [[DBRoute alloc] init:@"copy_batch/check_v2"
-                                            namespace_:@"files"
-                                            deprecated:@NO
-                                            resultType:[DBFILESRelocationBatchV2JobStatus class]
-                                             errorType:[DBASYNCPollError class]
-                                                 attrs:@{
-                                                   @"auth" : @"user",
-                                                   @"host" : @"api",
-                                                   @"style" : @"rpc"
-                                                 }
-                                 dataStructSerialBlock:nil
-                               dataStructDeserialBlock:nil];
-    }
-    return DBFILESDCopyBatchCheckV2;
-  }
++ (DBRoute *)DBFILESDCopyBatch {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDCopyBatch = [[DBRoute alloc] init:@"copy_batch"
+                                   namespace_:@"files"
+                                   deprecated:@YES
+                                   resultType:[DBFILESRelocationBatchLaunch class]
+                                    errorType:nil
+                                        attrs:@{
+                                          @"auth" : @"user",
+                                          @"host" : @"api",
+                                          @"style" : @"rpc"
+                                        }
+                        dataStructSerialBlock:nil
+                      dataStructDeserialBlock:nil];
+  });
+  return DBFILESDCopyBatch;
 }
 
-+ (DBRoute *)DBFILESDCopyBatchCheck {
-  @synchronized(lockObj) {
-    if (!DBFILESDCopyBatchCheck) {
-      DBFILESDCopyBatchCheck = [[DBRoute alloc] init:@"copy_batch/check"
++ (DBRoute *)DBFILESDCopyBatchCheckV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDCopyBatchCheckV2 = [[DBRoute alloc] init:@"copy_batch/check_v2"
                                           namespace_:@"files"
-                                          deprecated:@YES
-                                          resultType:[DBFILESRelocationBatchJobStatus class]
+                                          deprecated:@NO
+                                          resultType:[DBFILESRelocationBatchV2JobStatus class]
                                            errorType:[DBASYNCPollError class]
                                                attrs:@{
                                                  @"auth" : @"user",
@@ -364,78 +330,74 @@ static NSObject *lockObj = nil;
                                                }
                                dataStructSerialBlock:nil
                              dataStructDeserialBlock:nil];
-    }
-    return DBFILESDCopyBatchCheck;
-  }
+  });
+  return DBFILESDCopyBatchCheckV2;
+}
+
++ (DBRoute *)DBFILESDCopyBatchCheck {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDCopyBatchCheck = [[DBRoute alloc] init:@"copy_batch/check"
+                                        namespace_:@"files"
+                                        deprecated:@YES
+                                        resultType:[DBFILESRelocationBatchJobStatus class]
+                                         errorType:[DBASYNCPollError class]
+                                             attrs:@{
+                                               @"auth" : @"user",
+                                               @"host" : @"api",
+                                               @"style" : @"rpc"
+                                             }
+                             dataStructSerialBlock:nil
+                           dataStructDeserialBlock:nil];
+  });
+  return DBFILESDCopyBatchCheck;
 }
 
 + (DBRoute *)DBFILESDCopyReferenceGet {
-  @synchronized(lockObj) {
-    if (!DBFILESDCopyReferenceGet) {
-      DBFILESDCopyReferenceGet = [[DBRoute alloc] init:@"copy_reference/get"
-                                            namespace_:@"files"
-                                            deprecated:@NO
-                                            resultType:[DBFILESGetCopyReferenceResult class]
-                                             errorType:[DBFILESGetCopyReferenceError class]
-                                                 attrs:@{
-                                                   @"auth" : @"user",
-                                                   @"host" : @"api",
-                                                   @"style" : @"rpc"
-                                                 }
-                                 dataStructSerialBlock:nil
-                               dataStructDeserialBlock:nil];
-    }
-    return DBFILESDCopyReferenceGet;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDCopyReferenceGet = [[DBRoute alloc] init:@"copy_reference/get"
+                                          namespace_:@"files"
+                                          deprecated:@NO
+                                          resultType:[DBFILESGetCopyReferenceResult class]
+                                           errorType:[DBFILESGetCopyReferenceError class]
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBFILESDCopyReferenceGet;
 }
 
 + (DBRoute *)DBFILESDCopyReferenceSave {
-  @synchronized(lockObj) {
-    if (!DBFILESDCopyReferenceSave) {
-      DBFILESDCopyReferenceSave = [[DBRoute alloc] init:@"copy_reference/save"
-                                             namespace_:@"files"
-                                             deprecated:@NO
-                                             resultType:[DBFILESSaveCopyReferenceResult class]
-                                              errorType:[DBFILESSaveCopyReferenceError class]
-                                                  attrs:@{
-                                                    @"auth" : @"user",
-                                                    @"host" : @"api",
-                                                    @"style" : @"rpc"
-                                                  }
-                                  dataStructSerialBlock:nil
-                                dataStructDeserialBlock:nil];
-    }
-    return DBFILESDCopyReferenceSave;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDCopyReferenceSave = [[DBRoute alloc] init:@"copy_reference/save"
+                                           namespace_:@"files"
+                                           deprecated:@NO
+                                           resultType:[DBFILESSaveCopyReferenceResult class]
+                                            errorType:[DBFILESSaveCopyReferenceError class]
+                                                attrs:@{
+                                                  @"auth" : @"user",
+                                                  @"host" : @"api",
+                                                  @"style" : @"rpc"
+                                                }
+                                dataStructSerialBlock:nil
+                              dataStructDeserialBlock:nil];
+  });
+  return DBFILESDCopyReferenceSave;
 }
 
 + (DBRoute *)DBFILESCreateFolderV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESCreateFolderV2) {
-      DBFILESCreateFolderV2 = [[DBRoute alloc] init:@"create_folder_v2"
-                                         namespace_:@"files"
-                                         deprecated:@NO
-                                         resultType:[DBFILESCreateFolderResult class]
-                                          errorType:[DBFILESCreateFolderError class]
-                                              attrs:@{
-                                                @"auth" : @"user",
-                                                @"host" : @"api",
-                                                @"style" : @"rpc"
-                                              }
-                              dataStructSerialBlock:nil
-                            dataStructDeserialBlock:nil];
-    }
-    return DBFILESCreateFolderV2;
-  }
-}
-
-+ (DBRoute *)DBFILESCreateFolder {
-  @synchronized(lockObj) {
-    if (!DBFILESCreateFolder) {
-      DBFILESCreateFolder = [[DBRoute alloc] init:@"create_folder"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESCreateFolderV2 = [[DBRoute alloc] init:@"create_folder_v2"
                                        namespace_:@"files"
-                                       deprecated:@YES
-                                       resultType:[DBFILESFolderMetadata class]
+                                       deprecated:@NO
+                                       resultType:[DBFILESCreateFolderResult class]
                                         errorType:[DBFILESCreateFolderError class]
                                             attrs:@{
                                               @"auth" : @"user",
@@ -444,78 +406,74 @@ static NSObject *lockObj = nil;
                                             }
                             dataStructSerialBlock:nil
                           dataStructDeserialBlock:nil];
-    }
-    return DBFILESCreateFolder;
-  }
+  });
+  return DBFILESCreateFolderV2;
+}
+
++ (DBRoute *)DBFILESCreateFolder {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESCreateFolder = [[DBRoute alloc] init:@"create_folder"
+                                     namespace_:@"files"
+                                     deprecated:@YES
+                                     resultType:[DBFILESFolderMetadata class]
+                                      errorType:[DBFILESCreateFolderError class]
+                                          attrs:@{
+                                            @"auth" : @"user",
+                                            @"host" : @"api",
+                                            @"style" : @"rpc"
+                                          }
+                          dataStructSerialBlock:nil
+                        dataStructDeserialBlock:nil];
+  });
+  return DBFILESCreateFolder;
 }
 
 + (DBRoute *)DBFILESCreateFolderBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESCreateFolderBatch) {
-      DBFILESCreateFolderBatch = [[DBRoute alloc] init:@"create_folder_batch"
-                                            namespace_:@"files"
-                                            deprecated:@NO
-                                            resultType:[DBFILESCreateFolderBatchLaunch class]
-                                             errorType:nil
-                                                 attrs:@{
-                                                   @"auth" : @"user",
-                                                   @"host" : @"api",
-                                                   @"style" : @"rpc"
-                                                 }
-                                 dataStructSerialBlock:nil
-                               dataStructDeserialBlock:nil];
-    }
-    return DBFILESCreateFolderBatch;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESCreateFolderBatch = [[DBRoute alloc] init:@"create_folder_batch"
+                                          namespace_:@"files"
+                                          deprecated:@NO
+                                          resultType:[DBFILESCreateFolderBatchLaunch class]
+                                           errorType:nil
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBFILESCreateFolderBatch;
 }
 
 + (DBRoute *)DBFILESCreateFolderBatchCheck {
-  @synchronized(lockObj) {
-    if (!DBFILESCreateFolderBatchCheck) {
-      DBFILESCreateFolderBatchCheck = [[DBRoute alloc] init:@"create_folder_batch/check"
-                                                 namespace_:@"files"
-                                                 deprecated:@NO
-                                                 resultType:[DBFILESCreateFolderBatchJobStatus class]
-                                                  errorType:[DBASYNCPollError class]
-                                                      attrs:@{
-                                                        @"auth" : @"user",
-                                                        @"host" : @"api",
-                                                        @"style" : @"rpc"
-                                                      }
-                                      dataStructSerialBlock:nil
-                                    dataStructDeserialBlock:nil];
-    }
-    return DBFILESCreateFolderBatchCheck;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESCreateFolderBatchCheck = [[DBRoute alloc] init:@"create_folder_batch/check"
+                                               namespace_:@"files"
+                                               deprecated:@NO
+                                               resultType:[DBFILESCreateFolderBatchJobStatus class]
+                                                errorType:[DBASYNCPollError class]
+                                                    attrs:@{
+                                                      @"auth" : @"user",
+                                                      @"host" : @"api",
+                                                      @"style" : @"rpc"
+                                                    }
+                                    dataStructSerialBlock:nil
+                                  dataStructDeserialBlock:nil];
+  });
+  return DBFILESCreateFolderBatchCheck;
 }
 
 + (DBRoute *)DBFILESDelete_V2 {
-  @synchronized(lockObj) {
-    if (!DBFILESDelete_V2) {
-      DBFILESDelete_V2 = [[DBRoute alloc] init:@"delete_v2"
-                                    namespace_:@"files"
-                                    deprecated:@NO
-                                    resultType:[DBFILESDeleteResult class]
-                                     errorType:[DBFILESDeleteError class]
-                                         attrs:@{
-                                           @"auth" : @"user",
-                                           @"host" : @"api",
-                                           @"style" : @"rpc"
-                                         }
-                         dataStructSerialBlock:nil
-                       dataStructDeserialBlock:nil];
-    }
-    return DBFILESDelete_V2;
-  }
-}
-
-+ (DBRoute *)DBFILESDelete_ {
-  @synchronized(lockObj) {
-    if (!DBFILESDelete_) {
-      DBFILESDelete_ = [[DBRoute alloc] init:@"delete"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDelete_V2 = [[DBRoute alloc] init:@"delete_v2"
                                   namespace_:@"files"
-                                  deprecated:@YES
-                                  resultType:[DBFILESMetadata class]
+                                  deprecated:@NO
+                                  resultType:[DBFILESDeleteResult class]
                                    errorType:[DBFILESDeleteError class]
                                        attrs:@{
                                          @"auth" : @"user",
@@ -524,99 +482,75 @@ static NSObject *lockObj = nil;
                                        }
                        dataStructSerialBlock:nil
                      dataStructDeserialBlock:nil];
-    }
-    return DBFILESDelete_;
-  }
+  });
+  return DBFILESDelete_V2;
+}
+
++ (DBRoute *)DBFILESDelete_ {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDelete_ = [[DBRoute alloc] init:@"delete"
+                                namespace_:@"files"
+                                deprecated:@YES
+                                resultType:[DBFILESMetadata class]
+                                 errorType:[DBFILESDeleteError class]
+                                     attrs:@{
+                                       @"auth" : @"user",
+                                       @"host" : @"api",
+                                       @"style" : @"rpc"
+                                     }
+                     dataStructSerialBlock:nil
+                   dataStructDeserialBlock:nil];
+  });
+  return DBFILESDelete_;
 }
 
 + (DBRoute *)DBFILESDeleteBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESDeleteBatch) {
-      DBFILESDeleteBatch = [[DBRoute alloc] init:@"delete_batch"
-                                      namespace_:@"files"
-                                      deprecated:@NO
-                                      resultType:[DBFILESDeleteBatchLaunch class]
-                                       errorType:nil
-                                           attrs:@{
-                                             @"auth" : @"user",
-                                             @"host" : @"api",
-                                             @"style" : @"rpc"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBFILESDeleteBatch;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDeleteBatch = [[DBRoute alloc] init:@"delete_batch"
+                                    namespace_:@"files"
+                                    deprecated:@NO
+                                    resultType:[DBFILESDeleteBatchLaunch class]
+                                     errorType:nil
+                                         attrs:@{
+                                           @"auth" : @"user",
+                                           @"host" : @"api",
+                                           @"style" : @"rpc"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
+  });
+  return DBFILESDeleteBatch;
 }
 
 + (DBRoute *)DBFILESDeleteBatchCheck {
-  @synchronized(lockObj) {
-    if (!DBFILESDeleteBatchCheck) {
-      DBFILESDeleteBatchCheck = [[DBRoute alloc] init:@"delete_batch/check"
-                                           namespace_:@"files"
-                                           deprecated:@NO
-                                           resultType:[DBFILESDeleteBatchJobStatus class]
-                                            errorType:[DBASYNCPollError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBFILESDeleteBatchCheck;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDeleteBatchCheck = [[DBRoute alloc] init:@"delete_batch/check"
+                                         namespace_:@"files"
+                                         deprecated:@NO
+                                         resultType:[DBFILESDeleteBatchJobStatus class]
+                                          errorType:[DBASYNCPollError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBFILESDeleteBatchCheck;
 }
 
 + (DBRoute *)DBFILESDownload {
-  @synchronized(lockObj) {
-    if (!DBFILESDownload) {
-      DBFILESDownload = [[DBRoute alloc] init:@"download"
-                                   namespace_:@"files"
-                                   deprecated:@NO
-                                   resultType:[DBFILESFileMetadata class]
-                                    errorType:[DBFILESDownloadError class]
-                                        attrs:@{
-                                          @"auth" : @"user",
-                                          @"host" : @"content",
-                                          @"style" : @"download"
-                                        }
-                        dataStructSerialBlock:nil
-                      dataStructDeserialBlock:nil];
-    }
-    return DBFILESDownload;
-  }
-}
-
-+ (DBRoute *)DBFILESDownloadZip {
-  @synchronized(lockObj) {
-    if (!DBFILESDownloadZip) {
-      DBFILESDownloadZip = [[DBRoute alloc] init:@"download_zip"
-                                      namespace_:@"files"
-                                      deprecated:@NO
-                                      resultType:[DBFILESDownloadZipResult class]
-                                       errorType:[DBFILESDownloadZipError class]
-                                           attrs:@{
-                                             @"auth" : @"user",
-                                             @"host" : @"content",
-                                             @"style" : @"download"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBFILESDownloadZip;
-  }
-}
-
-+ (DBRoute *)DBFILESExport {
-  @synchronized(lockObj) {
-    if (!DBFILESExport) {
-      DBFILESExport = [[DBRoute alloc] init:@"export"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDownload = [[DBRoute alloc] init:@"download"
                                  namespace_:@"files"
                                  deprecated:@NO
-                                 resultType:[DBFILESExportResult class]
-                                  errorType:[DBFILESExportError class]
+                                 resultType:[DBFILESFileMetadata class]
+                                  errorType:[DBFILESDownloadError class]
                                       attrs:@{
                                         @"auth" : @"user",
                                         @"host" : @"content",
@@ -624,59 +558,151 @@ static NSObject *lockObj = nil;
                                       }
                       dataStructSerialBlock:nil
                     dataStructDeserialBlock:nil];
-    }
-    return DBFILESExport;
-  }
+  });
+  return DBFILESDownload;
+}
+
++ (DBRoute *)DBFILESDownloadZip {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESDownloadZip = [[DBRoute alloc] init:@"download_zip"
+                                    namespace_:@"files"
+                                    deprecated:@NO
+                                    resultType:[DBFILESDownloadZipResult class]
+                                     errorType:[DBFILESDownloadZipError class]
+                                         attrs:@{
+                                           @"auth" : @"user",
+                                           @"host" : @"content",
+                                           @"style" : @"download"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
+  });
+  return DBFILESDownloadZip;
+}
+
++ (DBRoute *)DBFILESExport {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESExport = [[DBRoute alloc] init:@"export"
+                               namespace_:@"files"
+                               deprecated:@NO
+                               resultType:[DBFILESExportResult class]
+                                errorType:[DBFILESExportError class]
+                                    attrs:@{
+                                      @"auth" : @"user",
+                                      @"host" : @"content",
+                                      @"style" : @"download"
+                                    }
+                    dataStructSerialBlock:nil
+                  dataStructDeserialBlock:nil];
+  });
+  return DBFILESExport;
 }
 
 + (DBRoute *)DBFILESGetFileLockBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESGetFileLockBatch) {
-      DBFILESGetFileLockBatch = [[DBRoute alloc] init:@"get_file_lock_batch"
-                                           namespace_:@"files"
-                                           deprecated:@NO
-                                           resultType:[DBFILESLockFileBatchResult class]
-                                            errorType:[DBFILESLockFileError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBFILESGetFileLockBatch;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESGetFileLockBatch = [[DBRoute alloc] init:@"get_file_lock_batch"
+                                         namespace_:@"files"
+                                         deprecated:@NO
+                                         resultType:[DBFILESLockFileBatchResult class]
+                                          errorType:[DBFILESLockFileError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBFILESGetFileLockBatch;
 }
 
 + (DBRoute *)DBFILESGetMetadata {
-  @synchronized(lockObj) {
-    if (!DBFILESGetMetadata) {
-      DBFILESGetMetadata = [[DBRoute alloc] init:@"get_metadata"
-                                      namespace_:@"files"
-                                      deprecated:@NO
-                                      resultType:[DBFILESMetadata class]
-                                       errorType:[DBFILESGetMetadataError class]
-                                           attrs:@{
-                                             @"auth" : @"user",
-                                             @"host" : @"api",
-                                             @"style" : @"rpc"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBFILESGetMetadata;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESGetMetadata = [[DBRoute alloc] init:@"get_metadata"
+                                    namespace_:@"files"
+                                    deprecated:@NO
+                                    resultType:[DBFILESMetadata class]
+                                     errorType:[DBFILESGetMetadataError class]
+                                         attrs:@{
+                                           @"auth" : @"user",
+                                           @"host" : @"api",
+                                           @"style" : @"rpc"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
+  });
+  return DBFILESGetMetadata;
 }
 
 + (DBRoute *)DBFILESGetPreview {
-  @synchronized(lockObj) {
-    if (!DBFILESGetPreview) {
-      DBFILESGetPreview = [[DBRoute alloc] init:@"get_preview"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESGetPreview = [[DBRoute alloc] init:@"get_preview"
+                                   namespace_:@"files"
+                                   deprecated:@NO
+                                   resultType:[DBFILESFileMetadata class]
+                                    errorType:[DBFILESPreviewError class]
+                                        attrs:@{
+                                          @"auth" : @"user",
+                                          @"host" : @"content",
+                                          @"style" : @"download"
+                                        }
+                        dataStructSerialBlock:nil
+                      dataStructDeserialBlock:nil];
+  });
+  return DBFILESGetPreview;
+}
+
++ (DBRoute *)DBFILESGetTemporaryLink {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESGetTemporaryLink = [[DBRoute alloc] init:@"get_temporary_link"
+                                         namespace_:@"files"
+                                         deprecated:@NO
+                                         resultType:[DBFILESGetTemporaryLinkResult class]
+                                          errorType:[DBFILESGetTemporaryLinkError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBFILESGetTemporaryLink;
+}
+
++ (DBRoute *)DBFILESGetTemporaryUploadLink {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESGetTemporaryUploadLink = [[DBRoute alloc] init:@"get_temporary_upload_link"
+                                               namespace_:@"files"
+                                               deprecated:@NO
+                                               resultType:[DBFILESGetTemporaryUploadLinkResult class]
+                                                errorType:nil
+                                                    attrs:@{
+                                                      @"auth" : @"user",
+                                                      @"host" : @"api",
+                                                      @"style" : @"rpc"
+                                                    }
+                                    dataStructSerialBlock:nil
+                                  dataStructDeserialBlock:nil];
+  });
+  return DBFILESGetTemporaryUploadLink;
+}
+
++ (DBRoute *)DBFILESGetThumbnail {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESGetThumbnail = [[DBRoute alloc] init:@"get_thumbnail"
                                      namespace_:@"files"
                                      deprecated:@NO
                                      resultType:[DBFILESFileMetadata class]
-                                      errorType:[DBFILESPreviewError class]
+                                      errorType:[DBFILESThumbnailError class]
                                           attrs:@{
                                             @"auth" : @"user",
                                             @"host" : @"content",
@@ -684,258 +710,169 @@ static NSObject *lockObj = nil;
                                           }
                           dataStructSerialBlock:nil
                         dataStructDeserialBlock:nil];
-    }
-    return DBFILESGetPreview;
-  }
-}
-
-+ (DBRoute *)DBFILESGetTemporaryLink {
-  @synchronized(lockObj) {
-    if (!DBFILESGetTemporaryLink) {
-      DBFILESGetTemporaryLink = [[DBRoute alloc] init:@"get_temporary_link"
-                                           namespace_:@"files"
-                                           deprecated:@NO
-                                           resultType:[DBFILESGetTemporaryLinkResult class]
-                                            errorType:[DBFILESGetTemporaryLinkError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBFILESGetTemporaryLink;
-  }
-}
-
-+ (DBRoute *)DBFILESGetTemporaryUploadLink {
-  @synchronized(lockObj) {
-    if (!DBFILESGetTemporaryUploadLink) {
-      DBFILESGetTemporaryUploadLink = [[DBRoute alloc] init:@"get_temporary_upload_link"
-                                                 namespace_:@"files"
-                                                 deprecated:@NO
-                                                 resultType:[DBFILESGetTemporaryUploadLinkResult class]
-                                                  errorType:nil
-                                                      attrs:@{
-                                                        @"auth" : @"user",
-                                                        @"host" : @"api",
-                                                        @"style" : @"rpc"
-                                                      }
-                                      dataStructSerialBlock:nil
-                                    dataStructDeserialBlock:nil];
-    }
-    return DBFILESGetTemporaryUploadLink;
-  }
+  });
+  return DBFILESGetThumbnail;
 }
 
-+ (DBRoute *)DBFILESGetThumbnail {
-  @synchronized(lockObj) {
-    if (!DBFILESGetThumbnail) {
-      DBFILESGetThumbnail = [[DBRoute alloc] init:@"get_thumbnail"
++ (DBRoute *)DBFILESGetThumbnailV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESGetThumbnailV2 = [[DBRoute alloc] init:@"get_thumbnail_v2"
                                        namespace_:@"files"
                                        deprecated:@NO
-                                       resultType:[DBFILESFileMetadata class]
-                                        errorType:[DBFILESThumbnailError class]
+                                       resultType:[DBFILESPreviewResult class]
+                                        errorType:[DBFILESThumbnailV2Error class]
                                             attrs:@{
-                                              @"auth" : @"user",
+                                              @"auth" : @"app, user",
                                               @"host" : @"content",
                                               @"style" : @"download"
                                             }
                             dataStructSerialBlock:nil
                           dataStructDeserialBlock:nil];
-    }
-    return DBFILESGetThumbnail;
-  }
-}
-
-+ (DBRoute *)DBFILESGetThumbnailV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESGetThumbnailV2) {
-      DBFILESGetThumbnailV2 = [[DBRoute alloc] init:@"get_thumbnail_v2"
-                                         namespace_:@"files"
-                                         deprecated:@NO
-                                         resultType:[DBFILESPreviewResult class]
-                                          errorType:[DBFILESThumbnailV2Error class]
-                                              attrs:@{
-                                                @"auth" : @"app, user",
-                                                @"host" : @"content",
-                                                @"style" : @"download"
-                                              }
-                              dataStructSerialBlock:nil
-                            dataStructDeserialBlock:nil];
-    }
-    return DBFILESGetThumbnailV2;
-  }
+  });
+  return DBFILESGetThumbnailV2;
 }
 
 + (DBRoute *)DBFILESGetThumbnailBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESGetThumbnailBatch) {
-      DBFILESGetThumbnailBatch = [[DBRoute alloc] init:@"get_thumbnail_batch"
-                                            namespace_:@"files"
-                                            deprecated:@NO
-                                            resultType:[DBFILESGetThumbnailBatchResult class]
-                                             errorType:[DBFILESGetThumbnailBatchError class]
-                                                 attrs:@{
-                                                   @"auth" : @"user",
-                                                   @"host" : @"content",
-                                                   @"style" : @"rpc"
-                                                 }
-                                 dataStructSerialBlock:nil
-                               dataStructDeserialBlock:nil];
-    }
-    return DBFILESGetThumbnailBatch;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESGetThumbnailBatch = [[DBRoute alloc] init:@"get_thumbnail_batch"
+                                          namespace_:@"files"
+                                          deprecated:@NO
+                                          resultType:[DBFILESGetThumbnailBatchResult class]
+                                           errorType:[DBFILESGetThumbnailBatchError class]
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"content",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBFILESGetThumbnailBatch;
 }
 
 + (DBRoute *)DBFILESListFolder {
-  @synchronized(lockObj) {
-    if (!DBFILESListFolder) {
-      DBFILESListFolder = [[DBRoute alloc] init:@"list_folder"
-                                     namespace_:@"files"
-                                     deprecated:@NO
-                                     resultType:[DBFILESListFolderResult class]
-                                      errorType:[DBFILESListFolderError class]
-                                          attrs:@{
-                                            @"auth" : @"app, user",
-                                            @"host" : @"api",
-                                            @"style" : @"rpc"
-                                          }
-                          dataStructSerialBlock:nil
-                        dataStructDeserialBlock:nil];
-    }
-    return DBFILESListFolder;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESListFolder = [[DBRoute alloc] init:@"list_folder"
+                                   namespace_:@"files"
+                                   deprecated:@NO
+                                   resultType:[DBFILESListFolderResult class]
+                                    errorType:[DBFILESListFolderError class]
+                                        attrs:@{
+                                          @"auth" : @"app, user",
+                                          @"host" : @"api",
+                                          @"style" : @"rpc"
+                                        }
+                        dataStructSerialBlock:nil
+                      dataStructDeserialBlock:nil];
+  });
+  return DBFILESListFolder;
 }
 
 + (DBRoute *)DBFILESListFolderContinue {
-  @synchronized(lockObj) {
-    if (!DBFILESListFolderContinue) {
-      DBFILESListFolderContinue = [[DBRoute alloc] init:@"list_folder/continue"
-                                             namespace_:@"files"
-                                             deprecated:@NO
-                                             resultType:[DBFILESListFolderResult class]
-                                              errorType:[DBFILESListFolderContinueError class]
-                                                  attrs:@{
-                                                    @"auth" : @"app, user",
-                                                    @"host" : @"api",
-                                                    @"style" : @"rpc"
-                                                  }
-                                  dataStructSerialBlock:nil
-                                dataStructDeserialBlock:nil];
-    }
-    return DBFILESListFolderContinue;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESListFolderContinue = [[DBRoute alloc] init:@"list_folder/continue"
+                                           namespace_:@"files"
+                                           deprecated:@NO
+                                           resultType:[DBFILESListFolderResult class]
+                                            errorType:[DBFILESListFolderContinueError class]
+                                                attrs:@{
+                                                  @"auth" : @"app, user",
+                                                  @"host" : @"api",
+                                                  @"style" : @"rpc"
+                                                }
+                                dataStructSerialBlock:nil
+                              dataStructDeserialBlock:nil];
+  });
+  return DBFILESListFolderContinue;
 }
 
 + (DBRoute *)DBFILESListFolderGetLatestCursor {
-  @synchronized(lockObj) {
-    if (!DBFILESListFolderGetLatestCursor) {
-      DBFILESListFolderGetLatestCursor = [[DBRoute alloc] init:@"list_folder/get_latest_cursor"
-                                                    namespace_:@"files"
-                                                    deprecated:@NO
-                                                    resultType:[DBFILESListFolderGetLatestCursorResult class]
-                                                     errorType:[DBFILESListFolderError class]
-                                                         attrs:@{
-                                                           @"auth" : @"user",
-                                                           @"host" : @"api",
-                                                           @"style" : @"rpc"
-                                                         }
-                                         dataStructSerialBlock:nil
-                                       dataStructDeserialBlock:nil];
-    }
-    return DBFILESListFolderGetLatestCursor;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESListFolderGetLatestCursor = [[DBRoute alloc] init:@"list_folder/get_latest_cursor"
+                                                  namespace_:@"files"
+                                                  deprecated:@NO
+                                                  resultType:[DBFILESListFolderGetLatestCursorResult class]
+                                                   errorType:[DBFILESListFolderError class]
+                                                       attrs:@{
+                                                         @"auth" : @"user",
+                                                         @"host" : @"api",
+                                                         @"style" : @"rpc"
+                                                       }
+                                       dataStructSerialBlock:nil
+                                     dataStructDeserialBlock:nil];
+  });
+  return DBFILESListFolderGetLatestCursor;
 }
 
 + (DBRoute *)DBFILESListFolderLongpoll {
-  @synchronized(lockObj) {
-    if (!DBFILESListFolderLongpoll) {
-      DBFILESListFolderLongpoll = [[DBRoute alloc] init:@"list_folder/longpoll"
-                                             namespace_:@"files"
-                                             deprecated:@NO
-                                             resultType:[DBFILESListFolderLongpollResult class]
-                                              errorType:[DBFILESListFolderLongpollError class]
-                                                  attrs:@{
-                                                    @"auth" : @"noauth",
-                                                    @"host" : @"notify",
-                                                    @"style" : @"rpc"
-                                                  }
-                                  dataStructSerialBlock:nil
-                                dataStructDeserialBlock:nil];
-    }
-    return DBFILESListFolderLongpoll;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESListFolderLongpoll = [[DBRoute alloc] init:@"list_folder/longpoll"
+                                           namespace_:@"files"
+                                           deprecated:@NO
+                                           resultType:[DBFILESListFolderLongpollResult class]
+                                            errorType:[DBFILESListFolderLongpollError class]
+                                                attrs:@{
+                                                  @"auth" : @"noauth",
+                                                  @"host" : @"notify",
+                                                  @"style" : @"rpc"
+                                                }
+                                dataStructSerialBlock:nil
+                              dataStructDeserialBlock:nil];
+  });
+  return DBFILESListFolderLongpoll;
 }
 
 + (DBRoute *)DBFILESListRevisions {
-  @synchronized(lockObj) {
-    if (!DBFILESListRevisions) {
-      DBFILESListRevisions = [[DBRoute alloc] init:@"list_revisions"
-                                        namespace_:@"files"
-                                        deprecated:@NO
-                                        resultType:[DBFILESListRevisionsResult class]
-                                         errorType:[DBFILESListRevisionsError class]
-                                             attrs:@{
-                                               @"auth" : @"user",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBFILESListRevisions;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESListRevisions = [[DBRoute alloc] init:@"list_revisions"
+                                      namespace_:@"files"
+                                      deprecated:@NO
+                                      resultType:[DBFILESListRevisionsResult class]
+                                       errorType:[DBFILESListRevisionsError class]
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBFILESListRevisions;
 }
 
 + (DBRoute *)DBFILESLockFileBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESLockFileBatch) {
-      DBFILESLockFileBatch = [[DBRoute alloc] init:@"lock_file_batch"
-                                        namespace_:@"files"
-                                        deprecated:@NO
-                                        resultType:[DBFILESLockFileBatchResult class]
-                                         errorType:[DBFILESLockFileError class]
-                                             attrs:@{
-                                               @"auth" : @"user",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBFILESLockFileBatch;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESLockFileBatch = [[DBRoute alloc] init:@"lock_file_batch"
+                                      namespace_:@"files"
+                                      deprecated:@NO
+                                      resultType:[DBFILESLockFileBatchResult class]
+                                       errorType:[DBFILESLockFileError class]
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBFILESLockFileBatch;
 }
 
 + (DBRoute *)DBFILESMoveV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESMoveV2) {
-      DBFILESMoveV2 = [[DBRoute alloc] init:@"move_v2"
-                                 namespace_:@"files"
-                                 deprecated:@NO
-                                 resultType:[DBFILESRelocationResult class]
-                                  errorType:[DBFILESRelocationError class]
-                                      attrs:@{
-                                        @"auth" : @"user",
-                                        @"host" : @"api",
-                                        @"style" : @"rpc"
-                                      }
-                      dataStructSerialBlock:nil
-                    dataStructDeserialBlock:nil];
-    }
-    return DBFILESMoveV2;
-  }
-}
-
-+ (DBRoute *)DBFILESMove {
-  @synchronized(lockObj) {
-    if (!DBFILESMove) {
-      DBFILESMove = [[DBRoute alloc] init:@"move"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESMoveV2 = [[DBRoute alloc] init:@"move_v2"
                                namespace_:@"files"
-                               deprecated:@YES
-                               resultType:[DBFILESMetadata class]
+                               deprecated:@NO
+                               resultType:[DBFILESRelocationResult class]
                                 errorType:[DBFILESRelocationError class]
                                     attrs:@{
                                       @"auth" : @"user",
@@ -944,38 +881,36 @@ static NSObject *lockObj = nil;
                                     }
                     dataStructSerialBlock:nil
                   dataStructDeserialBlock:nil];
-    }
-    return DBFILESMove;
-  }
+  });
+  return DBFILESMoveV2;
 }
 
-+ (DBRoute *)DBFILESMoveBatchV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESMoveBatchV2) {
-      DBFILESMoveBatchV2 = [[DBRoute alloc] init:@"move_batch_v2"
-                                      namespace_:@"files"
-                                      deprecated:@NO
-                                      resultType:[DBFILESRelocationBatchV2Launch class]
-                                       errorType:nil
-                                           attrs:@{
-                                             @"auth" : @"user",
-                                             @"host" : @"api",
-                                             @"style" : @"rpc"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBFILESMoveBatchV2;
-  }
++ (DBRoute *)DBFILESMove {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESMove = [[DBRoute alloc] init:@"move"
+                             namespace_:@"files"
+                             deprecated:@YES
+                             resultType:[DBFILESMetadata class]
+                              errorType:[DBFILESRelocationError class]
+                                  attrs:@{
+                                    @"auth" : @"user",
+                                    @"host" : @"api",
+                                    @"style" : @"rpc"
+                                  }
+                  dataStructSerialBlock:nil
+                dataStructDeserialBlock:nil];
+  });
+  return DBFILESMove;
 }
 
-+ (DBRoute *)DBFILESMoveBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESMoveBatch) {
-      DBFILESMoveBatch = [[DBRoute alloc] init:@"move_batch"
++ (DBRoute *)DBFILESMoveBatchV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESMoveBatchV2 = [[DBRoute alloc] init:@"move_batch_v2"
                                     namespace_:@"files"
-                                    deprecated:@YES
-                                    resultType:[DBFILESRelocationBatchLaunch class]
+                                    deprecated:@NO
+                                    resultType:[DBFILESRelocationBatchV2Launch class]
                                      errorType:nil
                                          attrs:@{
                                            @"auth" : @"user",
@@ -984,38 +919,36 @@ static NSObject *lockObj = nil;
                                          }
                          dataStructSerialBlock:nil
                        dataStructDeserialBlock:nil];
-    }
-    return DBFILESMoveBatch;
-  }
+  });
+  return DBFILESMoveBatchV2;
 }
 
-+ (DBRoute *)DBFILESMoveBatchCheckV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESMoveBatchCheckV2) {
-      DBFILESMoveBatchCheckV2 = [[DBRoute alloc] init:@"move_batch/check_v2"
-                                           namespace_:@"files"
-                                           deprecated:@NO
-                                           resultType:[DBFILESRelocationBatchV2JobStatus class]
-                                            errorType:[DBASYNCPollError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBFILESMoveBatchCheckV2;
-  }
++ (DBRoute *)DBFILESMoveBatch {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESMoveBatch = [[DBRoute alloc] init:@"move_batch"
+                                  namespace_:@"files"
+                                  deprecated:@YES
+                                  resultType:[DBFILESRelocationBatchLaunch class]
+                                   errorType:nil
+                                       attrs:@{
+                                         @"auth" : @"user",
+                                         @"host" : @"api",
+                                         @"style" : @"rpc"
+                                       }
+                       dataStructSerialBlock:nil
+                     dataStructDeserialBlock:nil];
+  });
+  return DBFILESMoveBatch;
 }
 
-+ (DBRoute *)DBFILESMoveBatchCheck {
-  @synchronized(lockObj) {
-    if (!DBFILESMoveBatchCheck) {
-      DBFILESMoveBatchCheck = [[DBRoute alloc] init:@"move_batch/check"
++ (DBRoute *)DBFILESMoveBatchCheckV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESMoveBatchCheckV2 = [[DBRoute alloc] init:@"move_batch/check_v2"
                                          namespace_:@"files"
-                                         deprecated:@YES
-                                         resultType:[DBFILESRelocationBatchJobStatus class]
+                                         deprecated:@NO
+                                         resultType:[DBFILESRelocationBatchV2JobStatus class]
                                           errorType:[DBASYNCPollError class]
                                               attrs:@{
                                                 @"auth" : @"user",
@@ -1024,59 +957,113 @@ static NSObject *lockObj = nil;
                                               }
                               dataStructSerialBlock:nil
                             dataStructDeserialBlock:nil];
-    }
-    return DBFILESMoveBatchCheck;
-  }
+  });
+  return DBFILESMoveBatchCheckV2;
+}
+
++ (DBRoute *)DBFILESMoveBatchCheck {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESMoveBatchCheck = [[DBRoute alloc] init:@"move_batch/check"
+                                       namespace_:@"files"
+                                       deprecated:@YES
+                                       resultType:[DBFILESRelocationBatchJobStatus class]
+                                        errorType:[DBASYNCPollError class]
+                                            attrs:@{
+                                              @"auth" : @"user",
+                                              @"host" : @"api",
+                                              @"style" : @"rpc"
+                                            }
+                            dataStructSerialBlock:nil
+                          dataStructDeserialBlock:nil];
+  });
+  return DBFILESMoveBatchCheck;
 }
 
 + (DBRoute *)DBFILESPaperCreate {
-  @synchronized(lockObj) {
-    if (!DBFILESPaperCreate) {
-      DBFILESPaperCreate = [[DBRoute alloc] init:@"paper/create"
-                                      namespace_:@"files"
-                                      deprecated:@NO
-                                      resultType:[DBFILESPaperCreateResult class]
-                                       errorType:[DBFILESPaperCreateError class]
-                                           attrs:@{
-                                             @"auth" : @"user",
-                                             @"host" : @"api",
-                                             @"style" : @"upload"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBFILESPaperCreate;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESPaperCreate = [[DBRoute alloc] init:@"paper/create"
+                                    namespace_:@"files"
+                                    deprecated:@NO
+                                    resultType:[DBFILESPaperCreateResult class]
+                                     errorType:[DBFILESPaperCreateError class]
+                                         attrs:@{
+                                           @"auth" : @"user",
+                                           @"host" : @"api",
+                                           @"style" : @"upload"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
+  });
+  return DBFILESPaperCreate;
 }
 
 + (DBRoute *)DBFILESPaperUpdate {
-  @synchronized(lockObj) {
-    if (!DBFILESPaperUpdate) {
-      DBFILESPaperUpdate = [[DBRoute alloc] init:@"paper/update"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESPaperUpdate = [[DBRoute alloc] init:@"paper/update"
+                                    namespace_:@"files"
+                                    deprecated:@NO
+                                    resultType:[DBFILESPaperUpdateResult class]
+                                     errorType:[DBFILESPaperUpdateError class]
+                                         attrs:@{
+                                           @"auth" : @"user",
+                                           @"host" : @"api",
+                                           @"style" : @"upload"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
+  });
+  return DBFILESPaperUpdate;
+}
+
++ (DBRoute *)DBFILESPermanentlyDelete {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESPermanentlyDelete = [[DBRoute alloc] init:@"permanently_delete"
+                                          namespace_:@"files"
+                                          deprecated:@NO
+                                          resultType:nil
+                                           errorType:[DBFILESDeleteError class]
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBFILESPermanentlyDelete;
+}
+
++ (DBRoute *)DBFILESPropertiesAdd {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESPropertiesAdd = [[DBRoute alloc] init:@"properties/add"
                                       namespace_:@"files"
-                                      deprecated:@NO
-                                      resultType:[DBFILESPaperUpdateResult class]
-                                       errorType:[DBFILESPaperUpdateError class]
+                                      deprecated:@YES
+                                      resultType:nil
+                                       errorType:[DBFILEPROPERTIESAddPropertiesError class]
                                            attrs:@{
                                              @"auth" : @"user",
                                              @"host" : @"api",
-                                             @"style" : @"upload"
+                                             @"style" : @"rpc"
                                            }
                            dataStructSerialBlock:nil
                          dataStructDeserialBlock:nil];
-    }
-    return DBFILESPaperUpdate;
-  }
+  });
+  return DBFILESPropertiesAdd;
 }
 
-+ (DBRoute *)DBFILESPermanentlyDelete {
-  @synchronized(lockObj) {
-    if (!DBFILESPermanentlyDelete) {
-      DBFILESPermanentlyDelete = [[DBRoute alloc] init:@"permanently_delete"
++ (DBRoute *)DBFILESPropertiesOverwrite {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESPropertiesOverwrite = [[DBRoute alloc] init:@"properties/overwrite"
                                             namespace_:@"files"
-                                            deprecated:@NO
+                                            deprecated:@YES
                                             resultType:nil
-                                             errorType:[DBFILESDeleteError class]
+                                             errorType:[DBFILEPROPERTIESInvalidPropertyGroupError class]
                                                  attrs:@{
                                                    @"auth" : @"user",
                                                    @"host" : @"api",
@@ -1084,39 +1071,37 @@ static NSObject *lockObj = nil;
                                                  }
                                  dataStructSerialBlock:nil
                                dataStructDeserialBlock:nil];
-    }
-    return DBFILESPermanentlyDelete;
-  }
+  });
+  return DBFILESPropertiesOverwrite;
 }
 
-+ (DBRoute *)DBFILESPropertiesAdd {
-  @synchronized(lockObj) {
-    if (!DBFILESPropertiesAdd) {
-      DBFILESPropertiesAdd = [[DBRoute alloc] init:@"properties/add"
-                                        namespace_:@"files"
-                                        deprecated:@YES
-                                        resultType:nil
-                                         errorType:[DBFILEPROPERTIESAddPropertiesError class]
-                                             attrs:@{
-                                               @"auth" : @"user",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBFILESPropertiesAdd;
-  }
++ (DBRoute *)DBFILESPropertiesRemove {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESPropertiesRemove = [[DBRoute alloc] init:@"properties/remove"
+                                         namespace_:@"files"
+                                         deprecated:@YES
+                                         resultType:nil
+                                          errorType:[DBFILEPROPERTIESRemovePropertiesError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBFILESPropertiesRemove;
 }
 
-+ (DBRoute *)DBFILESPropertiesOverwrite {
-  @synchronized(lockObj) {
-    if (!DBFILESPropertiesOverwrite) {
-      DBFILESPropertiesOverwrite = [[DBRoute alloc] init:@"properties/overwrite"
++ (DBRoute *)DBFILESPropertiesTemplateGet {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESPropertiesTemplateGet = [[DBRoute alloc] init:@"properties/template/get"
                                               namespace_:@"files"
                                               deprecated:@YES
-                                              resultType:nil
-                                               errorType:[DBFILEPROPERTIESInvalidPropertyGroupError class]
+                                              resultType:[DBFILEPROPERTIESGetTemplateResult class]
+                                               errorType:[DBFILEPROPERTIESTemplateError class]
                                                    attrs:@{
                                                      @"auth" : @"user",
                                                      @"host" : @"api",
@@ -1124,158 +1109,131 @@ static NSObject *lockObj = nil;
                                                    }
                                    dataStructSerialBlock:nil
                                  dataStructDeserialBlock:nil];
-    }
-    return DBFILESPropertiesOverwrite;
-  }
-}
-
-+ (DBRoute *)DBFILESPropertiesRemove {
-  @synchronized(lockObj) {
-    if (!DBFILESPropertiesRemove) {
-      DBFILESPropertiesRemove = [[DBRoute alloc] init:@"properties/remove"
-                                           namespace_:@"files"
-                                           deprecated:@YES
-                                           resultType:nil
-                                            errorType:[DBFILEPROPERTIESRemovePropertiesError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBFILESPropertiesRemove;
-  }
-}
-
-+ (DBRoute *)DBFILESPropertiesTemplateGet {
-  @synchronized(lockObj) {
-    if (!DBFILESPropertiesTemplateGet) {
-      DBFILESPropertiesTemplateGet = [[DBRoute alloc] init:@"properties/template/get"
-                                                namespace_:@"files"
-                                                deprecated:@YES
-                                                resultType:[DBFILEPROPERTIESGetTemplateResult class]
-                                                 errorType:[DBFILEPROPERTIESTemplateError class]
-                                                     attrs:@{
-                                                       @"auth" : @"user",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBFILESPropertiesTemplateGet;
-  }
+  });
+  return DBFILESPropertiesTemplateGet;
 }
 
 + (DBRoute *)DBFILESPropertiesTemplateList {
-  @synchronized(lockObj) {
-    if (!DBFILESPropertiesTemplateList) {
-      DBFILESPropertiesTemplateList = [[DBRoute alloc] init:@"properties/template/list"
-                                                 namespace_:@"files"
-                                                 deprecated:@YES
-                                                 resultType:[DBFILEPROPERTIESListTemplateResult class]
-                                                  errorType:[DBFILEPROPERTIESTemplateError class]
-                                                      attrs:@{
-                                                        @"auth" : @"user",
-                                                        @"host" : @"api",
-                                                        @"style" : @"rpc"
-                                                      }
-                                      dataStructSerialBlock:nil
-                                    dataStructDeserialBlock:nil];
-    }
-    return DBFILESPropertiesTemplateList;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESPropertiesTemplateList = [[DBRoute alloc] init:@"properties/template/list"
+                                               namespace_:@"files"
+                                               deprecated:@YES
+                                               resultType:[DBFILEPROPERTIESListTemplateResult class]
+                                                errorType:[DBFILEPROPERTIESTemplateError class]
+                                                    attrs:@{
+                                                      @"auth" : @"user",
+                                                      @"host" : @"api",
+                                                      @"style" : @"rpc"
+                                                    }
+                                    dataStructSerialBlock:nil
+                                  dataStructDeserialBlock:nil];
+  });
+  return DBFILESPropertiesTemplateList;
 }
 
 + (DBRoute *)DBFILESPropertiesUpdate {
-  @synchronized(lockObj) {
-    if (!DBFILESPropertiesUpdate) {
-      DBFILESPropertiesUpdate = [[DBRoute alloc] init:@"properties/update"
-                                           namespace_:@"files"
-                                           deprecated:@YES
-                                           resultType:nil
-                                            errorType:[DBFILEPROPERTIESUpdatePropertiesError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBFILESPropertiesUpdate;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESPropertiesUpdate = [[DBRoute alloc] init:@"properties/update"
+                                         namespace_:@"files"
+                                         deprecated:@YES
+                                         resultType:nil
+                                          errorType:[DBFILEPROPERTIESUpdatePropertiesError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBFILESPropertiesUpdate;
 }
 
 + (DBRoute *)DBFILESRestore {
-  @synchronized(lockObj) {
-    if (!DBFILESRestore) {
-      DBFILESRestore = [[DBRoute alloc] init:@"restore"
-                                  namespace_:@"files"
-                                  deprecated:@NO
-                                  resultType:[DBFILESFileMetadata class]
-                                   errorType:[DBFILESRestoreError class]
-                                       attrs:@{
-                                         @"auth" : @"user",
-                                         @"host" : @"api",
-                                         @"style" : @"rpc"
-                                       }
-                       dataStructSerialBlock:nil
-                     dataStructDeserialBlock:nil];
-    }
-    return DBFILESRestore;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESRestore = [[DBRoute alloc] init:@"restore"
+                                namespace_:@"files"
+                                deprecated:@NO
+                                resultType:[DBFILESFileMetadata class]
+                                 errorType:[DBFILESRestoreError class]
+                                     attrs:@{
+                                       @"auth" : @"user",
+                                       @"host" : @"api",
+                                       @"style" : @"rpc"
+                                     }
+                     dataStructSerialBlock:nil
+                   dataStructDeserialBlock:nil];
+  });
+  return DBFILESRestore;
 }
 
 + (DBRoute *)DBFILESSaveUrl {
-  @synchronized(lockObj) {
-    if (!DBFILESSaveUrl) {
-      DBFILESSaveUrl = [[DBRoute alloc] init:@"save_url"
-                                  namespace_:@"files"
-                                  deprecated:@NO
-                                  resultType:[DBFILESSaveUrlResult class]
-                                   errorType:[DBFILESSaveUrlError class]
-                                       attrs:@{
-                                         @"auth" : @"user",
-                                         @"host" : @"api",
-                                         @"style" : @"rpc"
-                                       }
-                       dataStructSerialBlock:nil
-                     dataStructDeserialBlock:nil];
-    }
-    return DBFILESSaveUrl;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESSaveUrl = [[DBRoute alloc] init:@"save_url"
+                                namespace_:@"files"
+                                deprecated:@NO
+                                resultType:[DBFILESSaveUrlResult class]
+                                 errorType:[DBFILESSaveUrlError class]
+                                     attrs:@{
+                                       @"auth" : @"user",
+                                       @"host" : @"api",
+                                       @"style" : @"rpc"
+                                     }
+                     dataStructSerialBlock:nil
+                   dataStructDeserialBlock:nil];
+  });
+  return DBFILESSaveUrl;
 }
 
 + (DBRoute *)DBFILESSaveUrlCheckJobStatus {
-  @synchronized(lockObj) {
-    if (!DBFILESSaveUrlCheckJobStatus) {
-      DBFILESSaveUrlCheckJobStatus = [[DBRoute alloc] init:@"save_url/check_job_status"
-                                                namespace_:@"files"
-                                                deprecated:@NO
-                                                resultType:[DBFILESSaveUrlJobStatus class]
-                                                 errorType:[DBASYNCPollError class]
-                                                     attrs:@{
-                                                       @"auth" : @"user",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBFILESSaveUrlCheckJobStatus;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESSaveUrlCheckJobStatus = [[DBRoute alloc] init:@"save_url/check_job_status"
+                                              namespace_:@"files"
+                                              deprecated:@NO
+                                              resultType:[DBFILESSaveUrlJobStatus class]
+                                               errorType:[DBASYNCPollError class]
+                                                   attrs:@{
+                                                     @"auth" : @"user",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBFILESSaveUrlCheckJobStatus;
+}
+
++ (DBRoute *)DBFILESSearch {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESSearch = [[DBRoute alloc] init:@"search"
+                               namespace_:@"files"
+                               deprecated:@YES
+                               resultType:[DBFILESSearchResult class]
+                                errorType:[DBFILESSearchError class]
+                                    attrs:@{
+                                      @"auth" : @"user",
+                                      @"host" : @"api",
+                                      @"style" : @"rpc"
+                                    }
+                    dataStructSerialBlock:nil
+                  dataStructDeserialBlock:nil];
+  });
+  return DBFILESSearch;
 }
 
-+ (DBRoute *)DBFILESSearch {
-  @synchronized(lockObj) {
-    if (!DBFILESSearch) {
-      DBFILESSearch = [[DBRoute alloc] init:@"search"
++ (DBRoute *)DBFILESSearchV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESSearchV2 = [[DBRoute alloc] init:@"search_v2"
                                  namespace_:@"files"
-                                 deprecated:@YES
-                                 resultType:[DBFILESSearchResult class]
+                                 deprecated:@NO
+                                 resultType:[DBFILESSearchV2Result class]
                                   errorType:[DBFILESSearchError class]
                                       attrs:@{
                                         @"auth" : @"user",
@@ -1284,177 +1242,130 @@ static NSObject *lockObj = nil;
                                       }
                       dataStructSerialBlock:nil
                     dataStructDeserialBlock:nil];
-    }
-    return DBFILESSearch;
-  }
-}
-
-+ (DBRoute *)DBFILESSearchV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESSearchV2) {
-      DBFILESSearchV2 = [[DBRoute alloc] init:@"search_v2"
-                                   namespace_:@"files"
-                                   deprecated:@NO
-                                   resultType:[DBFILESSearchV2Result class]
-                                    errorType:[DBFILESSearchError class]
-                                        attrs:@{
-                                          @"auth" : @"user",
-                                          @"host" : @"api",
-                                          @"style" : @"rpc"
-                                        }
-                        dataStructSerialBlock:nil
-                      dataStructDeserialBlock:nil];
-    }
-    return DBFILESSearchV2;
-  }
+  });
+  return DBFILESSearchV2;
 }
 
 + (DBRoute *)DBFILESSearchContinueV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESSearchContinueV2) {
-      DBFILESSearchContinueV2 = [[DBRoute alloc] init:@"search/continue_v2"
-                                           namespace_:@"files"
-                                           deprecated:@NO
-                                           resultType:[DBFILESSearchV2Result class]
-                                            errorType:[DBFILESSearchError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBFILESSearchContinueV2;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESSearchContinueV2 = [[DBRoute alloc] init:@"search/continue_v2"
+                                         namespace_:@"files"
+                                         deprecated:@NO
+                                         resultType:[DBFILESSearchV2Result class]
+                                          errorType:[DBFILESSearchError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBFILESSearchContinueV2;
 }
 
 + (DBRoute *)DBFILESTagsAdd {
-  @synchronized(lockObj) {
-    if (!DBFILESTagsAdd) {
-      DBFILESTagsAdd = [[DBRoute alloc] init:@"tags/add"
-                                  namespace_:@"files"
-                                  deprecated:@NO
-                                  resultType:nil
-                                   errorType:[DBFILESAddTagError class]
-                                       attrs:@{
-                                         @"auth" : @"user",
-                                         @"host" : @"api",
-                                         @"style" : @"rpc"
-                                       }
-                       dataStructSerialBlock:nil
-                     dataStructDeserialBlock:nil];
-    }
-    return DBFILESTagsAdd;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESTagsAdd = [[DBRoute alloc] init:@"tags/add"
+                                namespace_:@"files"
+                                deprecated:@NO
+                                resultType:nil
+                                 errorType:[DBFILESAddTagError class]
+                                     attrs:@{
+                                       @"auth" : @"user",
+                                       @"host" : @"api",
+                                       @"style" : @"rpc"
+                                     }
+                     dataStructSerialBlock:nil
+                   dataStructDeserialBlock:nil];
+  });
+  return DBFILESTagsAdd;
 }
 
 + (DBRoute *)DBFILESTagsGet {
-  @synchronized(lockObj) {
-    if (!DBFILESTagsGet) {
-      DBFILESTagsGet = [[DBRoute alloc] init:@"tags/get"
-                                  namespace_:@"files"
-                                  deprecated:@NO
-                                  resultType:[DBFILESGetTagsResult class]
-                                   errorType:[DBFILESBaseTagError class]
-                                       attrs:@{
-                                         @"auth" : @"user",
-                                         @"host" : @"api",
-                                         @"style" : @"rpc"
-                                       }
-                       dataStructSerialBlock:nil
-                     dataStructDeserialBlock:nil];
-    }
-    return DBFILESTagsGet;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESTagsGet = [[DBRoute alloc] init:@"tags/get"
+                                namespace_:@"files"
+                                deprecated:@NO
+                                resultType:[DBFILESGetTagsResult class]
+                                 errorType:[DBFILESBaseTagError class]
+                                     attrs:@{
+                                       @"auth" : @"user",
+                                       @"host" : @"api",
+                                       @"style" : @"rpc"
+                                     }
+                     dataStructSerialBlock:nil
+                   dataStructDeserialBlock:nil];
+  });
+  return DBFILESTagsGet;
 }
 
 + (DBRoute *)DBFILESTagsRemove {
-  @synchronized(lockObj) {
-    if (!DBFILESTagsRemove) {
-      DBFILESTagsRemove = [[DBRoute alloc] init:@"tags/remove"
-                                     namespace_:@"files"
-                                     deprecated:@NO
-                                     resultType:nil
-                                      errorType:[DBFILESRemoveTagError class]
-                                          attrs:@{
-                                            @"auth" : @"user",
-                                            @"host" : @"api",
-                                            @"style" : @"rpc"
-                                          }
-                          dataStructSerialBlock:nil
-                        dataStructDeserialBlock:nil];
-    }
-    return DBFILESTagsRemove;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESTagsRemove = [[DBRoute alloc] init:@"tags/remove"
+                                   namespace_:@"files"
+                                   deprecated:@NO
+                                   resultType:nil
+                                    errorType:[DBFILESRemoveTagError class]
+                                        attrs:@{
+                                          @"auth" : @"user",
+                                          @"host" : @"api",
+                                          @"style" : @"rpc"
+                                        }
+                        dataStructSerialBlock:nil
+                      dataStructDeserialBlock:nil];
+  });
+  return DBFILESTagsRemove;
 }
 
 + (DBRoute *)DBFILESUnlockFileBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESUnlockFileBatch) {
-      DBFILESUnlockFileBatch = [[DBRoute alloc] init:@"unlock_file_batch"
-                                          namespace_:@"files"
-                                          deprecated:@NO
-                                          resultType:[DBFILESLockFileBatchResult class]
-                                           errorType:[DBFILESLockFileError class]
-                                               attrs:@{
-                                                 @"auth" : @"user",
-                                                 @"host" : @"api",
-                                                 @"style" : @"rpc"
-                                               }
-                               dataStructSerialBlock:nil
-                             dataStructDeserialBlock:nil];
-    }
-    return DBFILESUnlockFileBatch;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUnlockFileBatch = [[DBRoute alloc] init:@"unlock_file_batch"
+                                        namespace_:@"files"
+                                        deprecated:@NO
+                                        resultType:[DBFILESLockFileBatchResult class]
+                                         errorType:[DBFILESLockFileError class]
+                                             attrs:@{
+                                               @"auth" : @"user",
+                                               @"host" : @"api",
+                                               @"style" : @"rpc"
+                                             }
+                             dataStructSerialBlock:nil
+                           dataStructDeserialBlock:nil];
+  });
+  return DBFILESUnlockFileBatch;
 }
 
 + (DBRoute *)DBFILESUpload {
-  @synchronized(lockObj) {
-    if (!DBFILESUpload) {
-      DBFILESUpload = [[DBRoute alloc] init:@"upload"
-                                 namespace_:@"files"
-                                 deprecated:@NO
-                                 resultType:[DBFILESFileMetadata class]
-                                  errorType:[DBFILESUploadError class]
-                                      attrs:@{
-                                        @"auth" : @"user",
-                                        @"host" : @"content",
-                                        @"style" : @"upload"
-                                      }
-                      dataStructSerialBlock:nil
-                    dataStructDeserialBlock:nil];
-    }
-    return DBFILESUpload;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUpload = [[DBRoute alloc] init:@"upload"
+                               namespace_:@"files"
+                               deprecated:@NO
+                               resultType:[DBFILESFileMetadata class]
+                                errorType:[DBFILESUploadError class]
+                                    attrs:@{
+                                      @"auth" : @"user",
+                                      @"host" : @"content",
+                                      @"style" : @"upload"
+                                    }
+                    dataStructSerialBlock:nil
+                  dataStructDeserialBlock:nil];
+  });
+  return DBFILESUpload;
 }
 
 + (DBRoute *)DBFILESUploadSessionAppendV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESUploadSessionAppendV2) {
-      DBFILESUploadSessionAppendV2 = [[DBRoute alloc] init:@"upload_session/append_v2"
-                                                namespace_:@"files"
-                                                deprecated:@NO
-                                                resultType:nil
-                                                 errorType:[DBFILESUploadSessionAppendError class]
-                                                     attrs:@{
-                                                       @"auth" : @"user",
-                                                       @"host" : @"content",
-                                                       @"style" : @"upload"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBFILESUploadSessionAppendV2;
-  }
-}
-
-+ (DBRoute *)DBFILESUploadSessionAppend {
-  @synchronized(lockObj) {
-    if (!DBFILESUploadSessionAppend) {
-      DBFILESUploadSessionAppend = [[DBRoute alloc] init:@"upload_session/append"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUploadSessionAppendV2 = [[DBRoute alloc] init:@"upload_session/append_v2"
                                               namespace_:@"files"
-                                              deprecated:@YES
+                                              deprecated:@NO
                                               resultType:nil
                                                errorType:[DBFILESUploadSessionAppendError class]
                                                    attrs:@{
@@ -1464,38 +1375,74 @@ static NSObject *lockObj = nil;
                                                    }
                                    dataStructSerialBlock:nil
                                  dataStructDeserialBlock:nil];
-    }
-    return DBFILESUploadSessionAppend;
-  }
+  });
+  return DBFILESUploadSessionAppendV2;
+}
+
++ (DBRoute *)DBFILESUploadSessionAppend {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUploadSessionAppend = [[DBRoute alloc] init:@"upload_session/append"
+                                            namespace_:@"files"
+                                            deprecated:@YES
+                                            resultType:nil
+                                             errorType:[DBFILESUploadSessionAppendError class]
+                                                 attrs:@{
+                                                   @"auth" : @"user",
+                                                   @"host" : @"content",
+                                                   @"style" : @"upload"
+                                                 }
+                                 dataStructSerialBlock:nil
+                               dataStructDeserialBlock:nil];
+  });
+  return DBFILESUploadSessionAppend;
 }
 
 + (DBRoute *)DBFILESUploadSessionFinish {
-  @synchronized(lockObj) {
-    if (!DBFILESUploadSessionFinish) {
-      DBFILESUploadSessionFinish = [[DBRoute alloc] init:@"upload_session/finish"
-                                              namespace_:@"files"
-                                              deprecated:@NO
-                                              resultType:[DBFILESFileMetadata class]
-                                               errorType:[DBFILESUploadSessionFinishError class]
-                                                   attrs:@{
-                                                     @"auth" : @"user",
-                                                     @"host" : @"content",
-                                                     @"style" : @"upload"
-                                                   }
-                                   dataStructSerialBlock:nil
-                                 dataStructDeserialBlock:nil];
-    }
-    return DBFILESUploadSessionFinish;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUploadSessionFinish = [[DBRoute alloc] init:@"upload_session/finish"
+                                            namespace_:@"files"
+                                            deprecated:@NO
+                                            resultType:[DBFILESFileMetadata class]
+                                             errorType:[DBFILESUploadSessionFinishError class]
+                                                 attrs:@{
+                                                   @"auth" : @"user",
+                                                   @"host" : @"content",
+                                                   @"style" : @"upload"
+                                                 }
+                                 dataStructSerialBlock:nil
+                               dataStructDeserialBlock:nil];
+  });
+  return DBFILESUploadSessionFinish;
 }
 
 + (DBRoute *)DBFILESUploadSessionFinishBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESUploadSessionFinishBatch) {
-      DBFILESUploadSessionFinishBatch = [[DBRoute alloc] init:@"upload_session/finish_batch"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUploadSessionFinishBatch = [[DBRoute alloc] init:@"upload_session/finish_batch"
+                                                 namespace_:@"files"
+                                                 deprecated:@YES
+                                                 resultType:[DBFILESUploadSessionFinishBatchLaunch class]
+                                                  errorType:nil
+                                                      attrs:@{
+                                                        @"auth" : @"user",
+                                                        @"host" : @"api",
+                                                        @"style" : @"rpc"
+                                                      }
+                                      dataStructSerialBlock:nil
+                                    dataStructDeserialBlock:nil];
+  });
+  return DBFILESUploadSessionFinishBatch;
+}
+
++ (DBRoute *)DBFILESUploadSessionFinishBatchV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUploadSessionFinishBatchV2 = [[DBRoute alloc] init:@"upload_session/finish_batch_v2"
                                                    namespace_:@"files"
-                                                   deprecated:@YES
-                                                   resultType:[DBFILESUploadSessionFinishBatchLaunch class]
+                                                   deprecated:@NO
+                                                   resultType:[DBFILESUploadSessionFinishBatchResult class]
                                                     errorType:nil
                                                         attrs:@{
                                                           @"auth" : @"user",
@@ -1504,89 +1451,65 @@ static NSObject *lockObj = nil;
                                                         }
                                         dataStructSerialBlock:nil
                                       dataStructDeserialBlock:nil];
-    }
-    return DBFILESUploadSessionFinishBatch;
-  }
-}
-
-+ (DBRoute *)DBFILESUploadSessionFinishBatchV2 {
-  @synchronized(lockObj) {
-    if (!DBFILESUploadSessionFinishBatchV2) {
-      DBFILESUploadSessionFinishBatchV2 = [[DBRoute alloc] init:@"upload_session/finish_batch_v2"
-                                                     namespace_:@"files"
-                                                     deprecated:@NO
-                                                     resultType:[DBFILESUploadSessionFinishBatchResult class]
-                                                      errorType:nil
-                                                          attrs:@{
-                                                            @"auth" : @"user",
-                                                            @"host" : @"api",
-                                                            @"style" : @"rpc"
-                                                          }
-                                          dataStructSerialBlock:nil
-                                        dataStructDeserialBlock:nil];
-    }
-    return DBFILESUploadSessionFinishBatchV2;
-  }
+  });
+  return DBFILESUploadSessionFinishBatchV2;
 }
 
 + (DBRoute *)DBFILESUploadSessionFinishBatchCheck {
-  @synchronized(lockObj) {
-    if (!DBFILESUploadSessionFinishBatchCheck) {
-      DBFILESUploadSessionFinishBatchCheck = [[DBRoute alloc] init:@"upload_session/finish_batch/check"
-                                                        namespace_:@"files"
-                                                        deprecated:@NO
-                                                        resultType:[DBFILESUploadSessionFinishBatchJobStatus class]
-                                                         errorType:[DBASYNCPollError class]
-                                                             attrs:@{
-                                                               @"auth" : @"user",
-                                                               @"host" : @"api",
-                                                               @"style" : @"rpc"
-                                                             }
-                                             dataStructSerialBlock:nil
-                                           dataStructDeserialBlock:nil];
-    }
-    return DBFILESUploadSessionFinishBatchCheck;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUploadSessionFinishBatchCheck = [[DBRoute alloc] init:@"upload_session/finish_batch/check"
+                                                      namespace_:@"files"
+                                                      deprecated:@NO
+                                                      resultType:[DBFILESUploadSessionFinishBatchJobStatus class]
+                                                       errorType:[DBASYNCPollError class]
+                                                           attrs:@{
+                                                             @"auth" : @"user",
+                                                             @"host" : @"api",
+                                                             @"style" : @"rpc"
+                                                           }
+                                           dataStructSerialBlock:nil
+                                         dataStructDeserialBlock:nil];
+  });
+  return DBFILESUploadSessionFinishBatchCheck;
 }
 
 + (DBRoute *)DBFILESUploadSessionStart {
-  @synchronized(lockObj) {
-    if (!DBFILESUploadSessionStart) {
-      DBFILESUploadSessionStart = [[DBRoute alloc] init:@"upload_session/start"
-                                             namespace_:@"files"
-                                             deprecated:@NO
-                                             resultType:[DBFILESUploadSessionStartResult class]
-                                              errorType:[DBFILESUploadSessionStartError class]
-                                                  attrs:@{
-                                                    @"auth" : @"user",
-                                                    @"host" : @"content",
-                                                    @"style" : @"upload"
-                                                  }
-                                  dataStructSerialBlock:nil
-                                dataStructDeserialBlock:nil];
-    }
-    return DBFILESUploadSessionStart;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUploadSessionStart = [[DBRoute alloc] init:@"upload_session/start"
+                                           namespace_:@"files"
+                                           deprecated:@NO
+                                           resultType:[DBFILESUploadSessionStartResult class]
+                                            errorType:[DBFILESUploadSessionStartError class]
+                                                attrs:@{
+                                                  @"auth" : @"user",
+                                                  @"host" : @"content",
+                                                  @"style" : @"upload"
+                                                }
+                                dataStructSerialBlock:nil
+                              dataStructDeserialBlock:nil];
+  });
+  return DBFILESUploadSessionStart;
 }
 
 + (DBRoute *)DBFILESUploadSessionStartBatch {
-  @synchronized(lockObj) {
-    if (!DBFILESUploadSessionStartBatch) {
-      DBFILESUploadSessionStartBatch = [[DBRoute alloc] init:@"upload_session/start_batch"
-                                                  namespace_:@"files"
-                                                  deprecated:@NO
-                                                  resultType:[DBFILESUploadSessionStartBatchResult class]
-                                                   errorType:nil
-                                                       attrs:@{
-                                                         @"auth" : @"user",
-                                                         @"host" : @"api",
-                                                         @"style" : @"rpc"
-                                                       }
-                                       dataStructSerialBlock:nil
-                                     dataStructDeserialBlock:nil];
-    }
-    return DBFILESUploadSessionStartBatch;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBFILESUploadSessionStartBatch = [[DBRoute alloc] init:@"upload_session/start_batch"
+                                                namespace_:@"files"
+                                                deprecated:@NO
+                                                resultType:[DBFILESUploadSessionStartBatchResult class]
+                                                 errorType:nil
+                                                     attrs:@{
+                                                       @"auth" : @"user",
+                                                       @"host" : @"api",
+                                                       @"style" : @"rpc"
+                                                     }
+                                     dataStructSerialBlock:nil
+                                   dataStructDeserialBlock:nil];
+  });
+  return DBFILESUploadSessionStartBatch;
 }
 
 @end
@@ -57,121 +57,70 @@ static DBRoute *DBPAPERDocsUsersListContinue;
 static DBRoute *DBPAPERDocsUsersRemove;
 static DBRoute *DBPAPERFoldersCreate;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBPAPERDocsArchive {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBPAPERDocsArchive = [[DBRoute alloc] init:@"docs/archive"
+                                    namespace_:@"paper"
+                                    deprecated:@YES
+                                    resultType:nil
+                                     errorType:[DBPAPERDocLookupError class]
+                                         attrs:@{
+                                           @"auth" : @"user",
+                                           @"host" : @"api",
+                                           @"style" : @"rpc"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
   });
+  return DBPAPERDocsArchive;
 }
 
-+ (DBRoute *)DBPAPERDocsArchive {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsArchive) {
-      DBPAPERDocsArchive = [[DBRoute alloc] init:@"docs/archive"
-                                      namespace_:@"paper"
-                                      deprecated:@YES
-                                      resultType:nil
-                                       errorType:[DBPAPERDocLookupError class]
-                                           attrs:@{
-                                             @"auth" : @"user",
-                                             @"host" : @"api",
-                                             @"style" : @"rpc"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsArchive;
-  }
++ (DBRoute *)DBPAPERDocsCreate {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsCreate = [[DBRoute alloc] init:@"docs/create"
+                                   namespace_:@"paper"
+                                   deprecated:@YES
+                                   resultType:[DBPAPERPaperDocCreateUpdateResult class]
+                                    errorType:[DBPAPERPaperDocCreateError class]
+                                        attrs:@{
+                                          @"auth" : @"user",
+                                          @"host" : @"api",
+                                          @"style" : @"upload"
+                                        }
+                        dataStructSerialBlock:nil
+                      dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsCreate;
 }
 
-+ (DBRoute *)DBPAPERDocsCreate {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsCreate) {
-      DBPAPERDocsCreate = [[DBRoute alloc] init:@"docs/create"
++ (DBRoute *)DBPAPERDocsDownload {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsDownload = [[DBRoute alloc] init:@"docs/download"
                                      namespace_:@"paper"
                                      deprecated:@YES
-                                     resultType:[DBPAPERPaperDocCreateUpdateResult class]
-                                      errorType:[DBPAPERPaperDocCreateError class]
+                                     resultType:[DBPAPERPaperDocExportResult class]
+                                      errorType:[DBPAPERDocLookupError class]
                                           attrs:@{
                                             @"auth" : @"user",
                                             @"host" : @"api",
-                                            @"style" : @"upload"
+                                            @"style" : @"download"
                                           }
                           dataStructSerialBlock:nil
                         dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsCreate;
-  }
-}
-
-+ (DBRoute *)DBPAPERDocsDownload {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsDownload) {
-      DBPAPERDocsDownload = [[DBRoute alloc] init:@"docs/download"
-                                       namespace_:@"paper"
-                                       deprecated:@YES
-                                       resultType:[DBPAPERPaperDocExportResult class]
-                                        errorType:[DBPAPERDocLookupError class]
-                                            attrs:@{
-                                              @"auth" : @"user",
-                                              @"host" : @"api",
-                                              @"style" : @"download"
-                                            }
-                            dataStructSerialBlock:nil
-                          dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsDownload;
-  }
+  });
+  return DBPAPERDocsDownload;
 }
 
 + (DBRoute *)DBPAPERDocsFolderUsersList {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsFolderUsersList) {
-      DBPAPERDocsFolderUsersList = [[DBRoute alloc] init:@"docs/folder_users/list"
-                                              namespace_:@"paper"
-                                              deprecated:@YES
-                                              resultType:[DBPAPERListUsersOnFolderResponse class]
-                                               errorType:[DBPAPERDocLookupError class]
-                                                   attrs:@{
-                                                     @"auth" : @"user",
-                                                     @"host" : @"api",
-                                                     @"style" : @"rpc"
-                                                   }
-                                   dataStructSerialBlock:nil
-                                 dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsFolderUsersList;
-  }
-}
-
-+ (DBRoute *)DBPAPERDocsFolderUsersListContinue {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsFolderUsersListContinue) {
-      DBPAPERDocsFolderUsersListContinue = [[DBRoute alloc] init:@"docs/folder_users/list/continue"
-                                                      namespace_:@"paper"
-                                                      deprecated:@YES
-                                                      resultType:[DBPAPERListUsersOnFolderResponse class]
-                                                       errorType:[DBPAPERListUsersCursorError class]
-                                                           attrs:@{
-                                                             @"auth" : @"user",
-                                                             @"host" : @"api",
-                                                             @"style" : @"rpc"
-                                                           }
-                                           dataStructSerialBlock:nil
-                                         dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsFolderUsersListContinue;
-  }
-}
-
-+ (DBRoute *)DBPAPERDocsGetFolderInfo {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsGetFolderInfo) {
-      DBPAPERDocsGetFolderInfo = [[DBRoute alloc] init:@"docs/get_folder_info"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsFolderUsersList = [[DBRoute alloc] init:@"docs/folder_users/list"
                                             namespace_:@"paper"
                                             deprecated:@YES
-                                            resultType:[DBPAPERFoldersContainingPaperDoc class]
+                                            resultType:[DBPAPERListUsersOnFolderResponse class]
                                              errorType:[DBPAPERDocLookupError class]
                                                  attrs:@{
                                                    @"auth" : @"user",
@@ -180,224 +129,232 @@ static NSObject *lockObj = nil;
                                                  }
                                  dataStructSerialBlock:nil
                                dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsGetFolderInfo;
-  }
+  });
+  return DBPAPERDocsFolderUsersList;
+}
+
++ (DBRoute *)DBPAPERDocsFolderUsersListContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsFolderUsersListContinue = [[DBRoute alloc] init:@"docs/folder_users/list/continue"
+                                                    namespace_:@"paper"
+                                                    deprecated:@YES
+                                                    resultType:[DBPAPERListUsersOnFolderResponse class]
+                                                     errorType:[DBPAPERListUsersCursorError class]
+                                                         attrs:@{
+                                                           @"auth" : @"user",
+                                                           @"host" : @"api",
+                                                           @"style" : @"rpc"
+                                                         }
+                                         dataStructSerialBlock:nil
+                                       dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsFolderUsersListContinue;
+}
+
++ (DBRoute *)DBPAPERDocsGetFolderInfo {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsGetFolderInfo = [[DBRoute alloc] init:@"docs/get_folder_info"
+                                          namespace_:@"paper"
+                                          deprecated:@YES
+                                          resultType:[DBPAPERFoldersContainingPaperDoc class]
+                                           errorType:[DBPAPERDocLookupError class]
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsGetFolderInfo;
 }
 
 + (DBRoute *)DBPAPERDocsList {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsList) {
-      DBPAPERDocsList = [[DBRoute alloc] init:@"docs/list"
-                                   namespace_:@"paper"
-                                   deprecated:@YES
-                                   resultType:[DBPAPERListPaperDocsResponse class]
-                                    errorType:nil
-                                        attrs:@{
-                                          @"auth" : @"user",
-                                          @"host" : @"api",
-                                          @"style" : @"rpc"
-                                        }
-                        dataStructSerialBlock:nil
-                      dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsList;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsList = [[DBRoute alloc] init:@"docs/list"
+                                 namespace_:@"paper"
+                                 deprecated:@YES
+                                 resultType:[DBPAPERListPaperDocsResponse class]
+                                  errorType:nil
+                                      attrs:@{
+                                        @"auth" : @"user",
+                                        @"host" : @"api",
+                                        @"style" : @"rpc"
+                                      }
+                      dataStructSerialBlock:nil
+                    dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsList;
 }
 
 + (DBRoute *)DBPAPERDocsListContinue {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsListContinue) {
-      DBPAPERDocsListContinue = [[DBRoute alloc] init:@"docs/list/continue"
-                                           namespace_:@"paper"
-                                           deprecated:@YES
-                                           resultType:[DBPAPERListPaperDocsResponse class]
-                                            errorType:[DBPAPERListDocsCursorError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsListContinue;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsListContinue = [[DBRoute alloc] init:@"docs/list/continue"
+                                         namespace_:@"paper"
+                                         deprecated:@YES
+                                         resultType:[DBPAPERListPaperDocsResponse class]
+                                          errorType:[DBPAPERListDocsCursorError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsListContinue;
 }
 
 + (DBRoute *)DBPAPERDocsPermanentlyDelete {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsPermanentlyDelete) {
-      DBPAPERDocsPermanentlyDelete = [[DBRoute alloc] init:@"docs/permanently_delete"
-                                                namespace_:@"paper"
-                                                deprecated:@YES
-                                                resultType:nil
-                                                 errorType:[DBPAPERDocLookupError class]
-                                                     attrs:@{
-                                                       @"auth" : @"user",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsPermanentlyDelete;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsPermanentlyDelete = [[DBRoute alloc] init:@"docs/permanently_delete"
+                                              namespace_:@"paper"
+                                              deprecated:@YES
+                                              resultType:nil
+                                               errorType:[DBPAPERDocLookupError class]
+                                                   attrs:@{
+                                                     @"auth" : @"user",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsPermanentlyDelete;
 }
 
 + (DBRoute *)DBPAPERDocsSharingPolicyGet {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsSharingPolicyGet) {
-      DBPAPERDocsSharingPolicyGet = [[DBRoute alloc] init:@"docs/sharing_policy/get"
-                                               namespace_:@"paper"
-                                               deprecated:@YES
-                                               resultType:[DBPAPERSharingPolicy class]
-                                                errorType:[DBPAPERDocLookupError class]
-                                                    attrs:@{
-                                                      @"auth" : @"user",
-                                                      @"host" : @"api",
-                                                      @"style" : @"rpc"
-                                                    }
-                                    dataStructSerialBlock:nil
-                                  dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsSharingPolicyGet;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsSharingPolicyGet = [[DBRoute alloc] init:@"docs/sharing_policy/get"
+                                             namespace_:@"paper"
+                                             deprecated:@YES
+                                             resultType:[DBPAPERSharingPolicy class]
+                                              errorType:[DBPAPERDocLookupError class]
+                                                  attrs:@{
+                                                    @"auth" : @"user",
+                                                    @"host" : @"api",
+                                                    @"style" : @"rpc"
+                                                  }
+                                  dataStructSerialBlock:nil
+                                dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsSharingPolicyGet;
 }
 
 + (DBRoute *)DBPAPERDocsSharingPolicySet {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsSharingPolicySet) {
-      DBPAPERDocsSharingPolicySet = [[DBRoute alloc] init:@"docs/sharing_policy/set"
-                                               namespace_:@"paper"
-                                               deprecated:@YES
-                                               resultType:nil
-                                                errorType:[DBPAPERDocLookupError class]
-                                                    attrs:@{
-                                                      @"auth" : @"user",
-                                                      @"host" : @"api",
-                                                      @"style" : @"rpc"
-                                                    }
-                                    dataStructSerialBlock:nil
-                                  dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsSharingPolicySet;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsSharingPolicySet = [[DBRoute alloc] init:@"docs/sharing_policy/set"
+                                             namespace_:@"paper"
+                                             deprecated:@YES
+                                             resultType:nil
+                                              errorType:[DBPAPERDocLookupError class]
+                                                  attrs:@{
+                                                    @"auth" : @"user",
+                                                    @"host" : @"api",
+                                                    @"style" : @"rpc"
+                                                  }
+                                  dataStructSerialBlock:nil
+                                dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsSharingPolicySet;
 }
 
 + (DBRoute *)DBPAPERDocsUpdate {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsUpdate) {
-      DBPAPERDocsUpdate = [[DBRoute alloc] init:@"docs/update"
-                                     namespace_:@"paper"
-                                     deprecated:@YES
-                                     resultType:[DBPAPERPaperDocCreateUpdateResult class]
-                                      errorType:[DBPAPERPaperDocUpdateError class]
-                                          attrs:@{
-                                            @"auth" : @"user",
-                                            @"host" : @"api",
-                                            @"style" : @"upload"
-                                          }
-                          dataStructSerialBlock:nil
-                        dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsUpdate;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsUpdate = [[DBRoute alloc] init:@"docs/update"
+                                   namespace_:@"paper"
+                                   deprecated:@YES
+                                   resultType:[DBPAPERPaperDocCreateUpdateResult class]
+                                    errorType:[DBPAPERPaperDocUpdateError class]
+                                        attrs:@{
+                                          @"auth" : @"user",
+                                          @"host" : @"api",
+                                          @"style" : @"upload"
+                                        }
+                        dataStructSerialBlock:nil
+                      dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsUpdate;
 }
 
 + (DBRoute *)DBPAPERDocsUsersAdd {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsUsersAdd) {
-      DBPAPERDocsUsersAdd = [[DBRoute alloc] init:@"docs/users/add"
-          namespace_:@"paper"
-          deprecated:@YES
-          resultType:[NSArray<DBPAPERAddPaperDocUserMemberResult *> class]
-          errorType:[DBPAPERDocLookupError class]
-          attrs:@{
-            @"auth" : @"user",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBPAPERAddPaperDocUserMemberResultSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBPAPERDocsUsersAdd;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsUsersAdd = [[DBRoute alloc] init:@"docs/users/add"
+        namespace_:@"paper"
+        deprecated:@YES
+        resultType:[NSArray<DBPAPERAddPaperDocUserMemberResult *> class]
+        errorType:[DBPAPERDocLookupError class]
+        attrs:@{
+          @"auth" : @"user",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBPAPERAddPaperDocUserMemberResultSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBPAPERDocsUsersAdd;
 }
 
 + (DBRoute *)DBPAPERDocsUsersList {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsUsersList) {
-      DBPAPERDocsUsersList = [[DBRoute alloc] init:@"docs/users/list"
-                                        namespace_:@"paper"
-                                        deprecated:@YES
-                                        resultType:[DBPAPERListUsersOnPaperDocResponse class]
-                                         errorType:[DBPAPERDocLookupError class]
-                                             attrs:@{
-                                               @"auth" : @"user",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsUsersList;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsUsersList = [[DBRoute alloc] init:@"docs/users/list"
+                                      namespace_:@"paper"
+                                      deprecated:@YES
+                                      resultType:[DBPAPERListUsersOnPaperDocResponse class]
+                                       errorType:[DBPAPERDocLookupError class]
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsUsersList;
 }
 
 + (DBRoute *)DBPAPERDocsUsersListContinue {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsUsersListContinue) {
-      DBPAPERDocsUsersListContinue = [[DBRoute alloc] init:@"docs/users/list/continue"
-                                                namespace_:@"paper"
-                                                deprecated:@YES
-                                                resultType:[DBPAPERListUsersOnPaperDocResponse class]
-                                                 errorType:[DBPAPERListUsersCursorError class]
-                                                     attrs:@{
-                                                       @"auth" : @"user",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsUsersListContinue;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsUsersListContinue = [[DBRoute alloc] init:@"docs/users/list/continue"
+                                              namespace_:@"paper"
+                                              deprecated:@YES
+                                              resultType:[DBPAPERListUsersOnPaperDocResponse class]
+                                               errorType:[DBPAPERListUsersCursorError class]
+                                                   attrs:@{
+                                                     @"auth" : @"user",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBPAPERDocsUsersListContinue;
 }
 
 + (DBRoute *)DBPAPERDocsUsersRemove {
-  @synchronized(lockObj) {
-    if (!DBPAPERDocsUsersRemove) {
-      DBPAPERDocsUsersRemove = [[DBRoute alloc] init:@"docs/users/remove"
-                                          namespace_:@"paper"
-                                          deprecated:@YES
-                                          resultType:nil
-                                           errorType:[DBPAPERDocLookupError class]
-                                               attrs:@{
-                                                 @"auth" : @"user",
-                                                 @"host" : @"api",
-                                                 @"style" : @"rpc"
-                                               }
-                               dataStructSerialBlock:nil
-                             dataStructDeserialBlock:nil];
-    }
-    return DBPAPERDocsUsersRemove;
-  }
-}
-
-+ (DBRoute *)DBPAPERFoldersCreate {
-  @synchronized(lockObj) {
-    if (!DBPAPERFoldersCreate) {
-      DBPAPERFoldersCreate = [[DBRoute alloc] init:@"folders/create"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERDocsUsersRemove = [[DBRoute alloc] init:@"docs/users/remove"
                                         namespace_:@"paper"
                                         deprecated:@YES
-                                        resultType:[DBPAPERPaperFolderCreateResult class]
-                                         errorType:[DBPAPERPaperFolderCreateError class]
+                                        resultType:nil
+                                         errorType:[DBPAPERDocLookupError class]
                                              attrs:@{
                                                @"auth" : @"user",
                                                @"host" : @"api",
@@ -405,9 +362,27 @@ static NSObject *lockObj = nil;
                                              }
                              dataStructSerialBlock:nil
                            dataStructDeserialBlock:nil];
-    }
-    return DBPAPERFoldersCreate;
-  }
+  });
+  return DBPAPERDocsUsersRemove;
+}
+
++ (DBRoute *)DBPAPERFoldersCreate {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBPAPERFoldersCreate = [[DBRoute alloc] init:@"folders/create"
+                                      namespace_:@"paper"
+                                      deprecated:@YES
+                                      resultType:[DBPAPERPaperFolderCreateResult class]
+                                       errorType:[DBPAPERPaperFolderCreateError class]
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBPAPERFoldersCreate;
 }
 
 @end
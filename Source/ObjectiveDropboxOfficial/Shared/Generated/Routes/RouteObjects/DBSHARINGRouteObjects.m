@@ -144,67 +144,114 @@ static DBRoute *DBSHARINGUpdateFileMember;
 static DBRoute *DBSHARINGUpdateFolderMember;
 static DBRoute *DBSHARINGUpdateFolderPolicy;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBSHARINGAddFileMember {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBSHARINGAddFileMember = [[DBRoute alloc] init:@"add_file_member"
+        namespace_:@"sharing"
+        deprecated:@NO
+        resultType:[NSArray<DBSHARINGFileMemberActionResult *> class]
+        errorType:[DBSHARINGAddFileMemberError class]
+        attrs:@{
+          @"auth" : @"user",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBSHARINGFileMemberActionResultSerializer deserialize:elem0];
+                                      }];
+        }];
   });
-}
-
-+ (DBRoute *)DBSHARINGAddFileMember {
-  @synchronized(lockObj) {
-    if (!DBSHARINGAddFileMember) {
-      DBSHARINGAddFileMember = [[DBRoute alloc] init:@"add_file_member"
-          namespace_:@"sharing"
-          deprecated:@NO
-          resultType:[NSArray<DBSHARINGFileMemberActionResult *> class]
-          errorType:[DBSHARINGAddFileMemberError class]
-          attrs:@{
-            @"auth" : @"user",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBSHARINGFileMemberActionResultSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBSHARINGAddFileMember;
-  }
+  return DBSHARINGAddFileMember;
 }
 
 + (DBRoute *)DBSHARINGAddFolderMember {
-  @synchronized(lockObj) {
-    if (!DBSHARINGAddFolderMember) {
-      DBSHARINGAddFolderMember = [[DBRoute alloc] init:@"add_folder_member"
-                                            namespace_:@"sharing"
-                                            deprecated:@NO
-                                            resultType:nil
-                                             errorType:[DBSHARINGAddFolderMemberError class]
-                                                 attrs:@{
-                                                   @"auth" : @"user",
-                                                   @"host" : @"api",
-                                                   @"style" : @"rpc"
-                                                 }
-                                 dataStructSerialBlock:nil
-                               dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGAddFolderMember;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGAddFolderMember = [[DBRoute alloc] init:@"add_folder_member"
+                                          namespace_:@"sharing"
+                                          deprecated:@NO
+                                          resultType:nil
+                                           errorType:[DBSHARINGAddFolderMemberError class]
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGAddFolderMember;
 }
 
 + (DBRoute *)DBSHARINGCheckJobStatus {
-  @synchronized(lockObj) {
-    if (!DBSHARINGCheckJobStatus) {
-      DBSHARINGCheckJobStatus = [[DBRoute alloc] init:@"check_job_status"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGCheckJobStatus = [[DBRoute alloc] init:@"check_job_status"
+                                         namespace_:@"sharing"
+                                         deprecated:@NO
+                                         resultType:[DBSHARINGJobStatus class]
+                                          errorType:[DBASYNCPollError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGCheckJobStatus;
+}
+
++ (DBRoute *)DBSHARINGCheckRemoveMemberJobStatus {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGCheckRemoveMemberJobStatus = [[DBRoute alloc] init:@"check_remove_member_job_status"
+                                                     namespace_:@"sharing"
+                                                     deprecated:@NO
+                                                     resultType:[DBSHARINGRemoveMemberJobStatus class]
+                                                      errorType:[DBASYNCPollError class]
+                                                          attrs:@{
+                                                            @"auth" : @"user",
+                                                            @"host" : @"api",
+                                                            @"style" : @"rpc"
+                                                          }
+                                          dataStructSerialBlock:nil
+                                        dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGCheckRemoveMemberJobStatus;
+}
+
++ (DBRoute *)DBSHARINGCheckShareJobStatus {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGCheckShareJobStatus = [[DBRoute alloc] init:@"check_share_job_status"
+                                              namespace_:@"sharing"
+                                              deprecated:@NO
+                                              resultType:[DBSHARINGShareFolderJobStatus class]
+                                               errorType:[DBASYNCPollError class]
+                                                   attrs:@{
+                                                     @"auth" : @"user",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGCheckShareJobStatus;
+}
+
++ (DBRoute *)DBSHARINGCreateSharedLink {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGCreateSharedLink = [[DBRoute alloc] init:@"create_shared_link"
                                            namespace_:@"sharing"
-                                           deprecated:@NO
-                                           resultType:[DBSHARINGJobStatus class]
-                                            errorType:[DBASYNCPollError class]
+                                           deprecated:@YES
+                                           resultType:[DBSHARINGPathLinkMetadata class]
+                                            errorType:[DBSHARINGCreateSharedLinkError class]
                                                 attrs:@{
                                                   @"auth" : @"user",
                                                   @"host" : @"api",
@@ -212,19 +259,18 @@ static NSObject *lockObj = nil;
                                                 }
                                 dataStructSerialBlock:nil
                               dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGCheckJobStatus;
-  }
+  });
+  return DBSHARINGCreateSharedLink;
 }
 
-+ (DBRoute *)DBSHARINGCheckRemoveMemberJobStatus {
-  @synchronized(lockObj) {
-    if (!DBSHARINGCheckRemoveMemberJobStatus) {
-      DBSHARINGCheckRemoveMemberJobStatus = [[DBRoute alloc] init:@"check_remove_member_job_status"
++ (DBRoute *)DBSHARINGCreateSharedLinkWithSettings {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGCreateSharedLinkWithSettings = [[DBRoute alloc] init:@"create_shared_link_with_settings"
                                                        namespace_:@"sharing"
                                                        deprecated:@NO
-                                                       resultType:[DBSHARINGRemoveMemberJobStatus class]
-                                                        errorType:[DBASYNCPollError class]
+                                                       resultType:[DBSHARINGSharedLinkMetadata class]
+                                                        errorType:[DBSHARINGCreateSharedLinkWithSettingsError class]
                                                             attrs:@{
                                                               @"auth" : @"user",
                                                               @"host" : @"api",
@@ -232,79 +278,61 @@ static NSObject *lockObj = nil;
                                                             }
                                             dataStructSerialBlock:nil
                                           dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGCheckRemoveMemberJobStatus;
-  }
-}
-
-+ (DBRoute *)DBSHARINGCheckShareJobStatus {
-  @synchronized(lockObj) {
-    if (!DBSHARINGCheckShareJobStatus) {
-      DBSHARINGCheckShareJobStatus = [[DBRoute alloc] init:@"check_share_job_status"
-                                                namespace_:@"sharing"
-                                                deprecated:@NO
-                                                resultType:[DBSHARINGShareFolderJobStatus class]
-                                                 errorType:[DBASYNCPollError class]
-                                                     attrs:@{
-                                                       @"auth" : @"user",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGCheckShareJobStatus;
-  }
+  });
+  return DBSHARINGCreateSharedLinkWithSettings;
 }
 
-+ (DBRoute *)DBSHARINGCreateSharedLink {
-  @synchronized(lockObj) {
-    if (!DBSHARINGCreateSharedLink) {
-      DBSHARINGCreateSharedLink = [[DBRoute alloc] init:@"create_shared_link"
-                                             namespace_:@"sharing"
-                                             deprecated:@YES
-                                             resultType:[DBSHARINGPathLinkMetadata class]
-                                              errorType:[DBSHARINGCreateSharedLinkError class]
-                                                  attrs:@{
-                                                    @"auth" : @"user",
-                                                    @"host" : @"api",
-                                                    @"style" : @"rpc"
-                                                  }
-                                  dataStructSerialBlock:nil
-                                dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGCreateSharedLink;
-  }
++ (DBRoute *)DBSHARINGGetFileMetadata {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGGetFileMetadata = [[DBRoute alloc] init:@"get_file_metadata"
+                                          namespace_:@"sharing"
+                                          deprecated:@NO
+                                          resultType:[DBSHARINGSharedFileMetadata class]
+                                           errorType:[DBSHARINGGetFileMetadataError class]
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGGetFileMetadata;
 }
 
-+ (DBRoute *)DBSHARINGCreateSharedLinkWithSettings {
-  @synchronized(lockObj) {
-    if (!DBSHARINGCreateSharedLinkWithSettings) {
-      DBSHARINGCreateSharedLinkWithSettings = [[DBRoute alloc] init:@"create_shared_link_with_settings"
-                                                         namespace_:@"sharing"
-                                                         deprecated:@NO
-                                                         resultType:[DBSHARINGSharedLinkMetadata class]
-                                                          errorType:[DBSHARINGCreateSharedLinkWithSettingsError class]
-                                                              attrs:@{
-                                                                @"auth" : @"user",
-                                                                @"host" : @"api",
-                                                                @"style" : @"rpc"
-                                                              }
-                                              dataStructSerialBlock:nil
-                                            dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGCreateSharedLinkWithSettings;
-  }
++ (DBRoute *)DBSHARINGGetFileMetadataBatch {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGGetFileMetadataBatch = [[DBRoute alloc] init:@"get_file_metadata/batch"
+        namespace_:@"sharing"
+        deprecated:@NO
+        resultType:[NSArray<DBSHARINGGetFileMetadataBatchResult *> class]
+        errorType:[DBSHARINGSharingUserError class]
+        attrs:@{
+          @"auth" : @"user",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBSHARINGGetFileMetadataBatchResultSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBSHARINGGetFileMetadataBatch;
 }
 
-+ (DBRoute *)DBSHARINGGetFileMetadata {
-  @synchronized(lockObj) {
-    if (!DBSHARINGGetFileMetadata) {
-      DBSHARINGGetFileMetadata = [[DBRoute alloc] init:@"get_file_metadata"
++ (DBRoute *)DBSHARINGGetFolderMetadata {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGGetFolderMetadata = [[DBRoute alloc] init:@"get_folder_metadata"
                                             namespace_:@"sharing"
                                             deprecated:@NO
-                                            resultType:[DBSHARINGSharedFileMetadata class]
-                                             errorType:[DBSHARINGGetFileMetadataError class]
+                                            resultType:[DBSHARINGSharedFolderMetadata class]
+                                             errorType:[DBSHARINGSharedFolderAccessError class]
                                                  attrs:@{
                                                    @"auth" : @"user",
                                                    @"host" : @"api",
@@ -312,124 +340,137 @@ static NSObject *lockObj = nil;
                                                  }
                                  dataStructSerialBlock:nil
                                dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGGetFileMetadata;
-  }
+  });
+  return DBSHARINGGetFolderMetadata;
 }
 
-+ (DBRoute *)DBSHARINGGetFileMetadataBatch {
-  @synchronized(lockObj) {
-    if (!DBSHARINGGetFileMetadataBatch) {
-      DBSHARINGGetFileMetadataBatch = [[DBRoute alloc] init:@"get_file_metadata/batch"
-          namespace_:@"sharing"
-          deprecated:@NO
-          resultType:[NSArray<DBSHARINGGetFileMetadataBatchResult *> class]
-          errorType:[DBSHARINGSharingUserError class]
-          attrs:@{
-            @"auth" : @"user",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBSHARINGGetFileMetadataBatchResultSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBSHARINGGetFileMetadataBatch;
-  }
++ (DBRoute *)DBSHARINGGetSharedLinkFile {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGGetSharedLinkFile = [[DBRoute alloc] init:@"get_shared_link_file"
+                                            namespace_:@"sharing"
+                                            deprecated:@NO
+                                            resultType:[DBSHARINGSharedLinkMetadata class]
+                                             errorType:[DBSHARINGGetSharedLinkFileError class]
+                                                 attrs:@{
+                                                   @"auth" : @"user",
+                                                   @"host" : @"content",
+                                                   @"style" : @"download"
+                                                 }
+                                 dataStructSerialBlock:nil
+                               dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGGetSharedLinkFile;
 }
 
-+ (DBRoute *)DBSHARINGGetFolderMetadata {
-  @synchronized(lockObj) {
-    if (!DBSHARINGGetFolderMetadata) {
-      DBSHARINGGetFolderMetadata = [[DBRoute alloc] init:@"get_folder_metadata"
-                                              namespace_:@"sharing"
-                                              deprecated:@NO
-                                              resultType:[DBSHARINGSharedFolderMetadata class]
-                                               errorType:[DBSHARINGSharedFolderAccessError class]
-                                                   attrs:@{
-                                                     @"auth" : @"user",
-                                                     @"host" : @"api",
-                                                     @"style" : @"rpc"
-                                                   }
-                                   dataStructSerialBlock:nil
-                                 dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGGetFolderMetadata;
-  }
++ (DBRoute *)DBSHARINGGetSharedLinkMetadata {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGGetSharedLinkMetadata = [[DBRoute alloc] init:@"get_shared_link_metadata"
+                                                namespace_:@"sharing"
+                                                deprecated:@NO
+                                                resultType:[DBSHARINGSharedLinkMetadata class]
+                                                 errorType:[DBSHARINGSharedLinkError class]
+                                                     attrs:@{
+                                                       @"auth" : @"app, user",
+                                                       @"host" : @"api",
+                                                       @"style" : @"rpc"
+                                                     }
+                                     dataStructSerialBlock:nil
+                                   dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGGetSharedLinkMetadata;
 }
 
-+ (DBRoute *)DBSHARINGGetSharedLinkFile {
-  @synchronized(lockObj) {
-    if (!DBSHARINGGetSharedLinkFile) {
-      DBSHARINGGetSharedLinkFile = [[DBRoute alloc] init:@"get_shared_link_file"
-                                              namespace_:@"sharing"
-                                              deprecated:@NO
-                                              resultType:[DBSHARINGSharedLinkMetadata class]
-                                               errorType:[DBSHARINGGetSharedLinkFileError class]
-                                                   attrs:@{
-                                                     @"auth" : @"user",
-                                                     @"host" : @"content",
-                                                     @"style" : @"download"
-                                                   }
-                                   dataStructSerialBlock:nil
-                                 dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGGetSharedLinkFile;
-  }
++ (DBRoute *)DBSHARINGGetSharedLinks {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGGetSharedLinks = [[DBRoute alloc] init:@"get_shared_links"
+                                         namespace_:@"sharing"
+                                         deprecated:@YES
+                                         resultType:[DBSHARINGGetSharedLinksResult class]
+                                          errorType:[DBSHARINGGetSharedLinksError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGGetSharedLinks;
 }
 
-+ (DBRoute *)DBSHARINGGetSharedLinkMetadata {
-  @synchronized(lockObj) {
-    if (!DBSHARINGGetSharedLinkMetadata) {
-      DBSHARINGGetSharedLinkMetadata = [[DBRoute alloc] init:@"get_shared_link_metadata"
++ (DBRoute *)DBSHARINGListFileMembers {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListFileMembers = [[DBRoute alloc] init:@"list_file_members"
+                                          namespace_:@"sharing"
+                                          deprecated:@NO
+                                          resultType:[DBSHARINGSharedFileMembers class]
+                                           errorType:[DBSHARINGListFileMembersError class]
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGListFileMembers;
+}
+
++ (DBRoute *)DBSHARINGListFileMembersBatch {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListFileMembersBatch = [[DBRoute alloc] init:@"list_file_members/batch"
+        namespace_:@"sharing"
+        deprecated:@NO
+        resultType:[NSArray<DBSHARINGListFileMembersBatchResult *> class]
+        errorType:[DBSHARINGSharingUserError class]
+        attrs:@{
+          @"auth" : @"user",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBSHARINGListFileMembersBatchResultSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBSHARINGListFileMembersBatch;
+}
+
++ (DBRoute *)DBSHARINGListFileMembersContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListFileMembersContinue = [[DBRoute alloc] init:@"list_file_members/continue"
                                                   namespace_:@"sharing"
                                                   deprecated:@NO
-                                                  resultType:[DBSHARINGSharedLinkMetadata class]
-                                                   errorType:[DBSHARINGSharedLinkError class]
+                                                  resultType:[DBSHARINGSharedFileMembers class]
+                                                   errorType:[DBSHARINGListFileMembersContinueError class]
                                                        attrs:@{
-                                                         @"auth" : @"app, user",
+                                                         @"auth" : @"user",
                                                          @"host" : @"api",
                                                          @"style" : @"rpc"
                                                        }
                                        dataStructSerialBlock:nil
                                      dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGGetSharedLinkMetadata;
-  }
-}
-
-+ (DBRoute *)DBSHARINGGetSharedLinks {
-  @synchronized(lockObj) {
-    if (!DBSHARINGGetSharedLinks) {
-      DBSHARINGGetSharedLinks = [[DBRoute alloc] init:@"get_shared_links"
-                                           namespace_:@"sharing"
-                                           deprecated:@YES
-                                           resultType:[DBSHARINGGetSharedLinksResult class]
-                                            errorType:[DBSHARINGGetSharedLinksError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGGetSharedLinks;
-  }
+  });
+  return DBSHARINGListFileMembersContinue;
 }
 
-+ (DBRoute *)DBSHARINGListFileMembers {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListFileMembers) {
-      DBSHARINGListFileMembers = [[DBRoute alloc] init:@"list_file_members"
++ (DBRoute *)DBSHARINGListFolderMembers {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListFolderMembers = [[DBRoute alloc] init:@"list_folder_members"
                                             namespace_:@"sharing"
                                             deprecated:@NO
-                                            resultType:[DBSHARINGSharedFileMembers class]
-                                             errorType:[DBSHARINGListFileMembersError class]
+                                            resultType:[DBSHARINGSharedFolderMembers class]
+                                             errorType:[DBSHARINGSharedFolderAccessError class]
                                                  attrs:@{
                                                    @"auth" : @"user",
                                                    @"host" : @"api",
@@ -437,44 +478,18 @@ static NSObject *lockObj = nil;
                                                  }
                                  dataStructSerialBlock:nil
                                dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListFileMembers;
-  }
-}
-
-+ (DBRoute *)DBSHARINGListFileMembersBatch {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListFileMembersBatch) {
-      DBSHARINGListFileMembersBatch = [[DBRoute alloc] init:@"list_file_members/batch"
-          namespace_:@"sharing"
-          deprecated:@NO
-          resultType:[NSArray<DBSHARINGListFileMembersBatchResult *> class]
-          errorType:[DBSHARINGSharingUserError class]
-          attrs:@{
-            @"auth" : @"user",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBSHARINGListFileMembersBatchResultSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBSHARINGListFileMembersBatch;
-  }
+  });
+  return DBSHARINGListFolderMembers;
 }
 
-+ (DBRoute *)DBSHARINGListFileMembersContinue {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListFileMembersContinue) {
-      DBSHARINGListFileMembersContinue = [[DBRoute alloc] init:@"list_file_members/continue"
++ (DBRoute *)DBSHARINGListFolderMembersContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListFolderMembersContinue = [[DBRoute alloc] init:@"list_folder_members/continue"
                                                     namespace_:@"sharing"
                                                     deprecated:@NO
-                                                    resultType:[DBSHARINGSharedFileMembers class]
-                                                     errorType:[DBSHARINGListFileMembersContinueError class]
+                                                    resultType:[DBSHARINGSharedFolderMembers class]
+                                                     errorType:[DBSHARINGListFolderMembersContinueError class]
                                                          attrs:@{
                                                            @"auth" : @"user",
                                                            @"host" : @"api",
@@ -482,19 +497,37 @@ static NSObject *lockObj = nil;
                                                          }
                                          dataStructSerialBlock:nil
                                        dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListFileMembersContinue;
-  }
+  });
+  return DBSHARINGListFolderMembersContinue;
 }
 
-+ (DBRoute *)DBSHARINGListFolderMembers {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListFolderMembers) {
-      DBSHARINGListFolderMembers = [[DBRoute alloc] init:@"list_folder_members"
++ (DBRoute *)DBSHARINGListFolders {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListFolders = [[DBRoute alloc] init:@"list_folders"
+                                      namespace_:@"sharing"
+                                      deprecated:@NO
+                                      resultType:[DBSHARINGListFoldersResult class]
+                                       errorType:nil
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGListFolders;
+}
+
++ (DBRoute *)DBSHARINGListFoldersContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListFoldersContinue = [[DBRoute alloc] init:@"list_folders/continue"
                                               namespace_:@"sharing"
                                               deprecated:@NO
-                                              resultType:[DBSHARINGSharedFolderMembers class]
-                                               errorType:[DBSHARINGSharedFolderAccessError class]
+                                              resultType:[DBSHARINGListFoldersResult class]
+                                               errorType:[DBSHARINGListFoldersContinueError class]
                                                    attrs:@{
                                                      @"auth" : @"user",
                                                      @"host" : @"api",
@@ -502,159 +535,56 @@ static NSObject *lockObj = nil;
                                                    }
                                    dataStructSerialBlock:nil
                                  dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListFolderMembers;
-  }
-}
-
-+ (DBRoute *)DBSHARINGListFolderMembersContinue {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListFolderMembersContinue) {
-      DBSHARINGListFolderMembersContinue = [[DBRoute alloc] init:@"list_folder_members/continue"
-                                                      namespace_:@"sharing"
-                                                      deprecated:@NO
-                                                      resultType:[DBSHARINGSharedFolderMembers class]
-                                                       errorType:[DBSHARINGListFolderMembersContinueError class]
-                                                           attrs:@{
-                                                             @"auth" : @"user",
-                                                             @"host" : @"api",
-                                                             @"style" : @"rpc"
-                                                           }
-                                           dataStructSerialBlock:nil
-                                         dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListFolderMembersContinue;
-  }
+  });
+  return DBSHARINGListFoldersContinue;
 }
 
-+ (DBRoute *)DBSHARINGListFolders {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListFolders) {
-      DBSHARINGListFolders = [[DBRoute alloc] init:@"list_folders"
-                                        namespace_:@"sharing"
-                                        deprecated:@NO
-                                        resultType:[DBSHARINGListFoldersResult class]
-                                         errorType:nil
-                                             attrs:@{
-                                               @"auth" : @"user",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListFolders;
-  }
-}
-
-+ (DBRoute *)DBSHARINGListFoldersContinue {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListFoldersContinue) {
-      DBSHARINGListFoldersContinue = [[DBRoute alloc] init:@"list_folders/continue"
-                                                namespace_:@"sharing"
-                                                deprecated:@NO
-                                                resultType:[DBSHARINGListFoldersResult class]
-                                                 errorType:[DBSHARINGListFoldersContinueError class]
-                                                     attrs:@{
-                                                       @"auth" : @"user",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListFoldersContinue;
-  }
-}
-
-+ (DBRoute *)DBSHARINGListMountableFolders {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListMountableFolders) {
-      DBSHARINGListMountableFolders = [[DBRoute alloc] init:@"list_mountable_folders"
-                                                 namespace_:@"sharing"
-                                                 deprecated:@NO
-                                                 resultType:[DBSHARINGListFoldersResult class]
-                                                  errorType:nil
-                                                      attrs:@{
-                                                        @"auth" : @"user",
-                                                        @"host" : @"api",
-                                                        @"style" : @"rpc"
-                                                      }
-                                      dataStructSerialBlock:nil
-                                    dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListMountableFolders;
-  }
++ (DBRoute *)DBSHARINGListMountableFolders {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListMountableFolders = [[DBRoute alloc] init:@"list_mountable_folders"
+                                               namespace_:@"sharing"
+                                               deprecated:@NO
+                                               resultType:[DBSHARINGListFoldersResult class]
+                                                errorType:nil
+                                                    attrs:@{
+                                                      @"auth" : @"user",
+                                                      @"host" : @"api",
+                                                      @"style" : @"rpc"
+                                                    }
+                                    dataStructSerialBlock:nil
+                                  dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGListMountableFolders;
 }
 
 + (DBRoute *)DBSHARINGListMountableFoldersContinue {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListMountableFoldersContinue) {
-      DBSHARINGListMountableFoldersContinue = [[DBRoute alloc] init:@"list_mountable_folders/continue"
-                                                         namespace_:@"sharing"
-                                                         deprecated:@NO
-                                                         resultType:[DBSHARINGListFoldersResult class]
-                                                          errorType:[DBSHARINGListFoldersContinueError class]
-                                                              attrs:@{
-                                                                @"auth" : @"user",
-                                                                @"host" : @"api",
-                                                                @"style" : @"rpc"
-                                                              }
-                                              dataStructSerialBlock:nil
-                                            dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListMountableFoldersContinue;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListMountableFoldersContinue = [[DBRoute alloc] init:@"list_mountable_folders/continue"
+                                                       namespace_:@"sharing"
+                                                       deprecated:@NO
+                                                       resultType:[DBSHARINGListFoldersResult class]
+                                                        errorType:[DBSHARINGListFoldersContinueError class]
+                                                            attrs:@{
+                                                              @"auth" : @"user",
+                                                              @"host" : @"api",
+                                                              @"style" : @"rpc"
+                                                            }
+                                            dataStructSerialBlock:nil
+                                          dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGListMountableFoldersContinue;
 }
 
 + (DBRoute *)DBSHARINGListReceivedFiles {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListReceivedFiles) {
-      DBSHARINGListReceivedFiles = [[DBRoute alloc] init:@"list_received_files"
-                                              namespace_:@"sharing"
-                                              deprecated:@NO
-                                              resultType:[DBSHARINGListFilesResult class]
-                                               errorType:[DBSHARINGSharingUserError class]
-                                                   attrs:@{
-                                                     @"auth" : @"user",
-                                                     @"host" : @"api",
-                                                     @"style" : @"rpc"
-                                                   }
-                                   dataStructSerialBlock:nil
-                                 dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListReceivedFiles;
-  }
-}
-
-+ (DBRoute *)DBSHARINGListReceivedFilesContinue {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListReceivedFilesContinue) {
-      DBSHARINGListReceivedFilesContinue = [[DBRoute alloc] init:@"list_received_files/continue"
-                                                      namespace_:@"sharing"
-                                                      deprecated:@NO
-                                                      resultType:[DBSHARINGListFilesResult class]
-                                                       errorType:[DBSHARINGListFilesContinueError class]
-                                                           attrs:@{
-                                                             @"auth" : @"user",
-                                                             @"host" : @"api",
-                                                             @"style" : @"rpc"
-                                                           }
-                                           dataStructSerialBlock:nil
-                                         dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListReceivedFilesContinue;
-  }
-}
-
-+ (DBRoute *)DBSHARINGListSharedLinks {
-  @synchronized(lockObj) {
-    if (!DBSHARINGListSharedLinks) {
-      DBSHARINGListSharedLinks = [[DBRoute alloc] init:@"list_shared_links"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListReceivedFiles = [[DBRoute alloc] init:@"list_received_files"
                                             namespace_:@"sharing"
                                             deprecated:@NO
-                                            resultType:[DBSHARINGListSharedLinksResult class]
-                                             errorType:[DBSHARINGListSharedLinksError class]
+                                            resultType:[DBSHARINGListFilesResult class]
+                                             errorType:[DBSHARINGSharingUserError class]
                                                  attrs:@{
                                                    @"auth" : @"user",
                                                    @"host" : @"api",
@@ -662,59 +592,113 @@ static NSObject *lockObj = nil;
                                                  }
                                  dataStructSerialBlock:nil
                                dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGListSharedLinks;
-  }
+  });
+  return DBSHARINGListReceivedFiles;
+}
+
++ (DBRoute *)DBSHARINGListReceivedFilesContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListReceivedFilesContinue = [[DBRoute alloc] init:@"list_received_files/continue"
+                                                    namespace_:@"sharing"
+                                                    deprecated:@NO
+                                                    resultType:[DBSHARINGListFilesResult class]
+                                                     errorType:[DBSHARINGListFilesContinueError class]
+                                                         attrs:@{
+                                                           @"auth" : @"user",
+                                                           @"host" : @"api",
+                                                           @"style" : @"rpc"
+                                                         }
+                                         dataStructSerialBlock:nil
+                                       dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGListReceivedFilesContinue;
+}
+
++ (DBRoute *)DBSHARINGListSharedLinks {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGListSharedLinks = [[DBRoute alloc] init:@"list_shared_links"
+                                          namespace_:@"sharing"
+                                          deprecated:@NO
+                                          resultType:[DBSHARINGListSharedLinksResult class]
+                                           errorType:[DBSHARINGListSharedLinksError class]
+                                               attrs:@{
+                                                 @"auth" : @"user",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGListSharedLinks;
 }
 
 + (DBRoute *)DBSHARINGModifySharedLinkSettings {
-  @synchronized(lockObj) {
-    if (!DBSHARINGModifySharedLinkSettings) {
-      DBSHARINGModifySharedLinkSettings = [[DBRoute alloc] init:@"modify_shared_link_settings"
-                                                     namespace_:@"sharing"
-                                                     deprecated:@NO
-                                                     resultType:[DBSHARINGSharedLinkMetadata class]
-                                                      errorType:[DBSHARINGModifySharedLinkSettingsError class]
-                                                          attrs:@{
-                                                            @"auth" : @"user",
-                                                            @"host" : @"api",
-                                                            @"style" : @"rpc"
-                                                          }
-                                          dataStructSerialBlock:nil
-                                        dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGModifySharedLinkSettings;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGModifySharedLinkSettings = [[DBRoute alloc] init:@"modify_shared_link_settings"
+                                                   namespace_:@"sharing"
+                                                   deprecated:@NO
+                                                   resultType:[DBSHARINGSharedLinkMetadata class]
+                                                    errorType:[DBSHARINGModifySharedLinkSettingsError class]
+                                                        attrs:@{
+                                                          @"auth" : @"user",
+                                                          @"host" : @"api",
+                                                          @"style" : @"rpc"
+                                                        }
+                                        dataStructSerialBlock:nil
+                                      dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGModifySharedLinkSettings;
 }
 
 + (DBRoute *)DBSHARINGMountFolder {
-  @synchronized(lockObj) {
-    if (!DBSHARINGMountFolder) {
-      DBSHARINGMountFolder = [[DBRoute alloc] init:@"mount_folder"
-                                        namespace_:@"sharing"
-                                        deprecated:@NO
-                                        resultType:[DBSHARINGSharedFolderMetadata class]
-                                         errorType:[DBSHARINGMountFolderError class]
-                                             attrs:@{
-                                               @"auth" : @"user",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGMountFolder;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGMountFolder = [[DBRoute alloc] init:@"mount_folder"
+                                      namespace_:@"sharing"
+                                      deprecated:@NO
+                                      resultType:[DBSHARINGSharedFolderMetadata class]
+                                       errorType:[DBSHARINGMountFolderError class]
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGMountFolder;
 }
 
 + (DBRoute *)DBSHARINGRelinquishFileMembership {
-  @synchronized(lockObj) {
-    if (!DBSHARINGRelinquishFileMembership) {
-      DBSHARINGRelinquishFileMembership = [[DBRoute alloc] init:@"relinquish_file_membership"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGRelinquishFileMembership = [[DBRoute alloc] init:@"relinquish_file_membership"
+                                                   namespace_:@"sharing"
+                                                   deprecated:@NO
+                                                   resultType:nil
+                                                    errorType:[DBSHARINGRelinquishFileMembershipError class]
+                                                        attrs:@{
+                                                          @"auth" : @"user",
+                                                          @"host" : @"api",
+                                                          @"style" : @"rpc"
+                                                        }
+                                        dataStructSerialBlock:nil
+                                      dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGRelinquishFileMembership;
+}
+
++ (DBRoute *)DBSHARINGRelinquishFolderMembership {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGRelinquishFolderMembership = [[DBRoute alloc] init:@"relinquish_folder_membership"
                                                      namespace_:@"sharing"
                                                      deprecated:@NO
-                                                     resultType:nil
-                                                      errorType:[DBSHARINGRelinquishFileMembershipError class]
+                                                     resultType:[DBASYNCLaunchEmptyResult class]
+                                                      errorType:[DBSHARINGRelinquishFolderMembershipError class]
                                                           attrs:@{
                                                             @"auth" : @"user",
                                                             @"host" : @"api",
@@ -722,39 +706,56 @@ static NSObject *lockObj = nil;
                                                           }
                                           dataStructSerialBlock:nil
                                         dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGRelinquishFileMembership;
-  }
+  });
+  return DBSHARINGRelinquishFolderMembership;
 }
 
-+ (DBRoute *)DBSHARINGRelinquishFolderMembership {
-  @synchronized(lockObj) {
-    if (!DBSHARINGRelinquishFolderMembership) {
-      DBSHARINGRelinquishFolderMembership = [[DBRoute alloc] init:@"relinquish_folder_membership"
-                                                       namespace_:@"sharing"
-                                                       deprecated:@NO
-                                                       resultType:[DBASYNCLaunchEmptyResult class]
-                                                        errorType:[DBSHARINGRelinquishFolderMembershipError class]
-                                                            attrs:@{
-                                                              @"auth" : @"user",
-                                                              @"host" : @"api",
-                                                              @"style" : @"rpc"
-                                                            }
-                                            dataStructSerialBlock:nil
-                                          dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGRelinquishFolderMembership;
-  }
++ (DBRoute *)DBSHARINGRemoveFileMember {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGRemoveFileMember = [[DBRoute alloc] init:@"remove_file_member"
+                                           namespace_:@"sharing"
+                                           deprecated:@YES
+                                           resultType:[DBSHARINGFileMemberActionIndividualResult class]
+                                            errorType:[DBSHARINGRemoveFileMemberError class]
+                                                attrs:@{
+                                                  @"auth" : @"user",
+                                                  @"host" : @"api",
+                                                  @"style" : @"rpc"
+                                                }
+                                dataStructSerialBlock:nil
+                              dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGRemoveFileMember;
 }
 
-+ (DBRoute *)DBSHARINGRemoveFileMember {
-  @synchronized(lockObj) {
-    if (!DBSHARINGRemoveFileMember) {
-      DBSHARINGRemoveFileMember = [[DBRoute alloc] init:@"remove_file_member"
++ (DBRoute *)DBSHARINGRemoveFileMember2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGRemoveFileMember2 = [[DBRoute alloc] init:@"remove_file_member_2"
+                                            namespace_:@"sharing"
+                                            deprecated:@NO
+                                            resultType:[DBSHARINGFileMemberRemoveActionResult class]
+                                             errorType:[DBSHARINGRemoveFileMemberError class]
+                                                 attrs:@{
+                                                   @"auth" : @"user",
+                                                   @"host" : @"api",
+                                                   @"style" : @"rpc"
+                                                 }
+                                 dataStructSerialBlock:nil
+                               dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGRemoveFileMember2;
+}
+
++ (DBRoute *)DBSHARINGRemoveFolderMember {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGRemoveFolderMember = [[DBRoute alloc] init:@"remove_folder_member"
                                              namespace_:@"sharing"
-                                             deprecated:@YES
-                                             resultType:[DBSHARINGFileMemberActionIndividualResult class]
-                                              errorType:[DBSHARINGRemoveFileMemberError class]
+                                             deprecated:@NO
+                                             resultType:[DBASYNCLaunchResultBase class]
+                                              errorType:[DBSHARINGRemoveFolderMemberError class]
                                                   attrs:@{
                                                     @"auth" : @"user",
                                                     @"host" : @"api",
@@ -762,39 +763,37 @@ static NSObject *lockObj = nil;
                                                   }
                                   dataStructSerialBlock:nil
                                 dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGRemoveFileMember;
-  }
+  });
+  return DBSHARINGRemoveFolderMember;
 }
 
-+ (DBRoute *)DBSHARINGRemoveFileMember2 {
-  @synchronized(lockObj) {
-    if (!DBSHARINGRemoveFileMember2) {
-      DBSHARINGRemoveFileMember2 = [[DBRoute alloc] init:@"remove_file_member_2"
-                                              namespace_:@"sharing"
-                                              deprecated:@NO
-                                              resultType:[DBSHARINGFileMemberRemoveActionResult class]
-                                               errorType:[DBSHARINGRemoveFileMemberError class]
-                                                   attrs:@{
-                                                     @"auth" : @"user",
-                                                     @"host" : @"api",
-                                                     @"style" : @"rpc"
-                                                   }
-                                   dataStructSerialBlock:nil
-                                 dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGRemoveFileMember2;
-  }
++ (DBRoute *)DBSHARINGRevokeSharedLink {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGRevokeSharedLink = [[DBRoute alloc] init:@"revoke_shared_link"
+                                           namespace_:@"sharing"
+                                           deprecated:@NO
+                                           resultType:nil
+                                            errorType:[DBSHARINGRevokeSharedLinkError class]
+                                                attrs:@{
+                                                  @"auth" : @"user",
+                                                  @"host" : @"api",
+                                                  @"style" : @"rpc"
+                                                }
+                                dataStructSerialBlock:nil
+                              dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGRevokeSharedLink;
 }
 
-+ (DBRoute *)DBSHARINGRemoveFolderMember {
-  @synchronized(lockObj) {
-    if (!DBSHARINGRemoveFolderMember) {
-      DBSHARINGRemoveFolderMember = [[DBRoute alloc] init:@"remove_folder_member"
++ (DBRoute *)DBSHARINGSetAccessInheritance {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGSetAccessInheritance = [[DBRoute alloc] init:@"set_access_inheritance"
                                                namespace_:@"sharing"
                                                deprecated:@NO
-                                               resultType:[DBASYNCLaunchResultBase class]
-                                                errorType:[DBSHARINGRemoveFolderMemberError class]
+                                               resultType:[DBSHARINGShareFolderLaunch class]
+                                                errorType:[DBSHARINGSetAccessInheritanceError class]
                                                     attrs:@{
                                                       @"auth" : @"user",
                                                       @"host" : @"api",
@@ -802,59 +801,56 @@ static NSObject *lockObj = nil;
                                                     }
                                     dataStructSerialBlock:nil
                                   dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGRemoveFolderMember;
-  }
+  });
+  return DBSHARINGSetAccessInheritance;
 }
 
-+ (DBRoute *)DBSHARINGRevokeSharedLink {
-  @synchronized(lockObj) {
-    if (!DBSHARINGRevokeSharedLink) {
-      DBSHARINGRevokeSharedLink = [[DBRoute alloc] init:@"revoke_shared_link"
-                                             namespace_:@"sharing"
-                                             deprecated:@NO
-                                             resultType:nil
-                                              errorType:[DBSHARINGRevokeSharedLinkError class]
-                                                  attrs:@{
-                                                    @"auth" : @"user",
-                                                    @"host" : @"api",
-                                                    @"style" : @"rpc"
-                                                  }
-                                  dataStructSerialBlock:nil
-                                dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGRevokeSharedLink;
-  }
++ (DBRoute *)DBSHARINGShareFolder {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGShareFolder = [[DBRoute alloc] init:@"share_folder"
+                                      namespace_:@"sharing"
+                                      deprecated:@NO
+                                      resultType:[DBSHARINGShareFolderLaunch class]
+                                       errorType:[DBSHARINGShareFolderError class]
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGShareFolder;
 }
 
-+ (DBRoute *)DBSHARINGSetAccessInheritance {
-  @synchronized(lockObj) {
-    if (!DBSHARINGSetAccessInheritance) {
-      DBSHARINGSetAccessInheritance = [[DBRoute alloc] init:@"set_access_inheritance"
-                                                 namespace_:@"sharing"
-                                                 deprecated:@NO
-                                                 resultType:[DBSHARINGShareFolderLaunch class]
-                                                  errorType:[DBSHARINGSetAccessInheritanceError class]
-                                                      attrs:@{
-                                                        @"auth" : @"user",
-                                                        @"host" : @"api",
-                                                        @"style" : @"rpc"
-                                                      }
-                                      dataStructSerialBlock:nil
-                                    dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGSetAccessInheritance;
-  }
++ (DBRoute *)DBSHARINGTransferFolder {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGTransferFolder = [[DBRoute alloc] init:@"transfer_folder"
+                                         namespace_:@"sharing"
+                                         deprecated:@NO
+                                         resultType:nil
+                                          errorType:[DBSHARINGTransferFolderError class]
+                                              attrs:@{
+                                                @"auth" : @"user",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGTransferFolder;
 }
 
-+ (DBRoute *)DBSHARINGShareFolder {
-  @synchronized(lockObj) {
-    if (!DBSHARINGShareFolder) {
-      DBSHARINGShareFolder = [[DBRoute alloc] init:@"share_folder"
++ (DBRoute *)DBSHARINGUnmountFolder {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGUnmountFolder = [[DBRoute alloc] init:@"unmount_folder"
                                         namespace_:@"sharing"
                                         deprecated:@NO
-                                        resultType:[DBSHARINGShareFolderLaunch class]
-                                         errorType:[DBSHARINGShareFolderError class]
+                                        resultType:nil
+                                         errorType:[DBSHARINGUnmountFolderError class]
                                              attrs:@{
                                                @"auth" : @"user",
                                                @"host" : @"api",
@@ -862,59 +858,37 @@ static NSObject *lockObj = nil;
                                              }
                              dataStructSerialBlock:nil
                            dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGShareFolder;
-  }
-}
-
-+ (DBRoute *)DBSHARINGTransferFolder {
-  @synchronized(lockObj) {
-    if (!DBSHARINGTransferFolder) {
-      DBSHARINGTransferFolder = [[DBRoute alloc] init:@"transfer_folder"
-                                           namespace_:@"sharing"
-                                           deprecated:@NO
-                                           resultType:nil
-                                            errorType:[DBSHARINGTransferFolderError class]
-                                                attrs:@{
-                                                  @"auth" : @"user",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGTransferFolder;
-  }
+  });
+  return DBSHARINGUnmountFolder;
 }
 
-+ (DBRoute *)DBSHARINGUnmountFolder {
-  @synchronized(lockObj) {
-    if (!DBSHARINGUnmountFolder) {
-      DBSHARINGUnmountFolder = [[DBRoute alloc] init:@"unmount_folder"
-                                          namespace_:@"sharing"
-                                          deprecated:@NO
-                                          resultType:nil
-                                           errorType:[DBSHARINGUnmountFolderError class]
-                                               attrs:@{
-                                                 @"auth" : @"user",
-                                                 @"host" : @"api",
-                                                 @"style" : @"rpc"
-                                               }
-                               dataStructSerialBlock:nil
-                             dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGUnmountFolder;
-  }
++ (DBRoute *)DBSHARINGUnshareFile {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGUnshareFile = [[DBRoute alloc] init:@"unshare_file"
+                                      namespace_:@"sharing"
+                                      deprecated:@NO
+                                      resultType:nil
+                                       errorType:[DBSHARINGUnshareFileError class]
+                                           attrs:@{
+                                             @"auth" : @"user",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGUnshareFile;
 }
 
-+ (DBRoute *)DBSHARINGUnshareFile {
-  @synchronized(lockObj) {
-    if (!DBSHARINGUnshareFile) {
-      DBSHARINGUnshareFile = [[DBRoute alloc] init:@"unshare_file"
++ (DBRoute *)DBSHARINGUnshareFolder {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGUnshareFolder = [[DBRoute alloc] init:@"unshare_folder"
                                         namespace_:@"sharing"
                                         deprecated:@NO
-                                        resultType:nil
-                                         errorType:[DBSHARINGUnshareFileError class]
+                                        resultType:[DBASYNCLaunchEmptyResult class]
+                                         errorType:[DBSHARINGUnshareFolderError class]
                                              attrs:@{
                                                @"auth" : @"user",
                                                @"host" : @"api",
@@ -922,39 +896,37 @@ static NSObject *lockObj = nil;
                                              }
                              dataStructSerialBlock:nil
                            dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGUnshareFile;
-  }
+  });
+  return DBSHARINGUnshareFolder;
 }
 
-+ (DBRoute *)DBSHARINGUnshareFolder {
-  @synchronized(lockObj) {
-    if (!DBSHARINGUnshareFolder) {
-      DBSHARINGUnshareFolder = [[DBRoute alloc] init:@"unshare_folder"
-                                          namespace_:@"sharing"
-                                          deprecated:@NO
-                                          resultType:[DBASYNCLaunchEmptyResult class]
-                                           errorType:[DBSHARINGUnshareFolderError class]
-                                               attrs:@{
-                                                 @"auth" : @"user",
-                                                 @"host" : @"api",
-                                                 @"style" : @"rpc"
-                                               }
-                               dataStructSerialBlock:nil
-                             dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGUnshareFolder;
-  }
++ (DBRoute *)DBSHARINGUpdateFileMember {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGUpdateFileMember = [[DBRoute alloc] init:@"update_file_member"
+                                           namespace_:@"sharing"
+                                           deprecated:@NO
+                                           resultType:[DBSHARINGMemberAccessLevelResult class]
+                                            errorType:[DBSHARINGFileMemberActionError class]
+                                                attrs:@{
+                                                  @"auth" : @"user",
+                                                  @"host" : @"api",
+                                                  @"style" : @"rpc"
+                                                }
+                                dataStructSerialBlock:nil
+                              dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGUpdateFileMember;
 }
 
-+ (DBRoute *)DBSHARINGUpdateFileMember {
-  @synchronized(lockObj) {
-    if (!DBSHARINGUpdateFileMember) {
-      DBSHARINGUpdateFileMember = [[DBRoute alloc] init:@"update_file_member"
++ (DBRoute *)DBSHARINGUpdateFolderMember {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGUpdateFolderMember = [[DBRoute alloc] init:@"update_folder_member"
                                              namespace_:@"sharing"
                                              deprecated:@NO
                                              resultType:[DBSHARINGMemberAccessLevelResult class]
-                                              errorType:[DBSHARINGFileMemberActionError class]
+                                              errorType:[DBSHARINGUpdateFolderMemberError class]
                                                   attrs:@{
                                                     @"auth" : @"user",
                                                     @"host" : @"api",
@@ -962,49 +934,27 @@ static NSObject *lockObj = nil;
                                                   }
                                   dataStructSerialBlock:nil
                                 dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGUpdateFileMember;
-  }
-}
-
-+ (DBRoute *)DBSHARINGUpdateFolderMember {
-  @synchronized(lockObj) {
-    if (!DBSHARINGUpdateFolderMember) {
-      DBSHARINGUpdateFolderMember = [[DBRoute alloc] init:@"update_folder_member"
-                                               namespace_:@"sharing"
-                                               deprecated:@NO
-                                               resultType:[DBSHARINGMemberAccessLevelResult class]
-                                                errorType:[DBSHARINGUpdateFolderMemberError class]
-                                                    attrs:@{
-                                                      @"auth" : @"user",
-                                                      @"host" : @"api",
-                                                      @"style" : @"rpc"
-                                                    }
-                                    dataStructSerialBlock:nil
-                                  dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGUpdateFolderMember;
-  }
+  });
+  return DBSHARINGUpdateFolderMember;
 }
 
 + (DBRoute *)DBSHARINGUpdateFolderPolicy {
-  @synchronized(lockObj) {
-    if (!DBSHARINGUpdateFolderPolicy) {
-      DBSHARINGUpdateFolderPolicy = [[DBRoute alloc] init:@"update_folder_policy"
-                                               namespace_:@"sharing"
-                                               deprecated:@NO
-                                               resultType:[DBSHARINGSharedFolderMetadata class]
-                                                errorType:[DBSHARINGUpdateFolderPolicyError class]
-                                                    attrs:@{
-                                                      @"auth" : @"user",
-                                                      @"host" : @"api",
-                                                      @"style" : @"rpc"
-                                                    }
-                                    dataStructSerialBlock:nil
-                                  dataStructDeserialBlock:nil];
-    }
-    return DBSHARINGUpdateFolderPolicy;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBSHARINGUpdateFolderPolicy = [[DBRoute alloc] init:@"update_folder_policy"
+                                             namespace_:@"sharing"
+                                             deprecated:@NO
+                                             resultType:[DBSHARINGSharedFolderMetadata class]
+                                              errorType:[DBSHARINGUpdateFolderPolicyError class]
+                                                  attrs:@{
+                                                    @"auth" : @"user",
+                                                    @"host" : @"api",
+                                                    @"style" : @"rpc"
+                                                  }
+                                  dataStructSerialBlock:nil
+                                dataStructDeserialBlock:nil];
+  });
+  return DBSHARINGUpdateFolderPolicy;
 }
 
 @end
@@ -18,52 +18,42 @@
 static DBRoute *DBTEAMLOGGetEvents;
 static DBRoute *DBTEAMLOGGetEventsContinue;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBTEAMLOGGetEvents {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBTEAMLOGGetEvents = [[DBRoute alloc] init:@"get_events"
+                                    namespace_:@"team_log"
+                                    deprecated:@NO
+                                    resultType:[DBTEAMLOGGetTeamEventsResult class]
+                                     errorType:[DBTEAMLOGGetTeamEventsError class]
+                                         attrs:@{
+                                           @"auth" : @"team",
+                                           @"host" : @"api",
+                                           @"style" : @"rpc"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
   });
-}
-
-+ (DBRoute *)DBTEAMLOGGetEvents {
-  @synchronized(lockObj) {
-    if (!DBTEAMLOGGetEvents) {
-      DBTEAMLOGGetEvents = [[DBRoute alloc] init:@"get_events"
-                                      namespace_:@"team_log"
-                                      deprecated:@NO
-                                      resultType:[DBTEAMLOGGetTeamEventsResult class]
-                                       errorType:[DBTEAMLOGGetTeamEventsError class]
-                                           attrs:@{
-                                             @"auth" : @"team",
-                                             @"host" : @"api",
-                                             @"style" : @"rpc"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLOGGetEvents;
-  }
+  return DBTEAMLOGGetEvents;
 }
 
 + (DBRoute *)DBTEAMLOGGetEventsContinue {
-  @synchronized(lockObj) {
-    if (!DBTEAMLOGGetEventsContinue) {
-      DBTEAMLOGGetEventsContinue = [[DBRoute alloc] init:@"get_events/continue"
-                                              namespace_:@"team_log"
-                                              deprecated:@NO
-                                              resultType:[DBTEAMLOGGetTeamEventsResult class]
-                                               errorType:[DBTEAMLOGGetTeamEventsContinueError class]
-                                                   attrs:@{
-                                                     @"auth" : @"team",
-                                                     @"host" : @"api",
-                                                     @"style" : @"rpc"
-                                                   }
-                                   dataStructSerialBlock:nil
-                                 dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLOGGetEventsContinue;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLOGGetEventsContinue = [[DBRoute alloc] init:@"get_events/continue"
+                                            namespace_:@"team_log"
+                                            deprecated:@NO
+                                            resultType:[DBTEAMLOGGetTeamEventsResult class]
+                                             errorType:[DBTEAMLOGGetTeamEventsContinueError class]
+                                                 attrs:@{
+                                                   @"auth" : @"team",
+                                                   @"host" : @"api",
+                                                   @"style" : @"rpc"
+                                                 }
+                                 dataStructSerialBlock:nil
+                               dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLOGGetEventsContinue;
 }
 
 @end
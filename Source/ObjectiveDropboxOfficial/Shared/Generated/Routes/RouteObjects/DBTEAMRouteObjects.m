@@ -275,22 +275,71 @@ static DBRoute *DBTEAMTeamFolderRename;
 static DBRoute *DBTEAMTeamFolderUpdateSyncSettings;
 static DBRoute *DBTEAMTokenGetAuthenticatedAdmin;
 
-static NSObject *lockObj = nil;
-+ (void)initialize {
++ (DBRoute *)DBTEAMDevicesListMemberDevices {
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    lockObj = [[NSObject alloc] init];
+    DBTEAMDevicesListMemberDevices = [[DBRoute alloc] init:@"devices/list_member_devices"
+                                                namespace_:@"team"
+                                                deprecated:@NO
+                                                resultType:[DBTEAMListMemberDevicesResult class]
+                                                 errorType:[DBTEAMListMemberDevicesError class]
+                                                     attrs:@{
+                                                       @"auth" : @"team",
+                                                       @"host" : @"api",
+                                                       @"style" : @"rpc"
+                                                     }
+                                     dataStructSerialBlock:nil
+                                   dataStructDeserialBlock:nil];
   });
+  return DBTEAMDevicesListMemberDevices;
 }
 
-+ (DBRoute *)DBTEAMDevicesListMemberDevices {
-  @synchronized(lockObj) {
-    if (!DBTEAMDevicesListMemberDevices) {
-      DBTEAMDevicesListMemberDevices = [[DBRoute alloc] init:@"devices/list_member_devices"
++ (DBRoute *)DBTEAMDevicesListMembersDevices {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMDevicesListMembersDevices = [[DBRoute alloc] init:@"devices/list_members_devices"
+                                                 namespace_:@"team"
+                                                 deprecated:@NO
+                                                 resultType:[DBTEAMListMembersDevicesResult class]
+                                                  errorType:[DBTEAMListMembersDevicesError class]
+                                                      attrs:@{
+                                                        @"auth" : @"team",
+                                                        @"host" : @"api",
+                                                        @"style" : @"rpc"
+                                                      }
+                                      dataStructSerialBlock:nil
+                                    dataStructDeserialBlock:nil];
+  });
+  return DBTEAMDevicesListMembersDevices;
+}
+
++ (DBRoute *)DBTEAMDevicesListTeamDevices {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMDevicesListTeamDevices = [[DBRoute alloc] init:@"devices/list_team_devices"
+                                              namespace_:@"team"
+                                              deprecated:@YES
+                                              resultType:[DBTEAMListTeamDevicesResult class]
+                                               errorType:[DBTEAMListTeamDevicesError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMDevicesListTeamDevices;
+}
+
++ (DBRoute *)DBTEAMDevicesRevokeDeviceSession {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMDevicesRevokeDeviceSession = [[DBRoute alloc] init:@"devices/revoke_device_session"
                                                   namespace_:@"team"
                                                   deprecated:@NO
-                                                  resultType:[DBTEAMListMemberDevicesResult class]
-                                                   errorType:[DBTEAMListMemberDevicesError class]
+                                                  resultType:nil
+                                                   errorType:[DBTEAMRevokeDeviceSessionError class]
                                                        attrs:@{
                                                          @"auth" : @"team",
                                                          @"host" : @"api",
@@ -298,224 +347,94 @@ static NSObject *lockObj = nil;
                                                        }
                                        dataStructSerialBlock:nil
                                      dataStructDeserialBlock:nil];
-    }
-    return DBTEAMDevicesListMemberDevices;
-  }
-}
-
-+ (DBRoute *)DBTEAMDevicesListMembersDevices {
-  @synchronized(lockObj) {
-    if (!DBTEAMDevicesListMembersDevices) {
-      DBTEAMDevicesListMembersDevices = [[DBRoute alloc] init:@"devices/list_members_devices"
-                                                   namespace_:@"team"
-                                                   deprecated:@NO
-                                                   resultType:[DBTEAMListMembersDevicesResult class]
-                                                    errorType:[DBTEAMListMembersDevicesError class]
-                                                        attrs:@{
-                                                          @"auth" : @"team",
-                                                          @"host" : @"api",
-                                                          @"style" : @"rpc"
-                                                        }
-                                        dataStructSerialBlock:nil
-                                      dataStructDeserialBlock:nil];
-    }
-    return DBTEAMDevicesListMembersDevices;
-  }
-}
-
-+ (DBRoute *)DBTEAMDevicesListTeamDevices {
-  @synchronized(lockObj) {
-    if (!DBTEAMDevicesListTeamDevices) {
-      DBTEAMDevicesListTeamDevices = [[DBRoute alloc] init:@"devices/list_team_devices"
-                                                namespace_:@"team"
-                                                deprecated:@YES
-                                                resultType:[DBTEAMListTeamDevicesResult class]
-                                                 errorType:[DBTEAMListTeamDevicesError class]
-                                                     attrs:@{
-                                                       @"auth" : @"team",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBTEAMDevicesListTeamDevices;
-  }
-}
-
-+ (DBRoute *)DBTEAMDevicesRevokeDeviceSession {
-  @synchronized(lockObj) {
-    if (!DBTEAMDevicesRevokeDeviceSession) {
-      DBTEAMDevicesRevokeDeviceSession = [[DBRoute alloc] init:@"devices/revoke_device_session"
-                                                    namespace_:@"team"
-                                                    deprecated:@NO
-                                                    resultType:nil
-                                                     errorType:[DBTEAMRevokeDeviceSessionError class]
-                                                         attrs:@{
-                                                           @"auth" : @"team",
-                                                           @"host" : @"api",
-                                                           @"style" : @"rpc"
-                                                         }
-                                         dataStructSerialBlock:nil
-                                       dataStructDeserialBlock:nil];
-    }
-    return DBTEAMDevicesRevokeDeviceSession;
-  }
+  });
+  return DBTEAMDevicesRevokeDeviceSession;
 }
 
 + (DBRoute *)DBTEAMDevicesRevokeDeviceSessionBatch {
-  @synchronized(lockObj) {
-    if (!DBTEAMDevicesRevokeDeviceSessionBatch) {
-      DBTEAMDevicesRevokeDeviceSessionBatch = [[DBRoute alloc] init:@"devices/revoke_device_session_batch"
-                                                         namespace_:@"team"
-                                                         deprecated:@NO
-                                                         resultType:[DBTEAMRevokeDeviceSessionBatchResult class]
-                                                          errorType:[DBTEAMRevokeDeviceSessionBatchError class]
-                                                              attrs:@{
-                                                                @"auth" : @"team",
-                                                                @"host" : @"api",
-                                                                @"style" : @"rpc"
-                                                              }
-                                              dataStructSerialBlock:nil
-                                            dataStructDeserialBlock:nil];
-    }
-    return DBTEAMDevicesRevokeDeviceSessionBatch;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMDevicesRevokeDeviceSessionBatch = [[DBRoute alloc] init:@"devices/revoke_device_session_batch"
+                                                       namespace_:@"team"
+                                                       deprecated:@NO
+                                                       resultType:[DBTEAMRevokeDeviceSessionBatchResult class]
+                                                        errorType:[DBTEAMRevokeDeviceSessionBatchError class]
+                                                            attrs:@{
+                                                              @"auth" : @"team",
+                                                              @"host" : @"api",
+                                                              @"style" : @"rpc"
+                                                            }
+                                            dataStructSerialBlock:nil
+                                          dataStructDeserialBlock:nil];
+  });
+  return DBTEAMDevicesRevokeDeviceSessionBatch;
 }
 
 + (DBRoute *)DBTEAMFeaturesGetValues {
-  @synchronized(lockObj) {
-    if (!DBTEAMFeaturesGetValues) {
-      DBTEAMFeaturesGetValues = [[DBRoute alloc] init:@"features/get_values"
-                                           namespace_:@"team"
-                                           deprecated:@NO
-                                           resultType:[DBTEAMFeaturesGetValuesBatchResult class]
-                                            errorType:[DBTEAMFeaturesGetValuesBatchError class]
-                                                attrs:@{
-                                                  @"auth" : @"team",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMFeaturesGetValues;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMFeaturesGetValues = [[DBRoute alloc] init:@"features/get_values"
+                                         namespace_:@"team"
+                                         deprecated:@NO
+                                         resultType:[DBTEAMFeaturesGetValuesBatchResult class]
+                                          errorType:[DBTEAMFeaturesGetValuesBatchError class]
+                                              attrs:@{
+                                                @"auth" : @"team",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMFeaturesGetValues;
 }
 
 + (DBRoute *)DBTEAMGetInfo {
-  @synchronized(lockObj) {
-    if (!DBTEAMGetInfo) {
-      DBTEAMGetInfo = [[DBRoute alloc] init:@"get_info"
-                                 namespace_:@"team"
-                                 deprecated:@NO
-                                 resultType:[DBTEAMTeamGetInfoResult class]
-                                  errorType:nil
-                                      attrs:@{
-                                        @"auth" : @"team",
-                                        @"host" : @"api",
-                                        @"style" : @"rpc"
-                                      }
-                      dataStructSerialBlock:nil
-                    dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGetInfo;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGetInfo = [[DBRoute alloc] init:@"get_info"
+                               namespace_:@"team"
+                               deprecated:@NO
+                               resultType:[DBTEAMTeamGetInfoResult class]
+                                errorType:nil
+                                    attrs:@{
+                                      @"auth" : @"team",
+                                      @"host" : @"api",
+                                      @"style" : @"rpc"
+                                    }
+                    dataStructSerialBlock:nil
+                  dataStructDeserialBlock:nil];
+  });
+  return DBTEAMGetInfo;
 }
 
 + (DBRoute *)DBTEAMGroupsCreate {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsCreate) {
-      DBTEAMGroupsCreate = [[DBRoute alloc] init:@"groups/create"
-                                      namespace_:@"team"
-                                      deprecated:@NO
-                                      resultType:[DBTEAMGroupFullInfo class]
-                                       errorType:[DBTEAMGroupCreateError class]
-                                           attrs:@{
-                                             @"auth" : @"team",
-                                             @"host" : @"api",
-                                             @"style" : @"rpc"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsCreate;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsCreate = [[DBRoute alloc] init:@"groups/create"
+                                    namespace_:@"team"
+                                    deprecated:@NO
+                                    resultType:[DBTEAMGroupFullInfo class]
+                                     errorType:[DBTEAMGroupCreateError class]
+                                         attrs:@{
+                                           @"auth" : @"team",
+                                           @"host" : @"api",
+                                           @"style" : @"rpc"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
+  });
+  return DBTEAMGroupsCreate;
 }
 
 + (DBRoute *)DBTEAMGroupsDelete {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsDelete) {
-      DBTEAMGroupsDelete = [[DBRoute alloc] init:@"groups/delete"
-                                      namespace_:@"team"
-                                      deprecated:@NO
-                                      resultType:[DBASYNCLaunchEmptyResult class]
-                                       errorType:[DBTEAMGroupDeleteError class]
-                                           attrs:@{
-                                             @"auth" : @"team",
-                                             @"host" : @"api",
-                                             @"style" : @"rpc"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsDelete;
-  }
-}
-
-+ (DBRoute *)DBTEAMGroupsGetInfo {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsGetInfo) {
-      DBTEAMGroupsGetInfo = [[DBRoute alloc] init:@"groups/get_info"
-          namespace_:@"team"
-          deprecated:@NO
-          resultType:[NSArray<DBTEAMGroupsGetInfoItem *> class]
-          errorType:[DBTEAMGroupsGetInfoError class]
-          attrs:@{
-            @"auth" : @"team",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBTEAMGroupsGetInfoItemSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBTEAMGroupsGetInfo;
-  }
-}
-
-+ (DBRoute *)DBTEAMGroupsJobStatusGet {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsJobStatusGet) {
-      DBTEAMGroupsJobStatusGet = [[DBRoute alloc] init:@"groups/job_status/get"
-                                            namespace_:@"team"
-                                            deprecated:@NO
-                                            resultType:[DBASYNCPollEmptyResult class]
-                                             errorType:[DBTEAMGroupsPollError class]
-                                                 attrs:@{
-                                                   @"auth" : @"team",
-                                                   @"host" : @"api",
-                                                   @"style" : @"rpc"
-                                                 }
-                                 dataStructSerialBlock:nil
-                               dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsJobStatusGet;
-  }
-}
-
-+ (DBRoute *)DBTEAMGroupsList {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsList) {
-      DBTEAMGroupsList = [[DBRoute alloc] init:@"groups/list"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsDelete = [[DBRoute alloc] init:@"groups/delete"
                                     namespace_:@"team"
                                     deprecated:@NO
-                                    resultType:[DBTEAMGroupsListResult class]
-                                     errorType:nil
+                                    resultType:[DBASYNCLaunchEmptyResult class]
+                                     errorType:[DBTEAMGroupDeleteError class]
                                          attrs:@{
                                            @"auth" : @"team",
                                            @"host" : @"api",
@@ -523,39 +442,42 @@ static NSObject *lockObj = nil;
                                          }
                          dataStructSerialBlock:nil
                        dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsList;
-  }
+  });
+  return DBTEAMGroupsDelete;
 }
 
-+ (DBRoute *)DBTEAMGroupsListContinue {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsListContinue) {
-      DBTEAMGroupsListContinue = [[DBRoute alloc] init:@"groups/list/continue"
-                                            namespace_:@"team"
-                                            deprecated:@NO
-                                            resultType:[DBTEAMGroupsListResult class]
-                                             errorType:[DBTEAMGroupsListContinueError class]
-                                                 attrs:@{
-                                                   @"auth" : @"team",
-                                                   @"host" : @"api",
-                                                   @"style" : @"rpc"
-                                                 }
-                                 dataStructSerialBlock:nil
-                               dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsListContinue;
-  }
++ (DBRoute *)DBTEAMGroupsGetInfo {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsGetInfo = [[DBRoute alloc] init:@"groups/get_info"
+        namespace_:@"team"
+        deprecated:@NO
+        resultType:[NSArray<DBTEAMGroupsGetInfoItem *> class]
+        errorType:[DBTEAMGroupsGetInfoError class]
+        attrs:@{
+          @"auth" : @"team",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBTEAMGroupsGetInfoItemSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBTEAMGroupsGetInfo;
 }
 
-+ (DBRoute *)DBTEAMGroupsMembersAdd {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsMembersAdd) {
-      DBTEAMGroupsMembersAdd = [[DBRoute alloc] init:@"groups/members/add"
++ (DBRoute *)DBTEAMGroupsJobStatusGet {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsJobStatusGet = [[DBRoute alloc] init:@"groups/job_status/get"
                                           namespace_:@"team"
                                           deprecated:@NO
-                                          resultType:[DBTEAMGroupMembersChangeResult class]
-                                           errorType:[DBTEAMGroupMembersAddError class]
+                                          resultType:[DBASYNCPollEmptyResult class]
+                                           errorType:[DBTEAMGroupsPollError class]
                                                attrs:@{
                                                  @"auth" : @"team",
                                                  @"host" : @"api",
@@ -563,19 +485,113 @@ static NSObject *lockObj = nil;
                                                }
                                dataStructSerialBlock:nil
                              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsMembersAdd;
-  }
+  });
+  return DBTEAMGroupsJobStatusGet;
+}
+
++ (DBRoute *)DBTEAMGroupsList {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsList = [[DBRoute alloc] init:@"groups/list"
+                                  namespace_:@"team"
+                                  deprecated:@NO
+                                  resultType:[DBTEAMGroupsListResult class]
+                                   errorType:nil
+                                       attrs:@{
+                                         @"auth" : @"team",
+                                         @"host" : @"api",
+                                         @"style" : @"rpc"
+                                       }
+                       dataStructSerialBlock:nil
+                     dataStructDeserialBlock:nil];
+  });
+  return DBTEAMGroupsList;
+}
+
++ (DBRoute *)DBTEAMGroupsListContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsListContinue = [[DBRoute alloc] init:@"groups/list/continue"
+                                          namespace_:@"team"
+                                          deprecated:@NO
+                                          resultType:[DBTEAMGroupsListResult class]
+                                           errorType:[DBTEAMGroupsListContinueError class]
+                                               attrs:@{
+                                                 @"auth" : @"team",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBTEAMGroupsListContinue;
+}
+
++ (DBRoute *)DBTEAMGroupsMembersAdd {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsMembersAdd = [[DBRoute alloc] init:@"groups/members/add"
+                                        namespace_:@"team"
+                                        deprecated:@NO
+                                        resultType:[DBTEAMGroupMembersChangeResult class]
+                                         errorType:[DBTEAMGroupMembersAddError class]
+                                             attrs:@{
+                                               @"auth" : @"team",
+                                               @"host" : @"api",
+                                               @"style" : @"rpc"
+                                             }
+                             dataStructSerialBlock:nil
+                           dataStructDeserialBlock:nil];
+  });
+  return DBTEAMGroupsMembersAdd;
 }
 
 + (DBRoute *)DBTEAMGroupsMembersList {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsMembersList) {
-      DBTEAMGroupsMembersList = [[DBRoute alloc] init:@"groups/members/list"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsMembersList = [[DBRoute alloc] init:@"groups/members/list"
+                                         namespace_:@"team"
+                                         deprecated:@NO
+                                         resultType:[DBTEAMGroupsMembersListResult class]
+                                          errorType:[DBTEAMGroupSelectorError class]
+                                              attrs:@{
+                                                @"auth" : @"team",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMGroupsMembersList;
+}
+
++ (DBRoute *)DBTEAMGroupsMembersListContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsMembersListContinue = [[DBRoute alloc] init:@"groups/members/list/continue"
+                                                 namespace_:@"team"
+                                                 deprecated:@NO
+                                                 resultType:[DBTEAMGroupsMembersListResult class]
+                                                  errorType:[DBTEAMGroupsMembersListContinueError class]
+                                                      attrs:@{
+                                                        @"auth" : @"team",
+                                                        @"host" : @"api",
+                                                        @"style" : @"rpc"
+                                                      }
+                                      dataStructSerialBlock:nil
+                                    dataStructDeserialBlock:nil];
+  });
+  return DBTEAMGroupsMembersListContinue;
+}
+
++ (DBRoute *)DBTEAMGroupsMembersRemove {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsMembersRemove = [[DBRoute alloc] init:@"groups/members/remove"
                                            namespace_:@"team"
                                            deprecated:@NO
-                                           resultType:[DBTEAMGroupsMembersListResult class]
-                                            errorType:[DBTEAMGroupSelectorError class]
+                                           resultType:[DBTEAMGroupMembersChangeResult class]
+                                            errorType:[DBTEAMGroupMembersRemoveError class]
                                                 attrs:@{
                                                   @"auth" : @"team",
                                                   @"host" : @"api",
@@ -583,19 +599,99 @@ static NSObject *lockObj = nil;
                                                 }
                                 dataStructSerialBlock:nil
                               dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsMembersList;
-  }
+  });
+  return DBTEAMGroupsMembersRemove;
 }
 
-+ (DBRoute *)DBTEAMGroupsMembersListContinue {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsMembersListContinue) {
-      DBTEAMGroupsMembersListContinue = [[DBRoute alloc] init:@"groups/members/list/continue"
++ (DBRoute *)DBTEAMGroupsMembersSetAccessType {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsMembersSetAccessType = [[DBRoute alloc] init:@"groups/members/set_access_type"
+        namespace_:@"team"
+        deprecated:@NO
+        resultType:[NSArray<DBTEAMGroupsGetInfoItem *> class]
+        errorType:[DBTEAMGroupMemberSetAccessTypeError class]
+        attrs:@{
+          @"auth" : @"team",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBTEAMGroupsGetInfoItemSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBTEAMGroupsMembersSetAccessType;
+}
+
++ (DBRoute *)DBTEAMGroupsUpdate {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMGroupsUpdate = [[DBRoute alloc] init:@"groups/update"
+                                    namespace_:@"team"
+                                    deprecated:@NO
+                                    resultType:[DBTEAMGroupFullInfo class]
+                                     errorType:[DBTEAMGroupUpdateError class]
+                                         attrs:@{
+                                           @"auth" : @"team",
+                                           @"host" : @"api",
+                                           @"style" : @"rpc"
+                                         }
+                         dataStructSerialBlock:nil
+                       dataStructDeserialBlock:nil];
+  });
+  return DBTEAMGroupsUpdate;
+}
+
++ (DBRoute *)DBTEAMLegalHoldsCreatePolicy {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLegalHoldsCreatePolicy = [[DBRoute alloc] init:@"legal_holds/create_policy"
+                                              namespace_:@"team"
+                                              deprecated:@NO
+                                              resultType:[DBTEAMLegalHoldPolicy class]
+                                               errorType:[DBTEAMLegalHoldsPolicyCreateError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLegalHoldsCreatePolicy;
+}
+
++ (DBRoute *)DBTEAMLegalHoldsGetPolicy {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLegalHoldsGetPolicy = [[DBRoute alloc] init:@"legal_holds/get_policy"
+                                           namespace_:@"team"
+                                           deprecated:@NO
+                                           resultType:[DBTEAMLegalHoldPolicy class]
+                                            errorType:[DBTEAMLegalHoldsGetPolicyError class]
+                                                attrs:@{
+                                                  @"auth" : @"team",
+                                                  @"host" : @"api",
+                                                  @"style" : @"rpc"
+                                                }
+                                dataStructSerialBlock:nil
+                              dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLegalHoldsGetPolicy;
+}
+
++ (DBRoute *)DBTEAMLegalHoldsListHeldRevisions {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLegalHoldsListHeldRevisions = [[DBRoute alloc] init:@"legal_holds/list_held_revisions"
                                                    namespace_:@"team"
                                                    deprecated:@NO
-                                                   resultType:[DBTEAMGroupsMembersListResult class]
-                                                    errorType:[DBTEAMGroupsMembersListContinueError class]
+                                                   resultType:[DBTEAMLegalHoldsListHeldRevisionResult class]
+                                                    errorType:[DBTEAMLegalHoldsListHeldRevisionsError class]
                                                         attrs:@{
                                                           @"auth" : @"team",
                                                           @"host" : @"api",
@@ -603,184 +699,151 @@ static NSObject *lockObj = nil;
                                                         }
                                         dataStructSerialBlock:nil
                                       dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsMembersListContinue;
-  }
-}
-
-+ (DBRoute *)DBTEAMGroupsMembersRemove {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsMembersRemove) {
-      DBTEAMGroupsMembersRemove = [[DBRoute alloc] init:@"groups/members/remove"
-                                             namespace_:@"team"
-                                             deprecated:@NO
-                                             resultType:[DBTEAMGroupMembersChangeResult class]
-                                              errorType:[DBTEAMGroupMembersRemoveError class]
-                                                  attrs:@{
-                                                    @"auth" : @"team",
-                                                    @"host" : @"api",
-                                                    @"style" : @"rpc"
-                                                  }
-                                  dataStructSerialBlock:nil
-                                dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsMembersRemove;
-  }
+  });
+  return DBTEAMLegalHoldsListHeldRevisions;
 }
 
-+ (DBRoute *)DBTEAMGroupsMembersSetAccessType {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsMembersSetAccessType) {
-      DBTEAMGroupsMembersSetAccessType = [[DBRoute alloc] init:@"groups/members/set_access_type"
-          namespace_:@"team"
-          deprecated:@NO
-          resultType:[NSArray<DBTEAMGroupsGetInfoItem *> class]
-          errorType:[DBTEAMGroupMemberSetAccessTypeError class]
-          attrs:@{
-            @"auth" : @"team",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBTEAMGroupsGetInfoItemSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBTEAMGroupsMembersSetAccessType;
-  }
++ (DBRoute *)DBTEAMLegalHoldsListHeldRevisionsContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLegalHoldsListHeldRevisionsContinue = [[DBRoute alloc] init:@"legal_holds/list_held_revisions_continue"
+                                                           namespace_:@"team"
+                                                           deprecated:@NO
+                                                           resultType:[DBTEAMLegalHoldsListHeldRevisionResult class]
+                                                            errorType:[DBTEAMLegalHoldsListHeldRevisionsError class]
+                                                                attrs:@{
+                                                                  @"auth" : @"team",
+                                                                  @"host" : @"api",
+                                                                  @"style" : @"rpc"
+                                                                }
+                                                dataStructSerialBlock:nil
+                                              dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLegalHoldsListHeldRevisionsContinue;
 }
 
-+ (DBRoute *)DBTEAMGroupsUpdate {
-  @synchronized(lockObj) {
-    if (!DBTEAMGroupsUpdate) {
-      DBTEAMGroupsUpdate = [[DBRoute alloc] init:@"groups/update"
-                                      namespace_:@"team"
-                                      deprecated:@NO
-                                      resultType:[DBTEAMGroupFullInfo class]
-                                       errorType:[DBTEAMGroupUpdateError class]
-                                           attrs:@{
-                                             @"auth" : @"team",
-                                             @"host" : @"api",
-                                             @"style" : @"rpc"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMGroupsUpdate;
-  }
++ (DBRoute *)DBTEAMLegalHoldsListPolicies {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLegalHoldsListPolicies = [[DBRoute alloc] init:@"legal_holds/list_policies"
+                                              namespace_:@"team"
+                                              deprecated:@NO
+                                              resultType:[DBTEAMLegalHoldsListPoliciesResult class]
+                                               errorType:[DBTEAMLegalHoldsListPoliciesError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLegalHoldsListPolicies;
 }
 
-+ (DBRoute *)DBTEAMLegalHoldsCreatePolicy {
-  @synchronized(lockObj) {
-    if (!DBTEAMLegalHoldsCreatePolicy) {
-      DBTEAMLegalHoldsCreatePolicy = [[DBRoute alloc] init:@"legal_holds/create_policy"
-                                                namespace_:@"team"
-                                                deprecated:@NO
-                                                resultType:[DBTEAMLegalHoldPolicy class]
-                                                 errorType:[DBTEAMLegalHoldsPolicyCreateError class]
-                                                     attrs:@{
-                                                       @"auth" : @"team",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLegalHoldsCreatePolicy;
-  }
++ (DBRoute *)DBTEAMLegalHoldsReleasePolicy {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLegalHoldsReleasePolicy = [[DBRoute alloc] init:@"legal_holds/release_policy"
+                                               namespace_:@"team"
+                                               deprecated:@NO
+                                               resultType:nil
+                                                errorType:[DBTEAMLegalHoldsPolicyReleaseError class]
+                                                    attrs:@{
+                                                      @"auth" : @"team",
+                                                      @"host" : @"api",
+                                                      @"style" : @"rpc"
+                                                    }
+                                    dataStructSerialBlock:nil
+                                  dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLegalHoldsReleasePolicy;
 }
 
-+ (DBRoute *)DBTEAMLegalHoldsGetPolicy {
-  @synchronized(lockObj) {
-    if (!DBTEAMLegalHoldsGetPolicy) {
-      DBTEAMLegalHoldsGetPolicy = [[DBRoute alloc] init:@"legal_holds/get_policy"
-                                             namespace_:@"team"
-                                             deprecated:@NO
-                                             resultType:[DBTEAMLegalHoldPolicy class]
-                                              errorType:[DBTEAMLegalHoldsGetPolicyError class]
-                                                  attrs:@{
-                                                    @"auth" : @"team",
-                                                    @"host" : @"api",
-                                                    @"style" : @"rpc"
-                                                  }
-                                  dataStructSerialBlock:nil
-                                dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLegalHoldsGetPolicy;
-  }
++ (DBRoute *)DBTEAMLegalHoldsUpdatePolicy {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLegalHoldsUpdatePolicy = [[DBRoute alloc] init:@"legal_holds/update_policy"
+                                              namespace_:@"team"
+                                              deprecated:@NO
+                                              resultType:[DBTEAMLegalHoldPolicy class]
+                                               errorType:[DBTEAMLegalHoldsPolicyUpdateError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLegalHoldsUpdatePolicy;
 }
 
-+ (DBRoute *)DBTEAMLegalHoldsListHeldRevisions {
-  @synchronized(lockObj) {
-    if (!DBTEAMLegalHoldsListHeldRevisions) {
-      DBTEAMLegalHoldsListHeldRevisions = [[DBRoute alloc] init:@"legal_holds/list_held_revisions"
-                                                     namespace_:@"team"
-                                                     deprecated:@NO
-                                                     resultType:[DBTEAMLegalHoldsListHeldRevisionResult class]
-                                                      errorType:[DBTEAMLegalHoldsListHeldRevisionsError class]
-                                                          attrs:@{
-                                                            @"auth" : @"team",
-                                                            @"host" : @"api",
-                                                            @"style" : @"rpc"
-                                                          }
-                                          dataStructSerialBlock:nil
-                                        dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLegalHoldsListHeldRevisions;
-  }
++ (DBRoute *)DBTEAMLinkedAppsListMemberLinkedApps {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLinkedAppsListMemberLinkedApps = [[DBRoute alloc] init:@"linked_apps/list_member_linked_apps"
+                                                      namespace_:@"team"
+                                                      deprecated:@NO
+                                                      resultType:[DBTEAMListMemberAppsResult class]
+                                                       errorType:[DBTEAMListMemberAppsError class]
+                                                           attrs:@{
+                                                             @"auth" : @"team",
+                                                             @"host" : @"api",
+                                                             @"style" : @"rpc"
+                                                           }
+                                           dataStructSerialBlock:nil
+                                         dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLinkedAppsListMemberLinkedApps;
 }
 
-+ (DBRoute *)DBTEAMLegalHoldsListHeldRevisionsContinue {
-  @synchronized(lockObj) {
-    if (!DBTEAMLegalHoldsListHeldRevisionsContinue) {
-      DBTEAMLegalHoldsListHeldRevisionsContinue = [[DBRoute alloc] init:@"legal_holds/list_held_revisions_continue"
-                                                             namespace_:@"team"
-                                                             deprecated:@NO
-                                                             resultType:[DBTEAMLegalHoldsListHeldRevisionResult class]
-                                                              errorType:[DBTEAMLegalHoldsListHeldRevisionsError class]
-                                                                  attrs:@{
-                                                                    @"auth" : @"team",
-                                                                    @"host" : @"api",
-                                                                    @"style" : @"rpc"
-                                                                  }
-                                                  dataStructSerialBlock:nil
-                                                dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLegalHoldsListHeldRevisionsContinue;
-  }
++ (DBRoute *)DBTEAMLinkedAppsListMembersLinkedApps {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLinkedAppsListMembersLinkedApps = [[DBRoute alloc] init:@"linked_apps/list_members_linked_apps"
+                                                       namespace_:@"team"
+                                                       deprecated:@NO
+                                                       resultType:[DBTEAMListMembersAppsResult class]
+                                                        errorType:[DBTEAMListMembersAppsError class]
+                                                            attrs:@{
+                                                              @"auth" : @"team",
+                                                              @"host" : @"api",
+                                                              @"style" : @"rpc"
+                                                            }
+                                            dataStructSerialBlock:nil
+                                          dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLinkedAppsListMembersLinkedApps;
 }
 
-+ (DBRoute *)DBTEAMLegalHoldsListPolicies {
-  @synchronized(lockObj) {
-    if (!DBTEAMLegalHoldsListPolicies) {
-      DBTEAMLegalHoldsListPolicies = [[DBRoute alloc] init:@"legal_holds/list_policies"
-                                                namespace_:@"team"
-                                                deprecated:@NO
-                                                resultType:[DBTEAMLegalHoldsListPoliciesResult class]
-                                                 errorType:[DBTEAMLegalHoldsListPoliciesError class]
-                                                     attrs:@{
-                                                       @"auth" : @"team",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLegalHoldsListPolicies;
-  }
++ (DBRoute *)DBTEAMLinkedAppsListTeamLinkedApps {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLinkedAppsListTeamLinkedApps = [[DBRoute alloc] init:@"linked_apps/list_team_linked_apps"
+                                                    namespace_:@"team"
+                                                    deprecated:@YES
+                                                    resultType:[DBTEAMListTeamAppsResult class]
+                                                     errorType:[DBTEAMListTeamAppsError class]
+                                                         attrs:@{
+                                                           @"auth" : @"team",
+                                                           @"host" : @"api",
+                                                           @"style" : @"rpc"
+                                                         }
+                                         dataStructSerialBlock:nil
+                                       dataStructDeserialBlock:nil];
+  });
+  return DBTEAMLinkedAppsListTeamLinkedApps;
 }
 
-+ (DBRoute *)DBTEAMLegalHoldsReleasePolicy {
-  @synchronized(lockObj) {
-    if (!DBTEAMLegalHoldsReleasePolicy) {
-      DBTEAMLegalHoldsReleasePolicy = [[DBRoute alloc] init:@"legal_holds/release_policy"
++ (DBRoute *)DBTEAMLinkedAppsRevokeLinkedApp {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLinkedAppsRevokeLinkedApp = [[DBRoute alloc] init:@"linked_apps/revoke_linked_app"
                                                  namespace_:@"team"
                                                  deprecated:@NO
                                                  resultType:nil
-                                                  errorType:[DBTEAMLegalHoldsPolicyReleaseError class]
+                                                  errorType:[DBTEAMRevokeLinkedAppError class]
                                                       attrs:@{
                                                         @"auth" : @"team",
                                                         @"host" : @"api",
@@ -788,79 +851,18 @@ static NSObject *lockObj = nil;
                                                       }
                                       dataStructSerialBlock:nil
                                     dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLegalHoldsReleasePolicy;
-  }
-}
-
-+ (DBRoute *)DBTEAMLegalHoldsUpdatePolicy {
-  @synchronized(lockObj) {
-    if (!DBTEAMLegalHoldsUpdatePolicy) {
-      DBTEAMLegalHoldsUpdatePolicy = [[DBRoute alloc] init:@"legal_holds/update_policy"
-                                                namespace_:@"team"
-                                                deprecated:@NO
-                                                resultType:[DBTEAMLegalHoldPolicy class]
-                                                 errorType:[DBTEAMLegalHoldsPolicyUpdateError class]
-                                                     attrs:@{
-                                                       @"auth" : @"team",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLegalHoldsUpdatePolicy;
-  }
-}
-
-+ (DBRoute *)DBTEAMLinkedAppsListMemberLinkedApps {
-  @synchronized(lockObj) {
-    if (!DBTEAMLinkedAppsListMemberLinkedApps) {
-      DBTEAMLinkedAppsListMemberLinkedApps = [[DBRoute alloc] init:@"linked_apps/list_member_linked_apps"
-                                                        namespace_:@"team"
-                                                        deprecated:@NO
-                                                        resultType:[DBTEAMListMemberAppsResult class]
-                                                         errorType:[DBTEAMListMemberAppsError class]
-                                                             attrs:@{
-                                                               @"auth" : @"team",
-                                                               @"host" : @"api",
-                                                               @"style" : @"rpc"
-                                                             }
-                                             dataStructSerialBlock:nil
-                                           dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLinkedAppsListMemberLinkedApps;
-  }
-}
-
-+ (DBRoute *)DBTEAMLinkedAppsListMembersLinkedApps {
-  @synchronized(lockObj) {
-    if (!DBTEAMLinkedAppsListMembersLinkedApps) {
-      DBTEAMLinkedAppsListMembersLinkedApps = [[DBRoute alloc] init:@"linked_apps/list_members_linked_apps"
-                                                         namespace_:@"team"
-                                                         deprecated:@NO
-                                                         resultType:[DBTEAMListMembersAppsResult class]
-                                                          errorType:[DBTEAMListMembersAppsError class]
-                                                              attrs:@{
-                                                                @"auth" : @"team",
-                                                                @"host" : @"api",
-                                                                @"style" : @"rpc"
-                                                              }
-                                              dataStructSerialBlock:nil
-                                            dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLinkedAppsListMembersLinkedApps;
-  }
+  });
+  return DBTEAMLinkedAppsRevokeLinkedApp;
 }
 
-+ (DBRoute *)DBTEAMLinkedAppsListTeamLinkedApps {
-  @synchronized(lockObj) {
-    if (!DBTEAMLinkedAppsListTeamLinkedApps) {
-      DBTEAMLinkedAppsListTeamLinkedApps = [[DBRoute alloc] init:@"linked_apps/list_team_linked_apps"
++ (DBRoute *)DBTEAMLinkedAppsRevokeLinkedAppBatch {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMLinkedAppsRevokeLinkedAppBatch = [[DBRoute alloc] init:@"linked_apps/revoke_linked_app_batch"
                                                       namespace_:@"team"
-                                                      deprecated:@YES
-                                                      resultType:[DBTEAMListTeamAppsResult class]
-                                                       errorType:[DBTEAMListTeamAppsError class]
+                                                      deprecated:@NO
+                                                      resultType:[DBTEAMRevokeLinkedAppBatchResult class]
+                                                       errorType:[DBTEAMRevokeLinkedAppBatchError class]
                                                            attrs:@{
                                                              @"auth" : @"team",
                                                              @"host" : @"api",
@@ -868,79 +870,76 @@ static NSObject *lockObj = nil;
                                                            }
                                            dataStructSerialBlock:nil
                                          dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLinkedAppsListTeamLinkedApps;
-  }
+  });
+  return DBTEAMLinkedAppsRevokeLinkedAppBatch;
 }
 
-+ (DBRoute *)DBTEAMLinkedAppsRevokeLinkedApp {
-  @synchronized(lockObj) {
-    if (!DBTEAMLinkedAppsRevokeLinkedApp) {
-      DBTEAMLinkedAppsRevokeLinkedApp = [[DBRoute alloc] init:@"linked_apps/revoke_linked_app"
-                                                   namespace_:@"team"
-                                                   deprecated:@NO
-                                                   resultType:nil
-                                                    errorType:[DBTEAMRevokeLinkedAppError class]
-                                                        attrs:@{
-                                                          @"auth" : @"team",
-                                                          @"host" : @"api",
-                                                          @"style" : @"rpc"
-                                                        }
-                                        dataStructSerialBlock:nil
-                                      dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLinkedAppsRevokeLinkedApp;
-  }
++ (DBRoute *)DBTEAMMemberSpaceLimitsExcludedUsersAdd {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMemberSpaceLimitsExcludedUsersAdd = [[DBRoute alloc] init:@"member_space_limits/excluded_users/add"
+                                                         namespace_:@"team"
+                                                         deprecated:@NO
+                                                         resultType:[DBTEAMExcludedUsersUpdateResult class]
+                                                          errorType:[DBTEAMExcludedUsersUpdateError class]
+                                                              attrs:@{
+                                                                @"auth" : @"team",
+                                                                @"host" : @"api",
+                                                                @"style" : @"rpc"
+                                                              }
+                                              dataStructSerialBlock:nil
+                                            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMemberSpaceLimitsExcludedUsersAdd;
 }
 
-+ (DBRoute *)DBTEAMLinkedAppsRevokeLinkedAppBatch {
-  @synchronized(lockObj) {
-    if (!DBTEAMLinkedAppsRevokeLinkedAppBatch) {
-      DBTEAMLinkedAppsRevokeLinkedAppBatch = [[DBRoute alloc] init:@"linked_apps/revoke_linked_app_batch"
-                                                        namespace_:@"team"
-                                                        deprecated:@NO
-                                                        resultType:[DBTEAMRevokeLinkedAppBatchResult class]
-                                                         errorType:[DBTEAMRevokeLinkedAppBatchError class]
-                                                             attrs:@{
-                                                               @"auth" : @"team",
-                                                               @"host" : @"api",
-                                                               @"style" : @"rpc"
-                                                             }
-                                             dataStructSerialBlock:nil
-                                           dataStructDeserialBlock:nil];
-    }
-    return DBTEAMLinkedAppsRevokeLinkedAppBatch;
-  }
++ (DBRoute *)DBTEAMMemberSpaceLimitsExcludedUsersList {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMemberSpaceLimitsExcludedUsersList = [[DBRoute alloc] init:@"member_space_limits/excluded_users/list"
+                                                          namespace_:@"team"
+                                                          deprecated:@NO
+                                                          resultType:[DBTEAMExcludedUsersListResult class]
+                                                           errorType:[DBTEAMExcludedUsersListError class]
+                                                               attrs:@{
+                                                                 @"auth" : @"team",
+                                                                 @"host" : @"api",
+                                                                 @"style" : @"rpc"
+                                                               }
+                                               dataStructSerialBlock:nil
+                                             dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMemberSpaceLimitsExcludedUsersList;
 }
 
-+ (DBRoute *)DBTEAMMemberSpaceLimitsExcludedUsersAdd {
-  @synchronized(lockObj) {
-    if (!DBTEAMMemberSpaceLimitsExcludedUsersAdd) {
-      DBTEAMMemberSpaceLimitsExcludedUsersAdd = [[DBRoute alloc] init:@"member_space_limits/excluded_users/add"
-                                                           namespace_:@"team"
-                                                           deprecated:@NO
-                                                           resultType:[DBTEAMExcludedUsersUpdateResult class]
-                                                            errorType:[DBTEAMExcludedUsersUpdateError class]
-                                                                attrs:@{
-                                                                  @"auth" : @"team",
-                                                                  @"host" : @"api",
-                                                                  @"style" : @"rpc"
-                                                                }
-                                                dataStructSerialBlock:nil
-                                              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMemberSpaceLimitsExcludedUsersAdd;
-  }
++ (DBRoute *)DBTEAMMemberSpaceLimitsExcludedUsersListContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMemberSpaceLimitsExcludedUsersListContinue =
+        [[DBRoute alloc] init:@"member_space_limits/excluded_users/list/continue"
+                         namespace_:@"team"
+                         deprecated:@NO
+                         resultType:[DBTEAMExcludedUsersListResult class]
+                          errorType:[DBTEAMExcludedUsersListContinueError class]
+                              attrs:@{
+                                @"auth" : @"team",
+                                @"host" : @"api",
+                                @"style" : @"rpc"
+                              }
+              dataStructSerialBlock:nil
+            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMemberSpaceLimitsExcludedUsersListContinue;
 }
 
-+ (DBRoute *)DBTEAMMemberSpaceLimitsExcludedUsersList {
-  @synchronized(lockObj) {
-    if (!DBTEAMMemberSpaceLimitsExcludedUsersList) {
-      DBTEAMMemberSpaceLimitsExcludedUsersList = [[DBRoute alloc] init:@"member_space_limits/excluded_users/list"
++ (DBRoute *)DBTEAMMemberSpaceLimitsExcludedUsersRemove {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMemberSpaceLimitsExcludedUsersRemove = [[DBRoute alloc] init:@"member_space_limits/excluded_users/remove"
                                                             namespace_:@"team"
                                                             deprecated:@NO
-                                                            resultType:[DBTEAMExcludedUsersListResult class]
-                                                             errorType:[DBTEAMExcludedUsersListError class]
+                                                            resultType:[DBTEAMExcludedUsersUpdateResult class]
+                                                             errorType:[DBTEAMExcludedUsersUpdateError class]
                                                                  attrs:@{
                                                                    @"auth" : @"team",
                                                                    @"host" : @"api",
@@ -948,154 +947,89 @@ static NSObject *lockObj = nil;
                                                                  }
                                                  dataStructSerialBlock:nil
                                                dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMemberSpaceLimitsExcludedUsersList;
-  }
-}
-
-+ (DBRoute *)DBTEAMMemberSpaceLimitsExcludedUsersListContinue {
-  @synchronized(lockObj) {
-    if (!DBTEAMMemberSpaceLimitsExcludedUsersListContinue) {
-      DBTEAMMemberSpaceLimitsExcludedUsersListContinue =
-          [[DBRoute alloc] init:@"member_space_limits/excluded_users/list/continue"
-                           namespace_:@"team"
-                           deprecated:@NO
-                           resultType:[DBTEAMExcludedUsersListResult class]
-                            errorType:[DBTEAMExcludedUsersListContinueError class]
-                                attrs:@{
-                                  @"auth" : @"team",
-                                  @"host" : @"api",
-                                  @"style" : @"rpc"
-                                }
-                dataStructSerialBlock:nil
-              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMemberSpaceLimitsExcludedUsersListContinue;
-  }
-}
-
-+ (DBRoute *)DBTEAMMemberSpaceLimitsExcludedUsersRemove {
-  @synchronized(lockObj) {
-    if (!DBTEAMMemberSpaceLimitsExcludedUsersRemove) {
-      DBTEAMMemberSpaceLimitsExcludedUsersRemove = [[DBRoute alloc] init:@"member_space_limits/excluded_users/remove"
-                                                              namespace_:@"team"
-                                                              deprecated:@NO
-                                                              resultType:[DBTEAMExcludedUsersUpdateResult class]
-                                                               errorType:[DBTEAMExcludedUsersUpdateError class]
-                                                                   attrs:@{
-                                                                     @"auth" : @"team",
-                                                                     @"host" : @"api",
-                                                                     @"style" : @"rpc"
-                                                                   }
-                                                   dataStructSerialBlock:nil
-                                                 dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMemberSpaceLimitsExcludedUsersRemove;
-  }
+  });
+  return DBTEAMMemberSpaceLimitsExcludedUsersRemove;
 }
 
 + (DBRoute *)DBTEAMMemberSpaceLimitsGetCustomQuota {
-  @synchronized(lockObj) {
-    if (!DBTEAMMemberSpaceLimitsGetCustomQuota) {
-      DBTEAMMemberSpaceLimitsGetCustomQuota = [[DBRoute alloc] init:@"member_space_limits/get_custom_quota"
-          namespace_:@"team"
-          deprecated:@NO
-          resultType:[NSArray<DBTEAMCustomQuotaResult *> class]
-          errorType:[DBTEAMCustomQuotaError class]
-          attrs:@{
-            @"auth" : @"team",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBTEAMCustomQuotaResultSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBTEAMMemberSpaceLimitsGetCustomQuota;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMemberSpaceLimitsGetCustomQuota = [[DBRoute alloc] init:@"member_space_limits/get_custom_quota"
+        namespace_:@"team"
+        deprecated:@NO
+        resultType:[NSArray<DBTEAMCustomQuotaResult *> class]
+        errorType:[DBTEAMCustomQuotaError class]
+        attrs:@{
+          @"auth" : @"team",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBTEAMCustomQuotaResultSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBTEAMMemberSpaceLimitsGetCustomQuota;
 }
 
 + (DBRoute *)DBTEAMMemberSpaceLimitsRemoveCustomQuota {
-  @synchronized(lockObj) {
-    if (!DBTEAMMemberSpaceLimitsRemoveCustomQuota) {
-      DBTEAMMemberSpaceLimitsRemoveCustomQuota = [[DBRoute alloc] init:@"member_space_limits/remove_custom_quota"
-          namespace_:@"team"
-          deprecated:@NO
-          resultType:[NSArray<DBTEAMRemoveCustomQuotaResult *> class]
-          errorType:[DBTEAMCustomQuotaError class]
-          attrs:@{
-            @"auth" : @"team",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBTEAMRemoveCustomQuotaResultSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBTEAMMemberSpaceLimitsRemoveCustomQuota;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMemberSpaceLimitsRemoveCustomQuota = [[DBRoute alloc] init:@"member_space_limits/remove_custom_quota"
+        namespace_:@"team"
+        deprecated:@NO
+        resultType:[NSArray<DBTEAMRemoveCustomQuotaResult *> class]
+        errorType:[DBTEAMCustomQuotaError class]
+        attrs:@{
+          @"auth" : @"team",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBTEAMRemoveCustomQuotaResultSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBTEAMMemberSpaceLimitsRemoveCustomQuota;
 }
 
 + (DBRoute *)DBTEAMMemberSpaceLimitsSetCustomQuota {
-  @synchronized(lockObj) {
-    if (!DBTEAMMemberSpaceLimitsSetCustomQuota) {
-      DBTEAMMemberSpaceLimitsSetCustomQuota = [[DBRoute alloc] init:@"member_space_limits/set_custom_quota"
-          namespace_:@"team"
-          deprecated:@NO
-          resultType:[NSArray<DBTEAMCustomQuotaResult *> class]
-          errorType:[DBTEAMSetCustomQuotaError class]
-          attrs:@{
-            @"auth" : @"team",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBTEAMCustomQuotaResultSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBTEAMMemberSpaceLimitsSetCustomQuota;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMemberSpaceLimitsSetCustomQuota = [[DBRoute alloc] init:@"member_space_limits/set_custom_quota"
+        namespace_:@"team"
+        deprecated:@NO
+        resultType:[NSArray<DBTEAMCustomQuotaResult *> class]
+        errorType:[DBTEAMSetCustomQuotaError class]
+        attrs:@{
+          @"auth" : @"team",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBTEAMCustomQuotaResultSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBTEAMMemberSpaceLimitsSetCustomQuota;
 }
 
 + (DBRoute *)DBTEAMMembersAddV2 {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersAddV2) {
-      DBTEAMMembersAddV2 = [[DBRoute alloc] init:@"members/add_v2"
-                                      namespace_:@"team"
-                                      deprecated:@NO
-                                      resultType:[DBTEAMMembersAddLaunchV2Result class]
-                                       errorType:nil
-                                           attrs:@{
-                                             @"auth" : @"team",
-                                             @"host" : @"api",
-                                             @"style" : @"rpc"
-                                           }
-                           dataStructSerialBlock:nil
-                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersAddV2;
-  }
-}
-
-+ (DBRoute *)DBTEAMMembersAdd {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersAdd) {
-      DBTEAMMembersAdd = [[DBRoute alloc] init:@"members/add"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersAddV2 = [[DBRoute alloc] init:@"members/add_v2"
                                     namespace_:@"team"
                                     deprecated:@NO
-                                    resultType:[DBTEAMMembersAddLaunch class]
+                                    resultType:[DBTEAMMembersAddLaunchV2Result class]
                                      errorType:nil
                                          attrs:@{
                                            @"auth" : @"team",
@@ -1104,38 +1038,36 @@ static NSObject *lockObj = nil;
                                          }
                          dataStructSerialBlock:nil
                        dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersAdd;
-  }
+  });
+  return DBTEAMMembersAddV2;
 }
 
-+ (DBRoute *)DBTEAMMembersAddJobStatusGetV2 {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersAddJobStatusGetV2) {
-      DBTEAMMembersAddJobStatusGetV2 = [[DBRoute alloc] init:@"members/add/job_status/get_v2"
-                                                  namespace_:@"team"
-                                                  deprecated:@NO
-                                                  resultType:[DBTEAMMembersAddJobStatusV2Result class]
-                                                   errorType:[DBASYNCPollError class]
-                                                       attrs:@{
-                                                         @"auth" : @"team",
-                                                         @"host" : @"api",
-                                                         @"style" : @"rpc"
-                                                       }
-                                       dataStructSerialBlock:nil
-                                     dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersAddJobStatusGetV2;
-  }
++ (DBRoute *)DBTEAMMembersAdd {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersAdd = [[DBRoute alloc] init:@"members/add"
+                                  namespace_:@"team"
+                                  deprecated:@NO
+                                  resultType:[DBTEAMMembersAddLaunch class]
+                                   errorType:nil
+                                       attrs:@{
+                                         @"auth" : @"team",
+                                         @"host" : @"api",
+                                         @"style" : @"rpc"
+                                       }
+                       dataStructSerialBlock:nil
+                     dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersAdd;
 }
 
-+ (DBRoute *)DBTEAMMembersAddJobStatusGet {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersAddJobStatusGet) {
-      DBTEAMMembersAddJobStatusGet = [[DBRoute alloc] init:@"members/add/job_status/get"
++ (DBRoute *)DBTEAMMembersAddJobStatusGetV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersAddJobStatusGetV2 = [[DBRoute alloc] init:@"members/add/job_status/get_v2"
                                                 namespace_:@"team"
                                                 deprecated:@NO
-                                                resultType:[DBTEAMMembersAddJobStatus class]
+                                                resultType:[DBTEAMMembersAddJobStatusV2Result class]
                                                  errorType:[DBASYNCPollError class]
                                                      attrs:@{
                                                        @"auth" : @"team",
@@ -1144,38 +1076,36 @@ static NSObject *lockObj = nil;
                                                      }
                                      dataStructSerialBlock:nil
                                    dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersAddJobStatusGet;
-  }
+  });
+  return DBTEAMMembersAddJobStatusGetV2;
 }
 
-+ (DBRoute *)DBTEAMMembersDeleteProfilePhotoV2 {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersDeleteProfilePhotoV2) {
-      DBTEAMMembersDeleteProfilePhotoV2 = [[DBRoute alloc] init:@"members/delete_profile_photo_v2"
-                                                     namespace_:@"team"
-                                                     deprecated:@NO
-                                                     resultType:[DBTEAMTeamMemberInfoV2Result class]
-                                                      errorType:[DBTEAMMembersDeleteProfilePhotoError class]
-                                                          attrs:@{
-                                                            @"auth" : @"team",
-                                                            @"host" : @"api",
-                                                            @"style" : @"rpc"
-                                                          }
-                                          dataStructSerialBlock:nil
-                                        dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersDeleteProfilePhotoV2;
-  }
++ (DBRoute *)DBTEAMMembersAddJobStatusGet {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersAddJobStatusGet = [[DBRoute alloc] init:@"members/add/job_status/get"
+                                              namespace_:@"team"
+                                              deprecated:@NO
+                                              resultType:[DBTEAMMembersAddJobStatus class]
+                                               errorType:[DBASYNCPollError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersAddJobStatusGet;
 }
 
-+ (DBRoute *)DBTEAMMembersDeleteProfilePhoto {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersDeleteProfilePhoto) {
-      DBTEAMMembersDeleteProfilePhoto = [[DBRoute alloc] init:@"members/delete_profile_photo"
++ (DBRoute *)DBTEAMMembersDeleteProfilePhotoV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersDeleteProfilePhotoV2 = [[DBRoute alloc] init:@"members/delete_profile_photo_v2"
                                                    namespace_:@"team"
                                                    deprecated:@NO
-                                                   resultType:[DBTEAMTeamMemberInfo class]
+                                                   resultType:[DBTEAMTeamMemberInfoV2Result class]
                                                     errorType:[DBTEAMMembersDeleteProfilePhotoError class]
                                                         attrs:@{
                                                           @"auth" : @"team",
@@ -1184,104 +1114,99 @@ static NSObject *lockObj = nil;
                                                         }
                                         dataStructSerialBlock:nil
                                       dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersDeleteProfilePhoto;
-  }
+  });
+  return DBTEAMMembersDeleteProfilePhotoV2;
+}
+
++ (DBRoute *)DBTEAMMembersDeleteProfilePhoto {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersDeleteProfilePhoto = [[DBRoute alloc] init:@"members/delete_profile_photo"
+                                                 namespace_:@"team"
+                                                 deprecated:@NO
+                                                 resultType:[DBTEAMTeamMemberInfo class]
+                                                  errorType:[DBTEAMMembersDeleteProfilePhotoError class]
+                                                      attrs:@{
+                                                        @"auth" : @"team",
+                                                        @"host" : @"api",
+                                                        @"style" : @"rpc"
+                                                      }
+                                      dataStructSerialBlock:nil
+                                    dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersDeleteProfilePhoto;
 }
 
 + (DBRoute *)DBTEAMMembersGetAvailableTeamMemberRoles {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersGetAvailableTeamMemberRoles) {
-      DBTEAMMembersGetAvailableTeamMemberRoles =
-          [[DBRoute alloc] init:@"members/get_available_team_member_roles"
-                           namespace_:@"team"
-                           deprecated:@NO
-                           resultType:[DBTEAMMembersGetAvailableTeamMemberRolesResult class]
-                            errorType:nil
-                                attrs:@{
-                                  @"auth" : @"team",
-                                  @"host" : @"api",
-                                  @"style" : @"rpc"
-                                }
-                dataStructSerialBlock:nil
-              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersGetAvailableTeamMemberRoles;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersGetAvailableTeamMemberRoles =
+        [[DBRoute alloc] init:@"members/get_available_team_member_roles"
+                         namespace_:@"team"
+                         deprecated:@NO
+                         resultType:[DBTEAMMembersGetAvailableTeamMemberRolesResult class]
+                          errorType:nil
+                              attrs:@{
+                                @"auth" : @"team",
+                                @"host" : @"api",
+                                @"style" : @"rpc"
+                              }
+              dataStructSerialBlock:nil
+            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersGetAvailableTeamMemberRoles;
 }
 
 + (DBRoute *)DBTEAMMembersGetInfoV2 {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersGetInfoV2) {
-      DBTEAMMembersGetInfoV2 = [[DBRoute alloc] init:@"members/get_info_v2"
-                                          namespace_:@"team"
-                                          deprecated:@NO
-                                          resultType:[DBTEAMMembersGetInfoV2Result class]
-                                           errorType:[DBTEAMMembersGetInfoError class]
-                                               attrs:@{
-                                                 @"auth" : @"team",
-                                                 @"host" : @"api",
-                                                 @"style" : @"rpc"
-                                               }
-                               dataStructSerialBlock:nil
-                             dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersGetInfoV2;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersGetInfoV2 = [[DBRoute alloc] init:@"members/get_info_v2"
+                                        namespace_:@"team"
+                                        deprecated:@NO
+                                        resultType:[DBTEAMMembersGetInfoV2Result class]
+                                         errorType:[DBTEAMMembersGetInfoError class]
+                                             attrs:@{
+                                               @"auth" : @"team",
+                                               @"host" : @"api",
+                                               @"style" : @"rpc"
+                                             }
+                             dataStructSerialBlock:nil
+                           dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersGetInfoV2;
 }
 
 + (DBRoute *)DBTEAMMembersGetInfo {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersGetInfo) {
-      DBTEAMMembersGetInfo = [[DBRoute alloc] init:@"members/get_info"
-          namespace_:@"team"
-          deprecated:@NO
-          resultType:[NSArray<DBTEAMMembersGetInfoItem *> class]
-          errorType:[DBTEAMMembersGetInfoError class]
-          attrs:@{
-            @"auth" : @"team",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBTEAMMembersGetInfoItemSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBTEAMMembersGetInfo;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersGetInfo = [[DBRoute alloc] init:@"members/get_info"
+        namespace_:@"team"
+        deprecated:@NO
+        resultType:[NSArray<DBTEAMMembersGetInfoItem *> class]
+        errorType:[DBTEAMMembersGetInfoError class]
+        attrs:@{
+          @"auth" : @"team",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBTEAMMembersGetInfoItemSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBTEAMMembersGetInfo;
 }
 
 + (DBRoute *)DBTEAMMembersListV2 {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersListV2) {
-      DBTEAMMembersListV2 = [[DBRoute alloc] init:@"members/list_v2"
-                                       namespace_:@"team"
-                                       deprecated:@NO
-                                       resultType:[DBTEAMMembersListV2Result class]
-                                        errorType:[DBTEAMMembersListError class]
-                                            attrs:@{
-                                              @"auth" : @"team",
-                                              @"host" : @"api",
-                                              @"style" : @"rpc"
-                                            }
-                            dataStructSerialBlock:nil
-                          dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersListV2;
-  }
-}
-
-+ (DBRoute *)DBTEAMMembersList {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersList) {
-      DBTEAMMembersList = [[DBRoute alloc] init:@"members/list"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersListV2 = [[DBRoute alloc] init:@"members/list_v2"
                                      namespace_:@"team"
                                      deprecated:@NO
-                                     resultType:[DBTEAMMembersListResult class]
+                                     resultType:[DBTEAMMembersListV2Result class]
                                       errorType:[DBTEAMMembersListError class]
                                           attrs:@{
                                             @"auth" : @"team",
@@ -1290,38 +1215,36 @@ static NSObject *lockObj = nil;
                                           }
                           dataStructSerialBlock:nil
                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersList;
-  }
+  });
+  return DBTEAMMembersListV2;
 }
 
-+ (DBRoute *)DBTEAMMembersListContinueV2 {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersListContinueV2) {
-      DBTEAMMembersListContinueV2 = [[DBRoute alloc] init:@"members/list/continue_v2"
-                                               namespace_:@"team"
-                                               deprecated:@NO
-                                               resultType:[DBTEAMMembersListV2Result class]
-                                                errorType:[DBTEAMMembersListContinueError class]
-                                                    attrs:@{
-                                                      @"auth" : @"team",
-                                                      @"host" : @"api",
-                                                      @"style" : @"rpc"
-                                                    }
-                                    dataStructSerialBlock:nil
-                                  dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersListContinueV2;
-  }
++ (DBRoute *)DBTEAMMembersList {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersList = [[DBRoute alloc] init:@"members/list"
+                                   namespace_:@"team"
+                                   deprecated:@NO
+                                   resultType:[DBTEAMMembersListResult class]
+                                    errorType:[DBTEAMMembersListError class]
+                                        attrs:@{
+                                          @"auth" : @"team",
+                                          @"host" : @"api",
+                                          @"style" : @"rpc"
+                                        }
+                        dataStructSerialBlock:nil
+                      dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersList;
 }
 
-+ (DBRoute *)DBTEAMMembersListContinue {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersListContinue) {
-      DBTEAMMembersListContinue = [[DBRoute alloc] init:@"members/list/continue"
++ (DBRoute *)DBTEAMMembersListContinueV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersListContinueV2 = [[DBRoute alloc] init:@"members/list/continue_v2"
                                              namespace_:@"team"
                                              deprecated:@NO
-                                             resultType:[DBTEAMMembersListResult class]
+                                             resultType:[DBTEAMMembersListV2Result class]
                                               errorType:[DBTEAMMembersListContinueError class]
                                                   attrs:@{
                                                     @"auth" : @"team",
@@ -1330,181 +1253,114 @@ static NSObject *lockObj = nil;
                                                   }
                                   dataStructSerialBlock:nil
                                 dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersListContinue;
-  }
+  });
+  return DBTEAMMembersListContinueV2;
+}
+
++ (DBRoute *)DBTEAMMembersListContinue {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersListContinue = [[DBRoute alloc] init:@"members/list/continue"
+                                           namespace_:@"team"
+                                           deprecated:@NO
+                                           resultType:[DBTEAMMembersListResult class]
+                                            errorType:[DBTEAMMembersListContinueError class]
+                                                attrs:@{
+                                                  @"auth" : @"team",
+                                                  @"host" : @"api",
+                                                  @"style" : @"rpc"
+                                                }
+                                dataStructSerialBlock:nil
+                              dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersListContinue;
 }
 
 + (DBRoute *)DBTEAMMembersMoveFormerMemberFiles {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersMoveFormerMemberFiles) {
-      DBTEAMMembersMoveFormerMemberFiles = [[DBRoute alloc] init:@"members/move_former_member_files"
-                                                      namespace_:@"team"
-                                                      deprecated:@NO
-                                                      resultType:[DBASYNCLaunchEmptyResult class]
-                                                       errorType:[DBTEAMMembersTransferFormerMembersFilesError class]
-                                                           attrs:@{
-                                                             @"auth" : @"team",
-                                                             @"host" : @"api",
-                                                             @"style" : @"rpc"
-                                                           }
-                                           dataStructSerialBlock:nil
-                                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersMoveFormerMemberFiles;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersMoveFormerMemberFiles = [[DBRoute alloc] init:@"members/move_former_member_files"
+                                                    namespace_:@"team"
+                                                    deprecated:@NO
+                                                    resultType:[DBASYNCLaunchEmptyResult class]
+                                                     errorType:[DBTEAMMembersTransferFormerMembersFilesError class]
+                                                         attrs:@{
+                                                           @"auth" : @"team",
+                                                           @"host" : @"api",
+                                                           @"style" : @"rpc"
+                                                         }
+                                         dataStructSerialBlock:nil
+                                       dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersMoveFormerMemberFiles;
 }
 
 + (DBRoute *)DBTEAMMembersMoveFormerMemberFilesJobStatusCheck {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersMoveFormerMemberFilesJobStatusCheck) {
-      DBTEAMMembersMoveFormerMemberFilesJobStatusCheck =
-          [[DBRoute alloc] init:@"members/move_former_member_files/job_status/check"
-                           namespace_:@"team"
-                           deprecated:@NO
-                           resultType:[DBASYNCPollEmptyResult class]
-                            errorType:[DBASYNCPollError class]
-                                attrs:@{
-                                  @"auth" : @"team",
-                                  @"host" : @"api",
-                                  @"style" : @"rpc"
-                                }
-                dataStructSerialBlock:nil
-              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersMoveFormerMemberFilesJobStatusCheck;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersMoveFormerMemberFilesJobStatusCheck =
+        [[DBRoute alloc] init:@"members/move_former_member_files/job_status/check"
+                         namespace_:@"team"
+                         deprecated:@NO
+                         resultType:[DBASYNCPollEmptyResult class]
+                          errorType:[DBASYNCPollError class]
+                              attrs:@{
+                                @"auth" : @"team",
+                                @"host" : @"api",
+                                @"style" : @"rpc"
+                              }
+              dataStructSerialBlock:nil
+            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersMoveFormerMemberFilesJobStatusCheck;
 }
 
 + (DBRoute *)DBTEAMMembersRecover {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersRecover) {
-      DBTEAMMembersRecover = [[DBRoute alloc] init:@"members/recover"
-                                        namespace_:@"team"
-                                        deprecated:@NO
-                                        resultType:nil
-                                         errorType:[DBTEAMMembersRecoverError class]
-                                             attrs:@{
-                                               @"auth" : @"team",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersRecover;
-  }
-}
-
-+ (DBRoute *)DBTEAMMembersRemove {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersRemove) {
-      DBTEAMMembersRemove = [[DBRoute alloc] init:@"members/remove"
-                                       namespace_:@"team"
-                                       deprecated:@NO
-                                       resultType:[DBASYNCLaunchEmptyResult class]
-                                        errorType:[DBTEAMMembersRemoveError class]
-                                            attrs:@{
-                                              @"auth" : @"team",
-                                              @"host" : @"api",
-                                              @"style" : @"rpc"
-                                            }
-                            dataStructSerialBlock:nil
-                          dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersRemove;
-  }
-}
-
-+ (DBRoute *)DBTEAMMembersRemoveJobStatusGet {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersRemoveJobStatusGet) {
-      DBTEAMMembersRemoveJobStatusGet = [[DBRoute alloc] init:@"members/remove/job_status/get"
-                                                   namespace_:@"team"
-                                                   deprecated:@NO
-                                                   resultType:[DBASYNCPollEmptyResult class]
-                                                    errorType:[DBASYNCPollError class]
-                                                        attrs:@{
-                                                          @"auth" : @"team",
-                                                          @"host" : @"api",
-                                                          @"style" : @"rpc"
-                                                        }
-                                        dataStructSerialBlock:nil
-                                      dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersRemoveJobStatusGet;
-  }
-}
-
-+ (DBRoute *)DBTEAMMembersSecondaryEmailsAdd {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSecondaryEmailsAdd) {
-      DBTEAMMembersSecondaryEmailsAdd = [[DBRoute alloc] init:@"members/secondary_emails/add"
-                                                   namespace_:@"team"
-                                                   deprecated:@NO
-                                                   resultType:[DBTEAMAddSecondaryEmailsResult class]
-                                                    errorType:[DBTEAMAddSecondaryEmailsError class]
-                                                        attrs:@{
-                                                          @"auth" : @"team",
-                                                          @"host" : @"api",
-                                                          @"style" : @"rpc"
-                                                        }
-                                        dataStructSerialBlock:nil
-                                      dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSecondaryEmailsAdd;
-  }
-}
-
-+ (DBRoute *)DBTEAMMembersSecondaryEmailsDelete {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSecondaryEmailsDelete) {
-      DBTEAMMembersSecondaryEmailsDelete = [[DBRoute alloc] init:@"members/secondary_emails/delete"
-                                                      namespace_:@"team"
-                                                      deprecated:@NO
-                                                      resultType:[DBTEAMDeleteSecondaryEmailsResult class]
-                                                       errorType:nil
-                                                           attrs:@{
-                                                             @"auth" : @"team",
-                                                             @"host" : @"api",
-                                                             @"style" : @"rpc"
-                                                           }
-                                           dataStructSerialBlock:nil
-                                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSecondaryEmailsDelete;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersRecover = [[DBRoute alloc] init:@"members/recover"
+                                      namespace_:@"team"
+                                      deprecated:@NO
+                                      resultType:nil
+                                       errorType:[DBTEAMMembersRecoverError class]
+                                           attrs:@{
+                                             @"auth" : @"team",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersRecover;
 }
 
-+ (DBRoute *)DBTEAMMembersSecondaryEmailsResendVerificationEmails {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSecondaryEmailsResendVerificationEmails) {
-      DBTEAMMembersSecondaryEmailsResendVerificationEmails =
-          [[DBRoute alloc] init:@"members/secondary_emails/resend_verification_emails"
-                           namespace_:@"team"
-                           deprecated:@NO
-                           resultType:[DBTEAMResendVerificationEmailResult class]
-                            errorType:nil
-                                attrs:@{
-                                  @"auth" : @"team",
-                                  @"host" : @"api",
-                                  @"style" : @"rpc"
-                                }
-                dataStructSerialBlock:nil
-              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSecondaryEmailsResendVerificationEmails;
-  }
++ (DBRoute *)DBTEAMMembersRemove {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersRemove = [[DBRoute alloc] init:@"members/remove"
+                                     namespace_:@"team"
+                                     deprecated:@NO
+                                     resultType:[DBASYNCLaunchEmptyResult class]
+                                      errorType:[DBTEAMMembersRemoveError class]
+                                          attrs:@{
+                                            @"auth" : @"team",
+                                            @"host" : @"api",
+                                            @"style" : @"rpc"
+                                          }
+                          dataStructSerialBlock:nil
+                        dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersRemove;
 }
 
-+ (DBRoute *)DBTEAMMembersSendWelcomeEmail {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSendWelcomeEmail) {
-      DBTEAMMembersSendWelcomeEmail = [[DBRoute alloc] init:@"members/send_welcome_email"
++ (DBRoute *)DBTEAMMembersRemoveJobStatusGet {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersRemoveJobStatusGet = [[DBRoute alloc] init:@"members/remove/job_status/get"
                                                  namespace_:@"team"
                                                  deprecated:@NO
-                                                 resultType:nil
-                                                  errorType:[DBTEAMMembersSendWelcomeError class]
+                                                 resultType:[DBASYNCPollEmptyResult class]
+                                                  errorType:[DBASYNCPollError class]
                                                       attrs:@{
                                                         @"auth" : @"team",
                                                         @"host" : @"api",
@@ -1512,39 +1368,37 @@ static NSObject *lockObj = nil;
                                                       }
                                       dataStructSerialBlock:nil
                                     dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSendWelcomeEmail;
-  }
+  });
+  return DBTEAMMembersRemoveJobStatusGet;
 }
 
-+ (DBRoute *)DBTEAMMembersSetAdminPermissionsV2 {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSetAdminPermissionsV2) {
-      DBTEAMMembersSetAdminPermissionsV2 = [[DBRoute alloc] init:@"members/set_admin_permissions_v2"
-                                                      namespace_:@"team"
-                                                      deprecated:@NO
-                                                      resultType:[DBTEAMMembersSetPermissions2Result class]
-                                                       errorType:[DBTEAMMembersSetPermissions2Error class]
-                                                           attrs:@{
-                                                             @"auth" : @"team",
-                                                             @"host" : @"api",
-                                                             @"style" : @"rpc"
-                                                           }
-                                           dataStructSerialBlock:nil
-                                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSetAdminPermissionsV2;
-  }
++ (DBRoute *)DBTEAMMembersSecondaryEmailsAdd {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSecondaryEmailsAdd = [[DBRoute alloc] init:@"members/secondary_emails/add"
+                                                 namespace_:@"team"
+                                                 deprecated:@NO
+                                                 resultType:[DBTEAMAddSecondaryEmailsResult class]
+                                                  errorType:[DBTEAMAddSecondaryEmailsError class]
+                                                      attrs:@{
+                                                        @"auth" : @"team",
+                                                        @"host" : @"api",
+                                                        @"style" : @"rpc"
+                                                      }
+                                      dataStructSerialBlock:nil
+                                    dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersSecondaryEmailsAdd;
 }
 
-+ (DBRoute *)DBTEAMMembersSetAdminPermissions {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSetAdminPermissions) {
-      DBTEAMMembersSetAdminPermissions = [[DBRoute alloc] init:@"members/set_admin_permissions"
++ (DBRoute *)DBTEAMMembersSecondaryEmailsDelete {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSecondaryEmailsDelete = [[DBRoute alloc] init:@"members/secondary_emails/delete"
                                                     namespace_:@"team"
                                                     deprecated:@NO
-                                                    resultType:[DBTEAMMembersSetPermissionsResult class]
-                                                     errorType:[DBTEAMMembersSetPermissionsError class]
+                                                    resultType:[DBTEAMDeleteSecondaryEmailsResult class]
+                                                     errorType:nil
                                                          attrs:@{
                                                            @"auth" : @"team",
                                                            @"host" : @"api",
@@ -1552,38 +1406,94 @@ static NSObject *lockObj = nil;
                                                          }
                                          dataStructSerialBlock:nil
                                        dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSetAdminPermissions;
-  }
+  });
+  return DBTEAMMembersSecondaryEmailsDelete;
 }
 
-+ (DBRoute *)DBTEAMMembersSetProfileV2 {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSetProfileV2) {
-      DBTEAMMembersSetProfileV2 = [[DBRoute alloc] init:@"members/set_profile_v2"
-                                             namespace_:@"team"
-                                             deprecated:@NO
-                                             resultType:[DBTEAMTeamMemberInfoV2Result class]
-                                              errorType:[DBTEAMMembersSetProfileError class]
-                                                  attrs:@{
-                                                    @"auth" : @"team",
-                                                    @"host" : @"api",
-                                                    @"style" : @"rpc"
-                                                  }
-                                  dataStructSerialBlock:nil
-                                dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSetProfileV2;
-  }
++ (DBRoute *)DBTEAMMembersSecondaryEmailsResendVerificationEmails {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSecondaryEmailsResendVerificationEmails =
+        [[DBRoute alloc] init:@"members/secondary_emails/resend_verification_emails"
+                         namespace_:@"team"
+                         deprecated:@NO
+                         resultType:[DBTEAMResendVerificationEmailResult class]
+                          errorType:nil
+                              attrs:@{
+                                @"auth" : @"team",
+                                @"host" : @"api",
+                                @"style" : @"rpc"
+                              }
+              dataStructSerialBlock:nil
+            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersSecondaryEmailsResendVerificationEmails;
 }
 
-+ (DBRoute *)DBTEAMMembersSetProfile {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSetProfile) {
-      DBTEAMMembersSetProfile = [[DBRoute alloc] init:@"members/set_profile"
++ (DBRoute *)DBTEAMMembersSendWelcomeEmail {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSendWelcomeEmail = [[DBRoute alloc] init:@"members/send_welcome_email"
+                                               namespace_:@"team"
+                                               deprecated:@NO
+                                               resultType:nil
+                                                errorType:[DBTEAMMembersSendWelcomeError class]
+                                                    attrs:@{
+                                                      @"auth" : @"team",
+                                                      @"host" : @"api",
+                                                      @"style" : @"rpc"
+                                                    }
+                                    dataStructSerialBlock:nil
+                                  dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersSendWelcomeEmail;
+}
+
++ (DBRoute *)DBTEAMMembersSetAdminPermissionsV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSetAdminPermissionsV2 = [[DBRoute alloc] init:@"members/set_admin_permissions_v2"
+                                                    namespace_:@"team"
+                                                    deprecated:@NO
+                                                    resultType:[DBTEAMMembersSetPermissions2Result class]
+                                                     errorType:[DBTEAMMembersSetPermissions2Error class]
+                                                         attrs:@{
+                                                           @"auth" : @"team",
+                                                           @"host" : @"api",
+                                                           @"style" : @"rpc"
+                                                         }
+                                         dataStructSerialBlock:nil
+                                       dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersSetAdminPermissionsV2;
+}
+
++ (DBRoute *)DBTEAMMembersSetAdminPermissions {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSetAdminPermissions = [[DBRoute alloc] init:@"members/set_admin_permissions"
+                                                  namespace_:@"team"
+                                                  deprecated:@NO
+                                                  resultType:[DBTEAMMembersSetPermissionsResult class]
+                                                   errorType:[DBTEAMMembersSetPermissionsError class]
+                                                       attrs:@{
+                                                         @"auth" : @"team",
+                                                         @"host" : @"api",
+                                                         @"style" : @"rpc"
+                                                       }
+                                       dataStructSerialBlock:nil
+                                     dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersSetAdminPermissions;
+}
+
++ (DBRoute *)DBTEAMMembersSetProfileV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSetProfileV2 = [[DBRoute alloc] init:@"members/set_profile_v2"
                                            namespace_:@"team"
                                            deprecated:@NO
-                                           resultType:[DBTEAMTeamMemberInfo class]
+                                           resultType:[DBTEAMTeamMemberInfoV2Result class]
                                             errorType:[DBTEAMMembersSetProfileError class]
                                                 attrs:@{
                                                   @"auth" : @"team",
@@ -1592,38 +1502,36 @@ static NSObject *lockObj = nil;
                                                 }
                                 dataStructSerialBlock:nil
                               dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSetProfile;
-  }
+  });
+  return DBTEAMMembersSetProfileV2;
 }
 
-+ (DBRoute *)DBTEAMMembersSetProfilePhotoV2 {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSetProfilePhotoV2) {
-      DBTEAMMembersSetProfilePhotoV2 = [[DBRoute alloc] init:@"members/set_profile_photo_v2"
-                                                  namespace_:@"team"
-                                                  deprecated:@NO
-                                                  resultType:[DBTEAMTeamMemberInfoV2Result class]
-                                                   errorType:[DBTEAMMembersSetProfilePhotoError class]
-                                                       attrs:@{
-                                                         @"auth" : @"team",
-                                                         @"host" : @"api",
-                                                         @"style" : @"rpc"
-                                                       }
-                                       dataStructSerialBlock:nil
-                                     dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSetProfilePhotoV2;
-  }
++ (DBRoute *)DBTEAMMembersSetProfile {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSetProfile = [[DBRoute alloc] init:@"members/set_profile"
+                                         namespace_:@"team"
+                                         deprecated:@NO
+                                         resultType:[DBTEAMTeamMemberInfo class]
+                                          errorType:[DBTEAMMembersSetProfileError class]
+                                              attrs:@{
+                                                @"auth" : @"team",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersSetProfile;
 }
 
-+ (DBRoute *)DBTEAMMembersSetProfilePhoto {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSetProfilePhoto) {
-      DBTEAMMembersSetProfilePhoto = [[DBRoute alloc] init:@"members/set_profile_photo"
++ (DBRoute *)DBTEAMMembersSetProfilePhotoV2 {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSetProfilePhotoV2 = [[DBRoute alloc] init:@"members/set_profile_photo_v2"
                                                 namespace_:@"team"
                                                 deprecated:@NO
-                                                resultType:[DBTEAMTeamMemberInfo class]
+                                                resultType:[DBTEAMTeamMemberInfoV2Result class]
                                                  errorType:[DBTEAMMembersSetProfilePhotoError class]
                                                      attrs:@{
                                                        @"auth" : @"team",
@@ -1632,19 +1540,56 @@ static NSObject *lockObj = nil;
                                                      }
                                      dataStructSerialBlock:nil
                                    dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSetProfilePhoto;
-  }
+  });
+  return DBTEAMMembersSetProfilePhotoV2;
+}
+
++ (DBRoute *)DBTEAMMembersSetProfilePhoto {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSetProfilePhoto = [[DBRoute alloc] init:@"members/set_profile_photo"
+                                              namespace_:@"team"
+                                              deprecated:@NO
+                                              resultType:[DBTEAMTeamMemberInfo class]
+                                               errorType:[DBTEAMMembersSetProfilePhotoError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersSetProfilePhoto;
 }
 
 + (DBRoute *)DBTEAMMembersSuspend {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersSuspend) {
-      DBTEAMMembersSuspend = [[DBRoute alloc] init:@"members/suspend"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersSuspend = [[DBRoute alloc] init:@"members/suspend"
+                                      namespace_:@"team"
+                                      deprecated:@NO
+                                      resultType:nil
+                                       errorType:[DBTEAMMembersSuspendError class]
+                                           attrs:@{
+                                             @"auth" : @"team",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBTEAMMembersSuspend;
+}
+
++ (DBRoute *)DBTEAMMembersUnsuspend {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMMembersUnsuspend = [[DBRoute alloc] init:@"members/unsuspend"
                                         namespace_:@"team"
                                         deprecated:@NO
                                         resultType:nil
-                                         errorType:[DBTEAMMembersSuspendError class]
+                                         errorType:[DBTEAMMembersUnsuspendError class]
                                              attrs:@{
                                                @"auth" : @"team",
                                                @"host" : @"api",
@@ -1652,119 +1597,113 @@ static NSObject *lockObj = nil;
                                              }
                              dataStructSerialBlock:nil
                            dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersSuspend;
-  }
-}
-
-+ (DBRoute *)DBTEAMMembersUnsuspend {
-  @synchronized(lockObj) {
-    if (!DBTEAMMembersUnsuspend) {
-      DBTEAMMembersUnsuspend = [[DBRoute alloc] init:@"members/unsuspend"
-                                          namespace_:@"team"
-                                          deprecated:@NO
-                                          resultType:nil
-                                           errorType:[DBTEAMMembersUnsuspendError class]
-                                               attrs:@{
-                                                 @"auth" : @"team",
-                                                 @"host" : @"api",
-                                                 @"style" : @"rpc"
-                                               }
-                               dataStructSerialBlock:nil
-                             dataStructDeserialBlock:nil];
-    }
-    return DBTEAMMembersUnsuspend;
-  }
+  });
+  return DBTEAMMembersUnsuspend;
 }
 
 + (DBRoute *)DBTEAMNamespacesList {
-  @synchronized(lockObj) {
-    if (!DBTEAMNamespacesList) {
-      DBTEAMNamespacesList = [[DBRoute alloc] init:@"namespaces/list"
-                                        namespace_:@"team"
-                                        deprecated:@NO
-                                        resultType:[DBTEAMTeamNamespacesListResult class]
-                                         errorType:[DBTEAMTeamNamespacesListError class]
-                                             attrs:@{
-                                               @"auth" : @"team",
-                                               @"host" : @"api",
-                                               @"style" : @"rpc"
-                                             }
-                             dataStructSerialBlock:nil
-                           dataStructDeserialBlock:nil];
-    }
-    return DBTEAMNamespacesList;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMNamespacesList = [[DBRoute alloc] init:@"namespaces/list"
+                                      namespace_:@"team"
+                                      deprecated:@NO
+                                      resultType:[DBTEAMTeamNamespacesListResult class]
+                                       errorType:[DBTEAMTeamNamespacesListError class]
+                                           attrs:@{
+                                             @"auth" : @"team",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBTEAMNamespacesList;
 }
 
 + (DBRoute *)DBTEAMNamespacesListContinue {
-  @synchronized(lockObj) {
-    if (!DBTEAMNamespacesListContinue) {
-      DBTEAMNamespacesListContinue = [[DBRoute alloc] init:@"namespaces/list/continue"
-                                                namespace_:@"team"
-                                                deprecated:@NO
-                                                resultType:[DBTEAMTeamNamespacesListResult class]
-                                                 errorType:[DBTEAMTeamNamespacesListContinueError class]
-                                                     attrs:@{
-                                                       @"auth" : @"team",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBTEAMNamespacesListContinue;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMNamespacesListContinue = [[DBRoute alloc] init:@"namespaces/list/continue"
+                                              namespace_:@"team"
+                                              deprecated:@NO
+                                              resultType:[DBTEAMTeamNamespacesListResult class]
+                                               errorType:[DBTEAMTeamNamespacesListContinueError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMNamespacesListContinue;
 }
 
 + (DBRoute *)DBTEAMPropertiesTemplateAdd {
-  @synchronized(lockObj) {
-    if (!DBTEAMPropertiesTemplateAdd) {
-      DBTEAMPropertiesTemplateAdd = [[DBRoute alloc] init:@"properties/template/add"
-                                               namespace_:@"team"
-                                               deprecated:@YES
-                                               resultType:[DBFILEPROPERTIESAddTemplateResult class]
-                                                errorType:[DBFILEPROPERTIESModifyTemplateError class]
-                                                    attrs:@{
-                                                      @"auth" : @"team",
-                                                      @"host" : @"api",
-                                                      @"style" : @"rpc"
-                                                    }
-                                    dataStructSerialBlock:nil
-                                  dataStructDeserialBlock:nil];
-    }
-    return DBTEAMPropertiesTemplateAdd;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMPropertiesTemplateAdd = [[DBRoute alloc] init:@"properties/template/add"
+                                             namespace_:@"team"
+                                             deprecated:@YES
+                                             resultType:[DBFILEPROPERTIESAddTemplateResult class]
+                                              errorType:[DBFILEPROPERTIESModifyTemplateError class]
+                                                  attrs:@{
+                                                    @"auth" : @"team",
+                                                    @"host" : @"api",
+                                                    @"style" : @"rpc"
+                                                  }
+                                  dataStructSerialBlock:nil
+                                dataStructDeserialBlock:nil];
+  });
+  return DBTEAMPropertiesTemplateAdd;
 }
 
 + (DBRoute *)DBTEAMPropertiesTemplateGet {
-  @synchronized(lockObj) {
-    if (!DBTEAMPropertiesTemplateGet) {
-      DBTEAMPropertiesTemplateGet = [[DBRoute alloc] init:@"properties/template/get"
-                                               namespace_:@"team"
-                                               deprecated:@YES
-                                               resultType:[DBFILEPROPERTIESGetTemplateResult class]
-                                                errorType:[DBFILEPROPERTIESTemplateError class]
-                                                    attrs:@{
-                                                      @"auth" : @"team",
-                                                      @"host" : @"api",
-                                                      @"style" : @"rpc"
-                                                    }
-                                    dataStructSerialBlock:nil
-                                  dataStructDeserialBlock:nil];
-    }
-    return DBTEAMPropertiesTemplateGet;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMPropertiesTemplateGet = [[DBRoute alloc] init:@"properties/template/get"
+                                             namespace_:@"team"
+                                             deprecated:@YES
+                                             resultType:[DBFILEPROPERTIESGetTemplateResult class]
+                                              errorType:[DBFILEPROPERTIESTemplateError class]
+                                                  attrs:@{
+                                                    @"auth" : @"team",
+                                                    @"host" : @"api",
+                                                    @"style" : @"rpc"
+                                                  }
+                                  dataStructSerialBlock:nil
+                                dataStructDeserialBlock:nil];
+  });
+  return DBTEAMPropertiesTemplateGet;
 }
 
 + (DBRoute *)DBTEAMPropertiesTemplateList {
-  @synchronized(lockObj) {
-    if (!DBTEAMPropertiesTemplateList) {
-      DBTEAMPropertiesTemplateList = [[DBRoute alloc] init:@"properties/template/list"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMPropertiesTemplateList = [[DBRoute alloc] init:@"properties/template/list"
+                                              namespace_:@"team"
+                                              deprecated:@YES
+                                              resultType:[DBFILEPROPERTIESListTemplateResult class]
+                                               errorType:[DBFILEPROPERTIESTemplateError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMPropertiesTemplateList;
+}
+
++ (DBRoute *)DBTEAMPropertiesTemplateUpdate {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMPropertiesTemplateUpdate = [[DBRoute alloc] init:@"properties/template/update"
                                                 namespace_:@"team"
                                                 deprecated:@YES
-                                                resultType:[DBFILEPROPERTIESListTemplateResult class]
-                                                 errorType:[DBFILEPROPERTIESTemplateError class]
+                                                resultType:[DBFILEPROPERTIESUpdateTemplateResult class]
+                                                 errorType:[DBFILEPROPERTIESModifyTemplateError class]
                                                      attrs:@{
                                                        @"auth" : @"team",
                                                        @"host" : @"api",
@@ -1772,119 +1711,56 @@ static NSObject *lockObj = nil;
                                                      }
                                      dataStructSerialBlock:nil
                                    dataStructDeserialBlock:nil];
-    }
-    return DBTEAMPropertiesTemplateList;
-  }
-}
-
-+ (DBRoute *)DBTEAMPropertiesTemplateUpdate {
-  @synchronized(lockObj) {
-    if (!DBTEAMPropertiesTemplateUpdate) {
-      DBTEAMPropertiesTemplateUpdate = [[DBRoute alloc] init:@"properties/template/update"
-                                                  namespace_:@"team"
-                                                  deprecated:@YES
-                                                  resultType:[DBFILEPROPERTIESUpdateTemplateResult class]
-                                                   errorType:[DBFILEPROPERTIESModifyTemplateError class]
-                                                       attrs:@{
-                                                         @"auth" : @"team",
-                                                         @"host" : @"api",
-                                                         @"style" : @"rpc"
-                                                       }
-                                       dataStructSerialBlock:nil
-                                     dataStructDeserialBlock:nil];
-    }
-    return DBTEAMPropertiesTemplateUpdate;
-  }
+  });
+  return DBTEAMPropertiesTemplateUpdate;
 }
 
 + (DBRoute *)DBTEAMReportsGetActivity {
-  @synchronized(lockObj) {
-    if (!DBTEAMReportsGetActivity) {
-      DBTEAMReportsGetActivity = [[DBRoute alloc] init:@"reports/get_activity"
-                                            namespace_:@"team"
-                                            deprecated:@YES
-                                            resultType:[DBTEAMGetActivityReport class]
-                                             errorType:[DBTEAMDateRangeError class]
-                                                 attrs:@{
-                                                   @"auth" : @"team",
-                                                   @"host" : @"api",
-                                                   @"style" : @"rpc"
-                                                 }
-                                 dataStructSerialBlock:nil
-                               dataStructDeserialBlock:nil];
-    }
-    return DBTEAMReportsGetActivity;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMReportsGetActivity = [[DBRoute alloc] init:@"reports/get_activity"
+                                          namespace_:@"team"
+                                          deprecated:@YES
+                                          resultType:[DBTEAMGetActivityReport class]
+                                           errorType:[DBTEAMDateRangeError class]
+                                               attrs:@{
+                                                 @"auth" : @"team",
+                                                 @"host" : @"api",
+                                                 @"style" : @"rpc"
+                                               }
+                               dataStructSerialBlock:nil
+                             dataStructDeserialBlock:nil];
+  });
+  return DBTEAMReportsGetActivity;
 }
 
 + (DBRoute *)DBTEAMReportsGetDevices {
-  @synchronized(lockObj) {
-    if (!DBTEAMReportsGetDevices) {
-      DBTEAMReportsGetDevices = [[DBRoute alloc] init:@"reports/get_devices"
-                                           namespace_:@"team"
-                                           deprecated:@YES
-                                           resultType:[DBTEAMGetDevicesReport class]
-                                            errorType:[DBTEAMDateRangeError class]
-                                                attrs:@{
-                                                  @"auth" : @"team",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMReportsGetDevices;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMReportsGetDevices = [[DBRoute alloc] init:@"reports/get_devices"
+                                         namespace_:@"team"
+                                         deprecated:@YES
+                                         resultType:[DBTEAMGetDevicesReport class]
+                                          errorType:[DBTEAMDateRangeError class]
+                                              attrs:@{
+                                                @"auth" : @"team",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMReportsGetDevices;
 }
 
 + (DBRoute *)DBTEAMReportsGetMembership {
-  @synchronized(lockObj) {
-    if (!DBTEAMReportsGetMembership) {
-      DBTEAMReportsGetMembership = [[DBRoute alloc] init:@"reports/get_membership"
-                                              namespace_:@"team"
-                                              deprecated:@YES
-                                              resultType:[DBTEAMGetMembershipReport class]
-                                               errorType:[DBTEAMDateRangeError class]
-                                                   attrs:@{
-                                                     @"auth" : @"team",
-                                                     @"host" : @"api",
-                                                     @"style" : @"rpc"
-                                                   }
-                                   dataStructSerialBlock:nil
-                                 dataStructDeserialBlock:nil];
-    }
-    return DBTEAMReportsGetMembership;
-  }
-}
-
-+ (DBRoute *)DBTEAMReportsGetStorage {
-  @synchronized(lockObj) {
-    if (!DBTEAMReportsGetStorage) {
-      DBTEAMReportsGetStorage = [[DBRoute alloc] init:@"reports/get_storage"
-                                           namespace_:@"team"
-                                           deprecated:@YES
-                                           resultType:[DBTEAMGetStorageReport class]
-                                            errorType:[DBTEAMDateRangeError class]
-                                                attrs:@{
-                                                  @"auth" : @"team",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMReportsGetStorage;
-  }
-}
-
-+ (DBRoute *)DBTEAMTeamFolderActivate {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderActivate) {
-      DBTEAMTeamFolderActivate = [[DBRoute alloc] init:@"team_folder/activate"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMReportsGetMembership = [[DBRoute alloc] init:@"reports/get_membership"
                                             namespace_:@"team"
-                                            deprecated:@NO
-                                            resultType:[DBTEAMTeamFolderMetadata class]
-                                             errorType:[DBTEAMTeamFolderActivateError class]
+                                            deprecated:@YES
+                                            resultType:[DBTEAMGetMembershipReport class]
+                                             errorType:[DBTEAMDateRangeError class]
                                                  attrs:@{
                                                    @"auth" : @"team",
                                                    @"host" : @"api",
@@ -1892,59 +1768,37 @@ static NSObject *lockObj = nil;
                                                  }
                                  dataStructSerialBlock:nil
                                dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTeamFolderActivate;
-  }
-}
-
-+ (DBRoute *)DBTEAMTeamFolderArchive {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderArchive) {
-      DBTEAMTeamFolderArchive = [[DBRoute alloc] init:@"team_folder/archive"
-                                           namespace_:@"team"
-                                           deprecated:@NO
-                                           resultType:[DBTEAMTeamFolderArchiveLaunch class]
-                                            errorType:[DBTEAMTeamFolderArchiveError class]
-                                                attrs:@{
-                                                  @"auth" : @"team",
-                                                  @"host" : @"api",
-                                                  @"style" : @"rpc"
-                                                }
-                                dataStructSerialBlock:nil
-                              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTeamFolderArchive;
-  }
+  });
+  return DBTEAMReportsGetMembership;
 }
 
-+ (DBRoute *)DBTEAMTeamFolderArchiveCheck {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderArchiveCheck) {
-      DBTEAMTeamFolderArchiveCheck = [[DBRoute alloc] init:@"team_folder/archive/check"
-                                                namespace_:@"team"
-                                                deprecated:@NO
-                                                resultType:[DBTEAMTeamFolderArchiveJobStatus class]
-                                                 errorType:[DBASYNCPollError class]
-                                                     attrs:@{
-                                                       @"auth" : @"team",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTeamFolderArchiveCheck;
-  }
++ (DBRoute *)DBTEAMReportsGetStorage {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMReportsGetStorage = [[DBRoute alloc] init:@"reports/get_storage"
+                                         namespace_:@"team"
+                                         deprecated:@YES
+                                         resultType:[DBTEAMGetStorageReport class]
+                                          errorType:[DBTEAMDateRangeError class]
+                                              attrs:@{
+                                                @"auth" : @"team",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMReportsGetStorage;
 }
 
-+ (DBRoute *)DBTEAMTeamFolderCreate {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderCreate) {
-      DBTEAMTeamFolderCreate = [[DBRoute alloc] init:@"team_folder/create"
++ (DBRoute *)DBTEAMTeamFolderActivate {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderActivate = [[DBRoute alloc] init:@"team_folder/activate"
                                           namespace_:@"team"
                                           deprecated:@NO
                                           resultType:[DBTEAMTeamFolderMetadata class]
-                                           errorType:[DBTEAMTeamFolderCreateError class]
+                                           errorType:[DBTEAMTeamFolderActivateError class]
                                                attrs:@{
                                                  @"auth" : @"team",
                                                  @"host" : @"api",
@@ -1952,44 +1806,56 @@ static NSObject *lockObj = nil;
                                                }
                                dataStructSerialBlock:nil
                              dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTeamFolderCreate;
-  }
+  });
+  return DBTEAMTeamFolderActivate;
 }
 
-+ (DBRoute *)DBTEAMTeamFolderGetInfo {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderGetInfo) {
-      DBTEAMTeamFolderGetInfo = [[DBRoute alloc] init:@"team_folder/get_info"
-          namespace_:@"team"
-          deprecated:@NO
-          resultType:[NSArray<DBTEAMTeamFolderGetInfoItem *> class]
-          errorType:nil
-          attrs:@{
-            @"auth" : @"team",
-            @"host" : @"api",
-            @"style" : @"rpc"
-          }
-          dataStructSerialBlock:nil
-          dataStructDeserialBlock:^id(id dataStruct) {
-            return [DBArraySerializer deserialize:dataStruct
-                                        withBlock:^id(id elem0) {
-                                          return [DBTEAMTeamFolderGetInfoItemSerializer deserialize:elem0];
-                                        }];
-          }];
-    }
-    return DBTEAMTeamFolderGetInfo;
-  }
++ (DBRoute *)DBTEAMTeamFolderArchive {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderArchive = [[DBRoute alloc] init:@"team_folder/archive"
+                                         namespace_:@"team"
+                                         deprecated:@NO
+                                         resultType:[DBTEAMTeamFolderArchiveLaunch class]
+                                          errorType:[DBTEAMTeamFolderArchiveError class]
+                                              attrs:@{
+                                                @"auth" : @"team",
+                                                @"host" : @"api",
+                                                @"style" : @"rpc"
+                                              }
+                              dataStructSerialBlock:nil
+                            dataStructDeserialBlock:nil];
+  });
+  return DBTEAMTeamFolderArchive;
 }
 
-+ (DBRoute *)DBTEAMTeamFolderList {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderList) {
-      DBTEAMTeamFolderList = [[DBRoute alloc] init:@"team_folder/list"
++ (DBRoute *)DBTEAMTeamFolderArchiveCheck {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderArchiveCheck = [[DBRoute alloc] init:@"team_folder/archive/check"
+                                              namespace_:@"team"
+                                              deprecated:@NO
+                                              resultType:[DBTEAMTeamFolderArchiveJobStatus class]
+                                               errorType:[DBASYNCPollError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMTeamFolderArchiveCheck;
+}
+
++ (DBRoute *)DBTEAMTeamFolderCreate {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderCreate = [[DBRoute alloc] init:@"team_folder/create"
                                         namespace_:@"team"
                                         deprecated:@NO
-                                        resultType:[DBTEAMTeamFolderListResult class]
-                                         errorType:[DBTEAMTeamFolderListError class]
+                                        resultType:[DBTEAMTeamFolderMetadata class]
+                                         errorType:[DBTEAMTeamFolderCreateError class]
                                              attrs:@{
                                                @"auth" : @"team",
                                                @"host" : @"api",
@@ -1997,99 +1863,118 @@ static NSObject *lockObj = nil;
                                              }
                              dataStructSerialBlock:nil
                            dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTeamFolderList;
-  }
+  });
+  return DBTEAMTeamFolderCreate;
+}
+
++ (DBRoute *)DBTEAMTeamFolderGetInfo {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderGetInfo = [[DBRoute alloc] init:@"team_folder/get_info"
+        namespace_:@"team"
+        deprecated:@NO
+        resultType:[NSArray<DBTEAMTeamFolderGetInfoItem *> class]
+        errorType:nil
+        attrs:@{
+          @"auth" : @"team",
+          @"host" : @"api",
+          @"style" : @"rpc"
+        }
+        dataStructSerialBlock:nil
+        dataStructDeserialBlock:^id(id dataStruct) {
+          return [DBArraySerializer deserialize:dataStruct
+                                      withBlock:^id(id elem0) {
+                                        return [DBTEAMTeamFolderGetInfoItemSerializer deserialize:elem0];
+                                      }];
+        }];
+  });
+  return DBTEAMTeamFolderGetInfo;
+}
+
++ (DBRoute *)DBTEAMTeamFolderList {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderList = [[DBRoute alloc] init:@"team_folder/list"
+                                      namespace_:@"team"
+                                      deprecated:@NO
+                                      resultType:[DBTEAMTeamFolderListResult class]
+                                       errorType:[DBTEAMTeamFolderListError class]
+                                           attrs:@{
+                                             @"auth" : @"team",
+                                             @"host" : @"api",
+                                             @"style" : @"rpc"
+                                           }
+                           dataStructSerialBlock:nil
+                         dataStructDeserialBlock:nil];
+  });
+  return DBTEAMTeamFolderList;
 }
 
 + (DBRoute *)DBTEAMTeamFolderListContinue {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderListContinue) {
-      DBTEAMTeamFolderListContinue = [[DBRoute alloc] init:@"team_folder/list/continue"
-                                                namespace_:@"team"
-                                                deprecated:@NO
-                                                resultType:[DBTEAMTeamFolderListResult class]
-                                                 errorType:[DBTEAMTeamFolderListContinueError class]
-                                                     attrs:@{
-                                                       @"auth" : @"team",
-                                                       @"host" : @"api",
-                                                       @"style" : @"rpc"
-                                                     }
-                                     dataStructSerialBlock:nil
-                                   dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTeamFolderListContinue;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderListContinue = [[DBRoute alloc] init:@"team_folder/list/continue"
+                                              namespace_:@"team"
+                                              deprecated:@NO
+                                              resultType:[DBTEAMTeamFolderListResult class]
+                                               errorType:[DBTEAMTeamFolderListContinueError class]
+                                                   attrs:@{
+                                                     @"auth" : @"team",
+                                                     @"host" : @"api",
+                                                     @"style" : @"rpc"
+                                                   }
+                                   dataStructSerialBlock:nil
+                                 dataStructDeserialBlock:nil];
+  });
+  return DBTEAMTeamFolderListContinue;
 }
 
 + (DBRoute *)DBTEAMTeamFolderPermanentlyDelete {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderPermanentlyDelete) {
-      DBTEAMTeamFolderPermanentlyDelete = [[DBRoute alloc] init:@"team_folder/permanently_delete"
-                                                     namespace_:@"team"
-                                                     deprecated:@NO
-                                                     resultType:nil
-                                                      errorType:[DBTEAMTeamFolderPermanentlyDeleteError class]
-                                                          attrs:@{
-                                                            @"auth" : @"team",
-                                                            @"host" : @"api",
-                                                            @"style" : @"rpc"
-                                                          }
-                                          dataStructSerialBlock:nil
-                                        dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTeamFolderPermanentlyDelete;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderPermanentlyDelete = [[DBRoute alloc] init:@"team_folder/permanently_delete"
+                                                   namespace_:@"team"
+                                                   deprecated:@NO
+                                                   resultType:nil
+                                                    errorType:[DBTEAMTeamFolderPermanentlyDeleteError class]
+                                                        attrs:@{
+                                                          @"auth" : @"team",
+                                                          @"host" : @"api",
+                                                          @"style" : @"rpc"
+                                                        }
+                                        dataStructSerialBlock:nil
+                                      dataStructDeserialBlock:nil];
+  });
+  return DBTEAMTeamFolderPermanentlyDelete;
 }
 
 + (DBRoute *)DBTEAMTeamFolderRename {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderRename) {
-      DBTEAMTeamFolderRename = [[DBRoute alloc] init:@"team_folder/rename"
-                                          namespace_:@"team"
-                                          deprecated:@NO
-                                          resultType:[DBTEAMTeamFolderMetadata class]
-                                           errorType:[DBTEAMTeamFolderRenameError class]
-                                               attrs:@{
-                                                 @"auth" : @"team",
-                                                 @"host" : @"api",
-                                                 @"style" : @"rpc"
-                                               }
-                               dataStructSerialBlock:nil
-                             dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTeamFolderRename;
-  }
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderRename = [[DBRoute alloc] init:@"team_folder/rename"
+                                        namespace_:@"team"
+                                        deprecated:@NO
+                                        resultType:[DBTEAMTeamFolderMetadata class]
+                                         errorType:[DBTEAMTeamFolderRenameError class]
+                                             attrs:@{
+                                               @"auth" : @"team",
+                                               @"host" : @"api",
+                                               @"style" : @"rpc"
+                                             }
+                             dataStructSerialBlock:nil
+                           dataStructDeserialBlock:nil];
+  });
+  return DBTEAMTeamFolderRename;
 }
 
 + (DBRoute *)DBTEAMTeamFolderUpdateSyncSettings {
-  @synchronized(lockObj) {
-    if (!DBTEAMTeamFolderUpdateSyncSettings) {
-      DBTEAMTeamFolderUpdateSyncSettings = [[DBRoute alloc] init:@"team_folder/update_sync_settings"
-                                                      namespace_:@"team"
-                                                      deprecated:@NO
-                                                      resultType:[DBTEAMTeamFolderMetadata class]
-                                                       errorType:[DBTEAMTeamFolderUpdateSyncSettingsError class]
-                                                           attrs:@{
-                                                             @"auth" : @"team",
-                                                             @"host" : @"api",
-                                                             @"style" : @"rpc"
-                                                           }
-                                           dataStructSerialBlock:nil
-                                         dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTeamFolderUpdateSyncSettings;
-  }
-}
-
-+ (DBRoute *)DBTEAMTokenGetAuthenticatedAdmin {
-  @synchronized(lockObj) {
-    if (!DBTEAMTokenGetAuthenticatedAdmin) {
-      DBTEAMTokenGetAuthenticatedAdmin = [[DBRoute alloc] init:@"token/get_authenticated_admin"
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTeamFolderUpdateSyncSettings = [[DBRoute alloc] init:@"team_folder/update_sync_settings"
                                                     namespace_:@"team"
                                                     deprecated:@NO
-                                                    resultType:[DBTEAMTokenGetAuthenticatedAdminResult class]
-                                                     errorType:[DBTEAMTokenGetAuthenticatedAdminError class]
+                                                    resultType:[DBTEAMTeamFolderMetadata class]
+                                                     errorType:[DBTEAMTeamFolderUpdateSyncSettingsError class]
                                                          attrs:@{
                                                            @"auth" : @"team",
                                                            @"host" : @"api",
@@ -2097,9 +1982,27 @@ static NSObject *lockObj = nil;
                                                          }
                                          dataStructSerialBlock:nil
                                        dataStructDeserialBlock:nil];
-    }
-    return DBTEAMTokenGetAuthenticatedAdmin;
-  }
+  });
+  return DBTEAMTeamFolderUpdateSyncSettings;
+}
+
++ (DBRoute *)DBTEAMTokenGetAuthenticatedAdmin {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    DBTEAMTokenGetAuthenticatedAdmin = [[DBRoute alloc] init:@"token/get_authenticated_admin"
+                                                  namespace_:@"team"
+                                                  deprecated:@NO
+                                                  resultType:[DBTEAMTokenGetAuthenticatedAdminResult class]
+                                                   errorType:[DBTEAMTokenGetAuthenticatedAdminError class]
+                                                       attrs:@{
+                                                         @"auth" : @"team",
+                                                         @"host" : @"api",
+                                                         @"style" : @"rpc"
+                                                       }
+                                       dataStructSerialBlock:nil
+                                     dataStructDeserialBlock:nil];
+  });
+  return DBTEAMTokenGetAuthenticatedAdmin;
 }
 
 @end
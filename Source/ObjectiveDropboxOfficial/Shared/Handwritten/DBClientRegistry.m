@@ -0,0 +1,155 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <stdatomic.h>
+
+#import "DBClientRegistry.h"
+#import "DBOAuthManager.h"
+
+/// A registered token, with its client once created.
+@interface DBClientRegistryEntry : NSObject
+
+@property (nonatomic, readonly) DBAccessToken *token;
+@property (atomic, strong, nullable) id client;
+
+/// The client once released, for as long as it is in use elsewhere, so that it is handed out again rather than a
+/// second client refreshing the same token.
+@property (atomic, weak, nullable) id releasedClient;
+
+/// The registry's use count at the latest lookup of the client, for picking the clients to release.
+@property (atomic) uint64_t lastUse;
+
+@end
+
+@implementation DBClientRegistryEntry
+
+- (instancetype)initWithToken:(DBAccessToken *)token {
+  self = [super init];
+  if (self) {
+    _token = token;
+  }
+  return self;
+}
+
+@end
+
+@interface DBClientRegistry ()
+
+/// Replaced, never mutated, under the lock on `self`.
+@property (atomic, copy) NSDictionary<NSString *, DBClientRegistryEntry *> *entries;
+
+@end
+
+@implementation DBClientRegistry {
+  id (^_clientFactory)(DBAccessToken *);
+  _Atomic(uint64_t) _useCount;
+}
+
+- (instancetype)initWithClientFactory:(id (^)(DBAccessToken *))clientFactory {
+  self = [super init];
+  if (self) {
+    _clientFactory = [clientFactory copy];
+    _entries = @{};
+  }
+  return self;
+}
+
+- (NSArray<NSString *> *)tokenUids {
+  return self.entries.allKeys;
+}
+
+- (void)registerToken:(DBAccessToken *)token {
+  @synchronized(self) {
+    NSMutableDictionary<NSString *, DBClientRegistryEntry *> *entries = [self.entries mutableCopy];
+    entries[token.uid] = [[DBClientRegistryEntry alloc] initWithToken:token];
+    self.entries = entries;
+  }
+}
+
+- (void)removeTokenUid:(NSString *)tokenUid {
+  @synchronized(self) {
+    NSMutableDictionary<NSString *, DBClientRegistryEntry *> *entries = [self.entries mutableCopy];
+    [entries removeObjectForKey:tokenUid];
+    self.entries = entries;
+  }
+}
+
+- (void)removeAllTokens {
+  @synchronized(self) {
+    self.entries = @{};
+  }
+}
+
+- (id)clientForTokenUid:(NSString *)tokenUid {
+  DBClientRegistryEntry *entry = self.entries[tokenUid];
+  if (!entry) {
+    return nil;
+  }
+  entry.lastUse = atomic_fetch_add_explicit(&_useCount, 1, memory_order_relaxed) + 1;
+  return entry.client ?: [self db_createClientForEntry:entry];
+}
+
+- (id)defaultClient {
+  NSString *tokenUid = self.defaultTokenUid;
+  return tokenUid ? [self clientForTokenUid:tokenUid] : nil;
+}
+
+- (NSDictionary<NSString *, id> *)allClients {
+  NSDictionary<NSString *, DBClientRegistryEntry *> *entries = self.entries;
+  NSMutableDictionary<NSString *, id> *clients = [NSMutableDictionary dictionaryWithCapacity:entries.count];
+  for (NSString *tokenUid in entries) {
+    DBClientRegistryEntry *entry = entries[tokenUid];
+    clients[tokenUid] = entry.client ?: [self db_createClientForEntry:entry];
+  }
+  return clients;
+}
+
+#pragma mark - Private helpers
+
+- (id)db_createClientForEntry:(DBClientRegistryEntry *)entry {
+  @synchronized(self) {
+    // another thread may have got here first
+    id client = entry.client;
+    if (!client) {
+      client = entry.releasedClient ?: _clientFactory(entry.token);
+      entry.client = client;
+      [self db_releaseClientsExcept:entry];
+    }
+    return client;
+  }
+}
+
+// Called under the lock on `self`.
+- (void)db_releaseClientsExcept:(DBClientRegistryEntry *)keptEntry {
+  NSUInteger maxActiveClients = self.maxActiveClients;
+  if (maxActiveClients == 0) {
+    return;
+  }
+  NSString *defaultTokenUid = self.defaultTokenUid;
+  NSMutableArray<DBClientRegistryEntry *> *releasable = [NSMutableArray new];
+  NSDictionary<NSString *, DBClientRegistryEntry *> *entries = self.entries;
+  for (NSString *tokenUid in entries) {
+    DBClientRegistryEntry *entry = entries[tokenUid];
+    if (entry.client && entry != keptEntry && ![tokenUid isEqualToString:defaultTokenUid]) {
+      [releasable addObject:entry];
+    }
+  }
+  // the new client counts towards the limit, unless it is the default one
+  NSUInteger activeClients = releasable.count + ([keptEntry.token.uid isEqualToString:defaultTokenUid] ? 0 : 1);
+  if (activeClients <= maxActiveClients) {
+    return;
+  }
+  [releasable sortUsingComparator:^NSComparisonResult(DBClientRegistryEntry *entry1, DBClientRegistryEntry *entry2) {
+    uint64_t lastUse1 = entry1.lastUse;
+    uint64_t lastUse2 = entry2.lastUse;
+    return lastUse1 < lastUse2 ? NSOrderedAscending : lastUse1 > lastUse2 ? NSOrderedDescending : NSOrderedSame;
+  }];
+  // clients still in use elsewhere live on, and are handed out again if looked up meanwhile
+  for (NSUInteger i = 0; i < activeClients - maxActiveClients && i < releasable.count; i++) {
+    releasable[i].releasedClient = releasable[i].client;
+    releasable[i].client = nil;
+  }
+}
+
+@end
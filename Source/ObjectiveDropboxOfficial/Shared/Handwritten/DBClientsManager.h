@@ -38,9 +38,23 @@ NS_ASSUME_NONNULL_BEGIN
 ///
 + (nullable DBUserClient *)authorizedClient;
 
+///
+/// Multi-Dropbox account use case. Accessor method for the authorized `DBUserClient` of one account.
+///
+/// Clients are created when first accessed, and looking up a client already created doesn't wait on other threads.
+///
+/// @param tokenUid The uid of the access token of the account.
+///
+/// @return The authorized `DBUserClient` instance of the account, or `nil` if the account isn't authorized.
+///
++ (nullable DBUserClient *)authorizedClientWithTokenUid:(NSString *)tokenUid;
+
 ///
 /// Multi-Dropbox account use case. Returns all current Dropbox user clients.
 ///
+/// Creates the clients of all accounts not accessed yet; prefer `authorizedClientWithTokenUid:` to access a few
+/// accounts of many.
+///
 /// @return Mapping of `tokenUid` (account ID) to authorized `DBUserClient` instance.
 ///
 + (NSDictionary<NSString *, DBUserClient *> *)authorizedClients;
@@ -52,13 +66,44 @@ NS_ASSUME_NONNULL_BEGIN
 ///
 + (nullable DBTeamClient *)authorizedTeamClient;
 
+///
+/// Multi-Dropbox account use case. Accessor method for the authorized `DBTeamClient` of one account.
+///
+/// Clients are created when first accessed, and looking up a client already created doesn't wait on other threads.
+///
+/// @param tokenUid The uid of the access token of the account.
+///
+/// @return The authorized `DBTeamClient` instance of the account, or `nil` if the account isn't authorized.
+///
++ (nullable DBTeamClient *)authorizedTeamClientWithTokenUid:(NSString *)tokenUid;
+
 ///
 /// Multi-Dropbox account use case. Returns all current Dropbox team clients.
 ///
+/// Creates the clients of all accounts not accessed yet; prefer `authorizedTeamClientWithTokenUid:` to access a few
+/// accounts of many.
+///
 /// @return Mapping of `tokenUid` (account ID) to authorized `DBTeamClient` instance.
 ///
 + (NSDictionary<NSString *, DBTeamClient *> *)authorizedTeamClients;
 
+///
+/// Multi-Dropbox account use case. The most user clients, and separately team clients, kept at a time besides
+/// `authorizedClient` and `authorizedTeamClient`, or 0 for no limit.
+///
+/// Beyond it, the clients accessed least recently are released along with their sessions once no longer in use
+/// elsewhere, and created again when next accessed. Defaults to 0.
+///
+@property (class, nonatomic) NSUInteger maxActiveClients;
+
+///
+/// Multi-Dropbox account use case. Whether the clients of all accounts make their requests through one set of
+/// sessions, and so share one connection pool, rather than each setting up its own.
+///
+/// Applies to clients created after it is set, so set it before setting up the manager. Defaults to `NO`.
+///
+@property (class, nonatomic) BOOL sharesSessionsAcrossClients;
+
 ///
 /// Multi-Dropbox account use case. Creates and stores a new shared authorized user client instance with the access
 /// token retrieved from storage via the supplied `tokenUid` key.
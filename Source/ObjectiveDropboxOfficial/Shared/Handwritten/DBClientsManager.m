@@ -3,10 +3,12 @@
 ///
 
 #import "DBClientsManager.h"
+#import "DBClientRegistry.h"
 #import "DBOAuthManager+Protected.h"
 #import "DBOAuthResult.h"
 #import "DBSDKKeychain.h"
 #import "DBTeamClient.h"
+#import "DBTransportDefaultClient+Internal.h"
 #import "DBTransportDefaultClient.h"
 #import "DBTransportDefaultConfig.h"
 #import "DBUserClient.h"
@@ -17,22 +19,28 @@ static DBTransportDefaultConfig *s_currentTransportConfig;
 
 static NSString *s_appKey;
 
-/// An authorized client. This will be set to `nil` if unlinked.
-static DBUserClient *s_authorizedClient;
+/// Authorized user clients, the default one of which is the authorized client. Clients are created on first use.
+static DBClientRegistry<DBUserClient *> *s_authorizedClients;
 
-static NSMutableDictionary<NSString *, DBUserClient *> *s_tokenUidToAuthorizedClients;
+/// Authorized team clients, the default one of which is the authorized team client. Clients are created on first use.
+static DBClientRegistry<DBTeamClient *> *s_authorizedTeamClients;
 
-/// An authorized team client. This will be set to `nil` if unlinked.
-static DBTeamClient *s_authorizedTeamClient;
+static BOOL s_sharesSessionsAcrossClients;
 
-static NSMutableDictionary<NSString *, DBTeamClient *> *s_tokenUidToAuthorizedTeamClients;
+/// The client whose sessions all authorized clients make their requests through, if they share sessions. Created
+/// with the first such client.
+static DBTransportDefaultClient *s_sessionOwnerClient;
 
 + (void)initialize {
   if (self != [DBClientsManager class])
     return;
 
-  s_tokenUidToAuthorizedClients = [NSMutableDictionary new];
-  s_tokenUidToAuthorizedTeamClients = [NSMutableDictionary new];
+  s_authorizedClients = [[DBClientRegistry alloc] initWithClientFactory:^DBUserClient *(DBAccessToken *token) {
+    return [[DBUserClient alloc] initWithTransportClient:[self db_transportClientWithToken:token]];
+  }];
+  s_authorizedTeamClients = [[DBClientRegistry alloc] initWithClientFactory:^DBTeamClient *(DBAccessToken *token) {
+    return [[DBTeamClient alloc] initWithTransportClient:[self db_transportClientWithToken:token]];
+  }];
 }
 
 + (NSString *)appKey {
@@ -51,30 +59,49 @@ static NSMutableDictionary<NSString *, DBTeamClient *> *s_tokenUidToAuthorizedTe
   s_currentTransportConfig = transportConfig;
 }
 
-+ (DBUserClient *)authorizedClient {
++ (NSUInteger)maxActiveClients {
+  return s_authorizedClients.maxActiveClients;
+}
+
++ (void)setMaxActiveClients:(NSUInteger)maxActiveClients {
+  s_authorizedClients.maxActiveClients = maxActiveClients;
+  s_authorizedTeamClients.maxActiveClients = maxActiveClients;
+}
+
++ (BOOL)sharesSessionsAcrossClients {
   @synchronized(self) {
-    return s_authorizedClient;
+    return s_sharesSessionsAcrossClients;
   }
 }
 
-+ (NSDictionary<NSString *, DBUserClient *> *)authorizedClients {
++ (void)setSharesSessionsAcrossClients:(BOOL)sharesSessionsAcrossClients {
   @synchronized(self) {
-    // return shallow copy
-    return [NSMutableDictionary dictionaryWithDictionary:s_tokenUidToAuthorizedClients];
+    s_sharesSessionsAcrossClients = sharesSessionsAcrossClients;
   }
 }
 
++ (DBUserClient *)authorizedClient {
+  return [s_authorizedClients defaultClient];
+}
+
++ (DBUserClient *)authorizedClientWithTokenUid:(NSString *)tokenUid {
+  return [s_authorizedClients clientForTokenUid:tokenUid];
+}
+
++ (NSDictionary<NSString *, DBUserClient *> *)authorizedClients {
+  return [s_authorizedClients allClients];
+}
+
 + (DBTeamClient *)authorizedTeamClient {
-  @synchronized(self) {
-    return s_authorizedTeamClient;
-  }
+  return [s_authorizedTeamClients defaultClient];
+}
+
++ (DBTeamClient *)authorizedTeamClientWithTokenUid:(NSString *)tokenUid {
+  return [s_authorizedTeamClients clientForTokenUid:tokenUid];
 }
 
 + (NSDictionary<NSString *, DBTeamClient *> *)authorizedTeamClients {
-  @synchronized(self) {
-    // return shallow copy
-    return [NSMutableDictionary dictionaryWithDictionary:s_tokenUidToAuthorizedTeamClients];
-  }
+  return [s_authorizedTeamClients allClients];
 }
 
 + (BOOL)authorizeClientFromKeychain:(NSString *)tokenUid {
@@ -149,25 +176,40 @@ static NSMutableDictionary<NSString *, DBTeamClient *> *s_tokenUidToAuthorizedTe
 
 #pragma mark Private helpers
 
-+ (void)db_addAuthorizedClientWithToken:(DBAccessToken *)token setAsDefault:(BOOL)setAsDefault {
-  id<DBAccessTokenProvider> tokenProvider = [[DBOAuthManager sharedOAuthManager] accessTokenProviderForToken:token];
-  DBUserClient *client = [[DBUserClient alloc] initWithAccessTokenProvider:tokenProvider
-                                                                  tokenUid:token.uid
-                                                           transportConfig:[self transportConfig]];
-  [self db_addAuthorizedClient:client tokenUid:token.uid setAsDefault:setAsDefault];
-}
++ (DBTransportDefaultClient *)db_transportClientWithToken:(DBAccessToken *)token {
+  // the registered token may have been refreshed since
+  DBOAuthManager *oAuthManager = [DBOAuthManager sharedOAuthManager];
+  DBAccessToken *accessToken = [oAuthManager retrieveAccessToken:token.uid] ?: token;
+  id<DBAccessTokenProvider> tokenProvider = [oAuthManager accessTokenProviderForToken:accessToken];
+  DBTransportDefaultConfig *transportConfig = [self transportConfig];
 
-+ (void)db_setAuthorizedClient:(DBUserClient *)client {
+  DBTransportDefaultClient *sessionOwnerClient = nil;
   @synchronized(self) {
-    s_authorizedClient = client;
+    if (s_sharesSessionsAcrossClients) {
+      if (!s_sessionOwnerClient) {
+        s_sessionOwnerClient = [[DBTransportDefaultClient alloc] initWithAccessTokenProvider:nil
+                                                                                     tokenUid:nil
+                                                                              transportConfig:transportConfig];
+      }
+      sessionOwnerClient = s_sessionOwnerClient;
+    }
+  }
+  if (sessionOwnerClient) {
+    return [[DBTransportDefaultClient alloc] initSharingSessionsOfClient:sessionOwnerClient
+                                                     accessTokenProvider:tokenProvider
+                                                                tokenUid:accessToken.uid
+                                                         transportConfig:transportConfig];
   }
+  return [[DBTransportDefaultClient alloc] initWithAccessTokenProvider:tokenProvider
+                                                              tokenUid:accessToken.uid
+                                                       transportConfig:transportConfig];
 }
 
-+ (void)db_addAuthorizedClient:(DBUserClient *)client tokenUid:(NSString *)tokenUid setAsDefault:(BOOL)setAsDefault {
-  @synchronized(self) {
-    s_tokenUidToAuthorizedClients[tokenUid] = client;
++ (void)db_addAuthorizedClientWithToken:(DBAccessToken *)token setAsDefault:(BOOL)setAsDefault {
+  @synchronized(s_authorizedClients) {
+    [s_authorizedClients registerToken:token];
     if (setAsDefault) {
-      [self db_setAuthorizedClient:client];
+      s_authorizedClients.defaultTokenUid = token.uid;
     }
   }
 }
@@ -177,63 +219,20 @@ static NSMutableDictionary<NSString *, DBTeamClient *> *s_tokenUidToAuthorizedTe
     return;
   }
 
-  id<DBAccessTokenProvider> tokenProvider = [[DBOAuthManager sharedOAuthManager] accessTokenProviderForToken:token];
-  DBTeamClient *client = [[DBTeamClient alloc] initWithAccessTokenProvider:tokenProvider
-                                                                  tokenUid:token.uid
-                                                           transportConfig:[self transportConfig]];
-  [self db_addAuthorizedTeamClient:client tokenUid:token.uid setAsDefault:setAsDefault];
-}
-
-+ (void)db_setAuthorizedTeamClient:(DBTeamClient *)client {
-  @synchronized(self) {
-    s_authorizedTeamClient = client;
-  }
-}
-
-+ (void)db_addAuthorizedTeamClient:(DBTeamClient *)client
-                          tokenUid:(NSString *)tokenUid
-                      setAsDefault:(BOOL)setAsDefault {
-  @synchronized(self) {
-    s_tokenUidToAuthorizedTeamClients[tokenUid] = client;
+  @synchronized(s_authorizedTeamClients) {
+    [s_authorizedTeamClients registerToken:token];
     if (setAsDefault) {
-      [self db_setAuthorizedTeamClient:client];
+      s_authorizedTeamClients.defaultTokenUid = token.uid;
     }
   }
 }
 
-+ (DBUserClient *)db_authorizedClient:(NSString *)tokenUid {
-  @synchronized(self) {
-    return s_tokenUidToAuthorizedClients[tokenUid];
-  }
-}
-
-+ (DBTeamClient *)db_authorizedTeamClient:(NSString *)tokenUid {
-  @synchronized(self) {
-    return s_tokenUidToAuthorizedTeamClients[tokenUid];
-  }
-}
-
-+ (void)db_removeAuthorizedClient:(NSString *)tokenUid {
-  @synchronized(self) {
-    [s_tokenUidToAuthorizedClients removeObjectForKey:tokenUid];
-  }
-}
-
-+ (void)db_removeAuthorizedTeamClient:(NSString *)tokenUid {
-  @synchronized(self) {
-    [s_tokenUidToAuthorizedTeamClients removeObjectForKey:tokenUid];
-  }
-}
-
-+ (void)db_removeAllAuthorizedClients {
-  @synchronized(self) {
-    [s_tokenUidToAuthorizedClients removeAllObjects];
-  }
-}
-
-+ (void)db_removeAllAuthorizedTeamClients {
-  @synchronized(self) {
-    [s_tokenUidToAuthorizedTeamClients removeAllObjects];
++ (void)db_removeAuthorizedClient:(NSString *)tokenUid fromRegistry:(DBClientRegistry *)registry {
+  @synchronized(registry) {
+    [registry removeTokenUid:tokenUid];
+    if ([tokenUid isEqualToString:registry.defaultTokenUid]) {
+      registry.defaultTokenUid = registry.tokenUids.firstObject;
+    }
   }
 }
 
@@ -259,40 +258,17 @@ static NSMutableDictionary<NSString *, DBTeamClient *> *s_tokenUidToAuthorizedTe
 }
 
 + (void)db_resetClients {
-  [DBClientsManager db_setAuthorizedClient:nil];
-  [DBClientsManager db_setAuthorizedTeamClient:nil];
-
-  [DBClientsManager db_removeAllAuthorizedClients];
-  [DBClientsManager db_removeAllAuthorizedTeamClients];
-}
-
-+ (void)db_resetClient:(NSString *)tokenUid {
-  BOOL shouldResetDefaultUserClient = [self db_authorizedClient:tokenUid] == [DBClientsManager authorizedClient];
-  [self db_removeAuthorizedClient:tokenUid];
-  if (shouldResetDefaultUserClient) {
-    [DBClientsManager db_setAuthorizedClient:nil];
-
-    NSDictionary<NSString *, DBUserClient *> *authorizedClientsCopy = [DBClientsManager authorizedClients];
-
-    if ([authorizedClientsCopy count] > 0) {
-      NSString *firstUid = [authorizedClientsCopy allKeys][0];
-      [DBClientsManager db_setAuthorizedClient:authorizedClientsCopy[firstUid]];
+  for (DBClientRegistry *registry in @[ s_authorizedClients, s_authorizedTeamClients ]) {
+    @synchronized(registry) {
+      registry.defaultTokenUid = nil;
+      [registry removeAllTokens];
     }
   }
+}
 
-  BOOL shouldResetDefaultTeamClient =
-      [self db_authorizedTeamClient:tokenUid] == [DBClientsManager authorizedTeamClient];
-  [self db_removeAuthorizedTeamClient:tokenUid];
-  if (shouldResetDefaultTeamClient) {
-    [DBClientsManager db_setAuthorizedTeamClient:nil];
-
-    NSDictionary<NSString *, DBTeamClient *> *authorizedTeamClientsCopy = [DBClientsManager authorizedTeamClients];
-
-    if ([authorizedTeamClientsCopy count] > 0) {
-      NSString *firstUid = [authorizedTeamClientsCopy allKeys][0];
-      [DBClientsManager db_setAuthorizedTeamClient:authorizedTeamClientsCopy[firstUid]];
-    }
-  }
++ (void)db_resetClient:(NSString *)tokenUid {
+  [self db_removeAuthorizedClient:tokenUid fromRegistry:s_authorizedClients];
+  [self db_removeAuthorizedClient:tokenUid fromRegistry:s_authorizedTeamClients];
 }
 
 + (BOOL)db_handleRedirectURL:(NSURL *)url isTeam:(BOOL)isTeam completion:(DBOAuthCompletion)completion {
@@ -26,6 +26,7 @@
 #import "DBTransportDefaultConfig.h"
 
 /// OAuth
+#import "DBAccessTokenStore.h"
 #import "DBOAuthManager.h"
 #import "DBOAuthResult.h"
 #import "DBOAuthResultCompletion.h"
@@ -38,6 +39,7 @@
 #import "DBCustomRoutes.h"
 #import "DBCustomTasks.h"
 #import "DBSDKConstants.h"
+#import "DBStoneValidators+ServerResponses.h"
 
 /// "Generated" Resources
 #import "DBSerializableProtocol.h"
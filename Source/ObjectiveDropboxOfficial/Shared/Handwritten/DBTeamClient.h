@@ -28,6 +28,12 @@ NS_ASSUME_NONNULL_BEGIN
 /// associated with a particular Dropbox account.
 @property (nonatomic, readonly, copy, nullable) NSString *tokenUid;
 
+/// Whether clients returned by `userClientWithMemberId:` make their requests through this client's sessions and
+/// delegate queue, only adding their `Dropbox-Api-Select-User` header, rather than each setting up sessions of their
+/// own. Sharing avoids the session setup and a separate connection pool per member, which matters when acting on
+/// behalf of many members in turn. Member clients created before a change keep their transport. Defaults to `NO`.
+@property (nonatomic) BOOL sharesSessionsWithMemberClients;
+
 ///
 /// Convenience initializer.
 ///
@@ -111,7 +117,7 @@ NS_ASSUME_NONNULL_BEGIN
 /// @param memberId The Dropbox `account_id` of the team member to perform actions on behalf of. e.g.
 /// "dbid:12345678910..."
 ///
-/// @return An initialized User API client instance.
+/// @return An initialized User API client instance. See `sharesSessionsWithMemberClients` for its transport.
 ///
 - (DBUserClient *)userClientWithMemberId:(NSString *)memberId;
 
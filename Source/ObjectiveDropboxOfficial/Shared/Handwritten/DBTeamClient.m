@@ -6,6 +6,7 @@
 
 #import "DBAccessTokenProvider.h"
 #import "DBOAuthManager+Protected.h"
+#import "DBTransportDefaultClient+Internal.h"
 #import "DBTransportDefaultClient.h"
 #import "DBTransportDefaultConfig.h"
 #import "DBUserClient.h"
@@ -73,7 +74,14 @@
 - (DBUserClient *)userClientWithMemberId:(NSString *)memberId {
   DBTransportDefaultConfig *transportConfig = nil;
   if ([_transportClient isKindOfClass:[DBTransportDefaultClient class]]) {
-    transportConfig = [(DBTransportDefaultClient *)_transportClient duplicateTransportConfigWithAsMemberId:memberId];
+    DBTransportDefaultClient *transportClient = (DBTransportDefaultClient *)_transportClient;
+    transportConfig = [transportClient duplicateTransportConfigWithAsMemberId:memberId];
+    if (_sharesSessionsWithMemberClients) {
+      DBTransportDefaultClient *memberTransportClient =
+          [[DBTransportDefaultClient alloc] initSharingSessionsOfClient:transportClient
+                                                        transportConfig:transportConfig];
+      return [[DBUserClient alloc] initWithTransportClient:memberTransportClient];
+    }
   }
   return [[DBUserClient alloc] initWithAccessTokenProvider:_transportClient.accessTokenProvider
                                                   tokenUid:_tokenUid
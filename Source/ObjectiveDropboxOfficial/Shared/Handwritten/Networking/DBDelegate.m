@@ -2,107 +2,253 @@
 /// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
 ///
 
+#import <stdatomic.h>
+
 #import "DBDelegate.h"
+#import "DBProgressCoalescer.h"
 #import "DBSDKConstants.h"
 #import "DBSessionData.h"
+#import "DBTransportBaseClient+Internal.h"
 
-#pragma mark - Initializers
+// bytes a streaming download may hand to its consumer ahead of consumption before the task is suspended
+static const NSUInteger kDBStreamConsumerMaxPendingBytes = 4 * 1024 * 1024;
 
-@implementation DBDelegate {
-  NSOperationQueue *_delegateQueue;
+static BOOL DBIsSuccessfulResponse(NSURLResponse *response) {
+  NSInteger statusCode = ((NSHTTPURLResponse *)response).statusCode;
+  return statusCode >= 200 && statusCode < 300;
+}
+
+// a server that ignores `Range` answers with the whole file, whose bytes would be taken for those of the range
+static BOOL DBIsIgnoredRangeResponse(NSURLSessionTask *task) {
+  return [task.originalRequest valueForHTTPHeaderField:@"Range"] != nil &&
+         ((NSHTTPURLResponse *)task.response).statusCode != 206;
+}
+
+// number of shards the per-task state is spread across, when no delegate queue is supplied
+static const NSUInteger kDBDelegateShardCount = 8;
+
+#pragma mark - Shards
+
+///
+/// A serial queue together with the session data of the tasks that hash to it.
+///
+@interface DBDelegateShard : NSObject
+
+/// The serial queue on which all state of the shard is accessed.
+@property (nonatomic, readonly) NSOperationQueue *queue;
+
+- (instancetype)initWithQueue:(NSOperationQueue *)queue;
+
+/// Must be called on `queue`.
+- (DBSessionData *)sessionDataWithSessionId:(NSString *)sessionId;
+
+@end
+
+///
+/// The private queue of a shard. Sessions are handed it as their delegate queue, so that the shard of their callbacks
+/// is known without a lookup.
+///
+@interface DBDelegateShardQueue : NSOperationQueue
+
+/// The shard the queue belongs to. Not retained: the shard is kept alive by the delegate, which every session using
+/// the queue retains.
+@property (nonatomic, unsafe_unretained) DBDelegateShard *shard;
+
+@end
+
+@implementation DBDelegateShardQueue
+@end
+
+@implementation DBDelegateShard {
   NSMutableDictionary<NSString *, DBSessionData *> *_sessionData;
 }
 
-- (instancetype)initWithQueue:(NSOperationQueue *)delegateQueue {
+- (instancetype)initWithQueue:(NSOperationQueue *)queue {
   self = [super init];
   if (self) {
-    _delegateQueue = delegateQueue ?: [NSOperationQueue new];
-    [_delegateQueue setMaxConcurrentOperationCount:1];
+    _queue = queue;
+    [_queue setMaxConcurrentOperationCount:1];
     _sessionData = [NSMutableDictionary new];
   }
   return self;
 }
 
-#pragma mark - Delegate protocol methods
+- (DBSessionData *)sessionDataWithSessionId:(NSString *)sessionId {
+  if (!_sessionData[sessionId]) {
+    _sessionData[sessionId] = [[DBSessionData alloc] initWithSessionId:sessionId];
+  }
+  return _sessionData[sessionId];
+}
 
-- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data {
-  DBSessionData *sessionData = [self sessionDataWithSession:session];
-  NSNumber *taskId = @(dataTask.taskIdentifier);
+@end
 
-  if (sessionData.responsesData[taskId]) {
-    [sessionData.responsesData[taskId] appendData:data];
-  } else {
-    sessionData.responsesData[taskId] = [NSMutableData dataWithData:data];
+#pragma mark - Initializers
+
+@implementation DBDelegate {
+  NSArray<DBDelegateShard *> *_shards;
+  BOOL _suppliedQueue;
+  atomic_uint _nextSessionShard;
+}
+
+- (instancetype)initWithQueue:(NSOperationQueue *)delegateQueue {
+  self = [super init];
+  if (self) {
+    NSMutableArray<DBDelegateShard *> *shards = [NSMutableArray new];
+    if (delegateQueue) {
+      // a supplied queue keeps the state of all tasks serialized on it
+      [shards addObject:[[DBDelegateShard alloc] initWithQueue:delegateQueue]];
+    } else {
+      for (NSUInteger i = 0; i < kDBDelegateShardCount; i++) {
+        DBDelegateShardQueue *shardQueue = [DBDelegateShardQueue new];
+        shardQueue.name =
+            [NSString stringWithFormat:@"%@ shard %lu", NSStringFromClass(self.class), (unsigned long)i];
+        shardQueue.qualityOfService = NSQualityOfServiceUtility;
+        DBDelegateShard *shard = [[DBDelegateShard alloc] initWithQueue:shardQueue];
+        shardQueue.shard = shard;
+        [shards addObject:shard];
+      }
+    }
+    _shards = shards;
+    _suppliedQueue = delegateQueue != nil;
+    atomic_init(&_nextSessionShard, 0);
   }
+  return self;
 }
 
-- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error {
-  DBSessionData *sessionData = [self sessionDataWithSession:session];
-  NSNumber *taskId = @(task.taskIdentifier);
+- (NSOperationQueue *)sessionDelegateQueue {
+  if (_suppliedQueue) {
+    return nil;
+  }
+  unsigned int shardIndex = atomic_fetch_add_explicit(&_nextSessionShard, 1, memory_order_relaxed);
+  return _shards[shardIndex % _shards.count].queue;
+}
 
-  if (error && [task isKindOfClass:[NSURLSessionDownloadTask class]]) {
-    DBDownloadResponseBlockStorage responseHandler = sessionData.downloadHandlers[taskId];
-    if (responseHandler) {
-      NSOperationQueue *queueToUse = sessionData.responseHandlerQueues[taskId] ?: [NSOperationQueue mainQueue];
-      [queueToUse addOperationWithBlock:^{
-        responseHandler(nil, task.response, error);
-      }];
+#pragma mark - Delegate protocol methods
 
-      [sessionData.downloadHandlers removeObjectForKey:taskId];
-      [sessionData.progressHandlers removeObjectForKey:taskId];
-      [sessionData.progressData removeObjectForKey:taskId];
-      [sessionData.responsesData removeObjectForKey:taskId];
-      [sessionData.responseHandlerQueues removeObjectForKey:taskId];
-      [sessionData.progressHandlerQueues removeObjectForKey:taskId];
-    } else {
-      sessionData.completionData[taskId] = [[DBCompletionData alloc] initWithCompletionData:nil
-                                                                           responseMetadata:task.response
-                                                                              responseError:error
-                                                                                  urlOutput:nil];
+- (void)URLSession:(NSURLSession *)session dataTask:(NSURLSessionDataTask *)dataTask didReceiveData:(NSData *)data {
+  [self performWithSessionDataForTaskWithIdentifier:dataTask.taskIdentifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    DBTaskData *taskData = [sessionData ensureTaskDataForTaskId:dataTask.taskIdentifier];
+
+    // streaming downloads hand their content straight to the consumer; error bodies are still collected below
+    DBDownloadStreamConsumer *streamConsumer = taskData.streamConsumer;
+    if (streamConsumer && DBIsSuccessfulResponse(dataTask.response)) {
+      if (DBIsIgnoredRangeResponse(dataTask)) {
+        [streamConsumer rejectResponseOfTask:dataTask];
+        return;
+      }
+      [streamConsumer consumeData:data task:dataTask];
+
+      int64_t bytesReceived = (int64_t)data.length;
+      int64_t totalBytesReceived = dataTask.countOfBytesReceived;
+      int64_t totalBytesExpectedToReceive = dataTask.countOfBytesExpectedToReceive;
+      DBProgressCoalescer *progressCoalescer = taskData.progressCoalescer;
+      if (progressCoalescer) {
+        [progressCoalescer reportProgress:bytesReceived
+                           totalCommitted:totalBytesReceived
+                         expectedToCommit:totalBytesExpectedToReceive];
+      } else {
+        taskData.progressData = [[DBProgressData alloc] initWithProgressData:bytesReceived
+                                                              totalCommitted:totalBytesReceived
+                                                            expectedToCommit:totalBytesExpectedToReceive];
+      }
+      return;
     }
-  } else if ([task isKindOfClass:[NSURLSessionUploadTask class]]) {
-    NSMutableData *responseData = sessionData.responsesData[taskId];
-    DBUploadResponseBlockStorage responseHandler = sessionData.uploadHandlers[taskId];
-    if (responseHandler) {
-      NSOperationQueue *queueToUse = sessionData.responseHandlerQueues[taskId] ?: [NSOperationQueue mainQueue];
-      [queueToUse addOperationWithBlock:^{
-        responseHandler(responseData, task.response, error);
-      }];
 
-      [sessionData.uploadHandlers removeObjectForKey:taskId];
-      [sessionData.progressHandlers removeObjectForKey:taskId];
-      [sessionData.progressData removeObjectForKey:taskId];
-      [sessionData.responsesData removeObjectForKey:taskId];
-      [sessionData.responseHandlerQueues removeObjectForKey:taskId];
-      [sessionData.progressHandlerQueues removeObjectForKey:taskId];
-    } else {
-      sessionData.completionData[taskId] = [[DBCompletionData alloc] initWithCompletionData:responseData
-                                                                           responseMetadata:task.response
-                                                                              responseError:error
-                                                                                  urlOutput:nil];
+    if (streamConsumer) {
+      // a failed streaming download only needs the start of its body to build the error
+      NSMutableData *errorData = taskData.responseData ?: [NSMutableData new];
+      taskData.responseData = errorData;
+      [DBTransportBaseClient appendErrorData:data toErrorData:errorData];
+      return;
     }
-  } else if ([task isKindOfClass:[NSURLSessionDataTask class]]) {
-    NSMutableData *responseData = sessionData.responsesData[taskId];
-    DBRpcResponseBlockStorage responseHandler = sessionData.rpcHandlers[taskId];
-    if (responseHandler) {
-      NSOperationQueue *queueToUse = sessionData.responseHandlerQueues[taskId] ?: [NSOperationQueue mainQueue];
-      [queueToUse addOperationWithBlock:^{
-        responseHandler(responseData, task.response, error);
-      }];
 
-      [sessionData.rpcHandlers removeObjectForKey:taskId];
-      [sessionData.progressHandlers removeObjectForKey:taskId];
-      [sessionData.progressData removeObjectForKey:taskId];
-      [sessionData.responsesData removeObjectForKey:taskId];
-      [sessionData.responseHandlerQueues removeObjectForKey:taskId];
-      [sessionData.progressHandlerQueues removeObjectForKey:taskId];
+    if (taskData.responseData) {
+      [taskData.responseData appendData:data];
     } else {
-      sessionData.completionData[taskId] = [[DBCompletionData alloc] initWithCompletionData:responseData
-                                                                           responseMetadata:task.response
-                                                                              responseError:error
-                                                                                  urlOutput:nil];
+      taskData.responseData = [NSMutableData dataWithData:data];
     }
-  }
+  }];
+}
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didCompleteWithError:(NSError *)error {
+  [self performWithSessionDataForTaskWithIdentifier:task.taskIdentifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    NSUInteger taskId = task.taskIdentifier;
+    DBTaskData *taskData = [sessionData taskDataForTaskId:taskId];
+    // the last update may still be held back, and must reach the progress queue before the response is queued
+    [taskData.progressCoalescer flush];
+
+    if (error && [task isKindOfClass:[NSURLSessionDownloadTask class]]) {
+      DBDownloadResponseBlockStorage responseHandler = taskData.downloadHandler;
+      if (responseHandler) {
+        NSOperationQueue *queueToUse = taskData.responseHandlerQueue ?: [NSOperationQueue mainQueue];
+        [queueToUse addOperationWithBlock:^{
+          responseHandler(nil, task.response, error);
+        }];
+
+        [sessionData removeTaskDataForTaskId:taskId];
+      } else {
+        [sessionData ensureTaskDataForTaskId:taskId].completionData =
+            [[DBCompletionData alloc] initWithCompletionData:nil
+                                            responseMetadata:task.response
+                                               responseError:error
+                                                   urlOutput:nil];
+      }
+    } else if ([task isKindOfClass:[NSURLSessionUploadTask class]]) {
+      NSMutableData *responseData = taskData.responseData;
+      DBUploadResponseBlockStorage responseHandler = taskData.uploadHandler;
+      if (responseHandler) {
+        NSOperationQueue *queueToUse = taskData.responseHandlerQueue ?: [NSOperationQueue mainQueue];
+        [queueToUse addOperationWithBlock:^{
+          responseHandler(responseData, task.response, error);
+        }];
+
+        [sessionData removeTaskDataForTaskId:taskId];
+      } else {
+        [sessionData ensureTaskDataForTaskId:taskId].completionData =
+            [[DBCompletionData alloc] initWithCompletionData:responseData
+                                            responseMetadata:task.response
+                                               responseError:error
+                                                   urlOutput:nil];
+      }
+    } else if ([task isKindOfClass:[NSURLSessionDataTask class]]) {
+      DBDownloadStreamConsumer *streamConsumer = taskData.streamConsumer;
+      if (streamConsumer) {
+        // complete only once the consumer has worked through everything handed to it, so that the response handler
+        // never runs ahead of the content
+        taskData.streamConsumer = nil;
+        [streamConsumer.queue addOperationWithBlock:^{
+          // a rejected response fails as such, rather than as the cancellation that stopped it
+          NSError *completionError =
+              streamConsumer.responseRejected
+                  ? [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorBadServerResponse userInfo:nil]
+                  : error;
+          [self URLSession:session task:task didCompleteWithError:completionError];
+        }];
+        return;
+      }
+
+      NSMutableData *responseData = taskData.responseData;
+      DBRpcResponseBlockStorage responseHandler = taskData.rpcHandler;
+      if (responseHandler) {
+        NSOperationQueue *queueToUse = taskData.responseHandlerQueue ?: [NSOperationQueue mainQueue];
+        [queueToUse addOperationWithBlock:^{
+          responseHandler(responseData, task.response, error);
+        }];
+
+        [sessionData removeTaskDataForTaskId:taskId];
+      } else {
+        [sessionData ensureTaskDataForTaskId:taskId].completionData =
+            [[DBCompletionData alloc] initWithCompletionData:responseData
+                                            responseMetadata:task.response
+                                               responseError:error
+                                                   urlOutput:nil];
+      }
+    }
+  }];
 }
 
 - (void)URLSession:(NSURLSession *)session
@@ -110,22 +256,26 @@
              didSendBodyData:(int64_t)bytesSent
               totalBytesSent:(int64_t)totalBytesSent
     totalBytesExpectedToSend:(int64_t)totalBytesExpectedToSend {
-  DBSessionData *sessionData = [self sessionDataWithSession:session];
-  NSNumber *taskId = @(task.taskIdentifier);
+  if (![task isKindOfClass:[NSURLSessionDataTask class]]) {
+    return;
+  }
 
-  if ([task isKindOfClass:[NSURLSessionDataTask class]]) {
-    DBProgressBlock progressHandler = sessionData.progressHandlers[taskId];
-    if (progressHandler) {
-      NSOperationQueue *queueToUse = sessionData.progressHandlerQueues[taskId] ?: [NSOperationQueue mainQueue];
-      [queueToUse addOperationWithBlock:^{
-        progressHandler(bytesSent, totalBytesSent, totalBytesExpectedToSend);
-      }];
+  [self performWithSessionDataForTaskWithIdentifier:task.taskIdentifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    DBTaskData *taskData = [sessionData ensureTaskDataForTaskId:task.taskIdentifier];
+
+    DBProgressCoalescer *progressCoalescer = taskData.progressCoalescer;
+    if (progressCoalescer) {
+      [progressCoalescer reportProgress:bytesSent
+                         totalCommitted:totalBytesSent
+                       expectedToCommit:totalBytesExpectedToSend];
     } else {
-      sessionData.progressData[taskId] = [[DBProgressData alloc] initWithProgressData:bytesSent
-                                                                       totalCommitted:totalBytesSent
-                                                                     expectedToCommit:totalBytesExpectedToSend];
+      taskData.progressData = [[DBProgressData alloc] initWithProgressData:bytesSent
+                                                            totalCommitted:totalBytesSent
+                                                          expectedToCommit:totalBytesExpectedToSend];
     }
-  }
+  }];
 }
 
 - (void)URLSession:(NSURLSession *)session
@@ -133,52 +283,55 @@
                  didWriteData:(int64_t)bytesWritten
             totalBytesWritten:(int64_t)totalBytesWritten
     totalBytesExpectedToWrite:(int64_t)totalBytesExpectedToWrite {
-  DBSessionData *sessionData = [self sessionDataWithSession:session];
-  NSNumber *taskId = @(downloadTask.taskIdentifier);
-
-  DBProgressBlock progressHandler = sessionData.progressHandlers[taskId];
-  if (progressHandler) {
-    NSOperationQueue *queueToUse = sessionData.progressHandlerQueues[taskId] ?: [NSOperationQueue mainQueue];
-    [queueToUse addOperationWithBlock:^{
-      progressHandler(bytesWritten, totalBytesWritten, totalBytesExpectedToWrite);
-    }];
-  } else {
-    sessionData.progressData[taskId] = [[DBProgressData alloc] initWithProgressData:bytesWritten
-                                                                     totalCommitted:totalBytesWritten
-                                                                   expectedToCommit:totalBytesExpectedToWrite];
-  }
+  [self performWithSessionDataForTaskWithIdentifier:downloadTask.taskIdentifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    DBTaskData *taskData = [sessionData ensureTaskDataForTaskId:downloadTask.taskIdentifier];
+
+    DBProgressCoalescer *progressCoalescer = taskData.progressCoalescer;
+    if (progressCoalescer) {
+      [progressCoalescer reportProgress:bytesWritten
+                         totalCommitted:totalBytesWritten
+                       expectedToCommit:totalBytesExpectedToWrite];
+    } else {
+      taskData.progressData = [[DBProgressData alloc] initWithProgressData:bytesWritten
+                                                            totalCommitted:totalBytesWritten
+                                                          expectedToCommit:totalBytesExpectedToWrite];
+    }
+  }];
 }
 
 - (void)URLSession:(NSURLSession *)session
                  downloadTask:(NSURLSessionDownloadTask *)downloadTask
     didFinishDownloadingToURL:(NSURL *)location {
-  DBSessionData *sessionData = [self sessionDataWithSession:session];
-  NSNumber *taskId = @(downloadTask.taskIdentifier);
-
-  DBDownloadResponseBlockStorage responseHandler = sessionData.downloadHandlers[taskId];
-
+  // `NSURLSession` removes the file once this method returns, so it is moved before hopping onto the shard
   NSError *fileError = nil;
   NSString *tmpOutputPath = [self moveFileToTempStorage:location fileError:&fileError];
   NSURL *tmpOutputUrl = fileError == nil ? [NSURL URLWithString:tmpOutputPath] : nil;
 
-  if (responseHandler) {
-    NSOperationQueue *queueToUse = sessionData.responseHandlerQueues[taskId] ?: [NSOperationQueue mainQueue];
-    [queueToUse addOperationWithBlock:^{
-      responseHandler(tmpOutputUrl, downloadTask.response, fileError);
-    }];
-
-    [sessionData.downloadHandlers removeObjectForKey:taskId];
-    [sessionData.progressHandlers removeObjectForKey:taskId];
-    [sessionData.progressData removeObjectForKey:taskId];
-    [sessionData.responsesData removeObjectForKey:taskId];
-    [sessionData.responseHandlerQueues removeObjectForKey:taskId];
-    [sessionData.progressHandlerQueues removeObjectForKey:taskId];
-  } else {
-    sessionData.completionData[taskId] = [[DBCompletionData alloc] initWithCompletionData:nil
-                                                                         responseMetadata:downloadTask.response
-                                                                            responseError:fileError
-                                                                                urlOutput:tmpOutputUrl];
-  }
+  [self performWithSessionDataForTaskWithIdentifier:downloadTask.taskIdentifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    NSUInteger taskId = downloadTask.taskIdentifier;
+    DBTaskData *taskData = [sessionData ensureTaskDataForTaskId:taskId];
+    [taskData.progressCoalescer flush];
+
+    DBDownloadResponseBlockStorage responseHandler = taskData.downloadHandler;
+
+    if (responseHandler) {
+      NSOperationQueue *queueToUse = taskData.responseHandlerQueue ?: [NSOperationQueue mainQueue];
+      [queueToUse addOperationWithBlock:^{
+        responseHandler(tmpOutputUrl, downloadTask.response, fileError);
+      }];
+
+      [sessionData removeTaskDataForTaskId:taskId];
+    } else {
+      taskData.completionData = [[DBCompletionData alloc] initWithCompletionData:nil
+                                                                responseMetadata:downloadTask.response
+                                                                   responseError:fileError
+                                                                       urlOutput:tmpOutputUrl];
+    }
+  }];
 }
 
 - (NSString *)moveFileToTempStorage:(NSURL *)startingLocation fileError:(NSError **)fileError {
@@ -203,28 +356,41 @@
   return tmpOutputPath;
 }
 
-- (void)addProgressHandlerForTaskWithIdentifier:(NSUInteger)identifier
-                                        session:(NSURLSession *)session
-                                progressHandler:(void (^)(int64_t, int64_t, int64_t))handler
-                           progressHandlerQueue:(NSOperationQueue *)handlerQueue {
-  [_delegateQueue addOperationWithBlock:^{
-    NSNumber *taskId = @(identifier);
+- (void)addProgressCoalescerForTaskWithIdentifier:(NSUInteger)identifier
+                                          session:(NSURLSession *)session
+                                progressCoalescer:(DBProgressCoalescer *)progressCoalescer {
+  [self performWithSessionDataForTaskWithIdentifier:identifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    DBTaskData *taskData = [sessionData ensureTaskDataForTaskId:identifier];
 
-    DBSessionData *sessionData = [self sessionDataWithSession:session];
-    DBProgressData *progressData = sessionData.progressData[taskId];
+    DBProgressData *progressData = taskData.progressData;
     if (progressData) {
-      NSOperationQueue *queueToUse = handlerQueue ?: [NSOperationQueue mainQueue];
-      [queueToUse addOperationWithBlock:^{
-        handler(progressData.committed, progressData.totalCommitted, progressData.expectedToCommit);
-      }];
-
-      [sessionData.progressData removeObjectForKey:taskId];
-    } else {
-      sessionData.progressHandlers[taskId] = handler;
-      if (handlerQueue) {
-        sessionData.progressHandlerQueues[taskId] = handlerQueue;
-      }
+      [progressCoalescer reportProgress:progressData.committed
+                         totalCommitted:progressData.totalCommitted
+                       expectedToCommit:progressData.expectedToCommit];
+      taskData.progressData = nil;
     }
+    taskData.progressCoalescer = progressCoalescer;
+  }];
+}
+
+#pragma mark - Add stream consumer
+
+- (void)addStreamConsumerForTaskWithIdentifier:(NSUInteger)identifier
+                                       session:(NSURLSession *)session
+                                 consumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+                                 consumerQueue:(NSOperationQueue *)consumerQueue {
+  DBDownloadStreamConsumer *streamConsumer =
+      [[DBDownloadStreamConsumer alloc] initWithConsumerBlock:consumerBlock
+                                                        queue:consumerQueue
+                                              maxPendingBytes:kDBStreamConsumerMaxPendingBytes];
+  // unlike handlers, the consumer must be in place before the first byte arrives; it is, since every callback of the
+  // not yet resumed task is queued behind it on the same shard
+  [self performWithSessionDataForTaskWithIdentifier:identifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    [sessionData ensureTaskDataForTaskId:identifier].streamConsumer = streamConsumer;
   }];
 }
 
@@ -234,28 +400,22 @@
                                            session:(NSURLSession *)session
                                    responseHandler:(DBRpcResponseBlockStorage)handler
                               responseHandlerQueue:(NSOperationQueue *)handlerQueue {
-  [_delegateQueue addOperationWithBlock:^{
-    NSNumber *taskId = @(identifier);
-    DBSessionData *sessionData = [self sessionDataWithSession:session];
+  [self performWithSessionDataForTaskWithIdentifier:identifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    DBTaskData *taskData = [sessionData ensureTaskDataForTaskId:identifier];
 
-    DBCompletionData *completionData = sessionData.completionData[taskId];
+    DBCompletionData *completionData = taskData.completionData;
     if (completionData) {
       NSOperationQueue *queueToUse = handlerQueue ?: [NSOperationQueue mainQueue];
       [queueToUse addOperationWithBlock:^{
         handler(completionData.responseBody, completionData.responseMetadata, completionData.responseError);
       }];
 
-      [sessionData.progressData removeObjectForKey:taskId];
-      [sessionData.completionData removeObjectForKey:taskId];
-      [sessionData.rpcHandlers removeObjectForKey:taskId];
-      [sessionData.progressHandlers removeObjectForKey:taskId];
-      [sessionData.responseHandlerQueues removeObjectForKey:taskId];
-      [sessionData.progressHandlerQueues removeObjectForKey:taskId];
+      [sessionData removeTaskDataForTaskId:identifier];
     } else {
-      sessionData.rpcHandlers[taskId] = handler;
-      if (handlerQueue) {
-        sessionData.responseHandlerQueues[taskId] = handlerQueue;
-      }
+      taskData.rpcHandler = handler;
+      taskData.responseHandlerQueue = handlerQueue;
     }
   }];
 }
@@ -266,28 +426,22 @@
                                               session:(NSURLSession *)session
                                       responseHandler:(DBUploadResponseBlockStorage)handler
                                  responseHandlerQueue:(NSOperationQueue *)handlerQueue {
-  [_delegateQueue addOperationWithBlock:^{
-    NSNumber *taskId = @(identifier);
-    DBSessionData *sessionData = [self sessionDataWithSession:session];
+  [self performWithSessionDataForTaskWithIdentifier:identifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    DBTaskData *taskData = [sessionData ensureTaskDataForTaskId:identifier];
 
-    DBCompletionData *completionData = sessionData.completionData[taskId];
+    DBCompletionData *completionData = taskData.completionData;
     if (completionData) {
       NSOperationQueue *queueToUse = handlerQueue ?: [NSOperationQueue mainQueue];
       [queueToUse addOperationWithBlock:^{
         handler(completionData.responseBody, completionData.responseMetadata, completionData.responseError);
       }];
 
-      [sessionData.progressData removeObjectForKey:taskId];
-      [sessionData.completionData removeObjectForKey:taskId];
-      [sessionData.uploadHandlers removeObjectForKey:taskId];
-      [sessionData.progressHandlers removeObjectForKey:taskId];
-      [sessionData.responseHandlerQueues removeObjectForKey:taskId];
-      [sessionData.progressHandlerQueues removeObjectForKey:taskId];
+      [sessionData removeTaskDataForTaskId:identifier];
     } else {
-      sessionData.uploadHandlers[taskId] = handler;
-      if (handlerQueue) {
-        sessionData.responseHandlerQueues[taskId] = handlerQueue;
-      }
+      taskData.uploadHandler = handler;
+      taskData.responseHandlerQueue = handlerQueue;
     }
   }];
 }
@@ -298,28 +452,22 @@
                                                 session:(NSURLSession *)session
                                         responseHandler:(DBDownloadResponseBlockStorage)handler
                                    responseHandlerQueue:(NSOperationQueue *)handlerQueue {
-  [_delegateQueue addOperationWithBlock:^{
-    NSNumber *taskId = @(identifier);
-    DBSessionData *sessionData = [self sessionDataWithSession:session];
+  [self performWithSessionDataForTaskWithIdentifier:identifier
+                                            session:session
+                                              block:^(DBSessionData *sessionData) {
+    DBTaskData *taskData = [sessionData ensureTaskDataForTaskId:identifier];
 
-    DBCompletionData *completionData = sessionData.completionData[taskId];
+    DBCompletionData *completionData = taskData.completionData;
     if (completionData) {
       NSOperationQueue *queueToUse = handlerQueue ?: [NSOperationQueue mainQueue];
       [queueToUse addOperationWithBlock:^{
         handler(completionData.urlOutput, completionData.responseMetadata, completionData.responseError);
       }];
 
-      [sessionData.progressData removeObjectForKey:taskId];
-      [sessionData.completionData removeObjectForKey:taskId];
-      [sessionData.downloadHandlers removeObjectForKey:taskId];
-      [sessionData.progressHandlers removeObjectForKey:taskId];
-      [sessionData.responseHandlerQueues removeObjectForKey:taskId];
-      [sessionData.progressHandlerQueues removeObjectForKey:taskId];
+      [sessionData removeTaskDataForTaskId:identifier];
     } else {
-      sessionData.downloadHandlers[taskId] = handler;
-      if (handlerQueue) {
-        sessionData.responseHandlerQueues[taskId] = handlerQueue;
-      }
+      taskData.downloadHandler = handler;
+      taskData.responseHandlerQueue = handlerQueue;
     }
   }];
 }
@@ -328,12 +476,31 @@
   return session.configuration.identifier ?: kDBSDKForegroundSessionId;
 }
 
-- (DBSessionData *)sessionDataWithSession:(NSURLSession *)session {
+#pragma mark - Per-task state
+
+- (void)performWithSessionDataForTaskWithIdentifier:(NSUInteger)identifier
+                                            session:(NSURLSession *)session
+                                              block:(void (^)(DBSessionData *sessionData))block {
   NSString *sessionId = [self sessionIdWithSession:session];
-  if (!_sessionData[sessionId]) {
-    _sessionData[sessionId] = [[DBSessionData alloc] initWithSessionId:sessionId];
+  // all state of a task lives on one serial shard, which keeps its callbacks in order, while the callbacks of tasks on
+  // other shards are processed concurrently. A session delivering its callbacks on a shard keeps all its tasks there
+  DBDelegateShard *shard = nil;
+  NSOperationQueue *sessionQueue = session.delegateQueue;
+  if ([sessionQueue isKindOfClass:[DBDelegateShardQueue class]]) {
+    shard = ((DBDelegateShardQueue *)sessionQueue).shard;
   }
-  return _sessionData[sessionId];
+  if (![_shards containsObject:shard]) {
+    shard = _shards[([sessionId hash] + identifier) % _shards.count];
+  }
+
+  if ([NSOperationQueue currentQueue] == shard.queue) {
+    // a session callback, already delivered on the shard
+    block([shard sessionDataWithSessionId:sessionId]);
+    return;
+  }
+  [shard.queue addOperationWithBlock:^{
+    block([shard sessionDataWithSessionId:sessionId]);
+  }];
 }
 
 @end
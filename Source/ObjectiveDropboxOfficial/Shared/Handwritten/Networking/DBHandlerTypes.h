@@ -7,6 +7,8 @@
 #import <Foundation/Foundation.h>
 
 @class DBASYNCPollError;
+@class DBFILESDownloadError;
+@class DBFILESFileMetadata;
 @class DBFILESUploadSessionFinishBatchJobStatus;
 @class DBFILESUploadSessionFinishBatchResultEntry;
 @class DBRequestError;
@@ -18,6 +20,12 @@ NS_ASSUME_NONNULL_BEGIN
 /// total bytes expected to be downloaded.
 typedef void (^DBProgressBlock)(int64_t bytesWritten, int64_t totalBytesWritten, int64_t totalBytesExpectedToWrite);
 
+/// The consumer block of a streaming download. It is executed serially, in order, with each piece of the file content
+/// as it arrives from the network, so the content is never held in memory or on disk as a whole. Returning `NO` cancels
+/// the download, e.g. when the bytes could not be stored. The download is paused while too many bytes are waiting to be
+/// consumed, so a slow consumer throttles the network rather than growing the backlog.
+typedef BOOL (^DBDownloadStreamConsumerBlock)(NSData *data);
+
 /// Special custom response block for batch upload. The first argument is a mapping of client-side NSURLs to batch
 /// upload result entries (each of which indicates the success / failure of the upload for the corresponding file). This
 /// object will be nonnull if the final call to `/upload_session/finish_batch/check` is successful. The second argument
@@ -32,6 +40,15 @@ typedef void (^DBBatchUploadResponseBlock)(
     DBASYNCPollError *_Nullable finishBatchRouteError, DBRequestError *_Nullable finishBatchRequestError,
     NSDictionary<NSURL *, DBRequestError *> *fileUrlsToRequestErrors);
 
+/// Special custom response block for segmented download. The first argument is the metadata of the downloaded file,
+/// which will be nonnull if every segment of the file was downloaded. The second argument is the route-specific error
+/// of the download, which will be nonnull if the file could not be looked up or downloaded. The third argument is the
+/// general request error of the download, which will be nonnull if any segment failed for good, after its retries. The
+/// fourth argument is the location the file was downloaded to, which will be nonnull if the download succeeded.
+typedef void (^DBSegmentedDownloadResponseBlock)(DBFILESFileMetadata *_Nullable result,
+                                                 DBFILESDownloadError *_Nullable routeError,
+                                                 DBRequestError *_Nullable networkError, NSURL *_Nullable destination);
+
 /// Special custom response block for performing SDK token migration between API v1 tokens and API v2 tokens. First
 /// argument indicates whether the migration should be attempted again (primarily when there was no active network
 /// connection). The second argument indicates whether the supplied app key and / or secret is invalid for some or
@@ -0,0 +1,101 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import "DBProgressCoalescer.h"
+
+@implementation DBProgressCoalescer {
+  DBProgressBlock _progressBlock;
+  NSOperationQueue *_queue;
+  NSTimeInterval _minimumInterval;
+  int64_t _minimumByteDelta;
+
+  // the update not yet handed to the progress block
+  BOOL _hasPendingUpdate;
+  int64_t _pendingCommitted;
+  int64_t _totalCommitted;
+  int64_t _expectedToCommit;
+
+  NSTimeInterval _lastUpdateTime;
+  BOOL _flushScheduled;
+}
+
+- (instancetype)initWithProgressBlock:(DBProgressBlock)progressBlock
+                                queue:(NSOperationQueue *)queue
+                      minimumInterval:(NSTimeInterval)minimumInterval
+                     minimumByteDelta:(int64_t)minimumByteDelta {
+  self = [super init];
+  if (self) {
+    _progressBlock = progressBlock;
+    _queue = queue ?: [NSOperationQueue mainQueue];
+    _minimumInterval = MAX(minimumInterval, 0);
+    _minimumByteDelta = MAX(minimumByteDelta, 0);
+    _hasPendingUpdate = NO;
+    _pendingCommitted = 0;
+    _totalCommitted = 0;
+    _expectedToCommit = 0;
+    // lets the first update through right away
+    _lastUpdateTime = -DBL_MAX;
+    _flushScheduled = NO;
+  }
+  return self;
+}
+
+- (void)reportProgress:(int64_t)committed
+        totalCommitted:(int64_t)totalCommitted
+      expectedToCommit:(int64_t)expectedToCommit {
+  @synchronized(self) {
+    _hasPendingUpdate = YES;
+    _pendingCommitted += committed;
+    _totalCommitted = totalCommitted;
+    _expectedToCommit = expectedToCommit;
+
+    NSTimeInterval now = [NSProcessInfo processInfo].systemUptime;
+    NSTimeInterval elapsed = now - _lastUpdateTime;
+    BOOL complete = expectedToCommit > 0 && totalCommitted >= expectedToCommit;
+    BOOL byteDeltaReached = _minimumByteDelta > 0 && _pendingCommitted >= _minimumByteDelta;
+
+    if (complete || byteDeltaReached || elapsed >= _minimumInterval) {
+      [self db_handOverPendingUpdateAtTime:now];
+    } else if (!_flushScheduled) {
+      // the transfer may go quiet, so the held back update is handed over once the interval has elapsed regardless
+      _flushScheduled = YES;
+      dispatch_time_t flushTime =
+          dispatch_time(DISPATCH_TIME_NOW, (int64_t)((_minimumInterval - elapsed) * NSEC_PER_SEC));
+      dispatch_after(flushTime, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        @synchronized(self) {
+          self->_flushScheduled = NO;
+        }
+        [self flush];
+      });
+    }
+  }
+}
+
+- (void)flush {
+  @synchronized(self) {
+    if (_hasPendingUpdate) {
+      [self db_handOverPendingUpdateAtTime:[NSProcessInfo processInfo].systemUptime];
+    }
+  }
+}
+
+#pragma mark Private helpers
+
+// must be called with `self` locked
+- (void)db_handOverPendingUpdateAtTime:(NSTimeInterval)now {
+  DBProgressBlock progressBlock = _progressBlock;
+  int64_t committed = _pendingCommitted;
+  int64_t totalCommitted = _totalCommitted;
+  int64_t expectedToCommit = _expectedToCommit;
+
+  _hasPendingUpdate = NO;
+  _pendingCommitted = 0;
+  _lastUpdateTime = now;
+
+  [_queue addOperationWithBlock:^{
+    progressBlock(committed, totalCommitted, expectedToCommit);
+  }];
+}
+
+@end
@@ -42,25 +42,123 @@
 
 @end
 
+#pragma mark - Stream consumer
+
+@implementation DBDownloadStreamConsumer {
+  DBDownloadStreamConsumerBlock _consumerBlock;
+  NSUInteger _maxPendingBytes;
+  NSUInteger _pendingBytes;
+  BOOL _suspended;
+  BOOL _cancelled;
+}
+
+- (instancetype)initWithConsumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+                                queue:(NSOperationQueue *)queue
+                      maxPendingBytes:(NSUInteger)maxPendingBytes {
+  self = [super init];
+  if (self) {
+    _consumerBlock = consumerBlock;
+    _queue = queue ?: [NSOperationQueue new];
+    [_queue setMaxConcurrentOperationCount:1];
+    _maxPendingBytes = maxPendingBytes;
+    _pendingBytes = 0;
+    _suspended = NO;
+    _cancelled = NO;
+    _responseRejected = NO;
+  }
+  return self;
+}
+
+- (void)consumeData:(NSData *)data task:(NSURLSessionTask *)task {
+  @synchronized(self) {
+    _pendingBytes += data.length;
+    if (!_suspended && _pendingBytes > _maxPendingBytes) {
+      _suspended = YES;
+      [task suspend];
+    }
+  }
+
+  [_queue addOperationWithBlock:^{
+    // `_cancelled` is only touched on the serial consumer queue
+    if (self->_cancelled) {
+      return;
+    }
+    if (!self->_consumerBlock(data)) {
+      self->_cancelled = YES;
+      [task cancel];
+      return;
+    }
+
+    @synchronized(self) {
+      self->_pendingBytes -= data.length;
+      // resuming only once half of the backlog is consumed keeps the task from flapping on every piece
+      if (self->_suspended && self->_pendingBytes <= self->_maxPendingBytes / 2) {
+        self->_suspended = NO;
+        [task resume];
+      }
+    }
+  }];
+}
+
+- (void)rejectResponseOfTask:(NSURLSessionTask *)task {
+  [_queue addOperationWithBlock:^{
+    if (self->_cancelled) {
+      return;
+    }
+    self->_cancelled = YES;
+    self->_responseRejected = YES;
+    [task cancel];
+  }];
+}
+
+@end
+
+#pragma mark - Task data
+
+@implementation DBTaskData
+
+@end
+
 #pragma mark - Session data
 
-@implementation DBSessionData
+// task ids are used as keys directly; they are offset by one since the table can't hold a NULL key
+static const void *DBTaskDataKey(NSUInteger taskId) {
+  return (const void *)(uintptr_t)(taskId + 1);
+}
+
+@implementation DBSessionData {
+  CFMutableDictionaryRef _taskData;
+}
 
 - (instancetype)initWithSessionId:(NSString *)sessionId {
   self = [super init];
   if (self) {
     _sessionId = sessionId;
-    _responsesData = [NSMutableDictionary new];
-    _progressHandlers = [NSMutableDictionary new];
-    _rpcHandlers = [NSMutableDictionary new];
-    _uploadHandlers = [NSMutableDictionary new];
-    _downloadHandlers = [NSMutableDictionary new];
-    _progressData = [NSMutableDictionary new];
-    _completionData = [NSMutableDictionary new];
-    _progressHandlerQueues = [NSMutableDictionary new];
-    _responseHandlerQueues = [NSMutableDictionary new];
+    // integer keys without boxing, retained `DBTaskData` values
+    _taskData = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, NULL, &kCFTypeDictionaryValueCallBacks);
   }
   return self;
 }
 
+- (void)dealloc {
+  CFRelease(_taskData);
+}
+
+- (DBTaskData *)taskDataForTaskId:(NSUInteger)taskId {
+  return (__bridge DBTaskData *)CFDictionaryGetValue(_taskData, DBTaskDataKey(taskId));
+}
+
+- (DBTaskData *)ensureTaskDataForTaskId:(NSUInteger)taskId {
+  DBTaskData *taskData = [self taskDataForTaskId:taskId];
+  if (!taskData) {
+    taskData = [DBTaskData new];
+    CFDictionarySetValue(_taskData, DBTaskDataKey(taskId), (__bridge const void *)taskData);
+  }
+  return taskData;
+}
+
+- (void)removeTaskDataForTaskId:(NSUInteger)taskId {
+  CFDictionaryRemoveValue(_taskData, DBTaskDataKey(taskId));
+}
+
 @end
@@ -46,6 +46,26 @@ NS_ASSUME_NONNULL_BEGIN
 /// associated with a particular Dropbox account.
 @property (nonatomic, readonly, copy) NSString *tokenUid;
 
+/// The minimum time between two updates handed to the progress block; updates in between are coalesced into the next
+/// one. Takes effect for progress blocks set afterwards. Defaults to 0.1 seconds.
+@property (nonatomic) NSTimeInterval progressMinimumInterval;
+
+/// The number of transferred bytes that lets a progress update through before `progressMinimumInterval` has elapsed.
+/// Takes effect for progress blocks set afterwards. Defaults to 0, so that only the interval applies.
+@property (nonatomic) int64_t progressMinimumByteDelta;
+
+/// The queue on which the response is deserialized, so that only the fully built result is handed to the response
+/// queue. Takes effect for response blocks set afterwards. Defaults to `defaultDecodeQueue`. If nil, the response is
+/// deserialized on the response queue.
+///
+/// @note Responses decoded on a concurrent queue may reach the response queue in a different order than their
+/// requests completed in. Use a serial decode queue where that order matters.
+@property (nonatomic, strong, nullable) NSOperationQueue *decodeQueue;
+
+/// The decode queue of tasks created from then on. Defaults to nil, so that responses are deserialized on their
+/// response queue unless decoding is opted into.
+@property (class, nonatomic, strong, nullable) NSOperationQueue *defaultDecodeQueue;
+
 ///
 /// Full constructor.
 ///
@@ -360,6 +380,13 @@ typedef void (^DBDownloadUrlResponseBlock)(TResponse _Nullable result, TError _N
 
 typedef void (^DBDownloadDataResponseBlock)(TResponse _Nullable result, TError _Nullable routeError, DBRequestError * _Nullable networkError, NSData * _Nullable fileData);
 
+/// Whether the `NSData` handed to the response block is a memory mapping of the downloaded file rather than a copy of
+/// it read into memory. Pages of a mapped file are loaded on demand and can be evicted without being written out, so
+/// large downloads don't need their full size in memory. The temporary file is removed as soon as it is mapped, and the
+/// mapping is released along with the data. Has no effect on streaming downloads, which have no file data. Defaults to
+/// `NO`.
+@property (nonatomic) BOOL mapsFileData;
+
 ///
 /// Installs a response handler for the current request.
 ///
@@ -6,6 +6,7 @@
 #import "DBDelegate.h"
 #import "DBGlobalErrorResponseHandler+Internal.h"
 #import "DBHandlerTypes.h"
+#import "DBProgressCoalescer.h"
 #import "DBRequestErrors.h"
 #import "DBStoneBase.h"
 #import "DBTransportBaseClient+Internal.h"
@@ -13,8 +14,22 @@
 
 #pragma mark - Base network task
 
+static NSOperationQueue *s_defaultDecodeQueue;
+
 @implementation DBTask : NSObject
 
++ (NSOperationQueue *)defaultDecodeQueue {
+  @synchronized([DBTask class]) {
+    return s_defaultDecodeQueue;
+  }
+}
+
++ (void)setDefaultDecodeQueue:(NSOperationQueue *)defaultDecodeQueue {
+  @synchronized([DBTask class]) {
+    s_defaultDecodeQueue = defaultDecodeQueue;
+  }
+}
+
 - (instancetype)initWithRoute:(DBRoute *)route tokenUid:(NSString *)tokenUid {
   self = [super init];
   if (self) {
@@ -22,6 +37,9 @@
     _queue = nil;
     _tokenUid = [tokenUid copy];
     _taskIdentifier = [[NSUUID UUID].UUIDString copy];
+    _progressMinimumInterval = 0.1;
+    _progressMinimumByteDelta = 0;
+    _decodeQueue = [DBTask defaultDecodeQueue];
   }
   return self;
 }
@@ -62,6 +80,14 @@
                userInfo:nil];
 }
 
+- (DBProgressCoalescer *)progressCoalescerWithProgressBlock:(DBProgressBlock)progressBlock
+                                                      queue:(NSOperationQueue *)queue {
+  return [[DBProgressCoalescer alloc] initWithProgressBlock:progressBlock
+                                                      queue:queue
+                                            minimumInterval:_progressMinimumInterval
+                                           minimumByteDelta:_progressMinimumByteDelta];
+}
+
 + (NSError *)dropboxBadResponseErrorWithException:(NSException *)exception {
   return [NSError errorWithDomain:@"dropbox.com" code:0 userInfo:@{ @"error_message" : exception }];
 }
@@ -328,11 +354,8 @@
     NSURL *destination = strongSelf->_destination;
 
     if (clientError || !resultData || !location) {
-      NSData *errorData = location ? [NSData dataWithContentsOfURL:location] : nil;
-      if (errorData == nil && location.path != nil) {
-        // error data is in response body (downloaded to output tmp file)
-        errorData = [NSData dataWithContentsOfURL:[NSURL fileURLWithPath:location.path]];
-      }
+      // error data is in response body (downloaded to output tmp file)
+      NSData *errorData = [DBTransportBaseClient errorDataWithContentsOfFile:location];
       networkError = [DBTransportBaseClient dBRequestErrorWithErrorData:errorData
                                                             clientError:clientError
                                                              statusCode:statusCode
@@ -397,6 +420,17 @@
 
 @implementation DBDownloadDataTask
 
++ (NSData *)mappedDataWithContentsOfURL:(NSURL *)location {
+  NSString *path = [location path];
+  NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:nil];
+  if (data == nil) {
+    return [NSData dataWithContentsOfFile:path];
+  }
+  // the mapping stays valid after the file is unlinked, and its storage is reclaimed once the data unmaps it
+  [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+  return data;
+}
+
 - (DBDownloadDataTask *)setResponseBlock:(DBDownloadDataResponseBlockImpl)responseBlock {
 #pragma unused(responseBlock)
   @throw [NSException
@@ -465,7 +499,7 @@
 
     if (clientError || !resultData) {
       // error data is in response body (downloaded to output tmp file)
-      NSData *errorData = location ? [NSData dataWithContentsOfFile:[location path]] : nil;
+      NSData *errorData = [DBTransportBaseClient errorDataWithContentsOfFile:location];
       networkError = [DBTransportBaseClient dBRequestErrorWithErrorData:errorData
                                                             clientError:clientError
                                                              statusCode:statusCode
@@ -488,7 +522,8 @@
         networkError = [[DBRequestError alloc] initAsClientError:serializationError];
       } else {
         result = !route.resultType ? [DBNilObject new] : result;
-        downloadContent = [NSData dataWithContentsOfFile:[location path]];
+        downloadContent = strongSelf.mapsFileData ? [DBDownloadDataTask mappedDataWithContentsOfURL:location]
+                                                  : [NSData dataWithContentsOfFile:[location path]];
         successful = YES;
       }
     }
@@ -502,4 +537,72 @@
   return storageBlock;
 }
 
+- (DBRpcResponseBlockStorage)streamStorageBlockWithResponseBlock:(DBDownloadDataResponseBlockImpl)responseBlock
+                                                     cleanupBlock:(DBCleanupBlock)cleanupBlock {
+  __weak DBDownloadDataTask *weakSelf = self;
+  DBRpcResponseBlockStorage storageBlock = ^BOOL(NSData *errorData, NSURLResponse *response, NSError *clientError) {
+    DBDownloadDataTask *strongSelf = weakSelf;
+    if (strongSelf == nil) {
+      // Indicates failure and no-op
+      return NO;
+    }
+
+    NSHTTPURLResponse *httpResponse = (NSHTTPURLResponse *)response;
+    int statusCode = (int)httpResponse.statusCode;
+    NSDictionary *httpHeaders = httpResponse.allHeaderFields;
+    id headerString =
+        [DBTransportBaseClient caseInsensitiveLookupWithKey:@"Dropbox-API-Result" headerFieldsDictionary:httpHeaders];
+
+    NSData *resultData = nil;
+    if ([headerString isKindOfClass:[NSString class]]) {
+      // If `headerString == nil` then `resultData = nil`
+      resultData = [headerString dataUsingEncoding:NSUTF8StringEncoding];
+    }
+
+    DBRoute *route = strongSelf.route;
+
+    BOOL successful = NO;
+
+    id result = nil;
+    id routeError = nil;
+    DBRequestError *networkError = nil;
+
+    if (clientError || !resultData) {
+      // error data is in response body (collected in memory, since it is never handed to the stream consumer)
+      networkError = [DBTransportBaseClient dBRequestErrorWithErrorData:errorData
+                                                            clientError:clientError
+                                                             statusCode:statusCode
+                                                            httpHeaders:httpHeaders];
+      routeError = [DBTransportBaseClient statusCodeIsRouteError:statusCode]
+                       ? [DBTransportBaseClient routeErrorWithRoute:route data:errorData statusCode:statusCode]
+                       : nil;
+      [DBGlobalErrorResponseHandler executeRegisteredResponseBlocksWithRouteError:routeError
+                                                                     networkError:networkError
+                                                                      restartTask:strongSelf];
+    } else {
+      NSError *serializationError;
+      @try {
+        result =
+            [DBTransportBaseClient routeResultWithRoute:route data:resultData serializationError:&serializationError];
+      } @catch (NSException *exception) {
+        serializationError = [[strongSelf class] dropboxBadResponseErrorWithException:exception];
+      }
+      if (serializationError) {
+        networkError = [[DBRequestError alloc] initAsClientError:serializationError];
+      } else {
+        result = !route.resultType ? [DBNilObject new] : result;
+        successful = YES;
+      }
+    }
+
+    // the file content has already been handed to the stream consumer
+    responseBlock(result, routeError, networkError, nil);
+    cleanupBlock();
+
+    return successful;
+  };
+
+  return storageBlock;
+}
+
 @end
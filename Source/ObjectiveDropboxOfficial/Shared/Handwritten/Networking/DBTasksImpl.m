@@ -72,11 +72,28 @@
 - (DBRpcTask *)setResponseBlock:(DBRpcResponseBlockImpl)responseBlock queue:(NSOperationQueue *)queue {
   _responseBlock = responseBlock;
   __weak __typeof(self) weakSelf = self;
-  DBRpcResponseBlockStorage storageBlock = [self storageBlockWithResponseBlock:responseBlock
-                                                                  cleanupBlock:^{
-                                                                    [weakSelf cleanup];
-                                                                  }];
-  [_task setResponseBlock:[DBURLSessionTaskResponseBlockWrapper withRpcResponseBlock:storageBlock] queue:queue];
+  DBCleanupBlock cleanupBlock = ^{
+    [weakSelf cleanup];
+  };
+  DBRpcResponseBlockImpl decodedResponseBlock = responseBlock;
+  DBCleanupBlock storageCleanupBlock = cleanupBlock;
+  if (self.decodeQueue) {
+    // the response is deserialized on the decode queue, and only the result is handed to the response queue. The task
+    // is cleaned up once the response block has run there, not once the response is decoded
+    NSOperationQueue *responseQueue = queue ?: [NSOperationQueue mainQueue];
+    decodedResponseBlock = ^(id result, id routeError, DBRequestError *networkError) {
+      [responseQueue addOperationWithBlock:^{
+        responseBlock(result, routeError, networkError);
+        cleanupBlock();
+      }];
+    };
+    storageCleanupBlock = ^{
+    };
+  }
+  DBRpcResponseBlockStorage storageBlock = [self storageBlockWithResponseBlock:decodedResponseBlock
+                                                                  cleanupBlock:storageCleanupBlock];
+  [_task setResponseBlock:[DBURLSessionTaskResponseBlockWrapper withRpcResponseBlock:storageBlock]
+                    queue:self.decodeQueue ?: queue];
   return self;
 }
 
@@ -85,7 +102,7 @@
 }
 
 - (DBRpcTask *)setProgressBlock:(DBProgressBlock)progressBlock queue:(NSOperationQueue *)queue {
-  [_task setProgressBlock:progressBlock queue:queue];
+  [_task setProgressCoalescer:[self progressCoalescerWithProgressBlock:progressBlock queue:queue]];
   return self;
 }
 
@@ -152,12 +169,28 @@
 - (DBUploadTask *)setResponseBlock:(DBUploadResponseBlockImpl)responseBlock queue:(NSOperationQueue *)queue {
   _responseBlock = responseBlock;
   __weak __typeof(self) weakSelf = self;
-  DBUploadResponseBlockStorage storageBlock = [self storageBlockWithResponseBlock:responseBlock
-                                                                     cleanupBlock:^{
-                                                                       [weakSelf cleanup];
-                                                                     }];
+  DBCleanupBlock cleanupBlock = ^{
+    [weakSelf cleanup];
+  };
+  DBUploadResponseBlockImpl decodedResponseBlock = responseBlock;
+  DBCleanupBlock storageCleanupBlock = cleanupBlock;
+  if (self.decodeQueue) {
+    // the response is deserialized on the decode queue, and only the result is handed to the response queue. The task
+    // is cleaned up once the response block has run there, not once the response is decoded
+    NSOperationQueue *responseQueue = queue ?: [NSOperationQueue mainQueue];
+    decodedResponseBlock = ^(id result, id routeError, DBRequestError *networkError) {
+      [responseQueue addOperationWithBlock:^{
+        responseBlock(result, routeError, networkError);
+        cleanupBlock();
+      }];
+    };
+    storageCleanupBlock = ^{
+    };
+  }
+  DBUploadResponseBlockStorage storageBlock = [self storageBlockWithResponseBlock:decodedResponseBlock
+                                                                     cleanupBlock:storageCleanupBlock];
   [_uploadTask setResponseBlock:[DBURLSessionTaskResponseBlockWrapper withUploadResponseBlock:storageBlock]
-                          queue:queue];
+                          queue:self.decodeQueue ?: queue];
   return self;
 }
 
@@ -166,7 +199,7 @@
 }
 
 - (DBUploadTask *)setProgressBlock:(DBProgressBlock)progressBlock queue:(NSOperationQueue *)queue {
-  [_uploadTask setProgressBlock:progressBlock queue:queue];
+  [_uploadTask setProgressCoalescer:[self progressCoalescerWithProgressBlock:progressBlock queue:queue]];
   return self;
 }
 
@@ -243,13 +276,29 @@
 - (DBDownloadUrlTask *)setResponseBlock:(DBDownloadUrlResponseBlockImpl)responseBlock queue:(NSOperationQueue *)queue {
   _responseBlock = responseBlock;
   __weak __typeof(self) weakSelf = self;
-  DBDownloadResponseBlockStorage storageBlock = [self storageBlockWithResponseBlock:responseBlock
-                                                                       cleanupBlock:^{
-                                                                         [weakSelf cleanup];
-                                                                       }];
+  DBCleanupBlock cleanupBlock = ^{
+    [weakSelf cleanup];
+  };
+  DBDownloadUrlResponseBlockImpl decodedResponseBlock = responseBlock;
+  DBCleanupBlock storageCleanupBlock = cleanupBlock;
+  if (self.decodeQueue) {
+    // the response is deserialized on the decode queue, and only the result is handed to the response queue. The task
+    // is cleaned up once the response block has run there, not once the response is decoded
+    NSOperationQueue *responseQueue = queue ?: [NSOperationQueue mainQueue];
+    decodedResponseBlock = ^(id result, id routeError, DBRequestError *networkError, NSURL *destination) {
+      [responseQueue addOperationWithBlock:^{
+        responseBlock(result, routeError, networkError, destination);
+        cleanupBlock();
+      }];
+    };
+    storageCleanupBlock = ^{
+    };
+  }
+  DBDownloadResponseBlockStorage storageBlock = [self storageBlockWithResponseBlock:decodedResponseBlock
+                                                                       cleanupBlock:storageCleanupBlock];
 
   [_downloadUrlTask setResponseBlock:[DBURLSessionTaskResponseBlockWrapper withDownloadResponseBlock:storageBlock]
-                               queue:queue];
+                               queue:self.decodeQueue ?: queue];
   return self;
 }
 
@@ -258,7 +307,7 @@
 }
 
 - (DBDownloadUrlTask *)setProgressBlock:(DBProgressBlock)progressBlock queue:(NSOperationQueue *)queue {
-  [_downloadUrlTask setProgressBlock:progressBlock queue:queue];
+  [_downloadUrlTask setProgressCoalescer:[self progressCoalescerWithProgressBlock:progressBlock queue:queue]];
   return self;
 }
 
@@ -270,12 +319,21 @@
   DBDownloadDataTaskImpl *_selfRetained;
   DBDownloadDataResponseBlockImpl _responseBlock;
   id<DBURLSessionTask> _downloadDataTask;
+  BOOL _streaming;
 }
 
 - (instancetype)initWithTask:(id<DBURLSessionTask>)task tokenUid:(NSString *)tokenUid route:(DBRoute *)route {
+  return [self initWithTask:task tokenUid:tokenUid route:route streaming:NO];
+}
+
+- (instancetype)initWithTask:(id<DBURLSessionTask>)task
+                    tokenUid:(NSString *)tokenUid
+                       route:(DBRoute *)route
+                   streaming:(BOOL)streaming {
   self = [super initWithRoute:route tokenUid:tokenUid];
   if (self) {
     _downloadDataTask = task;
+    _streaming = streaming;
     _selfRetained = self;
   }
   return self;
@@ -313,8 +371,10 @@
 - (DBTask *)restart {
   DBDownloadDataTaskImpl *sdkTask = [[DBDownloadDataTaskImpl alloc] initWithTask:[_downloadDataTask duplicate]
                                                                         tokenUid:self.tokenUid
-                                                                           route:self.route];
+                                                                           route:self.route
+                                                                       streaming:_streaming];
   sdkTask.retryCount += 1;
+  sdkTask.mapsFileData = self.mapsFileData;
   [sdkTask setResponseBlock:_responseBlock queue:_queue];
   [sdkTask resume];
   return sdkTask;
@@ -328,12 +388,37 @@
                                    queue:(NSOperationQueue *)queue {
   _responseBlock = responseBlock;
   __weak __typeof(self) weakSelf = self;
-  DBDownloadResponseBlockStorage storageBlock = [self storageBlockWithResponseBlock:responseBlock
-                                                                       cleanupBlock:^{
-                                                                         [weakSelf cleanup];
-                                                                       }];
-  [_downloadDataTask setResponseBlock:[DBURLSessionTaskResponseBlockWrapper withDownloadResponseBlock:storageBlock]
-                                queue:queue];
+  DBCleanupBlock cleanupBlock = ^{
+    [weakSelf cleanup];
+  };
+  DBDownloadDataResponseBlockImpl decodedResponseBlock = responseBlock;
+  DBCleanupBlock storageCleanupBlock = cleanupBlock;
+  if (self.decodeQueue) {
+    // the response is deserialized on the decode queue, and only the result is handed to the response queue. The task
+    // is cleaned up once the response block has run there, not once the response is decoded
+    NSOperationQueue *responseQueue = queue ?: [NSOperationQueue mainQueue];
+    decodedResponseBlock = ^(id result, id routeError, DBRequestError *networkError, NSData *fileContents) {
+      [responseQueue addOperationWithBlock:^{
+        responseBlock(result, routeError, networkError, fileContents);
+        cleanupBlock();
+      }];
+    };
+    storageCleanupBlock = ^{
+    };
+  }
+  NSOperationQueue *storageQueue = self.decodeQueue ?: queue;
+  if (_streaming) {
+    // a streaming download completes like an RPC-style request, with only an error body left in memory
+    DBRpcResponseBlockStorage storageBlock = [self streamStorageBlockWithResponseBlock:decodedResponseBlock
+                                                                          cleanupBlock:storageCleanupBlock];
+    [_downloadDataTask setResponseBlock:[DBURLSessionTaskResponseBlockWrapper withRpcResponseBlock:storageBlock]
+                                  queue:storageQueue];
+  } else {
+    DBDownloadResponseBlockStorage storageBlock = [self storageBlockWithResponseBlock:decodedResponseBlock
+                                                                         cleanupBlock:storageCleanupBlock];
+    [_downloadDataTask setResponseBlock:[DBURLSessionTaskResponseBlockWrapper withDownloadResponseBlock:storageBlock]
+                                  queue:storageQueue];
+  }
   return self;
 }
 
@@ -342,7 +427,7 @@
 }
 
 - (DBDownloadDataTask *)setProgressBlock:(DBProgressBlock)progressBlock queue:(NSOperationQueue *)queue {
-  [_downloadDataTask setProgressBlock:progressBlock queue:queue];
+  [_downloadDataTask setProgressCoalescer:[self progressCoalescerWithProgressBlock:progressBlock queue:queue]];
   return self;
 }
 
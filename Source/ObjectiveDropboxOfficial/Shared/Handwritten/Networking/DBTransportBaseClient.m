@@ -9,17 +9,69 @@
 #import "DBAUTHRateLimitError.h"
 #import "DBAccessTokenProvider+Internal.h"
 #import "DBCOMMONPathRootError.h"
+#import "DBJSONReader.h"
+#import "DBJSONWriter.h"
 #import "DBRequestErrors.h"
+#import "DBRoute+Internal.h"
 #import "DBSDKConstants.h"
 #import "DBStoneBase.h"
+#import "DBStoneValidators+ServerResponses.h"
 #import "DBTransportBaseClient.h"
 #import "DBTransportBaseConfig.h"
 #import "DBTransportBaseHostnameConfig.h"
 
+// error bodies from the API are small JSON objects; anything else is only kept long enough to summarize the error
+static const NSUInteger kDBErrorDataMaxJSONLength = 64 * 1024;
+static const NSUInteger kDBErrorDataMaxOtherLength = 4 * 1024;
+
+// the bytes read from a saved error body at a time, enough to decide how much of it to keep
+#define kDBErrorDataReadLength 4096
+
+// Returns how much of an error body starting with `data` is kept, or 0 if `data` is only whitespace so far.
+static NSUInteger DBErrorDataLimit(NSData *data) {
+  const uint8_t *bytes = data.bytes;
+  for (NSUInteger i = 0; i < data.length; i++) {
+    switch (bytes[i]) {
+    case ' ':
+    case '\t':
+    case '\r':
+    case '\n':
+      continue;
+    case '{':
+      return kDBErrorDataMaxJSONLength;
+    default:
+      return kDBErrorDataMaxOtherLength;
+    }
+  }
+  return 0;
+}
+
+// Drops a UTF-8 sequence cut off by truncation, so that the kept prefix still decodes as a string.
+static void DBTrimIncompleteUTF8Sequence(NSMutableData *data) {
+  const uint8_t *bytes = data.bytes;
+  NSUInteger length = data.length;
+  NSUInteger start = length;
+  while (start > 0 && length - start < 3 && (bytes[start - 1] & 0xC0) == 0x80) {
+    start--;
+  }
+  if (start == 0) {
+    return;
+  }
+  uint8_t lead = bytes[start - 1];
+  NSUInteger sequenceLength = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+  if (length - (start - 1) < sequenceLength) {
+    data.length = start - 1;
+  }
+}
+
 #pragma mark - Internal serialization helpers
 
 @interface DBTransportBaseClient ()
 @property (nonatomic, readonly, copy) DBTransportBaseHostnameConfig *hostnameConfig;
+@property (nonatomic, readonly, copy) NSString *pathRootHeader;
+@property (nonatomic, readonly, copy) NSDictionary<NSString *, NSString *> *headerTemplate;
+@property (nonatomic, readonly, copy) NSDictionary<NSString *, NSString *> *noauthHeaderTemplate;
+@property (nonatomic, readonly, copy, nullable) NSString *basicAuthorization;
 @end
 
 @implementation DBTransportBaseClient
@@ -49,74 +101,76 @@
                                            : defaultUserAgent;
     _asMemberId = transportConfig.asMemberId;
     _pathRoot = transportConfig.pathRoot;
+    // the path root is fixed for the client's lifetime, so it is serialized once rather than for every request
+    _pathRootHeader = _pathRoot ? [[self class] serializeStringWithRoute:nil routeArg:_pathRoot] : nil;
     _additionalHeaders = transportConfig.additionalHeaders;
+
+    // everything in the headers that is fixed for the client's lifetime is built once
+    NSMutableDictionary<NSString *, NSString *> *headerTemplate = [NSMutableDictionary new];
+    [headerTemplate setObject:_userAgent forKey:@"User-Agent"];
+    _noauthHeaderTemplate = [headerTemplate copy];
+    if (_asMemberId) {
+      [headerTemplate setObject:_asMemberId forKey:@"Dropbox-Api-Select-User"];
+    }
+    if (_pathRootHeader) {
+      [headerTemplate setObject:_pathRootHeader forKey:@"Dropbox-Api-Path-Root"];
+    }
+    _headerTemplate = [headerTemplate copy];
+    if (_appKey != nil && _appSecret != nil) {
+      NSString *authString = [NSString stringWithFormat:@"%@:%@", _appKey, _appSecret];
+      NSData *authData = [authString dataUsingEncoding:NSUTF8StringEncoding];
+      _basicAuthorization = [NSString stringWithFormat:@"Basic %@", [authData base64EncodedStringWithOptions:0]];
+    }
   }
   return self;
 }
 
-- (NSDictionary *)headersWithRouteInfo:(NSDictionary<NSString *, NSString *> *)routeAttributes
-                         serializedArg:(NSString *)serializedArg {
-  return [self headersWithRouteInfo:routeAttributes serializedArg:serializedArg byteOffsetStart:nil byteOffsetEnd:nil];
+- (NSDictionary *)headersWithRoute:(DBRoute *)route serializedArg:(NSString *)serializedArg {
+  return [self headersWithRoute:route serializedArg:serializedArg byteOffsetStart:nil byteOffsetEnd:nil];
 }
 
-- (NSDictionary *)headersWithRouteInfo:(NSDictionary<NSString *, NSString *> *)routeAttributes
-                         serializedArg:(NSString *)serializedArg
-                       byteOffsetStart:(NSNumber *)byteOffsetStart
-                         byteOffsetEnd:(NSNumber *)byteOffsetEnd {
-  NSString *routeStyle = routeAttributes[@"style"];
-
-  // routeAuthStr is one of user|team|app|noauth|app, user
-  NSString *routeAuthStr = routeAttributes[@"auth"];
-  NSArray *routeAuthsSplit = [routeAuthStr componentsSeparatedByString:@","];
-  NSMutableArray<NSString *> *routeAuths = [NSMutableArray array];
-  [routeAuthsSplit enumerateObjectsUsingBlock:^(NSString *_Nonnull obj, NSUInteger idx, BOOL *_Nonnull stop) {
-#pragma unused(idx)
-#pragma unused(stop)
-    [routeAuths addObject:[obj stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]]];
-  }];
-
-  NSMutableDictionary<NSString *, NSString *> *headers = [[NSMutableDictionary alloc] init];
-  [headers setObject:_userAgent forKey:@"User-Agent"];
+- (NSDictionary *)headersWithRoute:(DBRoute *)route
+                     serializedArg:(NSString *)serializedArg
+                   byteOffsetStart:(NSNumber *)byteOffsetStart
+                     byteOffsetEnd:(NSNumber *)byteOffsetEnd {
+  DBRouteAuth routeAuth = route.auth;
+  BOOL noauth = (routeAuth & DBRouteAuthNoAuth) != 0;
 
-  BOOL noauth = [routeAuths containsObject:@"noauth"];
+  // only the fields that vary between requests are added to the client's template
+  NSMutableDictionary<NSString *, NSString *> *headers =
+      [(noauth ? _noauthHeaderTemplate : _headerTemplate) mutableCopy];
 
   if (!noauth) {
-    if (_asMemberId) {
-      [headers setObject:_asMemberId forKey:@"Dropbox-Api-Select-User"];
-    }
-
-    if (_pathRoot) {
-      NSString *pathRootStr = [[self class] serializeStringWithRoute:nil routeArg:_pathRoot];
-      [headers setObject:pathRootStr forKey:@"Dropbox-Api-Path-Root"];
-    }
-
     // Order is important here. Route may support multiple auth types, so check from most specific to least.
-    if (([routeAuths containsObject:@"user"] || [routeAuths containsObject:@"team"]) && (_accessTokenProvider != nil)) {
+    if ((routeAuth & (DBRouteAuthUser | DBRouteAuthTeam)) && (_accessTokenProvider != nil)) {
       [headers setObject:[NSString stringWithFormat:@"Bearer %@", _accessTokenProvider.accessToken]
                   forKey:@"Authorization"];
-    } else if ([routeAuths containsObject:@"app"] && (_appKey != nil) && (_appSecret != nil)) {
-      NSString *authString = [NSString stringWithFormat:@"%@:%@", _appKey, _appSecret];
-      NSData *authData = [authString dataUsingEncoding:NSUTF8StringEncoding];
-      [headers setObject:[NSString stringWithFormat:@"Basic %@", [authData base64EncodedStringWithOptions:0]]
-                  forKey:@"Authorization"];
+    } else if ((routeAuth & DBRouteAuthApp) && (_basicAuthorization != nil)) {
+      [headers setObject:_basicAuthorization forKey:@"Authorization"];
     } else {
       NSLog(@"Auth info not properly configured. Use custom `DBTransportDefaultConfig` instance to set.");
     }
   }
 
-  if ([routeStyle isEqualToString:@"rpc"]) {
+  switch (route.style) {
+  case DBRouteStyleRpc:
     if (serializedArg) {
       [headers setObject:@"application/json" forKey:@"Content-Type"];
     }
-  } else if ([routeStyle isEqualToString:@"upload"]) {
+    break;
+  case DBRouteStyleUpload:
     [headers setObject:@"application/octet-stream" forKey:@"Content-Type"];
     if (serializedArg) {
       [headers setObject:serializedArg forKey:@"Dropbox-API-Arg"];
     }
-  } else if ([routeStyle isEqualToString:@"download"]) {
+    break;
+  case DBRouteStyleDownload:
     if (serializedArg) {
       [headers setObject:serializedArg forKey:@"Dropbox-API-Arg"];
     }
+    break;
+  case DBRouteStyleUnknown:
+    break;
   }
 
   if (byteOffsetStart && byteOffsetEnd) {
@@ -172,17 +226,15 @@
   if (!arg) {
     return nil;
   }
-  NSData *jsonData = [self serializeDataWithRoute:route routeArg:arg];
-  if (!jsonData) {
+  return [self serializedStringWithData:[self serializeDataWithRoute:route routeArg:arg]];
+}
+
++ (NSString *)serializedStringWithData:(NSData *)serializedData {
+  if (!serializedData) {
     return nil;
   }
-  NSString *asciiEscapedStr = [[self class] asciiEscapeWithString:[[self class] utf8StringWithData:jsonData]];
-  NSMutableString *filteredStr = [[NSMutableString alloc] initWithString:asciiEscapedStr];
-  [filteredStr replaceOccurrencesOfString:@"\\/"
-                               withString:@"/"
-                                  options:NSLiteralSearch
-                                    range:NSMakeRange(0, [filteredStr length])];
-  return filteredStr;
+  // the serialized data is already escaped to ASCII, so it can be used as a header value as is
+  return [[NSString alloc] initWithData:serializedData encoding:NSASCIIStringEncoding];
 }
 
 + (NSData *)jsonDataWithJsonObj:(id)jsonObj {
@@ -190,21 +242,16 @@
     return nil;
   }
 
-  NSError *error;
-  NSData *jsonData = [NSJSONSerialization dataWithJSONObject:jsonObj options:0 error:&error];
+  NSData *jsonData = [DBJSONWriter asciiDataWithJSONObject:jsonObj];
 
   if (!jsonData) {
-    NSLog(@"Error serializing dictionary: %@", error.localizedDescription);
+    NSLog(@"Error serializing dictionary: %@ is not a valid JSON object", jsonObj);
     return nil;
   } else {
     return jsonData;
   }
 }
 
-+ (NSString *)utf8StringWithData:(NSData *)jsonData {
-  return [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
-}
-
 + (NSString *)asciiEscapeWithString:(NSString *)string {
     // if the string is already ascii, return immediately
     if ([string canBeConvertedToEncoding:NSASCIIStringEncoding]) {
@@ -317,11 +364,50 @@
   id routeError = nil;
   NSDictionary *deserializedData = [self deserializeHttpData:data];
   if ([[self class] statusCodeIsRouteError:statusCode]) {
-    routeError = [route.errorType deserialize:deserializedData[@"error"]];
+    routeError = [DBStoneValidators deserializeTrustedValue:^id {
+      return [route.errorType deserialize:deserializedData[@"error"]];
+    }];
   }
   return routeError;
 }
 
++ (BOOL)appendErrorData:(NSData *)data toErrorData:(NSMutableData *)errorData {
+  NSUInteger limit = DBErrorDataLimit(errorData) ?: DBErrorDataLimit(data) ?: kDBErrorDataMaxJSONLength;
+  if (errorData.length >= limit) {
+    return NO;
+  }
+  NSUInteger length = MIN(data.length, limit - errorData.length);
+  [errorData appendBytes:data.bytes length:length];
+  if (length < data.length) {
+    DBTrimIncompleteUTF8Sequence(errorData);
+    return NO;
+  }
+  return errorData.length < limit;
+}
+
++ (NSData *)errorDataWithContentsOfFile:(NSURL *)location {
+  NSString *path = location.path;
+  if (path.length == 0) {
+    return nil;
+  }
+  FILE *file = fopen(path.fileSystemRepresentation, "rb");
+  if (file == NULL) {
+    return nil;
+  }
+
+  NSMutableData *errorData = [NSMutableData new];
+  uint8_t buffer[kDBErrorDataReadLength];
+  size_t length;
+  while ((length = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    NSData *chunk = [[NSData alloc] initWithBytesNoCopy:buffer length:length freeWhenDone:NO];
+    if (![self appendErrorData:chunk toErrorData:errorData]) {
+      break;
+    }
+  }
+  fclose(file);
+  return errorData;
+}
+
 + (NSDictionary *)deserializeHttpData:(NSData *)data {
   if (!data) {
     return nil;
@@ -338,20 +424,33 @@
   if (!route.resultType) {
     return nil;
   }
+
+  // build the result straight from the bytes when its type supports it, skipping the intermediate dictionaries
+  Class resultClass = (Class)route.resultType;
+  if (!route.dataStructDeserialBlock && [resultClass respondsToSelector:@selector(deserializeFromReader:)]) {
+    DBJSONReader *reader = [[DBJSONReader alloc] initWithData:data];
+    id result = [DBStoneValidators deserializeTrustedValue:^id {
+      return [(Class<DBStreamDeserializable>)resultClass deserializeFromReader:reader];
+    }];
+    if (![reader finish]) {
+      *serializationError = reader.error;
+      return nil;
+    }
+    return result;
+  }
+
   id jsonData =
       [NSJSONSerialization JSONObjectWithData:data options:NSJSONReadingMutableContainers error:serializationError];
   if (*serializationError) {
     return nil;
   }
 
-  if (route.resultType) {
+  return [DBStoneValidators deserializeTrustedValue:^id {
     if (route.dataStructDeserialBlock) {
       return route.dataStructDeserialBlock(jsonData);
     }
     return [(Class)route.resultType deserialize:jsonData];
-  }
-
-  return nil;
+  }];
 }
 
 + (BOOL)statusCodeIsRouteError:(int)statusCode {
@@ -4,6 +4,7 @@
 
 #import <Foundation/Foundation.h>
 
+#import "DBHandlerTypes.h"
 #import "DBSerializableProtocol.h"
 
 @class DBDownloadDataTask;
@@ -156,6 +157,59 @@ NS_ASSUME_NONNULL_BEGIN
                         byteOffsetStart:(nullable NSNumber *)byteOffsetStart
                           byteOffsetEnd:(nullable NSNumber *)byteOffsetEnd;
 
+#pragma mark - Download-style request (streaming)
+
+///
+/// Request to Download-style endpoint (streaming the output to a consumer block).
+///
+/// The file content is handed to `consumerBlock` as it arrives, rather than downloaded to a temporary file and loaded
+/// into memory, and the request is paused while the consumer falls behind. Streaming requests are always made in the
+/// foreground.
+///
+/// @param route The static `DBRoute` instance associated with the route. Contains information like route host, response
+/// type, etc.
+/// @param arg The unserialized route argument to pass. Must conform to the `DBSerializable` protocol.
+/// @param byteOffsetStart For partial file download. Download file beginning from this starting byte position.
+/// @param byteOffsetEnd For partial file download. Download file up until this ending byte position.
+/// @param consumerBlock The block to which the file content is handed, piece by piece and in order. Returning `NO`
+/// cancels the request.
+/// @param consumerQueue The operation queue on which to execute the consumer block. It is forced to be serial. If nil,
+/// a private serial queue is used.
+///
+/// @return A `DBDownloadDataTask` where response and progress handlers can be added, and the request can be halted or
+/// cancelled. The response handler is executed once the whole file content has been consumed, and always receives
+/// `nil` file data.
+///
+- (DBDownloadDataTask *)requestDownload:(DBRoute *)route
+                                    arg:(id<DBSerializable> _Nullable)arg
+                        byteOffsetStart:(nullable NSNumber *)byteOffsetStart
+                          byteOffsetEnd:(nullable NSNumber *)byteOffsetEnd
+                          consumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+                          consumerQueue:(nullable NSOperationQueue *)consumerQueue;
+
+///
+/// Request to Download-style endpoint (streaming the output to an `NSOutputStream`).
+///
+/// Behaves like `requestDownload:arg:byteOffsetStart:byteOffsetEnd:consumerBlock:consumerQueue:`, writing the file
+/// content to `outputStream` on a private serial queue. The stream is opened if it is not open yet, and is left open
+/// for the caller to close once the response handler is executed. A failed write cancels the request.
+///
+/// @param route The static `DBRoute` instance associated with the route. Contains information like route host, response
+/// type, etc.
+/// @param arg The unserialized route argument to pass. Must conform to the `DBSerializable` protocol.
+/// @param byteOffsetStart For partial file download. Download file beginning from this starting byte position.
+/// @param byteOffsetEnd For partial file download. Download file up until this ending byte position.
+/// @param outputStream The stream to which the file content is written.
+///
+/// @return A `DBDownloadDataTask` where response and progress handlers can be added, and the request can be halted or
+/// cancelled. The response handler always receives `nil` file data.
+///
+- (DBDownloadDataTask *)requestDownload:(DBRoute *)route
+                                    arg:(id<DBSerializable> _Nullable)arg
+                        byteOffsetStart:(nullable NSNumber *)byteOffsetStart
+                          byteOffsetEnd:(nullable NSNumber *)byteOffsetEnd
+                           outputStream:(NSOutputStream *)outputStream;
+
 @end
 
 NS_ASSUME_NONNULL_END
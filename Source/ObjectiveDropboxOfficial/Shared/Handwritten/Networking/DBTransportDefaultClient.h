@@ -36,7 +36,9 @@ NS_ASSUME_NONNULL_BEGIN
 @interface DBTransportDefaultClient : DBTransportBaseClient <DBTransportClient>
 
 /// A serial delegate queue used for executing blocks of code that touch state shared across threads (mainly the request
-/// handlers storage).
+/// handlers storage). This is the queue supplied in the transport config, if any. Otherwise the storage is sharded
+/// across internal serial queues, so that independent requests don't wait on each other, and this is the queue the
+/// callbacks of the main session are delivered on, which is one of those shards.
 @property (nonatomic, readonly) NSOperationQueue *delegateQueue;
 
 /// If set to true when the `DBTransportDefaultClient` object is initialized, all network requests are made on
@@ -12,13 +12,42 @@
 #import "DBTasksImpl.h"
 #import "DBTransportBaseClient+Internal.h"
 #import "DBTransportBaseHostnameConfig.h"
+#import "DBTransportDefaultClient+Internal.h"
 #import "DBTransportDefaultConfig.h"
 #import "DBURLSessionTaskWithTokenRefresh.h"
 
+static BOOL DBWriteDataToOutputStream(NSData *data, NSOutputStream *outputStream) {
+  if (outputStream.streamStatus == NSStreamStatusNotOpen) {
+    [outputStream open];
+  }
+
+  const uint8_t *bytes = data.bytes;
+  NSUInteger offset = 0;
+  while (offset < data.length) {
+    // blocks until the stream has space, which is fine on the private consumer queue
+    NSInteger written = [outputStream write:bytes + offset maxLength:data.length - offset];
+    if (written <= 0) {
+      return NO;
+    }
+    offset += (NSUInteger)written;
+  }
+  return YES;
+}
+
 @implementation DBTransportDefaultClient {
   /// The delegate used to manage execution of all response / error code. By default, this
   /// is an instance of `DBDelegate` with the main thread queue as delegate queue.
   DBDelegate *_delegate;
+
+  /// The delegate queue supplied in the transport config, if any, passed on to derived clients.
+  NSOperationQueue *_suppliedDelegateQueue;
+
+  /// The client whose sessions this client makes its requests through, kept alive for as long as this client, or
+  /// nil if the sessions are its own.
+  DBTransportDefaultClient *_sessionOwner;
+
+  /// The sessions this client set up, invalidated along with it.
+  NSArray<NSURLSession *> *_ownedSessions;
 }
 
 @synthesize session = _session;
@@ -40,9 +69,9 @@
                             transportConfig:(DBTransportDefaultConfig *)transportConfig {
   self = [super initWithAccessTokenProvider:accessTokenProvider tokenUid:tokenUid transportConfig:transportConfig];
   if (self) {
-    _delegateQueue = transportConfig.delegateQueue ?: [NSOperationQueue new];
-    _delegateQueue.maxConcurrentOperationCount = 1;
-    _delegate = [[DBDelegate alloc] initWithQueue:_delegateQueue];
+    _suppliedDelegateQueue = transportConfig.delegateQueue;
+    // without a supplied queue, the delegate shards the handler storage instead of serializing it on one queue
+    _delegate = [[DBDelegate alloc] initWithQueue:_suppliedDelegateQueue];
 
     NSURLSessionConfiguration *sessionConfig = [NSURLSessionConfiguration defaultSessionConfiguration];
     sessionConfig.timeoutIntervalForRequest = 60.0;
@@ -52,6 +81,7 @@
                                                                          NSStringFromClass(self.class)]];
     _session =
         [NSURLSession sessionWithConfiguration:sessionConfig delegate:_delegate delegateQueue:sessionDelegateQueue];
+    _delegateQueue = _suppliedDelegateQueue ?: sessionDelegateQueue;
     _forceForegroundSession = transportConfig.forceForegroundSession ? YES : NO;
     if (!_forceForegroundSession) {
       NSString *backgroundId =
@@ -81,13 +111,58 @@
     _longpollSession = [NSURLSession sessionWithConfiguration:longpollSessionConfig
                                                      delegate:_delegate
                                                 delegateQueue:longpollSessionDelegateQueue];
+    _ownedSessions = _secondarySession == _session ? @[ _session, _longpollSession ]
+                                                   : @[ _session, _secondarySession, _longpollSession ];
   }
   return self;
 }
 
+- (instancetype)initSharingSessionsOfClient:(DBTransportDefaultClient *)client
+                            transportConfig:(DBTransportDefaultConfig *)transportConfig {
+  return [self initSharingSessionsOfClient:client
+                       accessTokenProvider:client.accessTokenProvider
+                                  tokenUid:client.tokenUid
+                           transportConfig:transportConfig];
+}
+
+- (instancetype)initSharingSessionsOfClient:(DBTransportDefaultClient *)client
+                        accessTokenProvider:(id<DBAccessTokenProvider>)accessTokenProvider
+                                   tokenUid:(NSString *)tokenUid
+                            transportConfig:(DBTransportDefaultConfig *)transportConfig {
+  // skips the session setup of the designated initializer: everything but the headers comes from `client`
+  self = [super initWithAccessTokenProvider:accessTokenProvider tokenUid:tokenUid transportConfig:transportConfig];
+  if (self) {
+    _sessionOwner = client->_sessionOwner ?: client;
+    _suppliedDelegateQueue = client->_suppliedDelegateQueue;
+    _delegateQueue = client->_delegateQueue;
+    _delegate = client->_delegate;
+    _forceForegroundSession = client->_forceForegroundSession;
+    @synchronized(client) {
+      _session = client->_session;
+      _secondarySession = client->_secondarySession;
+      _longpollSession = client->_longpollSession;
+    }
+  }
+  return self;
+}
+
+- (void)dealloc {
+  // sessions hold on to their delegate until invalidated. Tasks not yet started are created through blocks that keep
+  // this client alive, and those already running are let finish.
+  for (NSURLSession *session in _ownedSessions) {
+    [session finishTasksAndInvalidate];
+  }
+}
+
 #pragma mark - Utility methods
 
 - (NSOperationQueue *)urlSessionDelegateQueueWithName:(NSString *)queueName {
+  // callbacks delivered straight onto a shard of the delegate don't need to hop onto it
+  NSOperationQueue *shardQueue = [_delegate sessionDelegateQueue];
+  if (shardQueue) {
+    return shardQueue;
+  }
+
   NSOperationQueue *sessionDelegateQueue = [[NSOperationQueue alloc] init];
   sessionDelegateQueue.maxConcurrentOperationCount = 1; // [Michael Fey, 2017-05-16] From the NSURLSession
                                                         // documentation: "The queue should be a serial queue, in order
@@ -108,10 +183,10 @@
 
   DBURLSessionTaskCreationBlock taskCreationBlock = ^{
     NSURL *requestUrl = [self urlWithRoute:route];
-    NSString *serializedArg = [[self class] serializeStringWithRoute:route routeArg:arg];
-    NSDictionary *headers = [self headersWithRouteInfo:route.attrs serializedArg:serializedArg];
     // RPC request submits argument in request body
     NSData *serializedArgData = [[self class] serializeDataWithRoute:route routeArg:arg];
+    NSString *serializedArg = [[self class] serializedStringWithData:serializedArgData];
+    NSDictionary *headers = [self headersWithRoute:route serializedArg:serializedArg];
     NSURLRequest *request =
         [[self class] requestWithHeaders:headers url:requestUrl content:serializedArgData stream:nil];
     return [sessionToUse dataTaskWithRequest:request];
@@ -135,7 +210,7 @@
     NSURL *inputUrl = [NSURL fileURLWithPath:input];
     NSURL *requestUrl = [self urlWithRoute:route];
     NSString *serializedArg = [[self class] serializeStringWithRoute:route routeArg:arg];
-    NSDictionary *headers = [self headersWithRouteInfo:route.attrs serializedArg:serializedArg];
+    NSDictionary *headers = [self headersWithRoute:route serializedArg:serializedArg];
     NSURLRequest *request = [[self class] requestWithHeaders:headers url:requestUrl content:nil stream:nil];
     return [sessionToUse uploadTaskWithRequest:request fromFile:inputUrl];
   };
@@ -158,7 +233,7 @@
   DBURLSessionTaskCreationBlock taskCreationBlock = ^{
     NSURL *requestUrl = [self urlWithRoute:route];
     NSString *serializedArg = [[self class] serializeStringWithRoute:route routeArg:arg];
-    NSDictionary *headers = [self headersWithRouteInfo:route.attrs serializedArg:serializedArg];
+    NSDictionary *headers = [self headersWithRoute:route serializedArg:serializedArg];
 
     NSURLRequest *request = [[self class] requestWithHeaders:headers url:requestUrl content:nil stream:nil];
 
@@ -183,7 +258,7 @@
   DBURLSessionTaskCreationBlock taskCreationBlock = ^{
     NSURL *requestUrl = [self urlWithRoute:route];
     NSString *serializedArg = [[self class] serializeStringWithRoute:route routeArg:arg];
-    NSDictionary *headers = [self headersWithRouteInfo:route.attrs serializedArg:serializedArg];
+    NSDictionary *headers = [self headersWithRoute:route serializedArg:serializedArg];
     NSURLRequest *request = [[self class] requestWithHeaders:headers url:requestUrl content:nil stream:input];
     return [sessionToUse uploadTaskWithStreamedRequest:request];
   };
@@ -222,10 +297,10 @@
   DBURLSessionTaskCreationBlock taskCreationBlock = ^{
     NSURL *requestUrl = [self urlWithRoute:route];
     NSString *serializedArg = [[self class] serializeStringWithRoute:route routeArg:arg];
-    NSDictionary *headers = [self headersWithRouteInfo:route.attrs
-                                         serializedArg:serializedArg
-                                       byteOffsetStart:byteOffsetStart
-                                         byteOffsetEnd:byteOffsetEnd];
+    NSDictionary *headers = [self headersWithRoute:route
+                                     serializedArg:serializedArg
+                                   byteOffsetStart:byteOffsetStart
+                                     byteOffsetEnd:byteOffsetEnd];
 
     NSURLRequest *request = [[self class] requestWithHeaders:headers url:requestUrl content:nil stream:nil];
 
@@ -259,10 +334,10 @@
   DBURLSessionTaskCreationBlock taskCreationBlock = ^{
     NSURL *requestUrl = [self urlWithRoute:route];
     NSString *serializedArg = [[self class] serializeStringWithRoute:route routeArg:arg];
-    NSDictionary *headers = [self headersWithRouteInfo:route.attrs
-                                         serializedArg:serializedArg
-                                       byteOffsetStart:byteOffsetStart
-                                         byteOffsetEnd:byteOffsetEnd];
+    NSDictionary *headers = [self headersWithRoute:route
+                                     serializedArg:serializedArg
+                                   byteOffsetStart:byteOffsetStart
+                                     byteOffsetEnd:byteOffsetEnd];
     NSURLRequest *request = [[self class] requestWithHeaders:headers url:requestUrl content:nil stream:nil];
     return [sessionToUse downloadTaskWithRequest:request];
   };
@@ -277,12 +352,67 @@
   return downloadTask;
 }
 
+#pragma mark - Download-style request (streaming)
+
+- (DBDownloadDataTask *)requestDownload:(DBRoute *)route
+                                    arg:(id<DBSerializable>)arg
+                        byteOffsetStart:(NSNumber *)byteOffsetStart
+                          byteOffsetEnd:(NSNumber *)byteOffsetEnd
+                          consumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+                          consumerQueue:(NSOperationQueue *)consumerQueue {
+  // background sessions only support download tasks, which always go through a temporary file
+  NSURLSession *sessionToUse = _session;
+  DBDelegate *delegate = _delegate;
+  DBURLSessionTaskCreationBlock taskCreationBlock = ^{
+    NSURL *requestUrl = [self urlWithRoute:route];
+    NSString *serializedArg = [[self class] serializeStringWithRoute:route routeArg:arg];
+    NSDictionary *headers = [self headersWithRoute:route
+                                     serializedArg:serializedArg
+                                   byteOffsetStart:byteOffsetStart
+                                     byteOffsetEnd:byteOffsetEnd];
+    NSURLRequest *request = [[self class] requestWithHeaders:headers url:requestUrl content:nil stream:nil];
+    NSURLSessionDataTask *task = [sessionToUse dataTaskWithRequest:request];
+    // installed for every created task, so that a restarted request streams to the same consumer
+    [delegate addStreamConsumerForTaskWithIdentifier:task.taskIdentifier
+                                             session:sessionToUse
+                                       consumerBlock:consumerBlock
+                                       consumerQueue:consumerQueue];
+    return task;
+  };
+  id<DBURLSessionTask> taskWithTokenRefresh =
+      [[DBURLSessionTaskWithTokenRefresh alloc] initWithTaskCreationBlock:taskCreationBlock
+                                                             taskDelegate:_delegate
+                                                               urlSession:sessionToUse
+                                                            tokenProvider:self.accessTokenProvider];
+  DBDownloadDataTaskImpl *downloadTask = [[DBDownloadDataTaskImpl alloc] initWithTask:taskWithTokenRefresh
+                                                                             tokenUid:self.tokenUid
+                                                                                route:route
+                                                                            streaming:YES];
+  [downloadTask resume];
+  return downloadTask;
+}
+
+- (DBDownloadDataTask *)requestDownload:(DBRoute *)route
+                                    arg:(id<DBSerializable>)arg
+                        byteOffsetStart:(NSNumber *)byteOffsetStart
+                          byteOffsetEnd:(NSNumber *)byteOffsetEnd
+                           outputStream:(NSOutputStream *)outputStream {
+  return [self requestDownload:route
+                           arg:arg
+               byteOffsetStart:byteOffsetStart
+                 byteOffsetEnd:byteOffsetEnd
+                 consumerBlock:^BOOL(NSData *data) {
+                   return DBWriteDataToOutputStream(data, outputStream);
+                 }
+                 consumerQueue:nil];
+}
+
 - (DBTransportDefaultConfig *)duplicateTransportConfigWithAsMemberId:(NSString *)asMemberId {
   return [[DBTransportDefaultConfig alloc] initWithAppKey:self.appKey
                                                 appSecret:self.appSecret
                                                 userAgent:self.userAgent
                                                asMemberId:asMemberId
-                                            delegateQueue:_delegateQueue
+                                            delegateQueue:_suppliedDelegateQueue
                                    forceForegroundSession:_forceForegroundSession];
 }
 
@@ -295,7 +425,7 @@
                                                asMemberId:self.asMemberId
                                                  pathRoot:pathRoot
                                         additionalHeaders:nil
-                                            delegateQueue:_delegateQueue
+                                            delegateQueue:_suppliedDelegateQueue
                                    forceForegroundSession:_forceForegroundSession
                                 sharedContainerIdentifier:nil
 										  keychainService:nil];
@@ -14,8 +14,7 @@
 @property (nonatomic, weak) DBDelegate *taskDelegate;
 @property (nonatomic, strong) DBURLSessionTaskCreationBlock taskCreationBlock;
 @property (nonatomic, strong) id<DBAccessTokenProvider> tokenProvider;
-@property (nonatomic, strong) DBProgressBlock progressBlock;
-@property (nonatomic, strong) NSOperationQueue *progressQueue;
+@property (nonatomic, strong) DBProgressCoalescer *progressCoalescer;
 @property (nonatomic, strong) DBURLSessionTaskResponseBlockWrapper *responseBlockWrapper;
 @property (nonatomic, strong) NSOperationQueue *responseQueue;
 @property (nonatomic, strong) dispatch_queue_t serialQueue;
@@ -80,10 +79,9 @@
   });
 }
 
-- (void)setProgressBlock:(DBProgressBlock)progressBlock queue:(NSOperationQueue *)queue {
+- (void)setProgressCoalescer:(DBProgressCoalescer *)progressCoalescer {
   dispatch_async(_serialQueue, ^{
-    self->_progressBlock = progressBlock;
-    self->_progressQueue = queue;
+    self->_progressCoalescer = progressCoalescer;
     [self db_setProgressHandlerIfNecessary];
   });
 }
@@ -143,11 +141,10 @@
 }
 
 - (void)db_setProgressHandlerIfNecessary {
-  if (_sessionTask && _progressBlock) {
-    [_taskDelegate addProgressHandlerForTaskWithIdentifier:_sessionTask.taskIdentifier
-                                                   session:_session
-                                           progressHandler:_progressBlock
-                                      progressHandlerQueue:_progressQueue];
+  if (_sessionTask && _progressCoalescer) {
+    [_taskDelegate addProgressCoalescerForTaskWithIdentifier:_sessionTask.taskIdentifier
+                                                     session:_session
+                                           progressCoalescer:_progressCoalescer];
   }
 }
 
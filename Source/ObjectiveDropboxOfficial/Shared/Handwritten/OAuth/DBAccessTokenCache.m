@@ -0,0 +1,105 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import "DBAccessTokenCache.h"
+
+#import "DBOAuthManager.h"
+
+@implementation DBAccessTokenCache {
+  /// The store's tokens by uid, or `nil` until they are read.
+  NSMutableDictionary<NSString *, DBAccessToken *> *_tokens;
+}
+
++ (DBAccessTokenCache *)cacheWithKeychainService:(NSString *)service {
+  service = service ?: [NSBundle mainBundle].bundleIdentifier ?: @"";
+  static NSMutableDictionary<NSString *, DBAccessTokenCache *> *caches;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    caches = [NSMutableDictionary new];
+  });
+  @synchronized(caches) {
+    DBAccessTokenCache *cache = caches[service];
+    if (!cache) {
+      cache = [[DBAccessTokenCache alloc] initWithStore:[[DBKeychainAccessTokenStore alloc] initWithService:service]];
+      caches[service] = cache;
+    }
+    return cache;
+  }
+}
+
+- (instancetype)initWithStore:(id<DBAccessTokenStore>)store {
+  self = [super init];
+  if (self) {
+    _store = store;
+  }
+  return self;
+}
+
+// must be called while synchronized on `self`
+- (NSMutableDictionary<NSString *, DBAccessToken *> *)db_tokens {
+  if (!_tokens) {
+    _tokens = [[_store retrieveAllAccessTokens] mutableCopy];
+  }
+  return _tokens;
+}
+
+- (BOOL)storeAccessToken:(DBAccessToken *)accessToken {
+  @synchronized(self) {
+    BOOL stored = [_store storeAccessToken:accessToken];
+    if (stored) {
+      [_tokens setObject:accessToken forKey:accessToken.uid];
+    } else {
+      // the store's state is unknown, so it is read again when next needed
+      _tokens = nil;
+    }
+    return stored;
+  }
+}
+
+- (DBAccessToken *)retrieveAccessToken:(NSString *)uid {
+  @synchronized(self) {
+    DBAccessToken *token = [self db_tokens][uid];
+    if (!token) {
+      token = [_store retrieveAccessToken:uid];
+      if (token) {
+        _tokens[uid] = token;
+      }
+    }
+    return token;
+  }
+}
+
+- (NSDictionary<NSString *, DBAccessToken *> *)retrieveAllAccessTokens {
+  @synchronized(self) {
+    return [[self db_tokens] copy];
+  }
+}
+
+- (BOOL)hasAccessTokens {
+  @synchronized(self) {
+    return [self db_tokens].count != 0;
+  }
+}
+
+- (BOOL)deleteAccessToken:(NSString *)uid {
+  @synchronized(self) {
+    BOOL deleted = [_store deleteAccessToken:uid];
+    if (deleted) {
+      [_tokens removeObjectForKey:uid];
+    } else {
+      _tokens = nil;
+    }
+    return deleted;
+  }
+}
+
+- (BOOL)deleteAllAccessTokens {
+  @synchronized(self) {
+    BOOL deleted = [_store deleteAllAccessTokens];
+    _tokens = deleted ? [NSMutableDictionary new] : nil;
+    return deleted;
+  }
+}
+
+@end
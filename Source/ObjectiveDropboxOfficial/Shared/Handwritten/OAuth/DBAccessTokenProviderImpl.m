@@ -6,6 +6,19 @@
 
 #import "DBOAuthResult.h"
 
+// lazy refreshes happen once a request finds the token this close to expiry
+static const NSTimeInterval kDBTokenRefreshLeadTime = 300;
+
+// proactive refreshes happen at a random point up to this long before the lazy refresh window, so that the tokens of
+// many providers aren't all refreshed at once
+static const uint32_t kDBProactiveRefreshJitter = 600;
+
+// a failed proactive refresh is retried after this long, plus up to as much again, until the token expires
+static const uint32_t kDBProactiveRefreshRetryInterval = 60;
+
+// proactive refreshes may be delayed this long to be coalesced with other work
+static const uint64_t kDBProactiveRefreshLeeway = 10 * NSEC_PER_SEC;
+
 @implementation DBLongLivedAccessTokenProvider
 
 @synthesize accessToken = _accessToken;
@@ -27,10 +40,14 @@
 
 @interface DBShortLivedAccessTokenProvider ()
 
-@property (nonatomic, strong) DBAccessToken *token;
+// `DBAccessToken` is immutable, so readers take the current token without waiting for the queue; only blocks on
+// the queue replace it
+@property (atomic, strong) DBAccessToken *token;
 @property (nonatomic, strong) id<DBAccessTokenRefreshing> tokenRefresher;
 @property (nonatomic, strong) dispatch_queue_t queue;
 @property (nonatomic, strong) NSMutableArray<DBOAuthCompletion> *completionBlocks;
+@property (nonatomic) BOOL refreshesProactively;
+@property (nonatomic, strong, nullable) dispatch_source_t refreshTimer;
 
 @end
 
@@ -49,12 +66,14 @@
   return self;
 }
 
+- (void)dealloc {
+  if (_refreshTimer) {
+    dispatch_source_cancel(_refreshTimer);
+  }
+}
+
 - (NSString *)accessToken {
-  __block NSString *tokenString = nil;
-  dispatch_sync(_queue, ^{
-    tokenString = _token.accessToken;
-  });
-  return tokenString;
+  return self.token.accessToken;
 }
 
 - (void)refreshAccessTokenIfNecessary:(DBOAuthCompletion)completion {
@@ -68,17 +87,29 @@
     BOOL refreshInProgress = [self db_refreshInProgress];
     [self->_completionBlocks addObject:completion];
     if (!refreshInProgress) {
-      __weak typeof(self) weakSelf = self;
-      [self->_tokenRefresher refreshAccessToken:self->_token
-                                         scopes:@[]
-                                          queue:nil
-                                     completion:^(DBOAuthResult *result) {
-                                       [weakSelf db_handleRefreshResult:result];
-                                     }];
+      [self db_startRefresh];
     }
   });
 }
 
+- (void)startProactiveRefresh {
+  dispatch_barrier_async(_queue, ^{
+    self->_refreshesProactively = YES;
+    [self db_scheduleProactiveRefreshAfter:[self db_proactiveRefreshDelay]];
+  });
+}
+
+// must be called on `_queue` with a barrier, after adding a completion block
+- (void)db_startRefresh {
+  __weak typeof(self) weakSelf = self;
+  [_tokenRefresher refreshAccessToken:_token
+                               scopes:@[]
+                                queue:nil
+                           completion:^(DBOAuthResult *result) {
+                             [weakSelf db_handleRefreshResult:result];
+                           }];
+}
+
 /// Refresh if it's about to expire (5 minutes from expiration) or already expired.
 - (BOOL)db_shouldRefresh {
   NSTimeInterval expirationTimestamp = _token.tokenExpirationTimestamp;
@@ -86,7 +117,8 @@
     return NO;
   }
 
-  NSDate *fiveMinutesBeforeExpire = [NSDate dateWithTimeIntervalSince1970:expirationTimestamp - 300];
+  NSDate *fiveMinutesBeforeExpire =
+      [NSDate dateWithTimeIntervalSince1970:expirationTimestamp - kDBTokenRefreshLeadTime];
   BOOL dateHasPassed = fiveMinutesBeforeExpire.timeIntervalSinceNow < 0;
   return dateHasPassed;
 }
@@ -95,10 +127,61 @@
   return _completionBlocks.count > 0;
 }
 
+/// A random point between the start of the lazy refresh window and `kDBProactiveRefreshJitter` before that.
+- (NSTimeInterval)db_proactiveRefreshDelay {
+  NSTimeInterval jitter = arc4random_uniform(kDBProactiveRefreshJitter * 1000) / 1000.0;
+  NSTimeInterval refreshTimestamp = _token.tokenExpirationTimestamp - kDBTokenRefreshLeadTime - jitter;
+  return refreshTimestamp - [[NSDate date] timeIntervalSince1970];
+}
+
+// must be called on `_queue` with a barrier
+- (void)db_scheduleProactiveRefreshAfter:(NSTimeInterval)delay {
+  if (_refreshTimer) {
+    dispatch_source_cancel(_refreshTimer);
+    _refreshTimer = nil;
+  }
+  if (_token.tokenExpirationTimestamp == 0 || !_token.refreshToken) {
+    return;
+  }
+
+  dispatch_source_t timer =
+      dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0));
+  // wall clock time, so that time spent asleep counts towards the expiry
+  dispatch_source_set_timer(timer, dispatch_walltime(NULL, (int64_t)(MAX(delay, 0) * NSEC_PER_SEC)),
+                            DISPATCH_TIME_FOREVER, kDBProactiveRefreshLeeway);
+  __weak typeof(self) weakSelf = self;
+  dispatch_source_set_event_handler(timer, ^{
+    [weakSelf db_refreshProactively];
+  });
+  dispatch_resume(timer);
+  _refreshTimer = timer;
+}
+
+- (void)db_refreshProactively {
+  dispatch_barrier_async(_queue, ^{
+    if (self->_refreshTimer) {
+      dispatch_source_cancel(self->_refreshTimer);
+      self->_refreshTimer = nil;
+    }
+    // a refresh in progress reschedules once it completes
+    if ([self db_refreshInProgress]) {
+      return;
+    }
+    [self->_completionBlocks addObject:^(DBOAuthResult *result) {
+#pragma unused(result)
+    }];
+    [self db_startRefresh];
+  });
+}
+
 - (void)db_handleRefreshResult:(DBOAuthResult *)result {
   dispatch_barrier_async(_queue, ^{
-    if ([result isSuccess] && result.accessToken) {
-      self->_token = result.accessToken;
+    BOOL success = [result isSuccess] && result.accessToken != nil;
+    if (success) {
+      self.token = result.accessToken;
+    }
+    if (self->_refreshesProactively) {
+      [self db_scheduleProactiveRefreshAfterResult:result success:success];
     }
     for (DBOAuthCompletion block in self->_completionBlocks) {
       block(result);
@@ -107,4 +190,20 @@
   });
 }
 
+// must be called on `_queue` with a barrier
+- (void)db_scheduleProactiveRefreshAfterResult:(DBOAuthResult *)result success:(BOOL)success {
+  if (success) {
+    [self db_scheduleProactiveRefreshAfter:[self db_proactiveRefreshDelay]];
+    return;
+  }
+  // a revoked refresh token won't work on a retry either, and once the token expires, requests refresh it anyway
+  BOOL revoked = [result isError] && result.errorType == DBAuthInvalidGrant;
+  BOOL expired = _token.tokenExpirationTimestamp <= [[NSDate date] timeIntervalSince1970];
+  if (revoked || expired) {
+    return;
+  }
+  uint32_t retryDelay = kDBProactiveRefreshRetryInterval + arc4random_uniform(kDBProactiveRefreshRetryInterval);
+  [self db_scheduleProactiveRefreshAfter:retryDelay];
+}
+
 @end
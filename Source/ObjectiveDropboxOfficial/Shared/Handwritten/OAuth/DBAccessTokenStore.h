@@ -0,0 +1,58 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+@class DBAccessToken;
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// Persistent storage for access tokens, keyed by the uid of their account.
+///
+/// `DBOAuthManager` reads and writes tokens through a store, and keeps an in-memory copy of its contents: the tokens
+/// are read once, with `retrieveAllAccessTokens`, and every change is written to the store as it happens. Stores need
+/// to be safe to call from any thread.
+///
+@protocol DBAccessTokenStore <NSObject>
+
+/// Stores `accessToken` under its uid, replacing any token stored for that uid. Returns whether it was stored.
+- (BOOL)storeAccessToken:(DBAccessToken *)accessToken;
+
+/// Returns the token stored for `uid`, if any.
+- (nullable DBAccessToken *)retrieveAccessToken:(NSString *)uid;
+
+/// Returns all stored tokens, keyed by uid.
+- (NSDictionary<NSString *, DBAccessToken *> *)retrieveAllAccessTokens;
+
+/// Deletes the token stored for `uid`. Returns whether it was deleted.
+- (BOOL)deleteAccessToken:(NSString *)uid;
+
+/// Deletes all stored tokens. Returns whether they were deleted.
+- (BOOL)deleteAllAccessTokens;
+
+@end
+
+///
+/// The default token store, which keeps tokens in the keychain.
+///
+@interface DBKeychainAccessTokenStore : NSObject <DBAccessTokenStore>
+
+/// The keychain service the tokens are stored under.
+@property (nonatomic, readonly, copy) NSString *service;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+///
+/// Designated initializer.
+///
+/// @param service The keychain service to store tokens under, as passed to `DBSDKKeychain`.
+///
+/// @return An initialized instance.
+///
+- (instancetype)initWithService:(NSString *)service NS_DESIGNATED_INITIALIZER;
+
+@end
+
+NS_ASSUME_NONNULL_END
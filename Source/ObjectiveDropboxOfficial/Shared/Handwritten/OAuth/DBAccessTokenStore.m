@@ -0,0 +1,39 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import "DBAccessTokenStore.h"
+
+#import "DBSDKKeychain.h"
+
+@implementation DBKeychainAccessTokenStore
+
+- (instancetype)initWithService:(NSString *)service {
+  self = [super init];
+  if (self) {
+    _service = [service copy];
+  }
+  return self;
+}
+
+- (BOOL)storeAccessToken:(DBAccessToken *)accessToken {
+  return [DBSDKKeychain storeAccessToken:accessToken service:_service];
+}
+
+- (DBAccessToken *)retrieveAccessToken:(NSString *)uid {
+  return [DBSDKKeychain retrieveTokenWithUid:uid service:_service];
+}
+
+- (NSDictionary<NSString *, DBAccessToken *> *)retrieveAllAccessTokens {
+  return [DBSDKKeychain retrieveAllTokensAtService:_service];
+}
+
+- (BOOL)deleteAccessToken:(NSString *)uid {
+  return [DBSDKKeychain deleteTokenWithUid:uid service:_service];
+}
+
+- (BOOL)deleteAllAccessTokens {
+  return [DBSDKKeychain clearAllTokensAtService:_service];
+}
+
+@end
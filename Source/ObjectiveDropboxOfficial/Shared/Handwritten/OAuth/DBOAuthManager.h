@@ -9,6 +9,7 @@
 @class DBOAuthPKCESession;
 @class DBOAuthResult;
 @class DBScopeRequest;
+@protocol DBAccessTokenStore;
 @protocol DBSharedApplication;
 
 NS_ASSUME_NONNULL_BEGIN
@@ -287,6 +288,24 @@ NS_ASSUME_NONNULL_BEGIN
 ///
 @property (nonatomic, assign) BOOL webAuthShouldForceReauthentication;
 
+///
+/// When YES, short-lived access tokens of clients created from this manager's tokens are refreshed in the background
+/// ahead of their expiry, instead of by the first request that finds them about to expire, which then waits for the
+/// refresh. Refreshes are spread out at random over the 10 minutes before that point, so that many clients don't
+/// refresh at once. Applies to clients created after it is set.
+///
+/// Default value is NO.
+///
+@property (nonatomic, assign) BOOL refreshesTokensProactively;
+
+///
+/// Where the manager persists access tokens. Its tokens are read once, in a single query, and then kept in memory;
+/// every change is written through to it. Set a different store before any tokens are stored or retrieved.
+///
+/// Defaults to a `DBKeychainAccessTokenStore` for the manager's keychain service.
+///
+@property (nonatomic, strong) id<DBAccessTokenStore> accessTokenStore;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -4,6 +4,7 @@
 
 #import "DBOAuthManager.h"
 
+#import "DBAccessTokenCache.h"
 #import "DBAccessTokenProvider+Internal.h"
 #import "DBOAuthConstants.h"
 #import "DBOAuthPKCESession.h"
@@ -98,6 +99,9 @@
 
 @property (nonatomic, readwrite, weak) id<DBSharedApplication> sharedApplication;
 
+/// In-memory copy of `accessTokenStore`, through which all tokens are read and written.
+@property (nonatomic, strong) DBAccessTokenCache *tokenCache;
+
 @end
 
 @implementation DBOAuthManager
@@ -146,11 +150,13 @@ static DBOAuthManager *s_sharedOAuthManager;
     _disableSignup = YES;
 #endif
     _webAuthShouldForceReauthentication = NO;
+    _refreshesTokensProactively = NO;
 	if (keychainService == nil) {
       _keychainService = [NSBundle mainBundle].bundleIdentifier ?: @"";
 	} else {
       _keychainService = keychainService;
 	}
+    _tokenCache = [DBAccessTokenCache cacheWithKeychainService:_keychainService];
   }
   return self;
 }
@@ -437,7 +443,12 @@ static DBOAuthManager *s_sharedOAuthManager;
 
 - (id<DBAccessTokenProvider>)accessTokenProviderForToken:(DBAccessToken *)token {
   if ([token isShortLivedToken]) {
-    return [[DBShortLivedAccessTokenProvider alloc] initWithToken:token tokenRefresher:self];
+    DBShortLivedAccessTokenProvider *provider =
+        [[DBShortLivedAccessTokenProvider alloc] initWithToken:token tokenRefresher:self];
+    if (_refreshesTokensProactively) {
+      [provider startProactiveRefresh];
+    }
+    return provider;
   } else {
     return [[DBLongLivedAccessTokenProvider alloc] initWithTokenString:token.accessToken];
   }
@@ -445,8 +456,22 @@ static DBOAuthManager *s_sharedOAuthManager;
 
 #pragma mark - Keychain methods
 
+- (id<DBAccessTokenStore>)accessTokenStore {
+  return _tokenCache.store;
+}
+
+- (void)setAccessTokenStore:(id<DBAccessTokenStore>)accessTokenStore {
+  if ([accessTokenStore isKindOfClass:[DBKeychainAccessTokenStore class]]) {
+    // keychain tokens are cached once per service, as they are also written outside of any manager
+    NSString *service = ((DBKeychainAccessTokenStore *)accessTokenStore).service;
+    _tokenCache = [DBAccessTokenCache cacheWithKeychainService:service];
+  } else {
+    _tokenCache = [[DBAccessTokenCache alloc] initWithStore:accessTokenStore];
+  }
+}
+
 - (BOOL)storeAccessToken:(DBAccessToken *)accessToken {
-  return [DBSDKKeychain storeAccessToken:accessToken service:_keychainService];
+  return [_tokenCache storeAccessToken:accessToken];
 }
 
 - (DBAccessToken *)retrieveFirstAccessToken {
@@ -459,31 +484,23 @@ static DBOAuthManager *s_sharedOAuthManager;
 }
 
 - (DBAccessToken *)retrieveAccessToken:(NSString *)tokenUid {
-  return [DBSDKKeychain retrieveTokenWithUid:tokenUid service:_keychainService];
+  return [_tokenCache retrieveAccessToken:tokenUid];
 }
 
 - (NSDictionary<NSString *, DBAccessToken *> *)retrieveAllAccessTokens {
-	NSArray<NSString *> *userIds = [DBSDKKeychain retrieveAllTokenIdsAtService: _keychainService];
-  NSMutableDictionary<NSString *, DBAccessToken *> *result = [[NSMutableDictionary alloc] init];
-  for (NSString *userId in userIds) {
-    DBAccessToken *token = [DBSDKKeychain retrieveTokenWithUid:userId service:_keychainService];
-    if (token) {
-      result[userId] = token;
-    }
-  }
-  return result;
+  return [_tokenCache retrieveAllAccessTokens];
 }
 
 - (BOOL)hasStoredAccessTokens {
-  return [self retrieveAllAccessTokens].count != 0;
+  return [_tokenCache hasAccessTokens];
 }
 
 - (BOOL)clearStoredAccessToken:(NSString *)tokenUid {
-  return [DBSDKKeychain deleteTokenWithUid:tokenUid service:_keychainService];
+  return [_tokenCache deleteAccessToken:tokenUid];
 }
 
 - (BOOL)clearStoredAccessTokens {
-  return [DBSDKKeychain clearAllTokensAtService:_keychainService];
+  return [_tokenCache deleteAllAccessTokens];
 }
 
 @end
@@ -24,6 +24,10 @@ NS_ASSUME_NONNULL_BEGIN
 /// Retrieves all token uids from the keychain.
 + (NSArray<NSString *> *)retrieveAllTokenIdsAtService:(NSString *)service;
 
+/// Retrieves all DBAccessTokens from the keychain, keyed by uid, with a single keychain query where the keychain
+/// supports it.
++ (NSDictionary<NSString *, DBAccessToken *> *)retrieveAllTokensAtService:(NSString *)service;
+
 /// Deletes the stored token value for a key (uid).
 + (BOOL)deleteTokenWithUid:(NSString *)uid service:(NSString *)service;
 
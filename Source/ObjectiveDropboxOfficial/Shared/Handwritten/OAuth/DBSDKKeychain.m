@@ -9,6 +9,7 @@
 #import "DBAUTHTokenFromOAuth1Result.h"
 #import "DBAUTHUserAuthRoutes.h"
 #import "DBAccessToken+NSSecureCoding.h"
+#import "DBAccessTokenCache.h"
 #import "DBAppClient.h"
 #import "DBClientsManager+Protected.h"
 #import "DBRequestErrors.h"
@@ -63,7 +64,10 @@ static const char *kV1OSXAccountName = "Dropbox";
   if (!data) {
     return nil;
   }
+  return [self tokenWithData:data uid:uid];
+}
 
++ (DBAccessToken *)tokenWithData:(NSData *)data uid:(NSString *)uid {
   DBAccessToken *token = [DBAccessToken createTokenFromData:data];
   if (token) {
     return token;
@@ -98,6 +102,43 @@ static const char *kV1OSXAccountName = "Dropbox";
   return results;
 }
 
++ (NSDictionary<NSString *, DBAccessToken *> *)retrieveAllTokensAtService:(NSString *)service {
+  // attributes and data of every item in one query, rather than one query for the uids and then one per token
+  NSMutableDictionary<id, id> *query = [DBSDKKeychain queryWithDict:@{
+    (id)kSecReturnAttributes : (id)kCFBooleanTrue,
+    (id)kSecReturnData : (id)kCFBooleanTrue,
+    (id)kSecMatchLimit : (id)kSecMatchLimitAll
+  }
+                                                           service:service];
+  CFTypeRef itemsResult = NULL;
+  OSStatus status = SecItemCopyMatching((__bridge CFDictionaryRef)query, &itemsResult);
+
+  NSMutableDictionary<NSString *, DBAccessToken *> *results = [NSMutableDictionary new];
+  if (status == errSecParam) {
+    // file-based macOS keychains don't return data for more than one item at a time
+    for (NSString *uid in [self retrieveAllTokenIdsAtService:service]) {
+      DBAccessToken *token = [self retrieveTokenWithUid:uid service:service];
+      if (token) {
+        results[uid] = token;
+      }
+    }
+    return results;
+  }
+
+  if (status == noErr) {
+    NSArray<NSDictionary<NSString *, id> *> *items = (__bridge_transfer NSArray *)itemsResult ?: @[];
+    for (NSDictionary<NSString *, id> *item in items) {
+      NSString *uid = item[(NSString *)kSecAttrAccount];
+      NSData *data = item[(NSString *)kSecValueData];
+      DBAccessToken *token = uid && data ? [self tokenWithData:data uid:uid] : nil;
+      if (token) {
+        results[uid] = token;
+      }
+    }
+  }
+  return results;
+}
+
 + (BOOL)deleteTokenWithUid:(NSString *)uid service:(NSString *)service  {
   NSMutableDictionary<id, id> *query = [DBSDKKeychain queryWithDict:@{(id)kSecAttrAccount : uid} service:service];
   return SecItemDelete((__bridge CFDictionaryRef)query) == noErr;
@@ -467,7 +508,9 @@ static const char *kV1OSXAccountName = "Dropbox";
   dispatch_group_notify(tokenConvertGroup, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH, 0), ^{
     if (shouldRetry == NO) {
       for (NSString *uid in tokenConversionResults) {
-        [self storeAccessToken:[DBAccessToken createWithLongLivedAccessToken:tokenConversionResults[uid] uid:uid] service: service];
+        // through the service's cache, so that managers reading from it see the migrated tokens
+        [[DBAccessTokenCache cacheWithKeychainService:service]
+            storeAccessToken:[DBAccessToken createWithLongLivedAccessToken:tokenConversionResults[uid] uid:uid]];
       }
       NSUserDefaults *userDefaults = [NSUserDefaults standardUserDefaults];
       [userDefaults setBool:YES forKey:[NSString stringWithFormat:kV1TokenMigrationOccurredKeyBase, appKey]];
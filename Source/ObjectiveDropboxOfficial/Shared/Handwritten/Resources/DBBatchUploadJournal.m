@@ -0,0 +1,217 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import "DBBatchUploadJournal.h"
+#import "DBFILESCommitInfo.h"
+
+static NSString *const kDBJournalRecordType = @"type";
+static NSString *const kDBJournalRecordFile = @"file";
+static NSString *const kDBJournalRecordSession = @"session";
+static NSString *const kDBJournalRecordRange = @"range";
+static NSString *const kDBJournalRecordClosed = @"closed";
+static NSString *const kDBJournalRecordFinished = @"finished";
+
+@interface DBBatchUploadJournalEntry ()
+
+@property (nonatomic) NSURL *fileUrl;
+@property (nonatomic) NSUInteger fileSize;
+@property (nonatomic, nullable) NSDate *modificationDate;
+@property (nonatomic) DBFILESCommitInfo *commitInfo;
+@property (nonatomic, copy, nullable) NSString *sessionId;
+@property (nonatomic) BOOL concurrent;
+@property (nonatomic) NSMutableIndexSet *committedRanges;
+@property (nonatomic) BOOL closed;
+@property (nonatomic) BOOL finished;
+
+@end
+
+@implementation DBBatchUploadJournalEntry
+
+- (BOOL)isResumableWithFileSize:(NSUInteger)fileSize modificationDate:(NSDate *)modificationDate {
+  if (!_sessionId || _fileSize != fileSize || !_modificationDate || !modificationDate) {
+    return NO;
+  }
+  // the journal keeps the date as seconds in JSON, which round trips to well within a millisecond
+  return fabs([_modificationDate timeIntervalSinceDate:modificationDate]) < 0.001;
+}
+
+@end
+
+@implementation DBBatchUploadJournal {
+  dispatch_queue_t _queue;
+  NSFileHandle *_fileHandle;
+}
+
+- (instancetype)initWithNewJournalUrl:(NSURL *)journalUrl error:(NSError **)error {
+  if (![[NSData data] writeToURL:journalUrl options:NSDataWritingAtomic error:error]) {
+    return nil;
+  }
+  return [self initWithJournalUrl:journalUrl entries:@{} error:error];
+}
+
+- (instancetype)initWithExistingJournalUrl:(NSURL *)journalUrl error:(NSError **)error {
+  NSData *contents = [NSData dataWithContentsOfURL:journalUrl options:0 error:error];
+  if (!contents) {
+    return nil;
+  }
+  return [self initWithJournalUrl:journalUrl entries:[[self class] entriesWithContents:contents] error:error];
+}
+
+- (instancetype)initWithJournalUrl:(NSURL *)journalUrl
+                           entries:(NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *)entries
+                             error:(NSError **)error {
+  NSFileHandle *fileHandle = [NSFileHandle fileHandleForWritingToURL:journalUrl error:error];
+  if (!fileHandle) {
+    return nil;
+  }
+
+  self = [super init];
+  if (self) {
+    _journalUrl = journalUrl;
+    _entries = entries;
+    _fileHandle = fileHandle;
+    [_fileHandle seekToEndOfFile];
+    _queue = dispatch_queue_create("com.dropbox.dropbox_sdk_obj_c.DBBatchUploadJournal.queue", DISPATCH_QUEUE_SERIAL);
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [_fileHandle closeFile];
+}
+
+#pragma mark - Writing
+
+- (void)recordFileUrl:(NSURL *)fileUrl
+             fileSize:(NSUInteger)fileSize
+     modificationDate:(NSDate *)modificationDate
+           commitInfo:(DBFILESCommitInfo *)commitInfo {
+  NSMutableDictionary<NSString *, id> *record = [@{
+    kDBJournalRecordType : kDBJournalRecordFile,
+    @"url" : fileUrl.absoluteString,
+    @"size" : @(fileSize),
+    @"commit" : [DBFILESCommitInfoSerializer serialize:commitInfo] ?: @{},
+  } mutableCopy];
+  if (modificationDate) {
+    record[@"modified"] = @([modificationDate timeIntervalSince1970]);
+  }
+  [self appendRecord:record];
+}
+
+- (void)recordSessionId:(NSString *)sessionId concurrent:(BOOL)concurrent fileUrl:(NSURL *)fileUrl {
+  [self appendRecord:@{
+    kDBJournalRecordType : kDBJournalRecordSession,
+    @"url" : fileUrl.absoluteString,
+    @"session_id" : sessionId,
+    @"concurrent" : @(concurrent),
+  }];
+}
+
+- (void)recordCommittedRangeWithStartBytes:(NSUInteger)startBytes
+                                  endBytes:(NSUInteger)endBytes
+                                   fileUrl:(NSURL *)fileUrl {
+  [self appendRecord:@{
+    kDBJournalRecordType : kDBJournalRecordRange,
+    @"url" : fileUrl.absoluteString,
+    @"start" : @(startBytes),
+    @"end" : @(endBytes),
+  }];
+}
+
+- (void)recordSessionClosedForFileUrl:(NSURL *)fileUrl {
+  [self appendRecord:@{kDBJournalRecordType : kDBJournalRecordClosed, @"url" : fileUrl.absoluteString}];
+}
+
+- (void)recordSessionFinishedForFileUrl:(NSURL *)fileUrl {
+  [self appendRecord:@{kDBJournalRecordType : kDBJournalRecordFinished, @"url" : fileUrl.absoluteString}];
+}
+
+- (void)remove {
+  dispatch_async(_queue, ^{
+    [self->_fileHandle closeFile];
+    self->_fileHandle = nil;
+    [[NSFileManager defaultManager] removeItemAtURL:self->_journalUrl error:nil];
+  });
+}
+
+- (void)appendRecord:(NSDictionary<NSString *, id> *)record {
+  dispatch_async(_queue, ^{
+    if (!self->_fileHandle) {
+      return;
+    }
+    NSMutableData *line = [[NSJSONSerialization dataWithJSONObject:record options:0 error:nil] mutableCopy];
+    [line appendBytes:"\n" length:1];
+    // records are small and written with a single `write`, so a crash can only ever truncate the last line
+    [self->_fileHandle writeData:line];
+  });
+}
+
+#pragma mark - Reading
+
++ (NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *)entriesWithContents:(NSData *)contents {
+  NSMutableDictionary<NSURL *, DBBatchUploadJournalEntry *> *entries = [NSMutableDictionary new];
+  NSString *contentsString = [[NSString alloc] initWithData:contents encoding:NSUTF8StringEncoding];
+
+  for (NSString *line in [contentsString componentsSeparatedByString:@"\n"]) {
+    NSData *lineData = [line dataUsingEncoding:NSUTF8StringEncoding];
+    if ([lineData length] == 0) {
+      continue;
+    }
+    NSDictionary<NSString *, id> *record = [NSJSONSerialization JSONObjectWithData:lineData options:0 error:nil];
+    if (![record isKindOfClass:[NSDictionary class]] || ![record[@"url"] isKindOfClass:[NSString class]]) {
+      // truncated by a crash while it was being written
+      continue;
+    }
+
+    NSURL *fileUrl = [NSURL URLWithString:record[@"url"]];
+    NSString *type = record[kDBJournalRecordType];
+
+    if ([type isEqualToString:kDBJournalRecordFile]) {
+      DBFILESCommitInfo *commitInfo = nil;
+      @try {
+        commitInfo = [DBFILESCommitInfoSerializer deserialize:record[@"commit"]];
+      } @catch (NSException *exception) {
+#pragma unused(exception)
+        continue;
+      }
+      DBBatchUploadJournalEntry *entry = [DBBatchUploadJournalEntry new];
+      entry.fileUrl = fileUrl;
+      entry.fileSize = [record[@"size"] unsignedIntegerValue];
+      if ([record[@"modified"] isKindOfClass:[NSNumber class]]) {
+        entry.modificationDate = [NSDate dateWithTimeIntervalSince1970:[record[@"modified"] doubleValue]];
+      }
+      entry.commitInfo = commitInfo;
+      entry.committedRanges = [NSMutableIndexSet new];
+      entries[fileUrl] = entry;
+      continue;
+    }
+
+    DBBatchUploadJournalEntry *entry = entries[fileUrl];
+    if (!entry) {
+      continue;
+    }
+
+    if ([type isEqualToString:kDBJournalRecordSession]) {
+      entry.sessionId = record[@"session_id"];
+      entry.concurrent = [record[@"concurrent"] boolValue];
+      entry.committedRanges = [NSMutableIndexSet new];
+      entry.closed = NO;
+      entry.finished = NO;
+    } else if ([type isEqualToString:kDBJournalRecordRange]) {
+      NSUInteger startBytes = [record[@"start"] unsignedIntegerValue];
+      NSUInteger endBytes = [record[@"end"] unsignedIntegerValue];
+      if (endBytes > startBytes && endBytes <= entry.fileSize) {
+        [entry.committedRanges addIndexesInRange:NSMakeRange(startBytes, endBytes - startBytes)];
+      }
+    } else if ([type isEqualToString:kDBJournalRecordClosed]) {
+      entry.closed = entry.sessionId != nil;
+    } else if ([type isEqualToString:kDBJournalRecordFinished]) {
+      entry.finished = entry.closed;
+    }
+  }
+
+  return entries;
+}
+
+@end
@@ -9,14 +9,205 @@
 #import "DBHandlerTypes.h"
 
 @class DBASYNCPollError;
+@class DBBatchUploadJournal;
 @class DBFILESCommitInfo;
+@class DBFILESFileMetadata;
 @class DBFILESUploadSessionFinishArg;
 @class DBFILESUploadSessionFinishBatchJobStatus;
+@class DBFILESUploadSessionFinishBatchResultEntry;
+@class DBProgressCoalescer;
 @class DBRequestError;
 @class DBTasksStorage;
 
 NS_ASSUME_NONNULL_BEGIN
 
+///
+/// Decides the size of the chunks large files are uploaded in.
+///
+/// Policies may be consulted and informed from several queues at once, so implementations must be thread-safe.
+///
+@protocol DBChunkSizePolicy <NSObject>
+
+///
+/// The size of the next chunk to upload.
+///
+/// Files smaller than this size are uploaded in a single request. For concurrent upload sessions, the size is rounded
+/// down to a multiple of 4 MB.
+///
+/// @return The chunk size in bytes. Must be positive and no larger than 150 MB.
+///
+- (NSUInteger)chunkSize;
+
+///
+/// Informs the policy that a chunk was uploaded successfully.
+///
+/// @param chunkSize The size of the uploaded chunk in bytes.
+/// @param duration The time taken to upload the chunk, from request creation to response.
+///
+- (void)recordChunkUploadOfSize:(NSUInteger)chunkSize duration:(NSTimeInterval)duration;
+
+///
+/// Informs the policy that a chunk failed to upload.
+///
+/// @param chunkSize The size of the failed chunk in bytes.
+///
+- (void)recordChunkUploadFailureOfSize:(NSUInteger)chunkSize;
+
+@end
+
+///
+/// Chunk size policy that always uses the same chunk size.
+///
+@interface DBFixedChunkSizePolicy : NSObject <DBChunkSizePolicy>
+
+///
+/// Full constructor.
+///
+/// @param chunkSize The chunk size in bytes. Must be positive and no larger than 150 MB.
+///
+/// @return An initialized instance.
+///
+- (instancetype)initWithChunkSize:(NSUInteger)chunkSize;
+
+@end
+
+///
+/// Chunk size policy that adapts the chunk size to the measured upload throughput and error rate.
+///
+/// The chunk size grows towards the amount of data that can be uploaded in `targetChunkDuration` at the measured
+/// throughput, and is halved whenever a chunk fails. Sizes are always a multiple of 4 MB and stay within
+/// `minChunkSize` and `maxChunkSize`.
+///
+@interface DBAdaptiveChunkSizePolicy : NSObject <DBChunkSizePolicy>
+
+/// The smallest chunk size the policy falls back to. A multiple of 4 MB.
+@property (nonatomic, readonly) NSUInteger minChunkSize;
+
+/// The largest chunk size the policy grows to. A multiple of 4 MB.
+@property (nonatomic, readonly) NSUInteger maxChunkSize;
+
+/// The time a single chunk upload should take at the measured throughput.
+@property (nonatomic, readonly) NSTimeInterval targetChunkDuration;
+
+///
+/// Convenience constructor. Chunk sizes range from 4 MB to 148 MB, targeting chunk uploads of 5 seconds.
+///
+/// @return An initialized instance.
+///
+- (instancetype)init;
+
+///
+/// Full constructor.
+///
+/// @param minChunkSize The smallest chunk size, rounded down to a multiple of 4 MB, at least 4 MB.
+/// @param maxChunkSize The largest chunk size, rounded down to a multiple of 4 MB, at most 148 MB.
+/// @param targetChunkDuration The time a single chunk upload should take at the measured throughput.
+///
+/// @return An initialized instance.
+///
+- (instancetype)initWithMinChunkSize:(NSUInteger)minChunkSize
+                        maxChunkSize:(NSUInteger)maxChunkSize
+                 targetChunkDuration:(NSTimeInterval)targetChunkDuration;
+
+@end
+
+///
+/// Tuning options for a batch upload.
+///
+@interface DBBatchUploadConfig : NSObject <NSCopying>
+
+/// Whether large files are uploaded through `concurrent` upload sessions, so that several chunks of the same file can
+/// be in flight at once. When `NO`, the chunks of a file are appended one after another. Defaults to `NO`.
+@property (nonatomic) BOOL concurrentUploadSessions;
+
+/// The maximum number of files that are uploaded at once. Defaults to 5.
+@property (nonatomic) NSUInteger maxConcurrentFileUploads;
+
+/// The maximum number of chunks of a single file that may be in flight at once when `concurrentUploadSessions` is
+/// enabled. Defaults to 4.
+@property (nonatomic) NSUInteger maxConcurrentChunksPerFile;
+
+/// The maximum number of chunks, across all files of the batch, that may be in flight at once when
+/// `concurrentUploadSessions` is enabled. Defaults to 8.
+@property (nonatomic) NSUInteger maxConcurrentChunks;
+
+/// The policy that decides the chunk size of large files, and thereby which files are large. Shared, not copied, by
+/// copies of the config. Defaults to a `DBFixedChunkSizePolicy` of 10 MB.
+@property (nonatomic, strong) id<DBChunkSizePolicy> chunkSizePolicy;
+
+/// The file the progress of the batch is journaled to, so that the batch can be resumed with
+/// `resumeBatchUploadWithJournalUrl:queue:config:progressBlock:responseBlock:` after the process was terminated, or to
+/// retry the files that failed. Any existing file is replaced when a new batch starts, and the journal is removed once
+/// every file of the batch is committed. Defaults to `nil`, which disables journaling.
+@property (nonatomic, copy, nullable) NSURL *journalUrl;
+
+/// The maximum number of files committed per `upload_session/finish_batch` call. Uploaded files are committed in shards
+/// of this size as soon as a shard is full, while the rest of the batch is still uploading. Values above the server
+/// limit of 1000 are lowered to it. Defaults to 1000.
+@property (nonatomic) NSUInteger maxFinishBatchEntries;
+
+/// The minimum time between two updates handed to the progress block. The progress of all files of the batch is
+/// aggregated, and updates in between are coalesced into the next one. Defaults to 0.1 seconds.
+@property (nonatomic) NSTimeInterval progressMinimumInterval;
+
+/// The number of uploaded bytes that lets a progress update through before `progressMinimumInterval` has elapsed.
+/// Defaults to 0, so that only the interval applies.
+@property (nonatomic) int64_t progressMinimumByteDelta;
+
+@end
+
+///
+/// Stores the state of a single file uploaded through a concurrent upload session.
+///
+@interface DBBatchUploadFileData : NSObject
+
+/// The url of the file being uploaded.
+@property (nonatomic, readonly) NSURL *fileUrl;
+
+/// The size of the file being uploaded.
+@property (nonatomic, readonly) NSUInteger fileSize;
+
+/// The id of the upload session the chunks of the file are appended to.
+@property (nonatomic, readonly, copy) NSString *sessionId;
+
+/// The byte ranges of the file that have not been sent yet.
+@property (nonatomic, readonly) NSMutableIndexSet *unsentRanges;
+
+/// Whether the final chunk, which closes the session, has been sent.
+@property (nonatomic) BOOL closeSent;
+
+/// The number of chunks of this file currently in flight.
+@property (nonatomic) NSUInteger chunksInFlight;
+
+/// Whether this file is queued in `filesAwaitingChunkSlots` of its batch.
+@property (nonatomic) BOOL awaitingChunkSlot;
+
+/// Whether any chunk of this file failed to upload.
+@property (nonatomic) BOOL failed;
+
+/// Whether the session resumed from a journal has expired, so that the file needs to be uploaded from scratch.
+@property (nonatomic) BOOL sessionExpired;
+
+/// Whether the upload of this file has completed, successfully or not.
+@property (nonatomic) BOOL finished;
+
+///
+/// Full constructor.
+///
+/// @param fileUrl The url of the file being uploaded.
+/// @param fileSize The size of the file being uploaded.
+/// @param sessionId The id of the concurrent upload session opened for the file.
+/// @param committedRanges The byte ranges of the file already appended to the session, when resuming a session.
+///
+/// @return An initialized instance.
+///
+- (instancetype)initWithFileUrl:(NSURL *)fileUrl
+                       fileSize:(NSUInteger)fileSize
+                      sessionId:(NSString *)sessionId
+                committedRanges:(nullable NSIndexSet *)committedRanges;
+
+@end
+
 ///
 /// Stores data for a particular batch upload attempt.
 ///
@@ -25,9 +216,6 @@ NS_ASSUME_NONNULL_BEGIN
 /// The queue on which most response handling is performed.
 @property (nonatomic, readonly) NSOperationQueue *queue;
 
-/// The queue on which we sleep until all processing is completed or the timeout is hit.
-@property (nonatomic, readonly) NSOperationQueue *pollingQueue;
-
 /// The dispatch group that pairs upload requests with upload responses so that we can wait for all request/response
 /// pairs to complete before batch committing. In this way, we can start many upload requests (for files under the chunk
 /// limit), without waiting for the corresponding response.
@@ -39,20 +227,40 @@ NS_ASSUME_NONNULL_BEGIN
 /// Mapping of urls for files that were unsuccessfully uploaded to any request errors that were encounted.
 @property (atomic, readonly) NSMutableDictionary<NSURL *, DBRequestError *> *fileUrlsToRequestErrors;
 
-/// List of finish args (which include commit info, cursor, etc.) which the SDK maintains and passes to
-/// `upload_session/finish_batch`.
+/// List of finish args (which include commit info, cursor, etc.) of uploaded files which the SDK maintains and passes
+/// to `upload_session/finish_batch`, once enough have been collected for a shard. Only accessed on `schedulingQueue`.
 @property (atomic, strong) NSMutableArray<DBFILESUploadSessionFinishArg *> *finishArgs;
 
+/// The file urls corresponding to `finishArgs`, in the same order. Only accessed on `schedulingQueue`.
+@property (atomic, strong) NSMutableArray<NSURL *> *finishArgFileUrls;
+
+/// The dispatch group that pairs `upload_session/finish_batch` requests with their responses, so that we can wait for
+/// all shards to be committed before executing the response block.
+@property (nonatomic, readonly) dispatch_group_t finishBatchGroup;
+
+/// Mapping of urls for files that were committed to their commit results, merged from all shards. Only accessed on
+/// `schedulingQueue`.
+@property (nonatomic, readonly) NSMutableDictionary<NSURL *, DBFILESUploadSessionFinishBatchResultEntry *>
+    *fileUrlsToBatchResultEntries;
+
+/// The request error of the most recent `upload_session/finish_batch` shard that failed, if any. Only accessed on
+/// `schedulingQueue`.
+@property (nonatomic, strong, nullable) DBRequestError *finishBatchRequestError;
+
 /// The progress block that is periodically executed once a file upload is complete.
 @property (nonatomic, readonly) DBProgressBlock _Nullable progressBlock;
 
+/// Hands the aggregated progress of the batch to `progressBlock` at a bounded rate. Nil without a progress block.
+@property (nonatomic, readonly, nullable) DBProgressCoalescer *progressCoalescer;
+
 /// The response block that is executed once all file uploads and the final batch commit is complete.
 @property (nonatomic, readonly) DBBatchUploadResponseBlock responseBlock;
 
 /// The total size of all the files to upload. Used to return progress data to the client.
 @property (nonatomic) NSUInteger totalUploadSize;
 
-/// The total size of all the file content upload so far. Used to return progress data to the client.
+/// The total size of all the file content upload so far. Used to return progress data to the client. Only accessed on
+/// `schedulingQueue` once the uploads have started.
 @property (nonatomic) NSUInteger totalUploadedSoFar;
 
 /// The flag that determines whether upload continues or not.
@@ -61,8 +269,32 @@ NS_ASSUME_NONNULL_BEGIN
 /// The container object that stores all upload / download task objects for cancelling.
 @property (nonatomic, strong) DBTasksStorage *taskStorage;
 
+/// The tuning options of this batch upload.
+@property (nonatomic, readonly) DBBatchUploadConfig *config;
+
+/// The serial queue on which file uploads and chunks are scheduled and all upload responses are handled, so that the
+/// in-flight limits need no locking and no thread ever blocks waiting for a slot.
+@property (nonatomic, readonly) NSOperationQueue *schedulingQueue;
+
+/// Blocks that each start the upload of a file, waiting for `filesInFlight` to drop below the batch limit. Only
+/// accessed on `schedulingQueue`.
+@property (nonatomic, readonly) NSMutableArray<void (^)(void)> *pendingFileUploads;
+
+/// The number of files currently being uploaded. Only accessed on `schedulingQueue`.
+@property (nonatomic) NSUInteger filesInFlight;
+
+/// The number of chunks of concurrent upload sessions currently in flight. Only accessed on `schedulingQueue`.
+@property (nonatomic) NSUInteger chunksInFlight;
+
+/// Files with chunks ready to be sent that are waiting for `chunksInFlight` to drop below the batch limit. Only
+/// accessed on `schedulingQueue`.
+@property (nonatomic, readonly) NSMutableArray<DBBatchUploadFileData *> *filesAwaitingChunkSlots;
+
+/// The journal the progress of the batch is recorded to, if `journalUrl` is set on `config`.
+@property (nonatomic, strong, nullable) DBBatchUploadJournal *journal;
+
 ///
-/// Full constructor.
+/// Convenience constructor.
 ///
 /// @param fileUrlsToCommitInfo A client-supplied parameter that maps the file urls of the files to upload to the
 /// corresponding commit info objects.
@@ -78,6 +310,166 @@ NS_ASSUME_NONNULL_BEGIN
                          responseBlock:(DBBatchUploadResponseBlock)responseBlock
                                  queue:(NSOperationQueue *)queue;
 
+///
+/// Full constructor.
+///
+/// @param fileUrlsToCommitInfo A client-supplied parameter that maps the file urls of the files to upload to the
+/// corresponding commit info objects.
+/// @param progressBlock The progress block that is periodically executed once a file upload is complete.
+/// @param responseBlock The response block that is executed once all file uploads and the final batch commit is
+/// complete.
+/// @param queue The queue on which most response handling is performed.
+/// @param config The tuning options of the batch upload. A copy is retained.
+///
+/// @return An initialized instance.
+///
+- (instancetype)initWithFileCommitInfo:(NSDictionary<NSURL *, DBFILESCommitInfo *> *)fileUrlsToCommitInfo
+                         progressBlock:(DBProgressBlock _Nullable)progressBlock
+                         responseBlock:(DBBatchUploadResponseBlock)responseBlock
+                                 queue:(NSOperationQueue *)queue
+                                config:(DBBatchUploadConfig *)config;
+
+@end
+
+///
+/// Tuning options for a segmented download.
+///
+/// Segments are only retried within a single download. The progress of a download is not persisted, so a download
+/// that is interrupted, e.g. because the process was terminated, starts over from the first byte.
+///
+@interface DBSegmentedDownloadConfig : NSObject <NSCopying>
+
+/// The size of the byte ranges the file is downloaded in. Files no larger than this are downloaded in a single request.
+/// Defaults to 8 MB.
+@property (nonatomic) NSUInteger segmentSize;
+
+/// The maximum number of segments that are downloaded at once. Defaults to 4.
+@property (nonatomic) NSUInteger maxConcurrentSegments;
+
+/// The number of times a failed segment is requested again, starting from its first missing byte, before the download
+/// fails and the incomplete destination is removed. Defaults to 3.
+@property (nonatomic) NSUInteger maxSegmentRetries;
+
+/// The minimum time between two updates handed to the progress block. The progress of all segments is aggregated, and
+/// updates in between are coalesced into the next one. Defaults to 0.1 seconds.
+@property (nonatomic) NSTimeInterval progressMinimumInterval;
+
+/// The number of downloaded bytes that lets a progress update through before `progressMinimumInterval` has elapsed.
+/// Defaults to 0, so that only the interval applies.
+@property (nonatomic) int64_t progressMinimumByteDelta;
+
+@end
+
+///
+/// Stores the state of a single byte range of a segmented download.
+///
+@interface DBSegmentedDownloadSegment : NSObject
+
+/// The offset of the segment in the file.
+@property (nonatomic, readonly) NSUInteger offset;
+
+/// The length of the segment.
+@property (nonatomic, readonly) NSUInteger length;
+
+/// The number of bytes of the segment written to the destination so far. Only accessed by the consumer of the current
+/// request of the segment, and on `schedulingQueue` once that request has completed.
+@property (nonatomic) NSUInteger received;
+
+/// The number of times the segment has been requested again after a failure.
+@property (nonatomic) NSUInteger retryCount;
+
+///
+/// Full constructor.
+///
+/// @param offset The offset of the segment in the file.
+/// @param length The length of the segment.
+///
+/// @return An initialized instance.
+///
+- (instancetype)initWithOffset:(NSUInteger)offset length:(NSUInteger)length;
+
+@end
+
+///
+/// Stores data for a particular segmented download attempt.
+///
+@interface DBSegmentedDownloadData : NSObject
+
+/// The path of the file to download.
+@property (nonatomic, readonly, copy) NSString *path;
+
+/// The location the file is downloaded to.
+@property (nonatomic, readonly) NSURL *destination;
+
+/// The tuning options of this segmented download.
+@property (nonatomic, readonly) DBSegmentedDownloadConfig *config;
+
+/// The queue on which progress and response handlers are executed.
+@property (nonatomic, readonly) NSOperationQueue *queue;
+
+/// The progress block that is executed as segment content is written to the destination.
+@property (nonatomic, readonly) DBProgressBlock _Nullable progressBlock;
+
+/// Hands the aggregated progress of all segments to `progressBlock` at a bounded rate. Nil without a progress block.
+@property (nonatomic, readonly, nullable) DBProgressCoalescer *progressCoalescer;
+
+/// The response block that is executed once every segment is downloaded, or the download fails.
+@property (nonatomic, readonly) DBSegmentedDownloadResponseBlock responseBlock;
+
+/// The serial queue on which segments are scheduled and all segment responses are handled.
+@property (nonatomic, readonly) NSOperationQueue *schedulingQueue;
+
+/// The metadata of the file, looked up before the segments are requested. Only accessed on `schedulingQueue`.
+@property (nonatomic, strong, nullable) DBFILESFileMetadata *metadata;
+
+/// The descriptor of the preallocated destination file, which segments are written to at their offset, or -1 while the
+/// file is not open.
+@property (atomic) int fileDescriptor;
+
+/// Segments waiting for `segmentsInFlight` to drop below the limit. Only accessed on `schedulingQueue`.
+@property (nonatomic, readonly) NSMutableArray<DBSegmentedDownloadSegment *> *pendingSegments;
+
+/// The number of segments currently being downloaded or waiting to be retried. Only accessed on `schedulingQueue`.
+@property (nonatomic) NSUInteger segmentsInFlight;
+
+/// The size of the file. Used to return progress data to the client.
+@property (nonatomic) NSUInteger totalDownloadSize;
+
+/// The number of bytes written to the destination so far. Only accessed while synchronized on the download data.
+@property (nonatomic) NSUInteger totalDownloadedSoFar;
+
+/// Whether the response block has been scheduled. Only accessed on `schedulingQueue`.
+@property (nonatomic) BOOL finished;
+
+/// The flag that determines whether the download continues or not.
+@property (atomic) BOOL cancel;
+
+/// The `errno` of the first failed write to the destination, or 0. Retrying can't get past it, so it fails the
+/// download in place of the cancellation it causes.
+@property (atomic) int writeErrno;
+
+/// The container object that stores all segment download tasks for cancelling.
+@property (nonatomic, strong) DBTasksStorage *taskStorage;
+
+///
+/// Full constructor.
+///
+/// @param path The path of the file to download.
+/// @param destination The location the file is downloaded to.
+/// @param config The tuning options of the segmented download. A copy is retained.
+/// @param queue The queue on which progress and response handlers are executed.
+/// @param progressBlock The progress block that is executed as segment content is written to the destination.
+/// @param responseBlock The response block that is executed once every segment is downloaded, or the download fails.
+///
+/// @return An initialized instance.
+///
+- (instancetype)initWithPath:(NSString *)path
+                 destination:(NSURL *)destination
+                      config:(DBSegmentedDownloadConfig *)config
+                       queue:(NSOperationQueue *)queue
+               progressBlock:(DBProgressBlock _Nullable)progressBlock
+               responseBlock:(DBSegmentedDownloadResponseBlock)responseBlock;
+
 @end
 
 NS_ASSUME_NONNULL_END
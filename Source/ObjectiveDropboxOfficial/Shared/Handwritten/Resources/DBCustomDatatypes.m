@@ -3,24 +3,197 @@
 ///
 
 #import "DBCustomDatatypes.h"
+#import "DBProgressCoalescer.h"
 #import "DBTasksStorage.h"
 
+// upload session appends must be a multiple of 4 MB for concurrent sessions and no larger than 150 MB
+static const NSUInteger kDBChunkSizeAlignment = 4 * 1024 * 1024;
+static const NSUInteger kDBMaxChunkSize = 148 * 1024 * 1024;
+
+// weight of the most recent sample in the throughput and error rate averages
+static const double kDBChunkSizeSmoothing = 0.3;
+
+// above this error rate, the adaptive policy stops growing the chunk size
+static const double kDBChunkSizeMaxErrorRateForGrowth = 0.1;
+
+static NSUInteger DBAlignedChunkSize(NSUInteger chunkSize, NSUInteger minChunkSize, NSUInteger maxChunkSize) {
+  NSUInteger aligned = (chunkSize / kDBChunkSizeAlignment) * kDBChunkSizeAlignment;
+  return MIN(MAX(aligned, minChunkSize), maxChunkSize);
+}
+
+@implementation DBFixedChunkSizePolicy {
+  NSUInteger _chunkSize;
+}
+
+- (instancetype)initWithChunkSize:(NSUInteger)chunkSize {
+  NSAssert(chunkSize > 0, @"chunk size must be positive");
+  self = [super init];
+  if (self) {
+    _chunkSize = MIN(chunkSize, kDBMaxChunkSize);
+  }
+  return self;
+}
+
+- (NSUInteger)chunkSize {
+  return _chunkSize;
+}
+
+- (void)recordChunkUploadOfSize:(NSUInteger)chunkSize duration:(NSTimeInterval)duration {
+#pragma unused(chunkSize)
+#pragma unused(duration)
+}
+
+- (void)recordChunkUploadFailureOfSize:(NSUInteger)chunkSize {
+#pragma unused(chunkSize)
+}
+
+@end
+
+@implementation DBAdaptiveChunkSizePolicy {
+  NSUInteger _chunkSize;
+  double _throughput;
+  double _errorRate;
+}
+
+- (instancetype)init {
+  return [self initWithMinChunkSize:kDBChunkSizeAlignment maxChunkSize:kDBMaxChunkSize targetChunkDuration:5];
+}
+
+- (instancetype)initWithMinChunkSize:(NSUInteger)minChunkSize
+                        maxChunkSize:(NSUInteger)maxChunkSize
+                 targetChunkDuration:(NSTimeInterval)targetChunkDuration {
+  self = [super init];
+  if (self) {
+    _minChunkSize = DBAlignedChunkSize(minChunkSize, kDBChunkSizeAlignment, kDBMaxChunkSize);
+    _maxChunkSize = DBAlignedChunkSize(maxChunkSize, _minChunkSize, kDBMaxChunkSize);
+    _targetChunkDuration = targetChunkDuration;
+    // start small and let the first measurements grow the chunk size
+    _chunkSize = DBAlignedChunkSize(2 * kDBChunkSizeAlignment, _minChunkSize, _maxChunkSize);
+    _throughput = 0;
+    _errorRate = 0;
+  }
+  return self;
+}
+
+- (NSUInteger)chunkSize {
+  @synchronized(self) {
+    return _chunkSize;
+  }
+}
+
+- (void)recordChunkUploadOfSize:(NSUInteger)chunkSize duration:(NSTimeInterval)duration {
+  if (chunkSize == 0 || duration <= 0) {
+    return;
+  }
+
+  @synchronized(self) {
+    double sample = chunkSize / duration;
+    _throughput =
+        _throughput == 0 ? sample : kDBChunkSizeSmoothing * sample + (1 - kDBChunkSizeSmoothing) * _throughput;
+    _errorRate = (1 - kDBChunkSizeSmoothing) * _errorRate;
+
+    NSUInteger targetChunkSize = (NSUInteger)MIN(_throughput * _targetChunkDuration, (double)_maxChunkSize);
+    if (targetChunkSize > _chunkSize && _errorRate > kDBChunkSizeMaxErrorRateForGrowth) {
+      // the link is still flaky, so don't risk larger chunks yet
+      return;
+    }
+
+    // at most double per sample, so one fast chunk can't blow up the size
+    targetChunkSize = MIN(targetChunkSize, 2 * _chunkSize);
+    _chunkSize = DBAlignedChunkSize(targetChunkSize, _minChunkSize, _maxChunkSize);
+  }
+}
+
+- (void)recordChunkUploadFailureOfSize:(NSUInteger)chunkSize {
+#pragma unused(chunkSize)
+  @synchronized(self) {
+    _errorRate = kDBChunkSizeSmoothing + (1 - kDBChunkSizeSmoothing) * _errorRate;
+    _chunkSize = DBAlignedChunkSize(_chunkSize / 2, _minChunkSize, _maxChunkSize);
+  }
+}
+
+@end
+
+@implementation DBBatchUploadConfig
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _concurrentUploadSessions = NO;
+    _maxConcurrentFileUploads = 5;
+    _maxFinishBatchEntries = 1000;
+    _maxConcurrentChunksPerFile = 4;
+    _maxConcurrentChunks = 8;
+    _chunkSizePolicy = [[DBFixedChunkSizePolicy alloc] initWithChunkSize:10 * 1024 * 1024];
+    _progressMinimumInterval = 0.1;
+    _progressMinimumByteDelta = 0;
+  }
+  return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+  DBBatchUploadConfig *copy = [[[self class] allocWithZone:zone] init];
+  copy.concurrentUploadSessions = _concurrentUploadSessions;
+  copy.maxConcurrentFileUploads = _maxConcurrentFileUploads;
+  copy.maxConcurrentChunksPerFile = _maxConcurrentChunksPerFile;
+  copy.maxConcurrentChunks = _maxConcurrentChunks;
+  copy.chunkSizePolicy = _chunkSizePolicy;
+  copy.journalUrl = _journalUrl;
+  copy.maxFinishBatchEntries = _maxFinishBatchEntries;
+  copy.progressMinimumInterval = _progressMinimumInterval;
+  copy.progressMinimumByteDelta = _progressMinimumByteDelta;
+  return copy;
+}
+
+@end
+
+@implementation DBBatchUploadFileData
+
+- (instancetype)initWithFileUrl:(NSURL *)fileUrl
+                       fileSize:(NSUInteger)fileSize
+                      sessionId:(NSString *)sessionId
+                committedRanges:(NSIndexSet *)committedRanges {
+  self = [super init];
+  if (self) {
+    _fileUrl = fileUrl;
+    _fileSize = fileSize;
+    _sessionId = [sessionId copy];
+    _unsentRanges = [NSMutableIndexSet indexSetWithIndexesInRange:NSMakeRange(0, fileSize)];
+    if (committedRanges) {
+      [_unsentRanges removeIndexes:committedRanges];
+    }
+    _closeSent = NO;
+    _chunksInFlight = 0;
+  }
+  return self;
+}
+
+@end
+
 @implementation DBBatchUploadData
 
 - (instancetype)initWithFileCommitInfo:(NSDictionary<NSURL *, DBFILESCommitInfo *> *)fileUrlsToCommitInfo
                          progressBlock:(DBProgressBlock)progressBlock
                          responseBlock:(DBBatchUploadResponseBlock)responseBlock
                                  queue:(NSOperationQueue *)queue {
+  return [self initWithFileCommitInfo:fileUrlsToCommitInfo
+                        progressBlock:progressBlock
+                        responseBlock:responseBlock
+                                queue:queue
+                               config:[DBBatchUploadConfig new]];
+}
+
+- (instancetype)initWithFileCommitInfo:(NSDictionary<NSURL *, DBFILESCommitInfo *> *)fileUrlsToCommitInfo
+                         progressBlock:(DBProgressBlock)progressBlock
+                         responseBlock:(DBBatchUploadResponseBlock)responseBlock
+                                 queue:(NSOperationQueue *)queue
+                                config:(DBBatchUploadConfig *)config {
   self = [super init];
   if (self) {
     // we specifiy a custom queue so that the main thread is not blocked
     _queue = queue;
     [_queue setMaxConcurrentOperationCount:1];
 
-    // create a special background queue to monitor progress and sleep until the processing is complete
-    _pollingQueue = [NSOperationQueue new];
-    [_pollingQueue setMaxConcurrentOperationCount:1];
-
     // we want to make sure all of our file data has been uploaded
     // before we make our final batch commit call to `/upload_session/finish_batch`,
     // but we also don't want to wait for each response before making a
@@ -31,10 +204,116 @@
     _fileUrlsToCommitInfo = fileUrlsToCommitInfo;
     _fileUrlsToRequestErrors = [NSMutableDictionary new];
     _finishArgs = [NSMutableArray new];
+    _finishArgFileUrls = [NSMutableArray new];
+    _finishBatchGroup = dispatch_group_create();
+    _fileUrlsToBatchResultEntries = [NSMutableDictionary new];
 
     _progressBlock = progressBlock;
     _responseBlock = responseBlock;
 
+    _cancel = NO;
+    _writeErrno = 0;
+
+    _taskStorage = [DBTasksStorage new];
+
+    _config = [config copy];
+
+    if (progressBlock) {
+      _progressCoalescer = [[DBProgressCoalescer alloc] initWithProgressBlock:progressBlock
+                                                                        queue:_queue
+                                                              minimumInterval:_config.progressMinimumInterval
+                                                             minimumByteDelta:_config.progressMinimumByteDelta];
+    }
+
+    // all upload responses of the batch are handled on one serial queue, so that the in-flight limits need no locking
+    _schedulingQueue = [NSOperationQueue new];
+    [_schedulingQueue setMaxConcurrentOperationCount:1];
+    _pendingFileUploads = [NSMutableArray new];
+    _filesInFlight = 0;
+    _chunksInFlight = 0;
+    _filesAwaitingChunkSlots = [NSMutableArray new];
+  }
+  return self;
+}
+
+@end
+
+@implementation DBSegmentedDownloadConfig
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _segmentSize = 8 * 1024 * 1024;
+    _maxConcurrentSegments = 4;
+    _maxSegmentRetries = 3;
+    _progressMinimumInterval = 0.1;
+    _progressMinimumByteDelta = 0;
+  }
+  return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+  DBSegmentedDownloadConfig *copy = [[[self class] allocWithZone:zone] init];
+  copy.segmentSize = _segmentSize;
+  copy.maxConcurrentSegments = _maxConcurrentSegments;
+  copy.maxSegmentRetries = _maxSegmentRetries;
+  copy.progressMinimumInterval = _progressMinimumInterval;
+  copy.progressMinimumByteDelta = _progressMinimumByteDelta;
+  return copy;
+}
+
+@end
+
+@implementation DBSegmentedDownloadSegment
+
+- (instancetype)initWithOffset:(NSUInteger)offset length:(NSUInteger)length {
+  self = [super init];
+  if (self) {
+    _offset = offset;
+    _length = length;
+    _received = 0;
+    _retryCount = 0;
+  }
+  return self;
+}
+
+@end
+
+@implementation DBSegmentedDownloadData
+
+- (instancetype)initWithPath:(NSString *)path
+                 destination:(NSURL *)destination
+                      config:(DBSegmentedDownloadConfig *)config
+                       queue:(NSOperationQueue *)queue
+               progressBlock:(DBProgressBlock)progressBlock
+               responseBlock:(DBSegmentedDownloadResponseBlock)responseBlock {
+  self = [super init];
+  if (self) {
+    _path = [path copy];
+    _destination = destination;
+    _config = [config copy];
+
+    _queue = queue;
+    [_queue setMaxConcurrentOperationCount:1];
+    _progressBlock = progressBlock;
+    _responseBlock = responseBlock;
+    if (progressBlock) {
+      _progressCoalescer = [[DBProgressCoalescer alloc] initWithProgressBlock:progressBlock
+                                                                        queue:_queue
+                                                              minimumInterval:_config.progressMinimumInterval
+                                                             minimumByteDelta:_config.progressMinimumByteDelta];
+    }
+
+    // all segment responses are handled on one serial queue, so that the in-flight limit needs no locking
+    _schedulingQueue = [NSOperationQueue new];
+    [_schedulingQueue setMaxConcurrentOperationCount:1];
+
+    _fileDescriptor = -1;
+    _pendingSegments = [NSMutableArray new];
+    _segmentsInFlight = 0;
+    _totalDownloadSize = 0;
+    _totalDownloadedSoFar = 0;
+    _finished = NO;
     _cancel = NO;
 
     _taskStorage = [DBTasksStorage new];
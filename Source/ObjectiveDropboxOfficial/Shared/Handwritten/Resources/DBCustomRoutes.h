@@ -11,8 +11,11 @@
 #import "DBFILESUserAuthRoutes.h"
 #import "DBHandlerTypes.h"
 
+@class DBBatchUploadConfig;
 @class DBBatchUploadTask;
 @class DBFILESCommitInfo;
+@class DBSegmentedDownloadConfig;
+@class DBSegmentedDownloadTask;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -50,6 +53,142 @@ NS_ASSUME_NONNULL_BEGIN
                           progressBlock:(DBProgressBlock _Nullable)progressBlock
                           responseBlock:(DBBatchUploadResponseBlock)responseBlock;
 
+///
+/// Batch uploads small and large files, using the given tuning options.
+///
+/// Behaves like `batchUploadFiles:queue:progressBlock:responseBlock:`. With `concurrentUploadSessions` enabled on
+/// `config`, large files are uploaded through `concurrent` upload sessions, keeping several chunks of each file in
+/// flight at once, bounded by the per-file and per-batch limits of `config`.
+///
+/// @param fileUrlsToCommitInfo Map from the file urls of the files to upload to the corresponding commit info objects.
+/// @param queue The operation queue to execute progress / response handlers on. Main queue if `nil` is passed.
+/// @param config The tuning options of the batch upload. Default options if `nil` is passed.
+/// @param progressBlock The progress block that is periodically executed once a file upload is complete.
+/// @param responseBlock The response block that is executed once all file uploads and the final batch commit is
+/// complete.
+///
+/// @returns Special `DBBatchUploadTask` that exposes cancellation method.
+///
+- (DBBatchUploadTask *)batchUploadFiles:(NSDictionary<NSURL *, DBFILESCommitInfo *> *)fileUrlsToCommitInfo
+                                  queue:(nullable NSOperationQueue *)queue
+                                 config:(nullable DBBatchUploadConfig *)config
+                          progressBlock:(DBProgressBlock _Nullable)progressBlock
+                          responseBlock:(DBBatchUploadResponseBlock)responseBlock;
+
+///
+/// Resumes a batch upload from its journal, e.g. after the process was terminated mid-batch.
+///
+/// The batch must have been started with `journalUrl` set on its `DBBatchUploadConfig`. Files are uploaded with the
+/// commit info recorded in the journal. Files that were committed are skipped, files that were fully uploaded or whose
+/// commit failed are only committed, and files with an open upload session only have their missing bytes sent. Files that changed size since they were journaled, or whose
+/// session has expired, are uploaded from scratch.
+///
+/// @param journalUrl The url of the journal of the batch to resume.
+/// @param queue The operation queue to execute progress / response handlers on. Main queue if `nil` is passed.
+/// @param config The tuning options of the batch upload. Default options if `nil` is passed. Its `journalUrl` is
+/// replaced with `journalUrl`.
+/// @param progressBlock The progress block that is periodically executed once a file upload is complete. Progress
+/// starts at the number of bytes uploaded before the batch was interrupted.
+/// @param responseBlock The response block that is executed once all file uploads and the final batch commit is
+/// complete. If the journal cannot be read, it is executed with a client error.
+///
+/// @returns Special `DBBatchUploadTask` that exposes cancellation method.
+///
+- (DBBatchUploadTask *)resumeBatchUploadWithJournalUrl:(NSURL *)journalUrl
+                                                 queue:(nullable NSOperationQueue *)queue
+                                                config:(nullable DBBatchUploadConfig *)config
+                                         progressBlock:(DBProgressBlock _Nullable)progressBlock
+                                         responseBlock:(DBBatchUploadResponseBlock)responseBlock;
+
+///
+/// Downloads a file from a user's Dropbox, streaming its content to a consumer block.
+///
+/// The file content is handed to `consumerBlock` as it arrives, so it is never held in memory or on disk as a whole,
+/// and the download is paused while the consumer falls behind.
+///
+/// @param path The path of the file to download.
+/// @param consumerBlock The block to which the file content is handed, piece by piece and in order. Returning `NO`
+/// cancels the download.
+/// @param consumerQueue The operation queue on which to execute the consumer block. It is forced to be serial. A
+/// private serial queue if `nil` is passed.
+///
+/// @return Through the response callback, the caller will receive a `DBFILESFileMetadata` object on success or a
+/// `DBFILESDownloadError` object on failure, once the whole file content has been consumed. The file data argument of
+/// the response callback is always `nil`.
+///
+- (DBDownloadDataTask<DBFILESFileMetadata *, DBFILESDownloadError *> *)
+    downloadStream:(NSString *)path
+     consumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+     consumerQueue:(nullable NSOperationQueue *)consumerQueue;
+
+///
+/// Downloads a byte range of a file from a user's Dropbox, streaming its content to a consumer block.
+///
+/// @param path The path of the file to download.
+/// @param byteOffsetStart For partial file download. Download file beginning from this starting byte position. Must
+/// include valid end range value.
+/// @param byteOffsetEnd For partial file download. Download file up until this ending byte position. Must include valid
+/// start range value.
+/// @param consumerBlock The block to which the file content is handed, piece by piece and in order. Returning `NO`
+/// cancels the download.
+/// @param consumerQueue The operation queue on which to execute the consumer block. It is forced to be serial. A
+/// private serial queue if `nil` is passed.
+///
+/// @return Through the response callback, the caller will receive a `DBFILESFileMetadata` object on success or a
+/// `DBFILESDownloadError` object on failure, once the whole file content has been consumed. The file data argument of
+/// the response callback is always `nil`.
+///
+- (DBDownloadDataTask<DBFILESFileMetadata *, DBFILESDownloadError *> *)
+    downloadStream:(NSString *)path
+   byteOffsetStart:(NSNumber *)byteOffsetStart
+     byteOffsetEnd:(NSNumber *)byteOffsetEnd
+     consumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+     consumerQueue:(nullable NSOperationQueue *)consumerQueue;
+
+///
+/// Downloads a file from a user's Dropbox, writing its content to an output stream as it arrives.
+///
+/// @param path The path of the file to download.
+/// @param outputStream The stream to which the file content is written. It is opened if it is not open yet, and left
+/// open for the caller to close once the response callback is executed. A failed write cancels the download.
+///
+/// @return Through the response callback, the caller will receive a `DBFILESFileMetadata` object on success or a
+/// `DBFILESDownloadError` object on failure. The file data argument of the response callback is always `nil`.
+///
+- (DBDownloadDataTask<DBFILESFileMetadata *, DBFILESDownloadError *> *)downloadStream:(NSString *)path
+                                                                        outputStream:(NSOutputStream *)outputStream;
+
+///
+/// Downloads a large file from a user's Dropbox as several byte ranges at once.
+///
+/// This is a custom route built as a convenience layer over several Dropbox endpoints. The file is looked up first, the
+/// destination is preallocated to its size, and its segments are then downloaded concurrently, each written in place at
+/// its offset as it arrives. Every segment is pinned to the revision that was looked up. A segment that fails is
+/// requested again from its first missing byte, up to the retry limit of `config`. Progress is not persisted across
+/// downloads, so a download that is started again, e.g. after the process was terminated, starts from scratch.
+///
+/// @note The interface of this route does not have the same structure as other routes in the SDK. Here, a special
+/// `DBSegmentedDownloadTask` object is returned. Progress and response handlers are passed in directly to the route,
+/// rather than installed via this response object.
+///
+/// @param path The path of the file to download.
+/// @param destination The location to download the file to. Any existing file is replaced, and the incomplete file is
+/// removed if the download fails.
+/// @param config The tuning options of the segmented download. Default options if `nil` is passed.
+/// @param queue The operation queue to execute progress / response handlers on. Main queue if `nil` is passed.
+/// @param progressBlock The progress block that is executed as file content is written to the destination, with the
+/// total across all segments.
+/// @param responseBlock The response block that is executed once every segment is downloaded, or the download fails.
+///
+/// @returns Special `DBSegmentedDownloadTask` that exposes cancellation method.
+///
+- (DBSegmentedDownloadTask *)segmentedDownloadFile:(NSString *)path
+                                       destination:(NSURL *)destination
+                                            config:(nullable DBSegmentedDownloadConfig *)config
+                                             queue:(nullable NSOperationQueue *)queue
+                                     progressBlock:(DBProgressBlock _Nullable)progressBlock
+                                     responseBlock:(DBSegmentedDownloadResponseBlock)responseBlock;
+
 @end
 
 NS_ASSUME_NONNULL_END
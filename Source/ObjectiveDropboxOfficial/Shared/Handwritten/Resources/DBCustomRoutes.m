@@ -3,11 +3,22 @@
 ///
 
 #import "DBCustomRoutes.h"
+#import <fcntl.h>
+#import <unistd.h>
 #import "DBASYNCLaunchEmptyResult.h"
+#import "DBBatchUploadJournal.h"
 #import "DBChunkInputStream.h"
 #import "DBCustomDatatypes.h"
 #import "DBCustomTasks.h"
 #import "DBFILESCommitInfo.h"
+#import "DBFILESDownloadArg.h"
+#import "DBFILESDownloadError.h"
+#import "DBFILESFileMetadata.h"
+#import "DBFILESGetMetadataError.h"
+#import "DBFILESLookupError.h"
+#import "DBFILESMetadata.h"
+#import "DBFILESRouteObjects.h"
+#import "DBFILESUploadSessionAppendError.h"
 #import "DBFILESUploadSessionCursor.h"
 #import "DBFILESUploadSessionFinishArg.h"
 #import "DBFILESUploadSessionFinishBatchJobStatus.h"
@@ -17,13 +28,39 @@
 #import "DBFILESUploadSessionLookupError.h"
 #import "DBFILESUploadSessionOffsetError.h"
 #import "DBFILESUploadSessionStartResult.h"
+#import "DBFILESUploadSessionType.h"
 #import "DBHandlerTypes.h"
+#import "DBProgressCoalescer.h"
 #import "DBRequestErrors.h"
+#import "DBStoneBase.h"
 #import "DBTasksImpl.h"
 #import "DBTasksStorage.h"
+#import "DBTransportClientProtocol.h"
 
-// 10 MB file chunk size
-static const NSUInteger fileChunkSize = 10 * 1024 * 1024;
+// `upload_session/finish_batch` accepts at most 1000 entries per call
+static const NSUInteger maxFinishBatchEntriesLimit = 1000;
+
+// concurrent upload sessions only accept appends that are a multiple of 4 MB
+static const NSUInteger concurrentChunkAlignment = 4 * 1024 * 1024;
+
+static BOOL DBWriteBytesAtOffset(int fileDescriptor, const void *bytes, NSUInteger length, off_t offset) {
+  NSUInteger written = 0;
+  while (written < length) {
+    ssize_t result =
+        pwrite(fileDescriptor, (const uint8_t *)bytes + written, length - written, offset + (off_t)written);
+    if (result < 0 && errno == EINTR) {
+      continue;
+    }
+    if (result <= 0) {
+      if (result == 0) {
+        errno = EIO;
+      }
+      return NO;
+    }
+    written += (NSUInteger)result;
+  }
+  return YES;
+}
 
 @implementation DBFILESUserAuthRoutes (DBCustomRoutes)
 
@@ -31,76 +68,291 @@ static const NSUInteger fileChunkSize = 10 * 1024 * 1024;
                                   queue:(NSOperationQueue *)queue
                           progressBlock:(DBProgressBlock)progressBlock
                           responseBlock:(DBBatchUploadResponseBlock)responseBlock {
+  return [self batchUploadFiles:fileUrlsToCommitInfo
+                          queue:queue
+                         config:nil
+                  progressBlock:progressBlock
+                  responseBlock:responseBlock];
+}
+
+- (DBBatchUploadTask *)batchUploadFiles:(NSDictionary<NSURL *, DBFILESCommitInfo *> *)fileUrlsToCommitInfo
+                                  queue:(NSOperationQueue *)queue
+                                 config:(DBBatchUploadConfig *)config
+                          progressBlock:(DBProgressBlock)progressBlock
+                          responseBlock:(DBBatchUploadResponseBlock)responseBlock {
   DBBatchUploadData *uploadData =
       [[DBBatchUploadData alloc] initWithFileCommitInfo:fileUrlsToCommitInfo
                                           progressBlock:progressBlock
                                           responseBlock:responseBlock
-                                                  queue:queue ?: [NSOperationQueue mainQueue]];
+                                                  queue:queue ?: [NSOperationQueue mainQueue]
+                                                 config:config ?: [DBBatchUploadConfig new]];
   DBBatchUploadTask *uploadTask = [[DBBatchUploadTask alloc] initWithUploadData:uploadData];
 
-  NSArray<NSURL *> *fileUrls = [fileUrlsToCommitInfo allKeys];
+  if (uploadData.config.journalUrl) {
+    NSError *journalError;
+    uploadData.journal = [[DBBatchUploadJournal alloc] initWithNewJournalUrl:uploadData.config.journalUrl
+                                                                       error:&journalError];
+    if (!uploadData.journal) {
+      [uploadData.queue addOperationWithBlock:^{
+        uploadData.responseBlock(nil, nil, [[DBRequestError alloc] initAsClientError:journalError], @{});
+      }];
+      return uploadTask;
+    }
+  }
+
+  [self startBatchUpload:uploadData];
+
+  return uploadTask;
+}
+
+- (DBBatchUploadTask *)resumeBatchUploadWithJournalUrl:(NSURL *)journalUrl
+                                                 queue:(NSOperationQueue *)queue
+                                                config:(DBBatchUploadConfig *)config
+                                         progressBlock:(DBProgressBlock)progressBlock
+                                         responseBlock:(DBBatchUploadResponseBlock)responseBlock {
+  NSError *journalError;
+  DBBatchUploadJournal *journal = [[DBBatchUploadJournal alloc] initWithExistingJournalUrl:journalUrl
+                                                                                     error:&journalError];
+
+  NSMutableDictionary<NSURL *, DBFILESCommitInfo *> *fileUrlsToCommitInfo = [NSMutableDictionary new];
+  for (NSURL *fileUrl in journal.entries) {
+    fileUrlsToCommitInfo[fileUrl] = journal.entries[fileUrl].commitInfo;
+  }
+
+  DBBatchUploadConfig *resumeConfig = [config ?: [DBBatchUploadConfig new] copy];
+  resumeConfig.journalUrl = journalUrl;
+
+  DBBatchUploadData *uploadData =
+      [[DBBatchUploadData alloc] initWithFileCommitInfo:fileUrlsToCommitInfo
+                                          progressBlock:progressBlock
+                                          responseBlock:responseBlock
+                                                  queue:queue ?: [NSOperationQueue mainQueue]
+                                                 config:resumeConfig];
+  uploadData.journal = journal;
+  DBBatchUploadTask *uploadTask = [[DBBatchUploadTask alloc] initWithUploadData:uploadData];
+
+  if (!journal) {
+    [uploadData.queue addOperationWithBlock:^{
+      uploadData.responseBlock(nil, nil, [[DBRequestError alloc] initAsClientError:journalError], @{});
+    }];
+    return uploadTask;
+  }
+
+  [self startBatchUpload:uploadData];
+
+  return uploadTask;
+}
+
+- (DBDownloadDataTask *)downloadStream:(NSString *)path
+                        consumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+                        consumerQueue:(NSOperationQueue *)consumerQueue {
+  DBRoute *route = DBFILESRouteObjects.DBFILESDownload;
+  DBFILESDownloadArg *arg = [[DBFILESDownloadArg alloc] initWithPath:path];
+  return [self.client requestDownload:route
+                                  arg:arg
+                      byteOffsetStart:nil
+                        byteOffsetEnd:nil
+                        consumerBlock:consumerBlock
+                        consumerQueue:consumerQueue];
+}
+
+- (DBDownloadDataTask *)downloadStream:(NSString *)path
+                      byteOffsetStart:(NSNumber *)byteOffsetStart
+                        byteOffsetEnd:(NSNumber *)byteOffsetEnd
+                        consumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+                        consumerQueue:(NSOperationQueue *)consumerQueue {
+  DBRoute *route = DBFILESRouteObjects.DBFILESDownload;
+  DBFILESDownloadArg *arg = [[DBFILESDownloadArg alloc] initWithPath:path];
+  return [self.client requestDownload:route
+                                  arg:arg
+                      byteOffsetStart:byteOffsetStart
+                        byteOffsetEnd:byteOffsetEnd
+                        consumerBlock:consumerBlock
+                        consumerQueue:consumerQueue];
+}
+
+- (DBDownloadDataTask *)downloadStream:(NSString *)path outputStream:(NSOutputStream *)outputStream {
+  DBRoute *route = DBFILESRouteObjects.DBFILESDownload;
+  DBFILESDownloadArg *arg = [[DBFILESDownloadArg alloc] initWithPath:path];
+  return [self.client requestDownload:route
+                                  arg:arg
+                      byteOffsetStart:nil
+                        byteOffsetEnd:nil
+                         outputStream:outputStream];
+}
+
+- (DBSegmentedDownloadTask *)segmentedDownloadFile:(NSString *)path
+                                       destination:(NSURL *)destination
+                                            config:(DBSegmentedDownloadConfig *)config
+                                             queue:(NSOperationQueue *)queue
+                                     progressBlock:(DBProgressBlock)progressBlock
+                                     responseBlock:(DBSegmentedDownloadResponseBlock)responseBlock {
+  DBSegmentedDownloadData *downloadData =
+      [[DBSegmentedDownloadData alloc] initWithPath:path
+                                        destination:destination
+                                             config:config ?: [DBSegmentedDownloadConfig new]
+                                              queue:queue ?: [NSOperationQueue mainQueue]
+                                      progressBlock:progressBlock
+                                      responseBlock:responseBlock];
+  DBSegmentedDownloadTask *downloadTask = [[DBSegmentedDownloadTask alloc] initWithDownloadData:downloadData];
+
+  // the size and revision of the file decide the segments, so look them up before requesting any content
+  [[self getMetadata:path]
+      setResponseBlock:^(DBFILESMetadata *result, DBFILESGetMetadataError *routeError, DBRequestError *error) {
+        if ([result isKindOfClass:[DBFILESFileMetadata class]]) {
+          [self startSegmentedDownload:downloadData metadata:(DBFILESFileMetadata *)result];
+          return;
+        }
+
+        DBFILESDownloadError *downloadError = nil;
+        if (routeError) {
+          downloadError = [routeError isPath] ? [[DBFILESDownloadError alloc] initWithPath:routeError.path]
+                                              : [[DBFILESDownloadError alloc] initWithOther];
+        } else if (result) {
+          // only files can be downloaded
+          downloadError = [[DBFILESDownloadError alloc] initWithPath:[[DBFILESLookupError alloc] initWithNotFile]];
+        }
+        [self failSegmentedDownload:downloadData routeError:downloadError networkError:error];
+      }
+                 queue:downloadData.schedulingQueue];
+
+  return downloadTask;
+}
+
+- (void)startBatchUpload:(DBBatchUploadData *)uploadData {
+  NSArray<NSURL *> *fileUrls = [uploadData.fileUrlsToCommitInfo allKeys];
   NSMutableDictionary<NSURL *, NSNumber *> *fileUrlsToFileSize = [NSMutableDictionary new];
+  NSMutableDictionary<NSURL *, NSDate *> *fileUrlsToModificationDate = [NSMutableDictionary new];
 
   NSUInteger totalUploadSize = 0;
 
   // determine total upload size for progress handler
   for (NSURL *fileUrl in fileUrls) {
-    NSNumber *fileSizeObj;
     NSError *fileSizeError;
-    [fileUrl getResourceValue:&fileSizeObj forKey:NSURLFileSizeKey error:&fileSizeError];
+    NSDictionary<NSURLResourceKey, id> *resourceValues =
+        [fileUrl resourceValuesForKeys:@[ NSURLFileSizeKey, NSURLContentModificationDateKey ] error:&fileSizeError];
 
     if (fileSizeError) {
       [uploadData.queue addOperationWithBlock:^{
         uploadData.responseBlock(nil, nil, nil, @{fileUrl : [[DBRequestError alloc] initAsClientError:fileSizeError]});
       }];
-      return uploadTask;
+      return;
     }
-    NSUInteger fileSize = [fileSizeObj unsignedIntegerValue];
+    NSUInteger fileSize = [resourceValues[NSURLFileSizeKey] unsignedIntegerValue];
 
     totalUploadSize += fileSize;
     fileUrlsToFileSize[fileUrl] = @(fileSize);
+    fileUrlsToModificationDate[fileUrl] = resourceValues[NSURLContentModificationDateKey];
   }
 
   uploadData.totalUploadSize = totalUploadSize;
 
-  NSOperationQueue *limitRequestsQueue = [NSOperationQueue new];
-  limitRequestsQueue.maxConcurrentOperationCount = 5;
-
+  // pick up where the journal left off, skipping files that changed since they were journaled
+  NSMutableDictionary<NSURL *, DBBatchUploadJournalEntry *> *fileUrlsToResumeEntry = [NSMutableDictionary new];
+  NSUInteger totalUploadedSoFar = 0;
   for (NSURL *fileUrl in fileUrls) {
     NSUInteger fileSize = [fileUrlsToFileSize[fileUrl] unsignedIntegerValue];
+    NSDate *modificationDate = fileUrlsToModificationDate[fileUrl];
+    DBBatchUploadJournalEntry *entry = uploadData.journal.entries[fileUrl];
 
-    if (!uploadData.cancel) {
-      dispatch_group_enter(uploadData.uploadGroup);
-
-      // queue to `limitRequestsQueue` then back to main queue to make request
-      [limitRequestsQueue addOperationWithBlock:^{
-        dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
-        if (fileSize < fileChunkSize) {
-          // file is small, so we won't chunk upload it.
-          [self startUploadSmallFile:uploadData fileUrl:fileUrl fileSize:fileSize blockingSemaphore:semaphore];
-        } else {
-          // file is somewhat large, so we will chunk upload it, repeatedly querying
-          // `/upload_session/append_v2` until the file is uploaded
-          [self startUploadLargeFile:uploadData fileUrl:fileUrl fileSize:fileSize blockingSemaphore:semaphore];
-        }
-        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
-      }];
+    if ([entry isResumableWithFileSize:fileSize modificationDate:modificationDate]) {
+      fileUrlsToResumeEntry[fileUrl] = entry;
+      totalUploadedSoFar += entry.closed ? fileSize : [entry.committedRanges count];
     } else {
-      break;
+      [uploadData.journal recordFileUrl:fileUrl
+                               fileSize:fileSize
+                       modificationDate:modificationDate
+                             commitInfo:uploadData.fileUrlsToCommitInfo[fileUrl]];
+    }
+  }
+
+  uploadData.totalUploadedSoFar = totalUploadedSoFar;
+
+  NSMutableArray<DBBatchUploadJournalEntry *> *closedResumeEntries = [NSMutableArray new];
+
+  for (NSURL *fileUrl in fileUrls) {
+    NSUInteger fileSize = [fileUrlsToFileSize[fileUrl] unsignedIntegerValue];
+    DBBatchUploadJournalEntry *resumeEntry = fileUrlsToResumeEntry[fileUrl];
+
+    if (resumeEntry.finished) {
+      // file was committed before, so there is nothing left to do
+      continue;
     }
+    if (resumeEntry.closed) {
+      // file was fully uploaded before, so it only needs to be committed
+      [closedResumeEntries addObject:resumeEntry];
+      continue;
+    }
+
+    // every file enters the group up front, so the group only empties once the last file is done,
+    // however many files are still waiting for a slot
+    dispatch_group_enter(uploadData.uploadGroup);
+
+    [uploadData.pendingFileUploads addObject:^{
+      if (resumeEntry && resumeEntry.concurrent) {
+        // re-send the chunks the server did not acknowledge
+        [self resumeConcurrentUploadLargeFile:uploadData resumeEntry:resumeEntry];
+      } else if (resumeEntry) {
+        // continue appending after the last acknowledged chunk
+        [self resumeUploadLargeFile:uploadData resumeEntry:resumeEntry];
+      } else if (fileSize < [uploadData.config.chunkSizePolicy chunkSize]) {
+        // file is small, so we won't chunk upload it.
+        [self startUploadSmallFile:uploadData fileUrl:fileUrl fileSize:fileSize];
+      } else if (uploadData.config.concurrentUploadSessions) {
+        // file is somewhat large, so we will chunk upload it through a concurrent
+        // session, keeping several `/upload_session/append_v2` calls in flight
+        [self startConcurrentUploadLargeFile:uploadData fileUrl:fileUrl fileSize:fileSize];
+      } else {
+        // file is somewhat large, so we will chunk upload it, repeatedly querying
+        // `/upload_session/append_v2` until the file is uploaded
+        [self startUploadLargeFile:uploadData fileUrl:fileUrl fileSize:fileSize];
+      }
+    }];
   }
 
+  [uploadData.schedulingQueue addOperationWithBlock:^{
+    for (DBBatchUploadJournalEntry *resumeEntry in closedResumeEntries) {
+      [self storeFinishArg:uploadData
+                   fileUrl:resumeEntry.fileUrl
+                 sessionId:resumeEntry.sessionId
+                  fileSize:resumeEntry.fileSize];
+    }
+    [self startPendingFileUploads:uploadData];
+  }];
+
   // small or large, we query `upload_session/finish_batch` to batch commit
   // uploaded files.
   [self batchFinishUponCompletion:uploadData];
+}
 
-  return uploadTask;
+// must be called on `uploadData.schedulingQueue`
+- (void)startPendingFileUploads:(DBBatchUploadData *)uploadData {
+  NSUInteger maxFileUploads = MAX(uploadData.config.maxConcurrentFileUploads, 1);
+  while (uploadData.filesInFlight < maxFileUploads && [uploadData.pendingFileUploads count] > 0) {
+    void (^startFileUpload)(void) = uploadData.pendingFileUploads[0];
+    [uploadData.pendingFileUploads removeObjectAtIndex:0];
+
+    if (uploadData.cancel) {
+      // never started, so there is nothing to wait for
+      dispatch_group_leave(uploadData.uploadGroup);
+      continue;
+    }
+
+    uploadData.filesInFlight++;
+    startFileUpload();
+  }
+}
+
+// must be called on `uploadData.schedulingQueue`
+- (void)finishFileUpload:(DBBatchUploadData *)uploadData {
+  uploadData.filesInFlight--;
+  [self startPendingFileUploads:uploadData];
+  dispatch_group_leave(uploadData.uploadGroup);
 }
 
 - (void)startUploadSmallFile:(DBBatchUploadData *)uploadData
                      fileUrl:(NSURL *)fileUrl
-                    fileSize:(NSUInteger)fileSize
-           blockingSemaphore:(dispatch_semaphore_t)blockingSemaphore {
+                    fileSize:(NSUInteger)fileSize {
   // immediately close session after first API call
   // because file can be uploaded in one request
   __block DBUploadTask *task = [[[self uploadSessionStartStream:@(YES)
@@ -110,133 +362,127 @@ static const NSUInteger fileChunkSize = 10 * 1024 * 1024;
       setResponseBlock:^(DBFILESUploadSessionStartResult *result, DBFILESUploadSessionStartError *routeError,
                          DBRequestError *error) {
         if (result && !routeError) {
-          NSString *sessionId = result.sessionId;
-          NSNumber *offset = @(fileSize);
-          DBFILESUploadSessionCursor *cursor =
-              [[DBFILESUploadSessionCursor alloc] initWithSessionId:sessionId offset:offset];
-          DBFILESCommitInfo *commitInfo = uploadData.fileUrlsToCommitInfo[fileUrl];
-          DBFILESUploadSessionFinishArg *finishArg =
-              [[DBFILESUploadSessionFinishArg alloc] initWithCursor:cursor commit:commitInfo];
+          [uploadData.journal recordSessionId:result.sessionId concurrent:NO fileUrl:fileUrl];
+          [uploadData.journal recordSessionClosedForFileUrl:fileUrl];
 
           // store commit info for this file
-          [uploadData.finishArgs addObject:finishArg];
+          [self storeFinishArg:uploadData fileUrl:fileUrl sessionId:result.sessionId fileSize:fileSize];
         } else {
           uploadData.fileUrlsToRequestErrors[fileUrl] = error;
         }
 
         [uploadData.taskStorage removeUploadTask:task];
-        dispatch_semaphore_signal(blockingSemaphore);
-        dispatch_group_leave(uploadData.uploadGroup);
+        [self finishFileUpload:uploadData];
       }
-                 queue:uploadData.queue]
+                 queue:uploadData.schedulingQueue]
       setProgressBlock:^(int64_t bytesWritten, int64_t totalBytesWritten, int64_t totalBytesExpectedToWrite) {
 #pragma unused(totalBytesWritten)
 #pragma unused(totalBytesExpectedToWrite)
         [self executeProgressHandler:uploadData amountUploaded:bytesWritten];
-      }];
+      }
+                 queue:uploadData.schedulingQueue];
 
   [uploadData.taskStorage addUploadTask:task];
 }
 
 - (void)startUploadLargeFile:(DBBatchUploadData *)uploadData
                      fileUrl:(NSURL *)fileUrl
-                    fileSize:(NSUInteger)fileSize
-           blockingSemaphore:(dispatch_semaphore_t)blockingSemaphore {
+                    fileSize:(NSUInteger)fileSize {
+  id<DBChunkSizePolicy> chunkSizePolicy = uploadData.config.chunkSizePolicy;
   NSUInteger startBytes = 0;
-  NSUInteger endBytes = fileChunkSize;
+  NSUInteger endBytes =
+      [self endBytesWithFileSize:fileSize startBytes:startBytes chunkSize:[chunkSizePolicy chunkSize]];
+  if (endBytes == fileSize) {
+    // the chunk size grew past the file size since it was scheduled
+    [self startUploadSmallFile:uploadData fileUrl:fileUrl fileSize:fileSize];
+    return;
+  }
+
   DBChunkInputStream *fileChunkInputStream =
       [[DBChunkInputStream alloc] initWithFileUrl:fileUrl startBytes:startBytes endBytes:endBytes];
-
-  // use seperate continue upload queue so we don't block other files from
-  // commencing their upload
-  NSOperationQueue *chunkUploadContinueQueue = [NSOperationQueue new];
+  NSDate *chunkStartDate = [NSDate date];
 
   // do not immediately close session
   __block DBUploadTask *task = [[[self uploadSessionStartStream:fileChunkInputStream]
       setResponseBlock:^(DBFILESUploadSessionStartResult *result, DBFILESUploadSessionStartError *routeError,
                          DBRequestError *error) {
         if (result && !routeError) {
+          [chunkSizePolicy recordChunkUploadOfSize:endBytes - startBytes
+                                          duration:-[chunkStartDate timeIntervalSinceNow]];
+
           NSString *sessionId = result.sessionId;
-          [self appendRemainingFileChunks:uploadData
-                                  fileUrl:fileUrl
-                                 fileSize:fileSize
-                                sessionId:sessionId
-                        blockingSemaphore:blockingSemaphore];
-
-          DBFILESUploadSessionCursor *cursor =
-              [[DBFILESUploadSessionCursor alloc] initWithSessionId:sessionId offset:@(fileSize)];
-          DBFILESCommitInfo *commitInfo = uploadData.fileUrlsToCommitInfo[fileUrl];
-          DBFILESUploadSessionFinishArg *finishArg =
-              [[DBFILESUploadSessionFinishArg alloc] initWithCursor:cursor commit:commitInfo];
-
-          // Store commit info for this file
-          [uploadData.finishArgs addObject:finishArg];
+          [uploadData.journal recordSessionId:sessionId concurrent:NO fileUrl:fileUrl];
+          [uploadData.journal recordCommittedRangeWithStartBytes:startBytes endBytes:endBytes fileUrl:fileUrl];
+
+          [self appendFileChunk:uploadData
+                        fileUrl:fileUrl
+                       fileSize:fileSize
+                      sessionId:sessionId
+                     retryCount:0
+                     startBytes:endBytes];
         } else {
+          [chunkSizePolicy recordChunkUploadFailureOfSize:endBytes - startBytes];
           uploadData.fileUrlsToRequestErrors[fileUrl] = error;
-          dispatch_semaphore_signal(blockingSemaphore);
-          dispatch_group_leave(uploadData.uploadGroup);
+          [self finishFileUpload:uploadData];
         }
 
         [uploadData.taskStorage removeUploadTask:task];
       }
-                 queue:chunkUploadContinueQueue]
+                 queue:uploadData.schedulingQueue]
       setProgressBlock:^(int64_t bytesWritten, int64_t totalBytesWritten, int64_t totalBytesExpectedToWrite) {
 #pragma unused(totalBytesWritten)
 #pragma unused(totalBytesExpectedToWrite)
         [self executeProgressHandler:uploadData amountUploaded:bytesWritten];
-      }];
+      }
+                 queue:uploadData.schedulingQueue];
 
   [uploadData.taskStorage addUploadTask:task];
 }
 
-- (void)appendRemainingFileChunks:(DBBatchUploadData *)uploadData
-                          fileUrl:(NSURL *)fileUrl
-                         fileSize:(NSUInteger)fileSize
-                        sessionId:(NSString *)sessionId
-                blockingSemaphore:(dispatch_semaphore_t)blockingSemaphore {
-  // use seperate response queue so we don't block response thread
-  // with dispatch_semaphore_t
-  NSOperationQueue *chunkUploadResponseQueue = [NSOperationQueue new];
-
-  [chunkUploadResponseQueue addOperationWithBlock:^{
-    NSUInteger startBytes = fileChunkSize;
-    NSUInteger endBytes = [self endBytesWithFileSize:fileSize startBytes:startBytes];
-    BOOL shouldClose = endBytes == fileSize;
-
-    DBChunkInputStream *fileChunkInputStream =
-        [[DBChunkInputStream alloc] initWithFileUrl:fileUrl startBytes:startBytes endBytes:endBytes];
-    DBFILESUploadSessionCursor *cursor =
-        [[DBFILESUploadSessionCursor alloc] initWithSessionId:sessionId offset:@(startBytes)];
-
-    [self appendFileChunk:uploadData
-                         fileUrl:fileUrl
-                        fileSize:fileSize
-                       sessionId:sessionId
-        chunkUploadResponseQueue:chunkUploadResponseQueue
-                      retryCount:0
-            fileChunkInputStream:fileChunkInputStream
-                          cursor:cursor
-                      startBytes:startBytes
-                     shouldClose:shouldClose
-               blockingSemaphore:blockingSemaphore];
-  }];
+- (void)resumeUploadLargeFile:(DBBatchUploadData *)uploadData resumeEntry:(DBBatchUploadJournalEntry *)resumeEntry {
+  // sequential sessions only ever grow from the start of the file, so everything
+  // up to the end of the first acknowledged range is on the server
+  NSUInteger committedBytes = 0;
+  NSRange committedRange = [self firstRangeInIndexSet:resumeEntry.committedRanges];
+  if (committedRange.location == 0) {
+    committedBytes = NSMaxRange(committedRange);
+  }
+
+  [self appendFileChunk:uploadData
+                fileUrl:resumeEntry.fileUrl
+               fileSize:resumeEntry.fileSize
+              sessionId:resumeEntry.sessionId
+             retryCount:0
+             startBytes:committedBytes];
 }
 
 - (void)appendFileChunk:(DBBatchUploadData *)uploadData
-                     fileUrl:(NSURL *)fileUrl
-                    fileSize:(NSUInteger)fileSize
-                   sessionId:(NSString *)sessionId
-    chunkUploadResponseQueue:(NSOperationQueue *)chunkUploadResponseQueue
-                  retryCount:(int)retryCount
-        fileChunkInputStream:(NSInputStream *)fileChunkInputStream
-                      cursor:(DBFILESUploadSessionCursor *)cursor
-                  startBytes:(NSUInteger)startBytes
-                 shouldClose:(BOOL)shouldClose
-           blockingSemaphore:(dispatch_semaphore_t)blockingSemaphore {
+                fileUrl:(NSURL *)fileUrl
+               fileSize:(NSUInteger)fileSize
+              sessionId:(NSString *)sessionId
+             retryCount:(int)retryCount
+             startBytes:(NSUInteger)startBytes {
+  // the chunk size is decided per request, so a retry goes out with the size the policy settled on after the failure
+  id<DBChunkSizePolicy> chunkSizePolicy = uploadData.config.chunkSizePolicy;
+  NSUInteger endBytes =
+      [self endBytesWithFileSize:fileSize startBytes:startBytes chunkSize:[chunkSizePolicy chunkSize]];
+  BOOL shouldClose = endBytes == fileSize;
+
+  NSInputStream *fileChunkInputStream = [self chunkInputStreamWithFileUrl:fileUrl
+                                                               startBytes:startBytes
+                                                                 endBytes:endBytes];
+  DBFILESUploadSessionCursor *cursor =
+      [[DBFILESUploadSessionCursor alloc] initWithSessionId:sessionId offset:@(startBytes)];
+  NSDate *chunkStartDate = [NSDate date];
+
   // close session on final append call
   __block DBUploadTask *task =
       [[[self uploadSessionAppendV2Stream:cursor close:@(shouldClose) contentHash:nil inputStream:fileChunkInputStream]
           setResponseBlock:^(DBNilObject *result, DBFILESUploadSessionAppendError *routeError, DBRequestError *error) {
+            if (!result) {
+              [chunkSizePolicy recordChunkUploadFailureOfSize:endBytes - startBytes];
+            }
+
             if (!result && !routeError) {
               if ([error isRateLimitError]) {
                 DBRequestRateLimitError *rateLimitError = [error asRateLimitError];
@@ -245,156 +491,471 @@ static const NSUInteger fileChunkSize = 10 * 1024 * 1024;
                     dispatch_time(DISPATCH_TIME_NOW, (int64_t)(backoffInSeconds * NSEC_PER_SEC));
 
                 // retry after backoff time
-                dispatch_after(delayTime, dispatch_get_main_queue(), ^(void) {
-                  if (retryCount <= 3) {
-                    [self appendFileChunk:uploadData
-                                         fileUrl:fileUrl
-                                        fileSize:fileSize
-                                       sessionId:sessionId
-                        chunkUploadResponseQueue:chunkUploadResponseQueue
-                                      retryCount:retryCount + 1
-                            fileChunkInputStream:fileChunkInputStream
-                                          cursor:cursor
-                                      startBytes:startBytes
-                                     shouldClose:shouldClose
-                               blockingSemaphore:blockingSemaphore];
-                  } else {
-                    uploadData.fileUrlsToRequestErrors[fileUrl] = error;
-                    dispatch_semaphore_signal(blockingSemaphore);
-                    dispatch_group_leave(uploadData.uploadGroup);
-                  }
-                });
+                [self afterDelay:delayTime
+                           queue:uploadData.schedulingQueue
+                         perform:^{
+                           if (retryCount <= 3) {
+                             [self appendFileChunk:uploadData
+                                           fileUrl:fileUrl
+                                          fileSize:fileSize
+                                         sessionId:sessionId
+                                        retryCount:retryCount + 1
+                                        startBytes:startBytes];
+                           } else {
+                             uploadData.fileUrlsToRequestErrors[fileUrl] = error;
+                             [self finishFileUpload:uploadData];
+                           }
+                         }];
               } else {
                 uploadData.fileUrlsToRequestErrors[fileUrl] = error;
-                dispatch_semaphore_signal(blockingSemaphore);
-                dispatch_group_leave(uploadData.uploadGroup);
+                [self finishFileUpload:uploadData];
               }
+            } else if (!result && [routeError isIncorrectOffset] && retryCount <= 3) {
+              // the server holds a different amount of the file than we assumed, which happens
+              // when resuming from a journal that missed the last acknowledged chunk
+              NSUInteger correctOffset = [routeError.incorrectOffset.correctOffset unsignedIntegerValue];
+              [self appendFileChunk:uploadData
+                            fileUrl:fileUrl
+                           fileSize:fileSize
+                          sessionId:sessionId
+                         retryCount:retryCount + 1
+                         startBytes:MIN(correctOffset, fileSize)];
+            } else if (!result && [routeError isNotFound] && [self isJournaledSession:uploadData
+                                                                                  sessionId:sessionId
+                                                                                    fileUrl:fileUrl]) {
+              // the session resumed from the journal has expired, so upload the file from scratch
+              [self startUploadLargeFile:uploadData fileUrl:fileUrl fileSize:fileSize];
             } else if (!result) {
               // if we error here, there's almost certainly a bug with the SDK
               uploadData.fileUrlsToRequestErrors[fileUrl] = error;
-              dispatch_semaphore_signal(blockingSemaphore);
-              dispatch_group_leave(uploadData.uploadGroup);
+              [self finishFileUpload:uploadData];
             } else {
+              [chunkSizePolicy recordChunkUploadOfSize:endBytes - startBytes
+                                              duration:-[chunkStartDate timeIntervalSinceNow]];
+              [uploadData.journal recordCommittedRangeWithStartBytes:startBytes endBytes:endBytes fileUrl:fileUrl];
+
+              if (shouldClose) {
+                [uploadData.journal recordSessionClosedForFileUrl:fileUrl];
+
+                // store commit info for this file
+                [self storeFinishArg:uploadData fileUrl:fileUrl sessionId:sessionId fileSize:fileSize];
+              }
+
               if (shouldClose || uploadData.cancel) {
-                dispatch_semaphore_signal(blockingSemaphore);
-                dispatch_group_leave(uploadData.uploadGroup);
+                [self finishFileUpload:uploadData];
+                [uploadData.taskStorage removeUploadTask:task];
                 return;
               }
 
-              NSUInteger startBytesContinue = startBytes + fileChunkSize;
-              NSUInteger endBytesContinue = [self endBytesWithFileSize:fileSize startBytes:startBytesContinue];
-              BOOL shouldCloseContinue = endBytesContinue == fileSize;
-
-              DBChunkInputStream *fileChunkInputStreamContinue =
-                  [[DBChunkInputStream alloc] initWithFileUrl:fileUrl
-                                                   startBytes:startBytesContinue
-                                                     endBytes:endBytesContinue];
-              DBFILESUploadSessionCursor *cursorContinue =
-                  [[DBFILESUploadSessionCursor alloc] initWithSessionId:sessionId offset:@(startBytesContinue)];
-
               [self appendFileChunk:uploadData
-                                   fileUrl:fileUrl
-                                  fileSize:fileSize
-                                 sessionId:sessionId
-                  chunkUploadResponseQueue:chunkUploadResponseQueue
-                                retryCount:retryCount
-                      fileChunkInputStream:fileChunkInputStreamContinue
-                                    cursor:cursorContinue
-                                startBytes:startBytesContinue
-                               shouldClose:shouldCloseContinue
-                         blockingSemaphore:blockingSemaphore];
+                            fileUrl:fileUrl
+                           fileSize:fileSize
+                          sessionId:sessionId
+                         retryCount:retryCount
+                         startBytes:endBytes];
             }
             [uploadData.taskStorage removeUploadTask:task];
           }
-                     queue:chunkUploadResponseQueue]
+                     queue:uploadData.schedulingQueue]
           setProgressBlock:^(int64_t bytesWritten, int64_t totalBytesWritten, int64_t totalBytesExpectedToWrite) {
 #pragma unused(totalBytesWritten)
 #pragma unused(totalBytesExpectedToWrite)
             if (retryCount == 0) {
               [self executeProgressHandler:uploadData amountUploaded:bytesWritten];
             }
-          }];
+          }
+                     queue:uploadData.schedulingQueue];
 
   [uploadData.taskStorage addUploadTask:task];
 }
 
-- (void)finishBatch:(DBBatchUploadData *)uploadData
-      resultEntries:(NSArray<DBFILESUploadSessionFinishBatchResultEntry *> *)resultEntries {
-  [uploadData.queue addOperationWithBlock:^{
-    // create reverse lookup
-    NSMutableDictionary<NSString *, NSURL *> *dropboxFilePathToNSURL = [NSMutableDictionary new];
-    for (NSURL *fileUrl in uploadData.fileUrlsToCommitInfo) {
-      DBFILESCommitInfo *commitInfo = uploadData.fileUrlsToCommitInfo[fileUrl];
-      dropboxFilePathToNSURL[commitInfo.path] = fileUrl;
+- (void)startConcurrentUploadLargeFile:(DBBatchUploadData *)uploadData
+                               fileUrl:(NSURL *)fileUrl
+                              fileSize:(NSUInteger)fileSize {
+  // concurrent sessions don't accept data on `/upload_session/start`, so the session
+  // is opened empty and every chunk is sent via `/upload_session/append_v2`
+  DBFILESUploadSessionType *sessionType = [[DBFILESUploadSessionType alloc] initWithConcurrent];
+
+  __block DBUploadTask *task =
+      [[self uploadSessionStartData:@(NO) sessionType:sessionType contentHash:nil inputData:[NSData data]]
+          setResponseBlock:^(DBFILESUploadSessionStartResult *result, DBFILESUploadSessionStartError *routeError,
+                             DBRequestError *error) {
+            if (result && !routeError) {
+              [uploadData.journal recordSessionId:result.sessionId concurrent:YES fileUrl:fileUrl];
+
+              DBBatchUploadFileData *fileData = [[DBBatchUploadFileData alloc] initWithFileUrl:fileUrl
+                                                                                       fileSize:fileSize
+                                                                                      sessionId:result.sessionId
+                                                                                committedRanges:nil];
+              [self sendConcurrentChunks:uploadData fileData:fileData];
+            } else {
+              uploadData.fileUrlsToRequestErrors[fileUrl] = error;
+              [self finishFileUpload:uploadData];
+            }
+
+            [uploadData.taskStorage removeUploadTask:task];
+          }
+                     queue:uploadData.schedulingQueue];
+
+  [uploadData.taskStorage addUploadTask:task];
+}
+
+- (void)resumeConcurrentUploadLargeFile:(DBBatchUploadData *)uploadData
+                            resumeEntry:(DBBatchUploadJournalEntry *)resumeEntry {
+  DBBatchUploadFileData *fileData = [[DBBatchUploadFileData alloc] initWithFileUrl:resumeEntry.fileUrl
+                                                                           fileSize:resumeEntry.fileSize
+                                                                          sessionId:resumeEntry.sessionId
+                                                                    committedRanges:resumeEntry.committedRanges];
+  [self sendConcurrentChunks:uploadData fileData:fileData];
+}
+
+// must be called on `uploadData.schedulingQueue`
+- (void)sendConcurrentChunks:(DBBatchUploadData *)uploadData fileData:(DBBatchUploadFileData *)fileData {
+  if (fileData.finished) {
+    return;
+  }
+
+  if (fileData.failed || uploadData.cancel) {
+    // wait for the remaining chunks to return before giving up on the file
+    if (fileData.chunksInFlight > 0) {
+      return;
     }
+    if (fileData.sessionExpired && !uploadData.cancel) {
+      // the session resumed from the journal has expired, so upload the file from scratch
+      fileData.finished = YES;
+      [self startConcurrentUploadLargeFile:uploadData fileUrl:fileData.fileUrl fileSize:fileData.fileSize];
+      return;
+    }
+    [self finishConcurrentUpload:uploadData fileData:fileData];
+    return;
+  }
 
-    NSMutableDictionary<NSURL *, DBFILESUploadSessionFinishBatchResultEntry *> *fileUrlsToBatchResultEntries =
-        [NSMutableDictionary new];
+  NSUInteger maxChunksPerFile = MAX(uploadData.config.maxConcurrentChunksPerFile, 1);
+  while (!fileData.closeSent && fileData.chunksInFlight < maxChunksPerFile) {
+    NSUInteger chunkSize = [self concurrentChunkSize:uploadData];
+    NSRange unsentRange = [self firstRangeInIndexSet:fileData.unsentRanges];
 
-    int index = 0;
-    for (DBFILESUploadSessionFinishArg *finishArg in uploadData.finishArgs) {
-      NSString *path = finishArg.commit.path;
-      DBFILESUploadSessionFinishBatchResultEntry *resultEntry = resultEntries[index];
-      fileUrlsToBatchResultEntries[dropboxFilePathToNSURL[path]] = resultEntry;
-      index++;
+    // the final chunk closes the session, so it is only sent once all other chunks are appended. It is empty when
+    // resuming a session that already holds all data
+    BOOL isFinalChunk = unsentRange.location == NSNotFound ||
+                        (NSMaxRange(unsentRange) == fileData.fileSize && unsentRange.length <= chunkSize);
+    if (isFinalChunk && fileData.chunksInFlight > 0) {
+      return;
+    }
+    if (![self reserveChunkSlot:uploadData fileData:fileData]) {
+      return;
     }
 
-    uploadData.responseBlock(fileUrlsToBatchResultEntries, nil, nil, uploadData.fileUrlsToRequestErrors);
+    NSUInteger startBytes = unsentRange.location == NSNotFound ? fileData.fileSize : unsentRange.location;
+    NSUInteger endBytes = isFinalChunk ? fileData.fileSize : MIN(startBytes + chunkSize, NSMaxRange(unsentRange));
+    [fileData.unsentRanges removeIndexesInRange:NSMakeRange(startBytes, endBytes - startBytes)];
+    fileData.closeSent = isFinalChunk;
+
+    [self appendConcurrentChunk:uploadData fileData:fileData startBytes:startBytes endBytes:endBytes retryCount:0];
+  }
+}
+
+- (NSUInteger)concurrentChunkSize:(DBBatchUploadData *)uploadData {
+  NSUInteger chunkSize = [uploadData.config.chunkSizePolicy chunkSize];
+  return MAX(chunkSize / concurrentChunkAlignment, 1) * concurrentChunkAlignment;
+}
+
+// must be called on `uploadData.schedulingQueue`
+- (BOOL)reserveChunkSlot:(DBBatchUploadData *)uploadData fileData:(DBBatchUploadFileData *)fileData {
+  if (uploadData.chunksInFlight >= MAX(uploadData.config.maxConcurrentChunks, 1)) {
+    if (!fileData.awaitingChunkSlot) {
+      fileData.awaitingChunkSlot = YES;
+      [uploadData.filesAwaitingChunkSlots addObject:fileData];
+    }
+    return NO;
+  }
+
+  uploadData.chunksInFlight++;
+  fileData.chunksInFlight++;
+  return YES;
+}
+
+// must be called on `uploadData.schedulingQueue`
+- (void)resumeFilesAwaitingChunkSlots:(DBBatchUploadData *)uploadData {
+  NSUInteger maxChunks = MAX(uploadData.config.maxConcurrentChunks, 1);
+  while ([uploadData.filesAwaitingChunkSlots count] > 0 && uploadData.chunksInFlight < maxChunks) {
+    DBBatchUploadFileData *fileData = uploadData.filesAwaitingChunkSlots[0];
+    [uploadData.filesAwaitingChunkSlots removeObjectAtIndex:0];
+    fileData.awaitingChunkSlot = NO;
+    [self sendConcurrentChunks:uploadData fileData:fileData];
+  }
+}
+
+- (void)appendConcurrentChunk:(DBBatchUploadData *)uploadData
+                     fileData:(DBBatchUploadFileData *)fileData
+                   startBytes:(NSUInteger)startBytes
+                     endBytes:(NSUInteger)endBytes
+                   retryCount:(int)retryCount {
+  BOOL shouldClose = endBytes == fileData.fileSize;
+  NSInputStream *fileChunkInputStream = [self chunkInputStreamWithFileUrl:fileData.fileUrl
+                                                               startBytes:startBytes
+                                                                 endBytes:endBytes];
+  DBFILESUploadSessionCursor *cursor =
+      [[DBFILESUploadSessionCursor alloc] initWithSessionId:fileData.sessionId offset:@(startBytes)];
+  id<DBChunkSizePolicy> chunkSizePolicy = uploadData.config.chunkSizePolicy;
+  NSDate *chunkStartDate = [NSDate date];
+
+  __block DBUploadTask *task =
+      [[[self uploadSessionAppendV2Stream:cursor close:@(shouldClose) contentHash:nil inputStream:fileChunkInputStream]
+          setResponseBlock:^(DBNilObject *result, DBFILESUploadSessionAppendError *routeError, DBRequestError *error) {
+            [uploadData.taskStorage removeUploadTask:task];
+
+            if (result) {
+              [chunkSizePolicy recordChunkUploadOfSize:endBytes - startBytes
+                                              duration:-[chunkStartDate timeIntervalSinceNow]];
+            } else {
+              [chunkSizePolicy recordChunkUploadFailureOfSize:endBytes - startBytes];
+            }
+
+            if (!result && !routeError && [error isRateLimitError] && retryCount <= 3 && !uploadData.cancel) {
+              DBRequestRateLimitError *rateLimitError = [error asRateLimitError];
+              double backoffInSeconds = [rateLimitError.backoff doubleValue];
+              dispatch_time_t delayTime = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(backoffInSeconds * NSEC_PER_SEC));
+
+              // retry the same range after backoff time, keeping its in-flight slot
+              [self afterDelay:delayTime
+                         queue:uploadData.schedulingQueue
+                       perform:^{
+                         [self appendConcurrentChunk:uploadData
+                                            fileData:fileData
+                                          startBytes:startBytes
+                                            endBytes:endBytes
+                                          retryCount:retryCount + 1];
+                       }];
+              return;
+            }
+
+            uploadData.chunksInFlight--;
+            fileData.chunksInFlight--;
+
+            if (result) {
+              if (endBytes > startBytes) {
+                [uploadData.journal recordCommittedRangeWithStartBytes:startBytes
+                                                              endBytes:endBytes
+                                                               fileUrl:fileData.fileUrl];
+              }
+              if (shouldClose) {
+                [uploadData.journal recordSessionClosedForFileUrl:fileData.fileUrl];
+
+                // store commit info for this file
+                [self storeFinishArg:uploadData
+                             fileUrl:fileData.fileUrl
+                           sessionId:fileData.sessionId
+                            fileSize:fileData.fileSize];
+                [self finishConcurrentUpload:uploadData fileData:fileData];
+              }
+            } else if ([routeError isNotFound] && [self isJournaledSession:uploadData
+                                                                  sessionId:fileData.sessionId
+                                                                    fileUrl:fileData.fileUrl]) {
+              fileData.failed = YES;
+              fileData.sessionExpired = YES;
+            } else if (!fileData.failed) {
+              fileData.failed = YES;
+              uploadData.fileUrlsToRequestErrors[fileData.fileUrl] = error;
+            }
+
+            // let files waiting on the batch limit go first, so no file can starve the others
+            [self resumeFilesAwaitingChunkSlots:uploadData];
+            [self sendConcurrentChunks:uploadData fileData:fileData];
+          }
+                     queue:uploadData.schedulingQueue]
+          setProgressBlock:^(int64_t bytesWritten, int64_t totalBytesWritten, int64_t totalBytesExpectedToWrite) {
+#pragma unused(totalBytesWritten)
+#pragma unused(totalBytesExpectedToWrite)
+            if (retryCount == 0) {
+              [self executeProgressHandler:uploadData amountUploaded:bytesWritten];
+            }
+          }
+                     queue:uploadData.schedulingQueue];
+
+  [uploadData.taskStorage addUploadTask:task];
+}
+
+- (void)finishConcurrentUpload:(DBBatchUploadData *)uploadData fileData:(DBBatchUploadFileData *)fileData {
+  fileData.finished = YES;
+  [self finishFileUpload:uploadData];
+}
+
+- (void)afterDelay:(dispatch_time_t)delayTime queue:(NSOperationQueue *)queue perform:(void (^)(void))block {
+  dispatch_after(delayTime, dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^(void) {
+    [queue addOperationWithBlock:block];
+  });
+}
+
+// must be called on `uploadData.schedulingQueue`
+- (void)storeFinishArg:(DBBatchUploadData *)uploadData
+               fileUrl:(NSURL *)fileUrl
+             sessionId:(NSString *)sessionId
+              fileSize:(NSUInteger)fileSize {
+  DBFILESUploadSessionCursor *cursor = [[DBFILESUploadSessionCursor alloc] initWithSessionId:sessionId
+                                                                                       offset:@(fileSize)];
+  DBFILESCommitInfo *commitInfo = uploadData.fileUrlsToCommitInfo[fileUrl];
+  DBFILESUploadSessionFinishArg *finishArg =
+      [[DBFILESUploadSessionFinishArg alloc] initWithCursor:cursor commit:commitInfo];
+
+  [uploadData.finishArgs addObject:finishArg];
+  [uploadData.finishArgFileUrls addObject:fileUrl];
+
+  // commit full shards right away instead of holding every session open until the whole batch is uploaded
+  if ([uploadData.finishArgs count] >= [self maxFinishBatchEntries:uploadData]) {
+    [self commitFinishArgs:uploadData];
+  }
+}
+
+- (BOOL)isJournaledSession:(DBBatchUploadData *)uploadData sessionId:(NSString *)sessionId fileUrl:(NSURL *)fileUrl {
+  return [uploadData.journal.entries[fileUrl].sessionId isEqualToString:sessionId];
+}
+
+- (NSInputStream *)chunkInputStreamWithFileUrl:(NSURL *)fileUrl
+                                    startBytes:(NSUInteger)startBytes
+                                      endBytes:(NSUInteger)endBytes {
+  if (endBytes == startBytes) {
+    // only closes a session that already holds all data
+    return [NSInputStream inputStreamWithData:[NSData data]];
+  }
+  return [[DBChunkInputStream alloc] initWithFileUrl:fileUrl startBytes:startBytes endBytes:endBytes];
+}
+
+- (NSRange)firstRangeInIndexSet:(NSIndexSet *)indexSet {
+  __block NSRange firstRange = NSMakeRange(NSNotFound, 0);
+  [indexSet enumerateRangesUsingBlock:^(NSRange range, BOOL *stop) {
+    firstRange = range;
+    *stop = YES;
   }];
+  return firstRange;
 }
 
-- (NSUInteger)endBytesWithFileSize:(NSUInteger)fileSize startBytes:(NSUInteger)startBytes {
-  if (startBytes + fileChunkSize < fileSize) {
-    return startBytes + fileChunkSize;
+- (NSUInteger)endBytesWithFileSize:(NSUInteger)fileSize
+                        startBytes:(NSUInteger)startBytes
+                         chunkSize:(NSUInteger)chunkSize {
+  if (startBytes + chunkSize < fileSize) {
+    return startBytes + chunkSize;
   }
 
   return fileSize;
 }
 
 - (void)batchFinishUponCompletion:(DBBatchUploadData *)uploadData {
-  // wait for all upload calls to complete and then batch "finish" all uploaded files
-  // with one call to `upload_session/finish_batch`
+  // wait for all upload calls to complete, commit the last partial shard and then
+  // wait for all `upload_session/finish_batch` calls to complete
   dispatch_group_notify(uploadData.uploadGroup, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH, 0), ^{
     if (uploadData.cancel) {
       uploadData.responseBlock(nil, nil, nil, uploadData.fileUrlsToRequestErrors);
       return;
     }
 
-    NSMutableArray<DBFILESUploadSessionFinishArg *> *sortedFinishArgs =
-        [[uploadData.finishArgs sortedArrayUsingComparator:^NSComparisonResult(id a, id b) {
-          DBFILESUploadSessionFinishArg *first = (DBFILESUploadSessionFinishArg *)a;
-          DBFILESUploadSessionFinishArg *second = (DBFILESUploadSessionFinishArg *)b;
-          return [first.commit.path compare:second.commit.path];
-        }] mutableCopy];
-
-    uploadData.finishArgs = sortedFinishArgs;
-
-    [[self uploadSessionFinishBatchV2:sortedFinishArgs]
-        setResponseBlock:^(DBFILESUploadSessionFinishBatchResult *_Nullable result, DBNilObject *_Nullable routeError,
-                           DBRequestError *_Nullable networkError) {
-          if (!result || routeError) {
-            [uploadData.queue addOperationWithBlock:^{
-              uploadData.responseBlock(nil, nil, networkError, uploadData.fileUrlsToRequestErrors);
-            }];
-          } else {
-            [self finishBatch:uploadData resultEntries:result.entries];
+    [uploadData.schedulingQueue addOperationWithBlock:^{
+      if ([uploadData.finishArgs count] > 0) {
+        [self commitFinishArgs:uploadData];
+      }
+
+      dispatch_group_notify(uploadData.finishBatchGroup, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_HIGH, 0), ^{
+        [uploadData.schedulingQueue addOperationWithBlock:^{
+          [self finishBatch:uploadData];
+        }];
+      });
+    }];
+  });
+}
+
+// must be called on `uploadData.schedulingQueue`
+- (void)commitFinishArgs:(DBBatchUploadData *)uploadData {
+  NSArray<DBFILESUploadSessionFinishArg *> *finishArgs = uploadData.finishArgs;
+  NSArray<NSURL *> *fileUrls = uploadData.finishArgFileUrls;
+  uploadData.finishArgs = [NSMutableArray new];
+  uploadData.finishArgFileUrls = [NSMutableArray new];
+
+  // commit in path order, so that files of the same folder are committed together
+  NSMutableArray<NSNumber *> *indices = [NSMutableArray arrayWithCapacity:[finishArgs count]];
+  for (NSUInteger i = 0; i < [finishArgs count]; i++) {
+    [indices addObject:@(i)];
+  }
+  [indices sortUsingComparator:^NSComparisonResult(NSNumber *a, NSNumber *b) {
+    return [finishArgs[[a unsignedIntegerValue]].commit.path compare:finishArgs[[b unsignedIntegerValue]].commit.path];
+  }];
+
+  NSMutableArray<DBFILESUploadSessionFinishArg *> *sortedFinishArgs = [NSMutableArray new];
+  NSMutableArray<NSURL *> *sortedFileUrls = [NSMutableArray new];
+  for (NSNumber *index in indices) {
+    [sortedFinishArgs addObject:finishArgs[[index unsignedIntegerValue]]];
+    [sortedFileUrls addObject:fileUrls[[index unsignedIntegerValue]]];
+  }
+
+  dispatch_group_enter(uploadData.finishBatchGroup);
+  [[self uploadSessionFinishBatchV2:sortedFinishArgs]
+      setResponseBlock:^(DBFILESUploadSessionFinishBatchResult *_Nullable result, DBNilObject *_Nullable routeError,
+                         DBRequestError *_Nullable networkError) {
+        if (!result || routeError) {
+          // the whole shard failed, so report it against each of its files. The route has no error type of its own,
+          // so a route error can only mean a response the SDK doesn't understand
+          DBRequestError *requestError =
+              networkError ?: [self requestErrorWithURLErrorCode:NSURLErrorBadServerResponse];
+          uploadData.finishBatchRequestError = requestError;
+          for (NSURL *fileUrl in sortedFileUrls) {
+            uploadData.fileUrlsToRequestErrors[fileUrl] = requestError;
           }
+        } else {
+          [result.entries enumerateObjectsUsingBlock:^(DBFILESUploadSessionFinishBatchResultEntry *resultEntry,
+                                                       NSUInteger index, BOOL *stop) {
+            if (index >= [sortedFileUrls count]) {
+              *stop = YES;
+              return;
+            }
+            uploadData.fileUrlsToBatchResultEntries[sortedFileUrls[index]] = resultEntry;
+            // failed entries stay closed in the journal, so that resuming the batch commits them again
+            if ([resultEntry isSuccess]) {
+              [uploadData.journal recordSessionFinishedForFileUrl:sortedFileUrls[index]];
+            }
+          }];
         }
-                   queue:uploadData.pollingQueue];
-  });
+        dispatch_group_leave(uploadData.finishBatchGroup);
+      }
+                 queue:uploadData.schedulingQueue];
 }
 
-- (void)executeProgressHandler:(DBBatchUploadData *)uploadData amountUploaded:(int64_t)amountUploaded {
-  if (!uploadData.progressBlock) {
-    return;
+// must be called on `uploadData.schedulingQueue`
+- (void)finishBatch:(DBBatchUploadData *)uploadData {
+  NSDictionary<NSURL *, DBFILESUploadSessionFinishBatchResultEntry *> *fileUrlsToBatchResultEntries =
+      [uploadData.fileUrlsToBatchResultEntries copy];
+  NSDictionary<NSURL *, DBRequestError *> *fileUrlsToRequestErrors = [uploadData.fileUrlsToRequestErrors copy];
+  DBRequestError *finishBatchRequestError = uploadData.finishBatchRequestError;
+
+  BOOL committed = !finishBatchRequestError && [fileUrlsToRequestErrors count] == 0;
+  for (DBFILESUploadSessionFinishBatchResultEntry *resultEntry in [fileUrlsToBatchResultEntries allValues]) {
+    committed = committed && [resultEntry isSuccess];
+  }
+  if (committed) {
+    // every file is committed, so there is nothing left to resume
+    [uploadData.journal remove];
   }
 
   [uploadData.queue addOperationWithBlock:^{
-    uploadData.totalUploadedSoFar += (NSUInteger)amountUploaded;
-    uploadData.progressBlock(amountUploaded, uploadData.totalUploadedSoFar, uploadData.totalUploadSize);
+    if (finishBatchRequestError && [fileUrlsToBatchResultEntries count] == 0) {
+      uploadData.responseBlock(nil, nil, finishBatchRequestError, fileUrlsToRequestErrors);
+    } else {
+      uploadData.responseBlock(fileUrlsToBatchResultEntries, nil, finishBatchRequestError, fileUrlsToRequestErrors);
+    }
   }];
 }
 
+- (NSUInteger)maxFinishBatchEntries:(DBBatchUploadData *)uploadData {
+  return MIN(MAX(uploadData.config.maxFinishBatchEntries, 1), maxFinishBatchEntriesLimit);
+}
+
+- (void)executeProgressHandler:(DBBatchUploadData *)uploadData amountUploaded:(int64_t)amountUploaded {
+  // chunk progress is handled on the scheduling queue, which keeps the running total of the batch consistent, and the
+  // coalescer bounds the rate at which the total reaches the progress block
+  uploadData.totalUploadedSoFar += (NSUInteger)amountUploaded;
+  [uploadData.progressCoalescer reportProgress:amountUploaded
+                                totalCommitted:(int64_t)uploadData.totalUploadedSoFar
+                              expectedToCommit:(int64_t)uploadData.totalUploadSize];
+}
+
 - (NSFileHandle *)fileHandle:(DBBatchUploadData *)uploadData fileUrl:(NSURL *)fileUrl {
   NSError *fileHandleError;
   NSFileHandle *fileHandle = [NSFileHandle fileHandleForReadingFromURL:fileUrl error:&fileHandleError];
@@ -409,4 +970,219 @@ static const NSUInteger fileChunkSize = 10 * 1024 * 1024;
   return fileHandle;
 }
 
+// must be called on `downloadData.schedulingQueue`
+- (void)startSegmentedDownload:(DBSegmentedDownloadData *)downloadData metadata:(DBFILESFileMetadata *)metadata {
+  if (downloadData.cancel) {
+    [self failSegmentedDownload:downloadData
+                     routeError:nil
+                   networkError:[self requestErrorWithURLErrorCode:NSURLErrorCancelled]];
+    return;
+  }
+
+  downloadData.metadata = metadata;
+  NSUInteger fileSize = [metadata.size unsignedIntegerValue];
+  downloadData.totalDownloadSize = fileSize;
+
+  // preallocate the destination, so that every segment is written in place and never needs to be reassembled. The
+  // progress of earlier downloads is not persisted, so a partial file left behind by one is of no use and replaced
+  const char *destinationPath = [downloadData.destination fileSystemRepresentation];
+  int fileDescriptor = open(destinationPath, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fileDescriptor < 0 || ftruncate(fileDescriptor, (off_t)fileSize) != 0) {
+    NSError *fileError = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+    if (fileDescriptor >= 0) {
+      close(fileDescriptor);
+      unlink(destinationPath);
+    }
+    [self failSegmentedDownload:downloadData
+                     routeError:nil
+                   networkError:[[DBRequestError alloc] initAsClientError:fileError]];
+    return;
+  }
+  downloadData.fileDescriptor = fileDescriptor;
+
+  NSUInteger segmentSize = MAX(downloadData.config.segmentSize, 1);
+  for (NSUInteger offset = 0; offset < fileSize; offset += segmentSize) {
+    [downloadData.pendingSegments addObject:[[DBSegmentedDownloadSegment alloc] initWithOffset:offset
+                                                                                        length:MIN(segmentSize,
+                                                                                                   fileSize - offset)]];
+  }
+
+  if (fileSize == 0) {
+    // nothing to request, the empty destination is the whole file
+    downloadData.segmentsInFlight += 1;
+    [self finishSegment:downloadData];
+    return;
+  }
+
+  [self startPendingSegments:downloadData];
+}
+
+// must be called on `downloadData.schedulingQueue`
+- (void)startPendingSegments:(DBSegmentedDownloadData *)downloadData {
+  NSUInteger maxConcurrentSegments = MAX(downloadData.config.maxConcurrentSegments, 1);
+  while (downloadData.segmentsInFlight < maxConcurrentSegments && downloadData.pendingSegments.count > 0) {
+    DBSegmentedDownloadSegment *segment = downloadData.pendingSegments.firstObject;
+    [downloadData.pendingSegments removeObjectAtIndex:0];
+    downloadData.segmentsInFlight += 1;
+    [self downloadSegment:segment downloadData:downloadData];
+  }
+}
+
+// must be called on `downloadData.schedulingQueue`, with a slot of `segmentsInFlight` reserved for the segment
+- (void)downloadSegment:(DBSegmentedDownloadSegment *)segment downloadData:(DBSegmentedDownloadData *)downloadData {
+  if (downloadData.cancel) {
+    [self failSegmentedDownload:downloadData
+                     routeError:nil
+                   networkError:[self requestErrorWithURLErrorCode:NSURLErrorCancelled]];
+    [self finishSegment:downloadData];
+    return;
+  }
+
+  // a retried segment resumes from its first missing byte, and `Range` ends are inclusive
+  NSUInteger startBytes = segment.offset + segment.received;
+  NSUInteger endBytes = segment.offset + segment.length - 1;
+  // pin every segment to the looked up revision, so that a concurrent edit can't mix two versions of the file
+  NSString *revisionPath = [NSString stringWithFormat:@"rev:%@", downloadData.metadata.rev];
+  int fileDescriptor = downloadData.fileDescriptor;
+
+  DBDownloadStreamConsumerBlock consumerBlock = ^BOOL(NSData *data) {
+    if (downloadData.cancel) {
+      return NO;
+    }
+    // never write past the segment, even if the server sends more than the requested range
+    NSUInteger length = MIN(data.length, segment.length - segment.received);
+    if (!DBWriteBytesAtOffset(fileDescriptor, data.bytes, length, (off_t)(segment.offset + segment.received))) {
+      if (downloadData.writeErrno == 0) {
+        downloadData.writeErrno = errno;
+      }
+      return NO;
+    }
+    segment.received += length;
+    [self executeSegmentedDownloadProgressHandler:downloadData amountDownloaded:(int64_t)length];
+    return YES;
+  };
+
+  DBDownloadDataTask *task = [self downloadStream:revisionPath
+                                  byteOffsetStart:@(startBytes)
+                                    byteOffsetEnd:@(endBytes)
+                                    consumerBlock:consumerBlock
+                                    consumerQueue:nil];
+
+  [task setResponseBlock:^(DBFILESFileMetadata *result, DBFILESDownloadError *routeError, DBRequestError *error,
+                           NSData *fileData) {
+#pragma unused(result)
+#pragma unused(fileData)
+    [downloadData.taskStorage removeDownloadDataTask:task];
+
+    if (!error && segment.received == segment.length) {
+      [self finishSegment:downloadData];
+      return;
+    }
+
+    // the write error that cancelled the segment would only recur on every retry
+    int writeErrno = downloadData.writeErrno;
+    if (writeErrno != 0) {
+      NSError *writeError = [NSError errorWithDomain:NSPOSIXErrorDomain code:writeErrno userInfo:nil];
+      [self failSegmentedDownload:downloadData
+                       routeError:nil
+                     networkError:[[DBRequestError alloc] initAsClientError:writeError]];
+      [self finishSegment:downloadData];
+      return;
+    }
+
+    // the same goes for a server that answered with the whole file instead of the requested range
+    BOOL rangeIgnored = [error.nsError.domain isEqualToString:NSURLErrorDomain] &&
+                        error.nsError.code == NSURLErrorBadServerResponse;
+    if (!routeError && !rangeIgnored && !downloadData.cancel &&
+        segment.retryCount < downloadData.config.maxSegmentRetries) {
+      segment.retryCount += 1;
+      double backoffInSeconds =
+          [error isRateLimitError] ? [[error asRateLimitError].backoff doubleValue] : (double)segment.retryCount;
+      dispatch_time_t delayTime = dispatch_time(DISPATCH_TIME_NOW, (int64_t)(backoffInSeconds * NSEC_PER_SEC));
+
+      // retry the rest of the segment after backoff time, keeping its in-flight slot
+      [self afterDelay:delayTime
+                 queue:downloadData.schedulingQueue
+               perform:^{
+                 [self downloadSegment:segment downloadData:downloadData];
+               }];
+      return;
+    }
+
+    // without an error, the response ended before the segment did
+    [self failSegmentedDownload:downloadData
+                     routeError:routeError
+                   networkError:error ?: [self requestErrorWithURLErrorCode:NSURLErrorNetworkConnectionLost]];
+    [self finishSegment:downloadData];
+  }
+                   queue:downloadData.schedulingQueue];
+
+  [downloadData.taskStorage addDownloadDataTask:task];
+}
+
+// must be called on `downloadData.schedulingQueue`, releasing the slot of a segment that is done with
+- (void)finishSegment:(DBSegmentedDownloadData *)downloadData {
+  downloadData.segmentsInFlight -= 1;
+
+  if (downloadData.finished) {
+    [self closeSegmentedDownloadFile:downloadData removeFile:YES];
+  } else if (downloadData.segmentsInFlight == 0 && downloadData.pendingSegments.count == 0) {
+    downloadData.finished = YES;
+    [self closeSegmentedDownloadFile:downloadData removeFile:NO];
+    [downloadData.queue addOperationWithBlock:^{
+      downloadData.responseBlock(downloadData.metadata, nil, nil, downloadData.destination);
+    }];
+  } else {
+    [self startPendingSegments:downloadData];
+  }
+}
+
+// must be called on `downloadData.schedulingQueue`
+- (void)failSegmentedDownload:(DBSegmentedDownloadData *)downloadData
+                   routeError:(DBFILESDownloadError *)routeError
+                 networkError:(DBRequestError *)networkError {
+  if (downloadData.finished) {
+    return;
+  }
+  downloadData.finished = YES;
+
+  // stop the other segments; the destination is closed and removed once all of them have returned
+  downloadData.cancel = YES;
+  [downloadData.taskStorage cancelAllTasks];
+  [self closeSegmentedDownloadFile:downloadData removeFile:YES];
+
+  [downloadData.queue addOperationWithBlock:^{
+    downloadData.responseBlock(nil, routeError, networkError, nil);
+  }];
+}
+
+// must be called on `downloadData.schedulingQueue`
+- (void)closeSegmentedDownloadFile:(DBSegmentedDownloadData *)downloadData removeFile:(BOOL)removeFile {
+  // a segment still in flight may be writing to the file
+  if (downloadData.segmentsInFlight > 0 || downloadData.fileDescriptor < 0) {
+    return;
+  }
+
+  close(downloadData.fileDescriptor);
+  downloadData.fileDescriptor = -1;
+  if (removeFile) {
+    [[NSFileManager defaultManager] removeItemAtURL:downloadData.destination error:nil];
+  }
+}
+
+- (void)executeSegmentedDownloadProgressHandler:(DBSegmentedDownloadData *)downloadData
+                               amountDownloaded:(int64_t)amountDownloaded {
+  // segments are written from their own consumer queues, so the running total is guarded by the download data
+  @synchronized(downloadData) {
+    downloadData.totalDownloadedSoFar += (NSUInteger)amountDownloaded;
+    [downloadData.progressCoalescer reportProgress:amountDownloaded
+                                    totalCommitted:(int64_t)downloadData.totalDownloadedSoFar
+                                  expectedToCommit:(int64_t)downloadData.totalDownloadSize];
+  }
+}
+
+- (DBRequestError *)requestErrorWithURLErrorCode:(NSInteger)code {
+  return [[DBRequestError alloc] initAsClientError:[NSError errorWithDomain:NSURLErrorDomain code:code userInfo:nil]];
+}
+
 @end
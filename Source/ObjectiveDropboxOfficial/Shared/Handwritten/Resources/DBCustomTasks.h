@@ -5,6 +5,7 @@
 #import <Foundation/Foundation.h>
 
 @class DBBatchUploadData;
+@class DBSegmentedDownloadData;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -43,4 +44,28 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+///
+/// Dropbox task object for custom segmented download route.
+///
+/// Like the batch upload route, the segmented download route is a convenience layer over our auto-generated API
+/// endpoints. Progress and response handlers are passed directly into the route and only `cancel` is available.
+///
+@interface DBSegmentedDownloadTask : NSObject
+
+///
+/// DBSegmentedDownloadTask full constructor.
+///
+/// @param downloadData relevant to the particular segmented download request.
+///
+/// @returns A DBSegmentedDownloadTask instance.
+///
+- (instancetype)initWithDownloadData:(DBSegmentedDownloadData *)downloadData;
+
+///
+/// Cancels the current request.
+///
+- (void)cancel;
+
+@end
+
 NS_ASSUME_NONNULL_END
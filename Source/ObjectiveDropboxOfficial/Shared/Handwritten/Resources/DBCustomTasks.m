@@ -28,3 +28,22 @@
 }
 
 @end
+
+@implementation DBSegmentedDownloadTask {
+  DBSegmentedDownloadData *_downloadData;
+}
+
+- (instancetype)initWithDownloadData:(DBSegmentedDownloadData *)downloadData {
+  self = [super init];
+  if (self) {
+    _downloadData = downloadData;
+  }
+  return self;
+}
+
+- (void)cancel {
+  _downloadData.cancel = YES;
+  [_downloadData.taskStorage cancelAllTasks];
+}
+
+@end
@@ -0,0 +1,671 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <xlocale.h>
+
+#import "DBJSONReader.h"
+
+// same nesting limit as `NSJSONSerialization`
+#define kDBJSONReaderMaxDepth 512
+
+// per-container flags kept on the nesting stack
+static const uint8_t kDBJSONContainerObject = 1 << 0;
+static const uint8_t kDBJSONContainerFirst = 1 << 1;
+
+// strings and numbers up to this many bytes are decoded without a heap buffer
+#define kDBJSONStackBufferLength 256
+
+static locale_t s_cLocale;
+
+static inline BOOL DBJSONIsWhitespace(uint8_t c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+static inline BOOL DBJSONIsDigit(uint8_t c) {
+  return c >= '0' && c <= '9';
+}
+
+static inline int DBJSONHexValue(uint8_t c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+static inline size_t DBJSONEncodeUTF8(uint32_t codePoint, uint8_t *out) {
+  if (codePoint < 0x80) {
+    out[0] = (uint8_t)codePoint;
+    return 1;
+  }
+  if (codePoint < 0x800) {
+    out[0] = (uint8_t)(0xC0 | (codePoint >> 6));
+    out[1] = (uint8_t)(0x80 | (codePoint & 0x3F));
+    return 2;
+  }
+  if (codePoint < 0x10000) {
+    out[0] = (uint8_t)(0xE0 | (codePoint >> 12));
+    out[1] = (uint8_t)(0x80 | ((codePoint >> 6) & 0x3F));
+    out[2] = (uint8_t)(0x80 | (codePoint & 0x3F));
+    return 3;
+  }
+  out[0] = (uint8_t)(0xF0 | (codePoint >> 18));
+  out[1] = (uint8_t)(0x80 | ((codePoint >> 12) & 0x3F));
+  out[2] = (uint8_t)(0x80 | ((codePoint >> 6) & 0x3F));
+  out[3] = (uint8_t)(0x80 | (codePoint & 0x3F));
+  return 4;
+}
+
+@implementation DBJSONReader {
+  NSData *_data;
+  const uint8_t *_bytes;
+  size_t _length;
+  size_t _pos;
+
+  uint8_t _containers[kDBJSONReaderMaxDepth];
+  NSUInteger _depth;
+
+  // the last key, either as a range of the input or, when it contains escapes, decoded
+  BOOL _hasKey;
+  size_t _keyStart;
+  size_t _keyLength;
+  NSString *_escapedKey;
+}
+
++ (void)initialize {
+  if (self == [DBJSONReader class]) {
+    // `strtod` honours the process locale, JSON always uses a '.' decimal separator
+    s_cLocale = newlocale(LC_NUMERIC_MASK, "C", NULL);
+  }
+}
+
+- (instancetype)initWithData:(NSData *)data {
+  self = [super init];
+  if (self) {
+    _data = data;
+    _bytes = data.bytes;
+    _length = data.length;
+    _pos = 0;
+    _depth = 0;
+    _hasKey = NO;
+
+    // tolerate a UTF-8 byte order mark, as `NSJSONSerialization` does
+    if (_length >= 3 && _bytes[0] == 0xEF && _bytes[1] == 0xBB && _bytes[2] == 0xBF) {
+      _pos = 3;
+    }
+  }
+  return self;
+}
+
+#pragma mark - Structure
+
+- (DBJSONToken)peek {
+  if (_error) {
+    return DBJSONTokenInvalid;
+  }
+  [self skipWhitespace];
+  if (_pos >= _length) {
+    return DBJSONTokenEnd;
+  }
+
+  switch (_bytes[_pos]) {
+  case '{':
+    return DBJSONTokenBeginObject;
+  case '}':
+    return DBJSONTokenEndObject;
+  case '[':
+    return DBJSONTokenBeginArray;
+  case ']':
+    return DBJSONTokenEndArray;
+  case '"':
+    return DBJSONTokenString;
+  case 't':
+    return DBJSONTokenTrue;
+  case 'f':
+    return DBJSONTokenFalse;
+  case 'n':
+    return DBJSONTokenNull;
+  default:
+    if (_bytes[_pos] == '-' || DBJSONIsDigit(_bytes[_pos])) {
+      return DBJSONTokenNumber;
+    }
+    return DBJSONTokenInvalid;
+  }
+}
+
+- (BOOL)beginObject {
+  return [self beginContainer:'{' flags:kDBJSONContainerObject];
+}
+
+- (BOOL)beginArray {
+  return [self beginContainer:'[' flags:0];
+}
+
+- (BOOL)nextKey {
+  if (![self advanceInContainerWithFlags:kDBJSONContainerObject closingCharacter:'}']) {
+    return NO;
+  }
+
+  size_t start = 0;
+  size_t length = 0;
+  BOOL escaped = NO;
+  if (_pos >= _length || _bytes[_pos] != '"') {
+    [self failWithMessage:@"Expected an object key"];
+    return NO;
+  }
+  if (![self scanStringStart:&start length:&length escaped:&escaped]) {
+    return NO;
+  }
+  _escapedKey = escaped ? [self stringWithStart:start length:length escaped:YES] : nil;
+  if (escaped && !_escapedKey) {
+    return NO;
+  }
+  _hasKey = YES;
+  _keyStart = start;
+  _keyLength = length;
+
+  [self skipWhitespace];
+  if (_pos >= _length || _bytes[_pos] != ':') {
+    [self failWithMessage:@"Expected ':' after object key"];
+    return NO;
+  }
+  _pos++;
+  return YES;
+}
+
+- (BOOL)keyEquals:(const char *)key {
+  if (!_hasKey) {
+    return NO;
+  }
+  if (_escapedKey) {
+    return strcmp(_escapedKey.UTF8String, key) == 0;
+  }
+  // keys never contain raw NUL bytes, so this stops at the end of the shorter one
+  return strncmp(key, (const char *)_bytes + _keyStart, _keyLength) == 0 && key[_keyLength] == '\0';
+}
+
+- (NSString *)key {
+  if (!_hasKey) {
+    return nil;
+  }
+  return _escapedKey ?: [self stringWithStart:_keyStart length:_keyLength escaped:NO];
+}
+
+- (BOOL)nextElement {
+  return [self advanceInContainerWithFlags:0 closingCharacter:']'];
+}
+
+- (BOOL)finish {
+  if (_error) {
+    return NO;
+  }
+  if (_depth > 0) {
+    [self failWithMessage:@"Unexpected end of input"];
+    return NO;
+  }
+  [self skipWhitespace];
+  if (_pos < _length) {
+    [self failWithMessage:@"Garbage at end"];
+    return NO;
+  }
+  return YES;
+}
+
+#pragma mark - Values
+
+- (NSString *)readString {
+  if ([self peek] != DBJSONTokenString) {
+    [self failWithMessage:@"Expected a string"];
+    return nil;
+  }
+  size_t start = 0;
+  size_t length = 0;
+  BOOL escaped = NO;
+  if (![self scanStringStart:&start length:&length escaped:&escaped]) {
+    return nil;
+  }
+  return [self stringWithStart:start length:length escaped:escaped];
+}
+
+- (NSNumber *)readNumber {
+  if ([self peek] != DBJSONTokenNumber) {
+    [self failWithMessage:@"Expected a number"];
+    return nil;
+  }
+  size_t start = _pos;
+  BOOL isInteger = YES;
+  if (![self scanNumberIsInteger:&isInteger]) {
+    return nil;
+  }
+  size_t length = _pos - start;
+  const uint8_t *digits = _bytes + start;
+
+  if (isInteger) {
+    BOOL negative = digits[0] == '-';
+    unsigned long long magnitude = 0;
+    BOOL overflow = NO;
+    for (size_t i = negative ? 1 : 0; i < length; i++) {
+      unsigned long long digit = digits[i] - '0';
+      if (magnitude > (ULLONG_MAX - digit) / 10) {
+        overflow = YES;
+        break;
+      }
+      magnitude = magnitude * 10 + digit;
+    }
+    if (!overflow) {
+      if (!negative) {
+        return magnitude <= (unsigned long long)LLONG_MAX ? @((long long)magnitude) : @(magnitude);
+      }
+      if (magnitude <= (unsigned long long)LLONG_MAX) {
+        return @(-(long long)magnitude);
+      }
+      if (magnitude == (unsigned long long)LLONG_MAX + 1) {
+        return @(LLONG_MIN);
+      }
+    }
+    // too large for a 64-bit integer, so fall back to a double like `NSJSONSerialization`
+  }
+
+  if (length < kDBJSONStackBufferLength) {
+    char buffer[kDBJSONStackBufferLength];
+    memcpy(buffer, digits, length);
+    buffer[length] = '\0';
+    return @(strtod_l(buffer, NULL, s_cLocale));
+  }
+  char *buffer = malloc(length + 1);
+  memcpy(buffer, digits, length);
+  buffer[length] = '\0';
+  double value = strtod_l(buffer, NULL, s_cLocale);
+  free(buffer);
+  return @(value);
+}
+
+- (NSNumber *)readBool {
+  DBJSONToken token = [self peek];
+  if (token == DBJSONTokenTrue && [self scanLiteral:"true" length:4]) {
+    return @YES;
+  }
+  if (token == DBJSONTokenFalse && [self scanLiteral:"false" length:5]) {
+    return @NO;
+  }
+  [self failWithMessage:@"Expected a boolean"];
+  return nil;
+}
+
+- (BOOL)readNull {
+  if ([self peek] != DBJSONTokenNull) {
+    return NO;
+  }
+  if (![self scanLiteral:"null" length:4]) {
+    [self failWithMessage:@"Invalid literal"];
+    return NO;
+  }
+  return YES;
+}
+
+- (id)readValue {
+  switch ([self peek]) {
+  case DBJSONTokenBeginObject: {
+    if (![self beginObject]) {
+      return nil;
+    }
+    NSMutableDictionary<NSString *, id> *dict = [NSMutableDictionary new];
+    while ([self nextKey]) {
+      NSString *key = self.key;
+      id value = key ? [self readValue] : nil;
+      if (!value) {
+        return nil;
+      }
+      dict[key] = value;
+    }
+    return _error ? nil : dict;
+  }
+  case DBJSONTokenBeginArray: {
+    if (![self beginArray]) {
+      return nil;
+    }
+    NSMutableArray *array = [NSMutableArray new];
+    while ([self nextElement]) {
+      id value = [self readValue];
+      if (!value) {
+        return nil;
+      }
+      [array addObject:value];
+    }
+    return _error ? nil : array;
+  }
+  case DBJSONTokenString:
+    return [self readString];
+  case DBJSONTokenNumber:
+    return [self readNumber];
+  case DBJSONTokenTrue:
+  case DBJSONTokenFalse:
+    return [self readBool];
+  case DBJSONTokenNull:
+    return [self readNull] ? [NSNull null] : nil;
+  case DBJSONTokenEnd:
+    [self failWithMessage:@"Unexpected end of input"];
+    return nil;
+  default:
+    [self failWithMessage:@"Invalid value"];
+    return nil;
+  }
+}
+
+- (void)skipValue {
+  size_t start = 0;
+  size_t length = 0;
+  BOOL escaped = NO;
+  BOOL isInteger = NO;
+
+  switch ([self peek]) {
+  case DBJSONTokenBeginObject:
+    if ([self beginObject]) {
+      while ([self nextKey]) {
+        [self skipValue];
+      }
+    }
+    return;
+  case DBJSONTokenBeginArray:
+    if ([self beginArray]) {
+      while ([self nextElement]) {
+        [self skipValue];
+      }
+    }
+    return;
+  case DBJSONTokenString:
+    [self scanStringStart:&start length:&length escaped:&escaped];
+    return;
+  case DBJSONTokenNumber:
+    [self scanNumberIsInteger:&isInteger];
+    return;
+  case DBJSONTokenTrue:
+  case DBJSONTokenFalse:
+    [self readBool];
+    return;
+  case DBJSONTokenNull:
+    if (![self readNull]) {
+      [self failWithMessage:@"Invalid literal"];
+    }
+    return;
+  case DBJSONTokenEnd:
+    [self failWithMessage:@"Unexpected end of input"];
+    return;
+  default:
+    [self failWithMessage:@"Invalid value"];
+    return;
+  }
+}
+
+#pragma mark - Scanning
+
+- (void)skipWhitespace {
+  while (_pos < _length && DBJSONIsWhitespace(_bytes[_pos])) {
+    _pos++;
+  }
+}
+
+- (BOOL)beginContainer:(uint8_t)openingCharacter flags:(uint8_t)flags {
+  if (_error) {
+    return NO;
+  }
+  [self skipWhitespace];
+  if (_pos >= _length || _bytes[_pos] != openingCharacter) {
+    [self failWithMessage:(flags & kDBJSONContainerObject) ? @"Expected an object" : @"Expected an array"];
+    return NO;
+  }
+  if (_depth >= kDBJSONReaderMaxDepth) {
+    [self failWithMessage:@"Too many nested arrays or dictionaries"];
+    return NO;
+  }
+  _containers[_depth++] = (uint8_t)(flags | kDBJSONContainerFirst);
+  _pos++;
+  return YES;
+}
+
+// Consumes the separator before the next member of the innermost container, or its closing character, and leaves
+// the reader before that member.
+- (BOOL)advanceInContainerWithFlags:(uint8_t)flags closingCharacter:(uint8_t)closingCharacter {
+  if (_error) {
+    return NO;
+  }
+  if (_depth == 0 || (_containers[_depth - 1] & kDBJSONContainerObject) != flags) {
+    [self failWithMessage:flags ? @"Not inside an object" : @"Not inside an array"];
+    return NO;
+  }
+  [self skipWhitespace];
+  if (_pos >= _length) {
+    [self failWithMessage:@"Unexpected end of input"];
+    return NO;
+  }
+
+  uint8_t *container = &_containers[_depth - 1];
+  if (_bytes[_pos] == closingCharacter) {
+    _pos++;
+    _depth--;
+    return NO;
+  }
+  if (!(*container & kDBJSONContainerFirst)) {
+    if (_bytes[_pos] != ',') {
+      [self failWithMessage:flags ? @"Expected ',' or '}'" : @"Expected ',' or ']'"];
+      return NO;
+    }
+    _pos++;
+    [self skipWhitespace];
+  }
+  *container = (uint8_t)(*container & ~kDBJSONContainerFirst);
+  return YES;
+}
+
+// Consumes a string token, returning the range of its contents in the input.
+- (BOOL)scanStringStart:(size_t *)start length:(size_t *)length escaped:(BOOL *)escaped {
+  _pos++;
+  *start = _pos;
+  *escaped = NO;
+  while (_pos < _length) {
+    uint8_t c = _bytes[_pos];
+    if (c == '"') {
+      *length = _pos - *start;
+      _pos++;
+      return YES;
+    }
+    if (c == '\\') {
+      if (_pos + 1 >= _length || !strchr("\"\\/bfnrtu", _bytes[_pos + 1])) {
+        [self failWithMessage:@"Invalid escape sequence"];
+        return NO;
+      }
+      *escaped = YES;
+      _pos += 2;
+    } else if (c < 0x20) {
+      [self failWithMessage:@"Unescaped control character"];
+      return NO;
+    } else {
+      _pos++;
+    }
+  }
+  [self failWithMessage:@"Unterminated string"];
+  return NO;
+}
+
+- (BOOL)scanNumberIsInteger:(BOOL *)isInteger {
+  *isInteger = YES;
+  if (_bytes[_pos] == '-') {
+    _pos++;
+  }
+  if (_pos >= _length || !DBJSONIsDigit(_bytes[_pos])) {
+    [self failWithMessage:@"Invalid number"];
+    return NO;
+  }
+  if (_bytes[_pos] == '0') {
+    _pos++;
+  } else {
+    while (_pos < _length && DBJSONIsDigit(_bytes[_pos])) {
+      _pos++;
+    }
+  }
+  if (_pos < _length && _bytes[_pos] == '.') {
+    *isInteger = NO;
+    _pos++;
+    if (_pos >= _length || !DBJSONIsDigit(_bytes[_pos])) {
+      [self failWithMessage:@"Invalid number"];
+      return NO;
+    }
+    while (_pos < _length && DBJSONIsDigit(_bytes[_pos])) {
+      _pos++;
+    }
+  }
+  if (_pos < _length && (_bytes[_pos] == 'e' || _bytes[_pos] == 'E')) {
+    *isInteger = NO;
+    _pos++;
+    if (_pos < _length && (_bytes[_pos] == '+' || _bytes[_pos] == '-')) {
+      _pos++;
+    }
+    if (_pos >= _length || !DBJSONIsDigit(_bytes[_pos])) {
+      [self failWithMessage:@"Invalid number"];
+      return NO;
+    }
+    while (_pos < _length && DBJSONIsDigit(_bytes[_pos])) {
+      _pos++;
+    }
+  }
+  return YES;
+}
+
+- (BOOL)scanLiteral:(const char *)literal length:(size_t)length {
+  if (_length - _pos < length || memcmp(_bytes + _pos, literal, length) != 0) {
+    return NO;
+  }
+  _pos += length;
+  return YES;
+}
+
+- (NSString *)stringWithStart:(size_t)start length:(size_t)length escaped:(BOOL)escaped {
+  if (!escaped) {
+    NSString *string = [[NSString alloc] initWithBytes:_bytes + start length:length encoding:NSUTF8StringEncoding];
+    if (!string) {
+      [self failWithMessage:@"Invalid UTF-8 in string"];
+    }
+    return string;
+  }
+
+  // unescaping never makes the UTF-8 longer
+  uint8_t stackBuffer[kDBJSONStackBufferLength];
+  uint8_t *buffer = length <= kDBJSONStackBufferLength ? stackBuffer : malloc(length);
+  size_t outLength = 0;
+  BOOL valid = YES;
+
+  const uint8_t *in = _bytes + start;
+  size_t i = 0;
+  while (valid && i < length) {
+    if (in[i] != '\\') {
+      buffer[outLength++] = in[i++];
+      continue;
+    }
+    i++;
+    switch (i < length ? in[i] : 0) {
+    case '"':
+    case '\\':
+    case '/':
+      buffer[outLength++] = in[i++];
+      break;
+    case 'b':
+      buffer[outLength++] = '\b';
+      i++;
+      break;
+    case 'f':
+      buffer[outLength++] = '\f';
+      i++;
+      break;
+    case 'n':
+      buffer[outLength++] = '\n';
+      i++;
+      break;
+    case 'r':
+      buffer[outLength++] = '\r';
+      i++;
+      break;
+    case 't':
+      buffer[outLength++] = '\t';
+      i++;
+      break;
+    case 'u': {
+      uint32_t codePoint = 0;
+      if (![self readHexEscapeFrom:in index:&i length:length codeUnit:&codePoint]) {
+        valid = NO;
+        break;
+      }
+      if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+        uint32_t low = 0;
+        if (i >= length || in[i] != '\\' || ![self readHexEscapeFrom:in index:&i length:length codeUnit:&low] ||
+            low < 0xDC00 || low > 0xDFFF) {
+          valid = NO;
+          break;
+        }
+        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+      } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+        valid = NO;
+        break;
+      }
+      outLength += DBJSONEncodeUTF8(codePoint, buffer + outLength);
+      break;
+    }
+    default:
+      valid = NO;
+      break;
+    }
+  }
+
+  NSString *string =
+      valid ? [[NSString alloc] initWithBytes:buffer length:outLength encoding:NSUTF8StringEncoding] : nil;
+  if (buffer != stackBuffer) {
+    free(buffer);
+  }
+  if (!string) {
+    [self failWithMessage:valid ? @"Invalid UTF-8 in string" : @"Invalid escape sequence"];
+  }
+  return string;
+}
+
+// Reads the four hex digits of a `\u` escape, with `*index` on the 'u' (or on the backslash of a low surrogate).
+// Leaves `*index` just past the escape.
+- (BOOL)readHexEscapeFrom:(const uint8_t *)in
+                    index:(size_t *)index
+                   length:(size_t)length
+                 codeUnit:(uint32_t *)codeUnit {
+  size_t i = *index;
+  if (in[i] == '\\') {
+    i++;
+  }
+  if (i >= length || in[i] != 'u' || length - i < 5) {
+    return NO;
+  }
+  uint32_t value = 0;
+  for (size_t j = 1; j <= 4; j++) {
+    int digit = DBJSONHexValue(in[i + j]);
+    if (digit < 0) {
+      return NO;
+    }
+    value = (value << 4) | (uint32_t)digit;
+  }
+  *codeUnit = value;
+  *index = i + 5;
+  return YES;
+}
+
+- (void)failWithMessage:(NSString *)message {
+  if (_error) {
+    return;
+  }
+  NSString *description = [NSString stringWithFormat:@"%@ around character %lu.", message, (unsigned long)_pos];
+  _error = [NSError errorWithDomain:NSCocoaErrorDomain
+                               code:NSPropertyListReadCorruptError
+                           userInfo:@{NSDebugDescriptionErrorKey : description}];
+}
+
+@end
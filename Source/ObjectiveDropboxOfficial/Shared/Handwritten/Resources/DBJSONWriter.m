@@ -0,0 +1,222 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import "DBJSONWriter.h"
+
+// output is staged in a fixed buffer and appended to the data in chunks of this size
+#define kDBJSONWriterBufferLength 1024
+
+// longest escape written for a single UTF-16 code unit: `\uxxxx`
+static const size_t kDBJSONWriterMaxEscapeLength = 6;
+
+static const char kDBJSONHexDigits[] = "0123456789abcdef";
+
+@implementation DBJSONWriter {
+  NSMutableData *_data;
+  uint8_t _buffer[kDBJSONWriterBufferLength];
+  size_t _length;
+}
+
++ (NSData *)asciiDataWithJSONObject:(id)jsonObject {
+  DBJSONWriter *writer = [[DBJSONWriter alloc] initPrivate];
+  if (![writer writeValue:jsonObject]) {
+    return nil;
+  }
+  [writer flush];
+  return writer->_data;
+}
+
+- (instancetype)initPrivate {
+  self = [super init];
+  if (self) {
+    _data = [NSMutableData new];
+    _length = 0;
+  }
+  return self;
+}
+
+#pragma mark - Values
+
+- (BOOL)writeValue:(id)value {
+  if ([value isKindOfClass:[NSString class]]) {
+    [self writeString:value];
+    return YES;
+  }
+  if ([value isKindOfClass:[NSNumber class]]) {
+    return [self writeNumber:value];
+  }
+  if ([value isKindOfClass:[NSDictionary class]]) {
+    return [self writeDictionary:value];
+  }
+  if ([value isKindOfClass:[NSArray class]]) {
+    return [self writeArray:value];
+  }
+  if (value == [NSNull null]) {
+    [self writeBytes:"null" length:4];
+    return YES;
+  }
+  return NO;
+}
+
+- (BOOL)writeDictionary:(NSDictionary *)dictionary {
+  __block BOOL valid = YES;
+  __block BOOL first = YES;
+  [self writeByte:'{'];
+  [dictionary enumerateKeysAndObjectsUsingBlock:^(id key, id obj, BOOL *stop) {
+    if (![key isKindOfClass:[NSString class]]) {
+      valid = NO;
+      *stop = YES;
+      return;
+    }
+    if (!first) {
+      [self writeByte:','];
+    }
+    first = NO;
+    [self writeString:key];
+    [self writeByte:':'];
+    if (![self writeValue:obj]) {
+      valid = NO;
+      *stop = YES;
+    }
+  }];
+  [self writeByte:'}'];
+  return valid;
+}
+
+- (BOOL)writeArray:(NSArray *)array {
+  [self writeByte:'['];
+  BOOL first = YES;
+  for (id element in array) {
+    if (!first) {
+      [self writeByte:','];
+    }
+    first = NO;
+    if (![self writeValue:element]) {
+      return NO;
+    }
+  }
+  [self writeByte:']'];
+  return YES;
+}
+
+- (BOOL)writeNumber:(NSNumber *)number {
+  if (CFGetTypeID((__bridge CFTypeRef)number) == CFBooleanGetTypeID()) {
+    if (number.boolValue) {
+      [self writeBytes:"true" length:4];
+    } else {
+      [self writeBytes:"false" length:5];
+    }
+    return YES;
+  }
+
+  char text[32];
+  int length = 0;
+  switch (number.objCType[0]) {
+  case 'c':
+  case 's':
+  case 'i':
+  case 'l':
+  case 'q':
+    length = snprintf(text, sizeof(text), "%lld", number.longLongValue);
+    break;
+  case 'C':
+  case 'S':
+  case 'I':
+  case 'L':
+  case 'Q':
+    length = snprintf(text, sizeof(text), "%llu", number.unsignedLongLongValue);
+    break;
+  default: {
+    if (!isfinite(number.doubleValue)) {
+      return NO;
+    }
+    // `stringValue` gives the shortest representation that round-trips, and handles `NSDecimalNumber` exactly
+    const char *string = number.stringValue.UTF8String;
+    [self writeBytes:string length:strlen(string)];
+    return YES;
+  }
+  }
+  [self writeBytes:text length:(size_t)length];
+  return YES;
+}
+
+- (void)writeString:(NSString *)string {
+  CFStringRef cfString = (__bridge CFStringRef)string;
+  CFIndex length = CFStringGetLength(cfString);
+  CFStringInlineBuffer inlineBuffer;
+  CFStringInitInlineBuffer(cfString, &inlineBuffer, CFRangeMake(0, length));
+
+  [self writeByte:'"'];
+  for (CFIndex i = 0; i < length; i++) {
+    UniChar c = CFStringGetCharacterFromInlineBuffer(&inlineBuffer, i);
+    if (_length + kDBJSONWriterMaxEscapeLength > kDBJSONWriterBufferLength) {
+      [self flush];
+    }
+
+    if (c >= 0x20 && c < 0x7F && c != '"' && c != '\\') {
+      _buffer[_length++] = (uint8_t)c;
+      continue;
+    }
+
+    _buffer[_length++] = '\\';
+    switch (c) {
+    case '"':
+    case '\\':
+      _buffer[_length++] = (uint8_t)c;
+      break;
+    case '\b':
+      _buffer[_length++] = 'b';
+      break;
+    case '\f':
+      _buffer[_length++] = 'f';
+      break;
+    case '\n':
+      _buffer[_length++] = 'n';
+      break;
+    case '\r':
+      _buffer[_length++] = 'r';
+      break;
+    case '\t':
+      _buffer[_length++] = 't';
+      break;
+    default:
+      // control characters, DEL and everything outside ASCII; surrogate pairs come out as two escapes
+      _buffer[_length++] = 'u';
+      _buffer[_length++] = (uint8_t)kDBJSONHexDigits[(c >> 12) & 0xF];
+      _buffer[_length++] = (uint8_t)kDBJSONHexDigits[(c >> 8) & 0xF];
+      _buffer[_length++] = (uint8_t)kDBJSONHexDigits[(c >> 4) & 0xF];
+      _buffer[_length++] = (uint8_t)kDBJSONHexDigits[c & 0xF];
+      break;
+    }
+  }
+  [self writeByte:'"'];
+}
+
+#pragma mark - Output
+
+- (void)writeByte:(uint8_t)byte {
+  if (_length == kDBJSONWriterBufferLength) {
+    [self flush];
+  }
+  _buffer[_length++] = byte;
+}
+
+- (void)writeBytes:(const char *)bytes length:(size_t)length {
+  if (_length + length > kDBJSONWriterBufferLength) {
+    [self flush];
+  }
+  if (length > kDBJSONWriterBufferLength) {
+    [_data appendBytes:bytes length:length];
+    return;
+  }
+  memcpy(_buffer + _length, bytes, length);
+  _length += length;
+}
+
+- (void)flush {
+  [_data appendBytes:_buffer length:_length];
+  _length = 0;
+}
+
+@end
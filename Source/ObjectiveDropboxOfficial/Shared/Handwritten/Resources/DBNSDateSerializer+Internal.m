@@ -0,0 +1,137 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#include <time.h>
+
+#import "DBNSDateSerializer+Internal.h"
+
+// the timestamp format of the Dropbox API, which gets a formatter-free fast path
+static NSString *const kDBTimestampFormat = @"%Y-%m-%dT%H:%M:%SZ";
+
+// length of a timestamp in that format, e.g. "2021-04-28T09:12:31Z"
+#define kDBTimestampLength 20
+
+// key of the per-thread formatter cache in `-[NSThread threadDictionary]`
+static NSString *const kDBDateFormattersThreadKey = @"com.dropbox.dropbox_sdk_obj_c.DBNSDateSerializer.formatters";
+
+// Days since 1970-01-01 of a proleptic Gregorian date, see http://howardhinnant.github.io/date_algorithms.html
+static int64_t DBDaysFromCivil(int64_t year, int month, int day) {
+  year -= month <= 2;
+  int64_t era = (year >= 0 ? year : year - 399) / 400;
+  int64_t yearOfEra = year - era * 400;
+  int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+static BOOL DBIsLeapYear(int year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static BOOL DBParseDigits(const UniChar *chars, NSUInteger count, int *value) {
+  int result = 0;
+  for (NSUInteger i = 0; i < count; i++) {
+    if (chars[i] < '0' || chars[i] > '9') {
+      return NO;
+    }
+    result = result * 10 + (chars[i] - '0');
+  }
+  *value = result;
+  return YES;
+}
+
+// Parses exactly "YYYY-MM-DDTHH:MM:SSZ". Anything else is left to the date formatter, so that edge cases behave the
+// same as before.
+static BOOL DBParseTimestamp(NSString *value, NSTimeInterval *timeInterval) {
+  if (value.length != kDBTimestampLength) {
+    return NO;
+  }
+  UniChar chars[kDBTimestampLength];
+  CFStringGetCharacters((__bridge CFStringRef)value, CFRangeMake(0, kDBTimestampLength), chars);
+  if (chars[4] != '-' || chars[7] != '-' || chars[10] != 'T' || chars[13] != ':' || chars[16] != ':' ||
+      chars[19] != 'Z') {
+    return NO;
+  }
+
+  int year, month, day, hour, minute, second;
+  if (!DBParseDigits(chars, 4, &year) || !DBParseDigits(chars + 5, 2, &month) ||
+      !DBParseDigits(chars + 8, 2, &day) || !DBParseDigits(chars + 11, 2, &hour) ||
+      !DBParseDigits(chars + 14, 2, &minute) || !DBParseDigits(chars + 17, 2, &second)) {
+    return NO;
+  }
+
+  static const int kDaysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  if (year < 1 || month < 1 || month > 12 || day < 1 || hour > 23 || minute > 59 || second > 59) {
+    return NO;
+  }
+  if (day > kDaysInMonth[month - 1] + (month == 2 && DBIsLeapYear(year) ? 1 : 0)) {
+    return NO;
+  }
+
+  int64_t days = DBDaysFromCivil(year, month, day);
+  *timeInterval = (NSTimeInterval)(days * 86400 + hour * 3600 + minute * 60 + second);
+  return YES;
+}
+
+// Prints "YYYY-MM-DDTHH:MM:SSZ", truncating fractional seconds like the date formatter. Years that don't fit four
+// digits are left to the formatter.
+static NSString *DBPrintTimestamp(NSDate *value) {
+  time_t seconds = (time_t)floor(value.timeIntervalSince1970);
+  struct tm components;
+  if (!gmtime_r(&seconds, &components) || components.tm_year + 1900 < 1 || components.tm_year + 1900 > 9999) {
+    return nil;
+  }
+
+  char buffer[kDBTimestampLength + 1];
+  snprintf(buffer, sizeof(buffer), "%04d-%02d-%02dT%02d:%02d:%02dZ", components.tm_year + 1900, components.tm_mon + 1,
+           components.tm_mday, components.tm_hour, components.tm_min, components.tm_sec);
+  return [[NSString alloc] initWithBytes:buffer length:kDBTimestampLength encoding:NSASCIIStringEncoding];
+}
+
+// implemented by the generated serializer
+@interface DBNSDateSerializer (Generated)
+
++ (NSString *)convertFormat:(NSString *)format;
+
+@end
+
+@implementation DBNSDateSerializer (Internal)
+
++ (NSString *)timestampStringWithDate:(NSDate *)value dateFormat:(NSString *)dateFormat {
+  if (![dateFormat isEqualToString:kDBTimestampFormat]) {
+    return nil;
+  }
+  return DBPrintTimestamp(value);
+}
+
++ (NSDate *)timestampDateWithString:(NSString *)value dateFormat:(NSString *)dateFormat {
+  NSTimeInterval timeInterval = 0;
+  if (![dateFormat isEqualToString:kDBTimestampFormat] || !DBParseTimestamp(value, &timeInterval)) {
+    return nil;
+  }
+  return [NSDate dateWithTimeIntervalSince1970:timeInterval];
+}
+
+// Formatters are cached per thread and per format, so that they are never shared or reconfigured, and no lock is
+// needed around them.
++ (NSDateFormatter *)formatterWithDateFormat:(NSString *)dateFormat {
+  NSMutableDictionary *threadDictionary = [NSThread currentThread].threadDictionary;
+  NSMutableDictionary<NSString *, NSDateFormatter *> *formatters = threadDictionary[kDBDateFormattersThreadKey];
+  if (!formatters) {
+    formatters = [NSMutableDictionary new];
+    threadDictionary[kDBDateFormattersThreadKey] = formatters;
+  }
+
+  NSDateFormatter *formatter = formatters[dateFormat];
+  if (!formatter) {
+    formatter = [[NSDateFormatter alloc] init];
+    [formatter setTimeZone:[NSTimeZone timeZoneWithName:@"UTC"]];
+    [formatter setLocale:[NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"]];
+    [formatter setDateFormat:[self convertFormat:dateFormat]];
+    formatters[dateFormat] = formatter;
+  }
+  return formatter;
+}
+
+@end
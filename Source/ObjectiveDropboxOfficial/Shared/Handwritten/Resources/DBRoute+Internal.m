@@ -0,0 +1,69 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <objc/runtime.h>
+
+#import "DBRoute+Internal.h"
+
+// associated object key of the parsed attributes: the `DBRouteAuth` in the low byte, the `DBRouteStyle` above it
+static char kDBRouteParsedAttributesKey;
+
+static const NSUInteger kDBRouteStyleShift = 8;
+
+// `auth` is one of user|team|app|noauth, or a comma-separated list of them such as "app, user"
+static DBRouteAuth DBRouteAuthWithAttribute(NSString *attribute) {
+  DBRouteAuth auth = 0;
+  for (NSString *component in [attribute componentsSeparatedByString:@","]) {
+    NSString *type = [component stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+    if ([type isEqualToString:@"noauth"]) {
+      auth |= DBRouteAuthNoAuth;
+    } else if ([type isEqualToString:@"user"]) {
+      auth |= DBRouteAuthUser;
+    } else if ([type isEqualToString:@"team"]) {
+      auth |= DBRouteAuthTeam;
+    } else if ([type isEqualToString:@"app"]) {
+      auth |= DBRouteAuthApp;
+    }
+  }
+  return auth;
+}
+
+static DBRouteStyle DBRouteStyleWithAttribute(NSString *attribute) {
+  if ([attribute isEqualToString:@"rpc"]) {
+    return DBRouteStyleRpc;
+  }
+  if ([attribute isEqualToString:@"upload"]) {
+    return DBRouteStyleUpload;
+  }
+  if ([attribute isEqualToString:@"download"]) {
+    return DBRouteStyleDownload;
+  }
+  return DBRouteStyleUnknown;
+}
+
+@implementation DBRoute (Internal)
+
+- (DBRouteAuth)auth {
+  return [self db_parsedAttributes] & ((1 << kDBRouteStyleShift) - 1);
+}
+
+- (DBRouteStyle)style {
+  return [self db_parsedAttributes] >> kDBRouteStyleShift;
+}
+
+#pragma mark - Private helpers
+
+- (NSUInteger)db_parsedAttributes {
+  NSNumber *parsedAttributes = objc_getAssociatedObject(self, &kDBRouteParsedAttributesKey);
+  if (!parsedAttributes) {
+    // routes are immutable, so threads racing to parse the attributes store the same value, atomically
+    NSUInteger auth = DBRouteAuthWithAttribute(self.attrs[@"auth"]);
+    NSUInteger style = DBRouteStyleWithAttribute(self.attrs[@"style"]);
+    parsedAttributes = @(auth | (style << kDBRouteStyleShift));
+    objc_setAssociatedObject(self, &kDBRouteParsedAttributesKey, parsedAttributes, OBJC_ASSOCIATION_RETAIN);
+  }
+  return parsedAttributes.unsignedIntegerValue;
+}
+
+@end
@@ -0,0 +1,37 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import <Foundation/Foundation.h>
+
+#import "DBStoneValidators.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// Control over the constraint checks run while API objects are built from server responses.
+///
+@interface DBStoneValidators (ServerResponses)
+
+///
+/// Whether objects built from API responses are checked against the constraints declared for their fields.
+///
+/// The server already enforces these constraints, so turning this off saves the checks when decoding large results
+/// such as folder listings. Objects constructed by the app itself are always checked, and `nil` is still rejected
+/// for required fields. Defaults to `YES`.
+///
+@property (class, nonatomic) BOOL validatesServerResponses;
+
+///
+/// Runs a block that builds objects from API response data, skipping constraint checks on the calling thread for
+/// its duration when `validatesServerResponses` is `NO`.
+///
+/// @param block The block that deserializes the response.
+///
+/// @return The value returned by `block`.
+///
++ (nullable id)deserializeTrustedValue:(id _Nullable (^_Nonnull)(void))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
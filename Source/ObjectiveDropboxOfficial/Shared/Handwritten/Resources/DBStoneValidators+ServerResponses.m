@@ -0,0 +1,68 @@
+///
+/// Copyright (c) 2016 Dropbox, Inc. All rights reserved.
+///
+
+#import "DBStoneValidators+Internal.h"
+#import "DBStoneValidators+ServerResponses.h"
+
+static BOOL sDBStoneValidatorsValidatesServerResponses = YES;
+
+// number of `deserializeTrustedValue:` calls on the current thread that are skipping constraint checks
+static __thread NSUInteger sDBStoneValidatorsTrustedDepth = 0;
+
+@implementation DBStoneValidators (ServerResponses)
+
++ (BOOL)validatesServerResponses {
+  return sDBStoneValidatorsValidatesServerResponses;
+}
+
++ (void)setValidatesServerResponses:(BOOL)validatesServerResponses {
+  sDBStoneValidatorsValidatesServerResponses = validatesServerResponses;
+}
+
++ (id)deserializeTrustedValue:(id (^)(void))block {
+  if (sDBStoneValidatorsValidatesServerResponses) {
+    return block();
+  }
+  sDBStoneValidatorsTrustedDepth++;
+  @try {
+    return block();
+  } @finally {
+    sDBStoneValidatorsTrustedDepth--;
+  }
+}
+
+@end
+
+@implementation DBStoneValidators (Internal)
+
++ (BOOL)checksSuspended {
+  return sDBStoneValidatorsTrustedDepth > 0;
+}
+
++ (NSRegularExpression *)regularExpressionWithPattern:(NSString *)pattern {
+  // compiled expressions are immutable and safe to share, and there's one per distinct pattern in the spec
+  static NSMutableDictionary<NSString *, NSRegularExpression *> *cache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    cache = [NSMutableDictionary new];
+  });
+
+  NSRegularExpression *re;
+  @synchronized(cache) {
+    re = cache[pattern];
+  }
+  if (re) {
+    return re;
+  }
+
+  re = [NSRegularExpression regularExpressionWithPattern:pattern options:0 error:nil];
+  if (re) {
+    @synchronized(cache) {
+      cache[pattern] = re;
+    }
+  }
+  return re;
+}
+
+@end
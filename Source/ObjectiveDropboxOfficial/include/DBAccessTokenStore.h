@@ -0,0 +1 @@
+../Shared/Handwritten/OAuth/DBAccessTokenStore.h
\ No newline at end of file
@@ -0,0 +1 @@
+../Shared/Handwritten/Resources/DBStoneValidators+ServerResponses.h
\ No newline at end of file
@@ -0,0 +1,19 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+// Response bodies for benchmarks, each built by repeating an entry recorded from the live API with distinct ids.
+
+/// A `files/list_folder` page of `entryCount` entries, one in ten of them a folder.
+NSData *DBBenchmarkListFolderPayload(NSUInteger entryCount);
+
+/// A `team_log/get_events` page of `entryCount` sign-in events.
+NSData *DBBenchmarkGetEventsPayload(NSUInteger entryCount);
+
+/// A `team/members/list` page of `entryCount` members.
+NSData *DBBenchmarkMembersListPayload(NSUInteger entryCount);
+
+/// A `users/get_current_account` response for a member of a team.
+NSData *DBBenchmarkFullAccountPayload(void);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,94 @@
+#import "DBBenchmarkPayloads.h"
+
+NSData *DBBenchmarkListFolderPayload(NSUInteger entryCount) {
+    NSMutableString *json = [NSMutableString stringWithString:@"{\"entries\": ["];
+    for (NSUInteger i = 0; i < entryCount; i++) {
+        if (i % 10 == 0) {
+            [json appendFormat:@"%@{\".tag\": \"folder\", \"name\": \"Folder %lu\", "
+                                "\"path_lower\": \"/photos/folder %lu\", \"path_display\": \"/Photos/Folder %lu\", "
+                                "\"id\": \"id:a4ayc_80_OEAAAAAAAAB%lu\"}",
+                               i ? @", " : @"", (unsigned long)i, (unsigned long)i, (unsigned long)i, (unsigned long)i];
+        } else {
+            [json appendFormat:@"%@{\".tag\": \"file\", \"name\": \"IMG_%04lu.jpg\", "
+                                "\"path_lower\": \"/photos/img_%04lu.jpg\", "
+                                "\"path_display\": \"/Photos/IMG_%04lu.jpg\", \"id\": \"id:a4ayc_80_OEAAAAAAAAA%lu\", "
+                                "\"client_modified\": \"2021-04-28T09:12:31Z\", "
+                                "\"server_modified\": \"2021-04-28T09:12:33Z\", "
+                                "\"rev\": \"5c0e6a1b2f%05lu0000001d9e1d0\", "
+                                "\"size\": %lu, \"is_downloadable\": true, \"content_hash\": "
+                                "\"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855\"}",
+                               i ? @", " : @"", (unsigned long)i, (unsigned long)i, (unsigned long)i, (unsigned long)i,
+                               (unsigned long)i, (unsigned long)(1024 * 1024 + i)];
+        }
+    }
+    [json appendString:@"], \"cursor\": \"ZtkX9_EHj3x7PMkVuFIhwKYXEpwpLwyxp9vMKomUhllil9q7eWiAu\", "
+                        "\"has_more\": true}"];
+    return [json dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+NSData *DBBenchmarkGetEventsPayload(NSUInteger entryCount) {
+    NSMutableString *json = [NSMutableString stringWithString:@"{\"events\": ["];
+    for (NSUInteger i = 0; i < entryCount; i++) {
+        [json appendFormat:@"%@{\"timestamp\": \"2021-04-28T09:12:%02luZ\", "
+                            "\"event_category\": {\".tag\": \"logins\"}, "
+                            "\"actor\": {\".tag\": \"user\", \"user\": {\".tag\": \"team_member\", "
+                            "\"account_id\": \"dbid:AAH4f99T0taONIb-OurWxbNQ6ywGRopQ%lu\", "
+                            "\"display_name\": \"Jane Doe\", \"email\": \"jane.doe@example.com\", "
+                            "\"team_member_id\": \"dbmid:AAHhy7WsR0x%lu\"}}, "
+                            "\"origin\": {\"geo_location\": {\"city\": \"San Francisco\", \"region\": \"California\", "
+                            "\"country\": \"US\", \"ip_address\": \"192.0.2.%lu\"}, \"access_method\": {\".tag\": "
+                            "\"end_user\", \"end_user\": {\".tag\": \"web\", \"session_id\": \"dbwsid:%lu\"}}}, "
+                            "\"involve_non_team_member\": false, "
+                            "\"context\": {\".tag\": \"team_member\", \"account_id\": "
+                            "\"dbid:AAH4f99T0taONIb-OurWxbNQ6ywGRopQ%lu\", \"display_name\": \"Jane Doe\", "
+                            "\"email\": \"jane.doe@example.com\", \"team_member_id\": \"dbmid:AAHhy7WsR0x%lu\"}, "
+                            "\"participants\": [], \"assets\": [], "
+                            "\"event_type\": {\".tag\": \"login_success\", \"description\": \"Signed in\"}, "
+                            "\"details\": {\".tag\": \"login_success_details\", \"is_emm_managed\": false, "
+                            "\"login_method\": {\".tag\": \"password\"}}}",
+                           i ? @", " : @"", (unsigned long)(i % 60), (unsigned long)i, (unsigned long)i,
+                           (unsigned long)(i % 256), (unsigned long)i, (unsigned long)i, (unsigned long)i];
+    }
+    [json appendString:@"], \"cursor\": \"AAAAAAAAAAB2GnuA6Cqs9AAAAAAAAQg\", \"has_more\": false}"];
+    return [json dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+NSData *DBBenchmarkMembersListPayload(NSUInteger entryCount) {
+    NSMutableString *json = [NSMutableString stringWithString:@"{\"members\": ["];
+    for (NSUInteger i = 0; i < entryCount; i++) {
+        [json appendFormat:@"%@{\"profile\": {\"team_member_id\": \"dbmid:FDFSVF-DFSDF%lu\", "
+                            "\"account_id\": \"dbid:AAH4f99T0taONIb-OurWxbNQ6ywGRopQ%lu\", "
+                            "\"email\": \"member%lu@example.com\", \"email_verified\": true, "
+                            "\"secondary_emails\": [], \"status\": {\".tag\": \"active\"}, "
+                            "\"name\": {\"given_name\": \"Franz\", \"surname\": \"Ferdinand\", \"familiar_name\": "
+                            "\"Franz\", \"display_name\": \"Franz Ferdinand (Personal)\", \"abbreviated_name\": "
+                            "\"FF\"}, \"membership_type\": {\".tag\": \"full\"}, \"joined_on\": "
+                            "\"2015-05-12T15:50:38Z\", \"groups\": [\"g:e2db7665347abcd600000000001a2b3c\"], "
+                            "\"member_folder_id\": \"20%lu\", \"profile_photo_url\": "
+                            "\"https://dl-web.dropbox.com/account_photo/get/"
+                            "dbaphid%%3AAAHWGmIXV3sUuOmBfTz0wPsiqHUpBWvv3ZA?vers=1556069330102\\u0026size=128x128\"}, "
+                            "\"role\": {\".tag\": \"member_only\"}}",
+                           i ? @", " : @"", (unsigned long)i, (unsigned long)i, (unsigned long)i, (unsigned long)i];
+    }
+    [json appendString:@"], \"cursor\": \"ZtkX9_EHj3x7PMkVuFIhwKYXEpwpLwyxp9vMKomUhllil9q7eWiAu\", "
+                        "\"has_more\": false}"];
+    return [json dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+NSData *DBBenchmarkFullAccountPayload(void) {
+    NSString *json = @"{\"account_id\": \"dbid:AAH4f99T0taONIb-OurWxbNQ6ywGRopQngc\", "
+                     "\"name\": {\"given_name\": \"Franz\", \"surname\": \"Ferdinand\", \"familiar_name\": "
+                     "\"Franz\", \"display_name\": \"Franz Ferdinand (Personal)\", \"abbreviated_name\": \"FF\"}, "
+                     "\"email\": \"franz@example.com\", \"email_verified\": true, \"disabled\": false, "
+                     "\"locale\": \"en\", \"referral_link\": \"https://db.tt/ZITNuhtI\", \"is_paired\": true, "
+                     "\"account_type\": {\".tag\": \"business\"}, \"root_info\": {\".tag\": \"team\", "
+                     "\"root_namespace_id\": \"3235641\", \"home_namespace_id\": \"3235641\", "
+                     "\"home_path\": \"/Franz Ferdinand\"}, \"country\": \"US\", "
+                     "\"team\": {\"id\": \"dbtid:AAFdgehTzw7WlXhZJsbGCLePe8RvQGYDr-I\", \"name\": \"Acme, Inc.\", "
+                     "\"sharing_policies\": {\"shared_folder_member_policy\": {\".tag\": \"team\"}, "
+                     "\"shared_folder_join_policy\": {\".tag\": \"from_anyone\"}, "
+                     "\"shared_link_create_policy\": {\".tag\": \"team_only\"}}, "
+                     "\"office_addin_policy\": {\".tag\": \"disabled\"}}, "
+                     "\"team_member_id\": \"dbmid:AAHhy7WsR0x-u4ZCqiDl5Fz5zvuL3kmspwU\"}";
+    return [json dataUsingEncoding:NSUTF8StringEncoding];
+}
@@ -0,0 +1,50 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// Times benchmark cases and writes their results as JSON, so that runs of different releases can be compared.
+///
+/// Results go to the file named by the `DB_BENCHMARK_OUTPUT` environment variable, or to `DBBenchmarks.json` in the
+/// temporary directory, and are rewritten after every case so that a crash keeps those recorded before it. When
+/// running through `xcodebuild`, set `TEST_RUNNER_DB_BENCHMARK_OUTPUT` to pass the variable on to the tests.
+///
+@interface DBBenchmarkReporter : NSObject
+
++ (instancetype)sharedReporter;
+
+/// The number of timed samples taken per case, after one untimed warm-up. Defaults to 5.
+@property (nonatomic) NSUInteger sampleCount;
+
+///
+/// Times `block` and records the time per operation under `name`.
+///
+/// @param name Identifies the case across runs, e.g. `serialization.files.list_folder.deserialize`.
+/// @param operations How many operations one call of `block` performs, to report the time per operation.
+/// @param block The work for one sample.
+///
+- (void)measure:(NSString *)name operations:(NSUInteger)operations block:(void (^)(void))block;
+
+///
+/// Times `block`, which calls its completion handler from any thread once its asynchronous work is done, and records
+/// the time per operation under `name`.
+///
+- (void)measureAsync:(NSString *)name
+          operations:(NSUInteger)operations
+               block:(void (^)(dispatch_block_t completion))block;
+
+///
+/// Records `value`, a measurement other than time such as the bytes a case allocates, under `name`.
+///
+/// @param name Identifies the measurement across runs, e.g. `decode.files.list_folder.stream.live_bytes`.
+/// @param value The measured value.
+/// @param unit The unit of `value`, e.g. `bytes`.
+///
+- (void)record:(NSString *)name value:(double)value unit:(NSString *)unit;
+
+/// The results recorded so far, in the form they are written out.
+@property (nonatomic, readonly) NSArray<NSDictionary<NSString *, id> *> *results;
+
+@end
+
+NS_ASSUME_NONNULL_END
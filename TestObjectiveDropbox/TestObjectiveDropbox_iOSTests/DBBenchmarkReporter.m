@@ -0,0 +1,130 @@
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+#import <sys/sysctl.h>
+#import <time.h>
+
+#import "DBBenchmarkReporter.h"
+
+// samples that take longer than this are reported as timed out, rather than holding up the whole run
+static const int64_t kDBBenchmarkSampleTimeout = 120 * NSEC_PER_SEC;
+
+@implementation DBBenchmarkReporter {
+    NSMutableArray<NSDictionary<NSString *, id> *> *_results;
+}
+
++ (instancetype)sharedReporter {
+    static DBBenchmarkReporter *reporter;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        reporter = [DBBenchmarkReporter new];
+    });
+    return reporter;
+}
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _sampleCount = 5;
+        _results = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (NSArray<NSDictionary<NSString *, id> *> *)results {
+    @synchronized(self) {
+        return [_results copy];
+    }
+}
+
+- (void)measure:(NSString *)name operations:(NSUInteger)operations block:(void (^)(void))block {
+    [self measureAsync:name
+            operations:operations
+                 block:^(dispatch_block_t completion) {
+                     block();
+                     completion();
+                 }];
+}
+
+- (void)measureAsync:(NSString *)name
+          operations:(NSUInteger)operations
+               block:(void (^)(dispatch_block_t completion))block {
+    NSMutableArray<NSNumber *> *samples = [NSMutableArray new];
+    BOOL timedOut = NO;
+    for (NSUInteger i = 0; i <= _sampleCount && !timedOut; i++) {
+        dispatch_semaphore_t done = dispatch_semaphore_create(0);
+        uint64_t start = clock_gettime_nsec_np(CLOCK_UPTIME_RAW);
+        @autoreleasepool {
+            block(^{
+                dispatch_semaphore_signal(done);
+            });
+        }
+        timedOut = dispatch_semaphore_wait(done, dispatch_time(DISPATCH_TIME_NOW, kDBBenchmarkSampleTimeout)) != 0;
+        uint64_t elapsed = clock_gettime_nsec_np(CLOCK_UPTIME_RAW) - start;
+        if (i > 0 && !timedOut) {
+            [samples addObject:@((double)elapsed / MAX(operations, 1))];
+        }
+    }
+    [self recordName:name operations:operations samples:samples timedOut:timedOut];
+}
+
+- (void)recordName:(NSString *)name
+        operations:(NSUInteger)operations
+           samples:(NSArray<NSNumber *> *)samples
+          timedOut:(BOOL)timedOut {
+    NSArray<NSNumber *> *sorted = [samples sortedArrayUsingSelector:@selector(compare:)];
+    NSMutableDictionary<NSString *, id> *result = [@{
+        @"name" : name,
+        @"operations_per_sample" : @(operations),
+        @"samples_ns_per_op" : sorted,
+        @"timed_out" : @(timedOut),
+    } mutableCopy];
+    if (sorted.count) {
+        double median = sorted[sorted.count / 2].doubleValue;
+        result[@"median_ns_per_op"] = @(median);
+        result[@"min_ns_per_op"] = sorted.firstObject;
+        result[@"max_ns_per_op"] = sorted.lastObject;
+        result[@"ops_per_sec"] = @(median > 0 ? 1e9 / median : 0);
+    }
+    NSLog(@"[benchmark] %@: %@ ns/op (median of %lu)%@", name, result[@"median_ns_per_op"] ?: @"-",
+          (unsigned long)sorted.count, timedOut ? @", timed out" : @"");
+    [self addResult:result];
+}
+
+- (void)record:(NSString *)name value:(double)value unit:(NSString *)unit {
+    NSLog(@"[benchmark] %@: %g %@", name, value, unit);
+    [self addResult:@{ @"name" : name, @"value" : @(value), @"unit" : unit }];
+}
+
+- (void)addResult:(NSDictionary<NSString *, id> *)result {
+    @synchronized(self) {
+        [_results addObject:result];
+        [self writeResults];
+    }
+}
+
+- (void)writeResults {
+    NSString *path = NSProcessInfo.processInfo.environment[@"DB_BENCHMARK_OUTPUT"]
+                         ?: [NSTemporaryDirectory() stringByAppendingPathComponent:@"DBBenchmarks.json"];
+    NSDictionary *report = @{
+        @"sdk_version" : kDBSDKVersion,
+        @"device" : [DBBenchmarkReporter deviceModel],
+        @"os_version" : NSProcessInfo.processInfo.operatingSystemVersionString,
+        @"processor_count" : @(NSProcessInfo.processInfo.activeProcessorCount),
+        @"timestamp" : [DBNSDateSerializer serialize:[NSDate date] dateFormat:@"%Y-%m-%dT%H:%M:%SZ"],
+        @"results" : _results,
+    };
+    NSData *data = [NSJSONSerialization dataWithJSONObject:report
+                                                   options:NSJSONWritingPrettyPrinted | NSJSONWritingSortedKeys
+                                                     error:nil];
+    [data writeToFile:path atomically:YES];
+}
+
++ (NSString *)deviceModel {
+    char model[256] = {0};
+    size_t size = sizeof(model) - 1;
+    if (sysctlbyname("hw.machine", model, &size, NULL, 0) != 0) {
+        return @"unknown";
+    }
+    return @(model);
+}
+
+@end
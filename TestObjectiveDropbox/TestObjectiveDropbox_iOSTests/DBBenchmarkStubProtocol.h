@@ -0,0 +1,47 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Builds the response to a stubbed request, whose `HTTPBody` holds the request body: returns the response body, and
+/// may change the status code (200 by default) and set response headers.
+typedef NSData *_Nullable (^DBBenchmarkStubResponder)(
+    NSURLRequest *request, NSInteger *statusCode, NSDictionary<NSString *, NSString *> *_Nullable *_Nonnull headers);
+
+/// Hands a stubbed response back to the SDK, at any time and from any thread.
+typedef void (^DBBenchmarkStubRespond)(NSInteger statusCode, NSDictionary<NSString *, NSString *> *_Nullable headers,
+                                       NSData *_Nullable body);
+
+/// Like `DBBenchmarkStubResponder`, but answers through `respond` whenever it likes, e.g. to keep requests in flight.
+typedef void (^DBBenchmarkStubDeferredResponder)(NSURLRequest *request, DBBenchmarkStubRespond respond);
+
+///
+/// Local stand-in for the Dropbox API servers, answering requests in-process so that benchmarks measure the SDK
+/// rather than the network. Requests to paths without a responder are left to the network.
+///
+@interface DBBenchmarkStubProtocol : NSURLProtocol
+
+/// Routes requests of sessions created from `defaultSessionConfiguration` from then on through the stub, which covers
+/// every foreground session of `DBTransportDefaultClient`.
++ (void)install;
+
+/// Answers requests to `path`, e.g. `/2/files/list_folder`, with `responder`, on any API host.
++ (void)setResponder:(nullable DBBenchmarkStubResponder)responder forPath:(NSString *)path;
+
+/// Answers requests to `path` with `responder`, which may respond later.
++ (void)setDeferredResponder:(nullable DBBenchmarkStubDeferredResponder)responder forPath:(NSString *)path;
+
+/// Answers requests to `path` with a fixed JSON body.
++ (void)setJSONResponse:(NSData *)body forPath:(NSString *)path;
+
+/// Answers download-style requests to `path` with `body`, and a `Dropbox-API-Result` header of `result`.
++ (void)setDownloadResponse:(NSData *)body result:(NSString *)result forPath:(NSString *)path;
+
+/// Hands response bodies to the SDK in pieces of at most `pieceSize` bytes, as the network would. 0, the default, hands
+/// each body over at once.
++ (void)setBodyPieceSize:(NSUInteger)pieceSize;
+
++ (void)removeAllResponders;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,171 @@
+#import <objc/runtime.h>
+
+#import "DBBenchmarkStubProtocol.h"
+
+// responders of both kinds by path, deferred ones wrapped in an array to tell them apart
+static NSMutableDictionary<NSString *, id> *s_responders;
+static NSUInteger s_bodyPieceSize;
+
+@implementation DBBenchmarkStubProtocol {
+    NSThread *_clientThread;
+    NSString *_clientRunLoopMode;
+    BOOL _stopped;
+}
+
++ (void)initialize {
+    if (self == [DBBenchmarkStubProtocol class]) {
+        s_responders = [NSMutableDictionary new];
+    }
+}
+
++ (void)install {
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        // custom sessions ignore `registerClass:`, so the stub is added to the configurations they are created from
+        Method method =
+            class_getClassMethod([NSURLSessionConfiguration class], @selector(defaultSessionConfiguration));
+        IMP originalImp = method_getImplementation(method);
+        method_setImplementation(method, imp_implementationWithBlock(^NSURLSessionConfiguration *(id configClass) {
+            NSURLSessionConfiguration *configuration = ((NSURLSessionConfiguration * (*)(id, SEL)) originalImp)(
+                configClass, @selector(defaultSessionConfiguration));
+            NSArray<Class> *protocolClasses = configuration.protocolClasses ?: @[];
+            configuration.protocolClasses =
+                [@[ [DBBenchmarkStubProtocol class] ] arrayByAddingObjectsFromArray:protocolClasses];
+            return configuration;
+        }));
+    });
+}
+
++ (void)setResponder:(DBBenchmarkStubResponder)responder forPath:(NSString *)path {
+    @synchronized(s_responders) {
+        s_responders[path] = responder;
+    }
+}
+
++ (void)setDeferredResponder:(DBBenchmarkStubDeferredResponder)responder forPath:(NSString *)path {
+    @synchronized(s_responders) {
+        s_responders[path] = responder ? @[ [responder copy] ] : nil;
+    }
+}
+
++ (void)setJSONResponse:(NSData *)body forPath:(NSString *)path {
+    [self setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+#pragma unused(request)
+#pragma unused(statusCode)
+        *headers = @{ @"Content-Type" : @"application/json" };
+        return body;
+    }
+               forPath:path];
+}
+
++ (void)setDownloadResponse:(NSData *)body result:(NSString *)result forPath:(NSString *)path {
+    [self setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+#pragma unused(request)
+#pragma unused(statusCode)
+        *headers = @{ @"Content-Type" : @"application/octet-stream", @"Dropbox-API-Result" : result };
+        return body;
+    }
+               forPath:path];
+}
+
++ (void)setBodyPieceSize:(NSUInteger)pieceSize {
+    @synchronized(s_responders) {
+        s_bodyPieceSize = pieceSize;
+    }
+}
+
++ (void)removeAllResponders {
+    @synchronized(s_responders) {
+        [s_responders removeAllObjects];
+        s_bodyPieceSize = 0;
+    }
+}
+
++ (id)responderForRequest:(NSURLRequest *)request {
+    NSString *host = request.URL.host;
+    if (![host hasSuffix:@".dropbox.com"] && ![host hasSuffix:@".dropboxapi.com"]) {
+        return nil;
+    }
+    @synchronized(s_responders) {
+        return s_responders[request.URL.path];
+    }
+}
+
++ (BOOL)canInitWithRequest:(NSURLRequest *)request {
+    return [self responderForRequest:request] != nil;
+}
+
++ (NSURLRequest *)canonicalRequestForRequest:(NSURLRequest *)request {
+    return request;
+}
+
+- (void)startLoading {
+    // consume an upload body the way the server would, so that upload benchmarks include reading it; sessions hand
+    // even in-memory bodies to protocols as a stream
+    NSURLRequest *request = self.request;
+    NSInputStream *bodyStream = request.HTTPBodyStream;
+    if (bodyStream) {
+        NSMutableData *bodyData = [NSMutableData new];
+        uint8_t buffer[64 * 1024];
+        NSInteger length;
+        [bodyStream open];
+        while ((length = [bodyStream read:buffer maxLength:sizeof(buffer)]) > 0) {
+            [bodyData appendBytes:buffer length:(NSUInteger)length];
+        }
+        [bodyStream close];
+
+        NSMutableURLRequest *requestWithBody = [request mutableCopy];
+        requestWithBody.HTTPBody = bodyData;
+        request = requestWithBody;
+    }
+
+    id responder = [[self class] responderForRequest:request];
+    if ([responder isKindOfClass:[NSArray class]]) {
+        // the client expects its callbacks on the thread and in the run loop mode loading started in
+        _clientThread = [NSThread currentThread];
+        _clientRunLoopMode = [[NSRunLoop currentRunLoop] currentMode] ?: NSDefaultRunLoopMode;
+        DBBenchmarkStubDeferredResponder deferredResponder = ((NSArray *)responder).firstObject;
+        deferredResponder(request, ^(NSInteger statusCode, NSDictionary *headers, NSData *body) {
+            [self performSelector:@selector(respondWithResponse:)
+                         onThread:self->_clientThread
+                       withObject:@[ @(statusCode), headers ?: @{}, body ?: [NSData data] ]
+                    waitUntilDone:NO
+                            modes:@[ self->_clientRunLoopMode ]];
+        });
+        return;
+    }
+
+    NSInteger statusCode = 200;
+    NSDictionary<NSString *, NSString *> *headers = nil;
+    NSData *body = responder ? ((DBBenchmarkStubResponder)responder)(request, &statusCode, &headers) : nil;
+    [self respondWithResponse:@[ @(statusCode), headers ?: @{}, body ?: [NSData data] ]];
+}
+
+// Takes the status code, headers and body, in that order.
+- (void)respondWithResponse:(NSArray *)response {
+    if (_stopped) {
+        return;
+    }
+    NSData *body = response[2];
+    NSHTTPURLResponse *httpResponse = [[NSHTTPURLResponse alloc] initWithURL:self.request.URL
+                                                                  statusCode:[response[0] integerValue]
+                                                                 HTTPVersion:@"HTTP/1.1"
+                                                                headerFields:response[1]];
+    [self.client URLProtocol:self didReceiveResponse:httpResponse cacheStoragePolicy:NSURLCacheStorageNotAllowed];
+    NSUInteger pieceSize = 0;
+    @synchronized(s_responders) {
+        pieceSize = s_bodyPieceSize ?: body.length;
+    }
+    for (NSUInteger offset = 0; offset < body.length; offset += pieceSize) {
+        NSRange pieceRange = NSMakeRange(offset, MIN(pieceSize, body.length - offset));
+        [self.client URLProtocol:self didLoadData:[body subdataWithRange:pieceRange]];
+    }
+    [self.client URLProtocolDidFinishLoading:self];
+}
+
+- (void)stopLoading {
+    // only ever called on the client thread, like deferred responses
+    _stopped = YES;
+}
+
+@end
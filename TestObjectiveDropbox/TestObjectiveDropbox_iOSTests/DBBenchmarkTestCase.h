@@ -0,0 +1,24 @@
+#import <XCTest/XCTest.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+///
+/// A test case whose benchmark cases are skipped unless the `DB_RUN_BENCHMARKS` environment variable is set, so that
+/// the default test run stays quick and doesn't depend on how fast the machine is.
+///
+/// Every test case with benchmark cases derives from this class, and is listed in `run_benchmarks.sh`, which sets the
+/// variable. When running through `xcodebuild` yourself, set `TEST_RUNNER_DB_RUN_BENCHMARKS=1` to pass it on to the
+/// tests.
+///
+@interface DBBenchmarkTestCase : XCTestCase
+
+/// Whether the running case is a benchmark. Defaults to `YES` for cases whose name ends in `Performance`.
+@property (nonatomic, readonly) BOOL isBenchmark;
+
+/// Times `block` with `DBBenchmarkReporter` under the class and case name, so that the result is written out with the
+/// others, rather than kept by XCTest.
+- (void)measureBlock:(void (^)(void))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
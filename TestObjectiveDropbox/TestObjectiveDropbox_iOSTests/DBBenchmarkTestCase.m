@@ -0,0 +1,26 @@
+#import "DBBenchmarkTestCase.h"
+
+#import "DBBenchmarkReporter.h"
+
+@implementation DBBenchmarkTestCase
+
+- (BOOL)isBenchmark {
+    return [NSStringFromSelector(self.invocation.selector) hasSuffix:@"Performance"];
+}
+
+- (BOOL)setUpWithError:(NSError **)error {
+    if (![super setUpWithError:error]) {
+        return NO;
+    }
+    XCTSkipIf(self.isBenchmark && NSProcessInfo.processInfo.environment[@"DB_RUN_BENCHMARKS"] == nil,
+              @"benchmarks only run with DB_RUN_BENCHMARKS set");
+    return YES;
+}
+
+- (void)measureBlock:(void (^)(void))block {
+    NSString *name = [NSString
+        stringWithFormat:@"%@.%@", NSStringFromClass([self class]), NSStringFromSelector(self.invocation.selector)];
+    [[DBBenchmarkReporter sharedReporter] measure:name operations:1 block:block];
+}
+
+@end
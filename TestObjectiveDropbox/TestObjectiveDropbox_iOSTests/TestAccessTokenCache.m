@@ -0,0 +1,27 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+@interface DBAccessTokenCache : NSObject <DBAccessTokenStore>
++ (DBAccessTokenCache *)cacheWithKeychainService:(NSString *)service;
+@end
+
+@interface TestAccessTokenCache : XCTestCase
+
+@end
+
+@implementation TestAccessTokenCache
+
+- (void)testCacheIsSharedPerService {
+    NSString *service = [NSString stringWithFormat:@"TestAccessTokenCache.%@", [NSUUID UUID].UUIDString];
+    DBAccessTokenCache *cache = [DBAccessTokenCache cacheWithKeychainService:service];
+    XCTAssertEqual([DBAccessTokenCache cacheWithKeychainService:[service mutableCopy]], cache);
+    XCTAssertNotEqual([DBAccessTokenCache cacheWithKeychainService:[service stringByAppendingString:@".other"]], cache);
+}
+
+- (void)testNilServiceDefaultsToBundleIdentifier {
+    DBAccessTokenCache *cache = [DBAccessTokenCache cacheWithKeychainService:nil];
+    XCTAssertNotNil(cache);
+    XCTAssertEqual([DBAccessTokenCache cacheWithKeychainService:[NSBundle mainBundle].bundleIdentifier ?: @""], cache);
+}
+
+@end
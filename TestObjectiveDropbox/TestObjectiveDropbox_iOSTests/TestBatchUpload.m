@@ -0,0 +1,431 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkStubProtocol.h"
+
+static const NSUInteger kChunkAlignment = 4 * 1024 * 1024;
+
+// An append to an upload session, as received by the stub.
+@interface TestAppend : NSObject
+@property (nonatomic, copy) NSString *sessionId;
+@property (nonatomic) NSUInteger offset;
+@property (nonatomic) NSUInteger length;
+@property (nonatomic) BOOL close;
+@end
+
+@implementation TestAppend
+@end
+
+// Records the appends received by the stub, and how many were in flight at once.
+@interface TestAppendRecorder : NSObject
+@property (nonatomic, readonly) NSMutableArray<TestAppend *> *appends;
+@property (nonatomic, readonly) NSCountedSet<NSString *> *inFlightPerSession;
+@property (nonatomic) NSUInteger inFlight;
+@property (nonatomic) NSUInteger maxInFlight;
+@property (nonatomic) NSUInteger maxInFlightPerSession;
+@property (nonatomic) BOOL closedWhileInFlight;
+@end
+
+@implementation TestAppendRecorder
+
+- (instancetype)init {
+    self = [super init];
+    if (self) {
+        _appends = [NSMutableArray new];
+        _inFlightPerSession = [NSCountedSet new];
+    }
+    return self;
+}
+
+@end
+
+// The arguments the response block of a batch was called with.
+@interface TestBatchResult : NSObject
+@property (nonatomic, copy) NSDictionary<NSURL *, DBFILESUploadSessionFinishBatchResultEntry *> *entries;
+@property (nonatomic) DBRequestError *requestError;
+@property (nonatomic, copy) NSDictionary<NSURL *, DBRequestError *> *fileErrors;
+@end
+
+@implementation TestBatchResult
+@end
+
+@interface TestBatchUpload : XCTestCase
+
+@end
+
+@implementation TestBatchUpload {
+    DBUserClient *_client;
+    NSString *_directory;
+    NSUInteger _sessionCount;
+}
+
++ (void)setUp {
+    [super setUp];
+    [DBBenchmarkStubProtocol install];
+}
+
+- (void)setUp {
+    [super setUp];
+    DBTransportDefaultConfig *config = [[DBTransportDefaultConfig alloc] initWithAppKey:@"app-key"
+                                                                              appSecret:@"app-secret"
+                                                                              userAgent:nil
+                                                                          delegateQueue:nil
+                                                                 forceForegroundSession:YES];
+    _client = [[DBUserClient alloc] initWithAccessToken:@"token" transportConfig:config];
+    _directory = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    [[NSFileManager defaultManager] createDirectoryAtPath:_directory
+                              withIntermediateDirectories:YES
+                                               attributes:nil
+                                                    error:nil];
+    [self stubUploadSessionStart];
+    [self stubFinishBatch];
+}
+
+- (void)tearDown {
+    [DBBenchmarkStubProtocol removeAllResponders];
+    [[NSFileManager defaultManager] removeItemAtPath:_directory error:nil];
+    [super tearDown];
+}
+
+#pragma mark - Stubs
+
+// Opens a new session for every request.
+- (void)stubUploadSessionStart {
+    [DBBenchmarkStubProtocol
+        setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+#pragma unused(request)
+#pragma unused(statusCode)
+            NSUInteger sessionNumber;
+            @synchronized(self) {
+                sessionNumber = ++self->_sessionCount;
+            }
+            *headers = @{ @"Content-Type" : @"application/json" };
+            NSString *sessionId = [NSString stringWithFormat:@"session-%lu", (unsigned long)sessionNumber];
+            NSDictionary *result = @{ @"session_id" : sessionId };
+            return [NSJSONSerialization dataWithJSONObject:result options:0 error:nil];
+        }
+             forPath:@"/2/files/upload_session/start"];
+}
+
+// Commits every entry of the request, in order, unless its path is in `failedPaths`. Returns the paths of each request.
+- (NSMutableArray<NSArray<NSString *> *> *)stubFinishBatchFailingPaths:(NSSet<NSString *> *)failedPaths {
+    NSMutableArray<NSArray<NSString *> *> *requestPaths = [NSMutableArray new];
+    [DBBenchmarkStubProtocol
+        setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+#pragma unused(statusCode)
+            NSDictionary *arg = [NSJSONSerialization JSONObjectWithData:request.HTTPBody options:0 error:nil];
+            NSMutableArray *entries = [NSMutableArray new];
+            NSMutableArray<NSString *> *paths = [NSMutableArray new];
+            for (NSDictionary *entry in arg[@"entries"]) {
+                NSString *path = entry[@"commit"][@"path"];
+                [paths addObject:path];
+                if ([failedPaths containsObject:path]) {
+                    [entries addObject:@{
+                        @".tag" : @"failure",
+                        @"failure" : @{@".tag" : @"too_many_write_operations"},
+                    }];
+                    continue;
+                }
+                [entries addObject:@{
+                    @".tag" : @"success",
+                    @"name" : path.lastPathComponent,
+                    @"id" : @"id:a4ayc_80_OEAAAAAAAAAXw",
+                    @"client_modified" : @"2015-05-12T15:50:38Z",
+                    @"server_modified" : @"2015-05-12T15:50:38Z",
+                    @"rev" : @"a1c10ce0dd78",
+                    @"size" : entry[@"cursor"][@"offset"],
+                    @"path_lower" : path.lowercaseString,
+                    @"path_display" : path,
+                }];
+            }
+            @synchronized(requestPaths) {
+                [requestPaths addObject:paths];
+            }
+            *headers = @{ @"Content-Type" : @"application/json" };
+            return [NSJSONSerialization dataWithJSONObject:@{ @"entries" : entries } options:0 error:nil];
+        }
+             forPath:@"/2/files/upload_session/finish_batch_v2"];
+    return requestPaths;
+}
+
+- (NSMutableArray<NSArray<NSString *> *> *)stubFinishBatch {
+    return [self stubFinishBatchFailingPaths:[NSSet set]];
+}
+
+// Holds every append for `delay` before acknowledging it.
+- (TestAppendRecorder *)stubAppendsWithDelay:(NSTimeInterval)delay {
+    TestAppendRecorder *recorder = [TestAppendRecorder new];
+    [DBBenchmarkStubProtocol
+        setDeferredResponder:^(NSURLRequest *request, DBBenchmarkStubRespond respond) {
+            NSString *argString = [request valueForHTTPHeaderField:@"Dropbox-API-Arg"];
+            NSData *argData = [argString dataUsingEncoding:NSUTF8StringEncoding];
+            NSDictionary *arg = [NSJSONSerialization JSONObjectWithData:argData options:0 error:nil];
+            TestAppend *append = [TestAppend new];
+            append.sessionId = arg[@"cursor"][@"session_id"];
+            append.offset = [arg[@"cursor"][@"offset"] unsignedIntegerValue];
+            append.length = request.HTTPBody.length;
+            append.close = [arg[@"close"] boolValue];
+
+            @synchronized(recorder) {
+                [recorder.appends addObject:append];
+                if (append.close && [recorder.inFlightPerSession countForObject:append.sessionId] > 0) {
+                    recorder.closedWhileInFlight = YES;
+                }
+                recorder.inFlight++;
+                [recorder.inFlightPerSession addObject:append.sessionId];
+                recorder.maxInFlight = MAX(recorder.maxInFlight, recorder.inFlight);
+                recorder.maxInFlightPerSession =
+                    MAX(recorder.maxInFlightPerSession, [recorder.inFlightPerSession countForObject:append.sessionId]);
+            }
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(delay * NSEC_PER_SEC)),
+                           dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+                               // no longer counted before the SDK sees the response, so the counts never run high
+                               @synchronized(recorder) {
+                                   recorder.inFlight--;
+                                   [recorder.inFlightPerSession removeObject:append.sessionId];
+                               }
+                               respond(200, @{ @"Content-Type" : @"application/json" },
+                                       [@"null" dataUsingEncoding:NSUTF8StringEncoding]);
+                           });
+        }
+                     forPath:@"/2/files/upload_session/append_v2"];
+    return recorder;
+}
+
+#pragma mark - Helpers
+
+- (NSDictionary<NSURL *, DBFILESCommitInfo *> *)filesWithCount:(NSUInteger)count size:(NSUInteger)size {
+    NSMutableData *contents = [NSMutableData dataWithLength:size];
+    NSMutableDictionary<NSURL *, DBFILESCommitInfo *> *files = [NSMutableDictionary new];
+    for (NSUInteger i = 0; i < count; i++) {
+        NSString *name = [NSString stringWithFormat:@"file-%04lu.bin", (unsigned long)i];
+        NSURL *url = [NSURL fileURLWithPath:[_directory stringByAppendingPathComponent:name]];
+        [contents writeToURL:url atomically:NO];
+        files[url] = [[DBFILESCommitInfo alloc] initWithPath:[@"/Uploads/" stringByAppendingString:name]];
+    }
+    return files;
+}
+
+// Starts a batch with `startBatch` and waits for it to complete.
+- (TestBatchResult *)waitForBatch:(void (^)(DBBatchUploadResponseBlock responseBlock))startBatch {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"batch"];
+    TestBatchResult *result = [TestBatchResult new];
+    startBatch(^(NSDictionary<NSURL *, DBFILESUploadSessionFinishBatchResultEntry *> *fileUrlsToBatchResultEntries,
+                 DBASYNCPollError *finishBatchRouteError, DBRequestError *finishBatchRequestError,
+                 NSDictionary<NSURL *, DBRequestError *> *fileUrlsToRequestErrors) {
+#pragma unused(finishBatchRouteError)
+        result.entries = fileUrlsToBatchResultEntries;
+        result.requestError = finishBatchRequestError;
+        result.fileErrors = fileUrlsToRequestErrors;
+        [expectation fulfill];
+    });
+    [self waitForExpectationsWithTimeout:60 handler:nil];
+    return result;
+}
+
+- (TestBatchResult *)uploadFiles:(NSDictionary<NSURL *, DBFILESCommitInfo *> *)files
+                          config:(DBBatchUploadConfig *)config {
+    DBFILESUserAuthRoutes *filesRoutes = _client.filesRoutes;
+    return [self waitForBatch:^(DBBatchUploadResponseBlock responseBlock) {
+        [filesRoutes batchUploadFiles:files
+                                queue:[NSOperationQueue new]
+                               config:config
+                        progressBlock:nil
+                        responseBlock:responseBlock];
+    }];
+}
+
+#pragma mark - Concurrent upload sessions
+
+- (void)testConcurrentSessionsSendAlignedChunksWithinLimits {
+    NSUInteger fileSize = 3 * kChunkAlignment + 1234;
+    NSDictionary<NSURL *, DBFILESCommitInfo *> *files = [self filesWithCount:3 size:fileSize];
+
+    TestAppendRecorder *recorder = [self stubAppendsWithDelay:0.05];
+
+    DBBatchUploadConfig *config = [DBBatchUploadConfig new];
+    config.concurrentUploadSessions = YES;
+    // not a multiple of 4 MB, so it is rounded down
+    config.chunkSizePolicy = [[DBFixedChunkSizePolicy alloc] initWithChunkSize:6 * 1024 * 1024];
+    config.maxConcurrentFileUploads = 3;
+    config.maxConcurrentChunksPerFile = 2;
+    config.maxConcurrentChunks = 3;
+
+    TestBatchResult *result = [self uploadFiles:files config:config];
+    XCTAssertEqual(result.entries.count, files.count);
+    XCTAssertEqual(result.fileErrors.count, (NSUInteger)0);
+
+    XCTAssertLessThanOrEqual(recorder.maxInFlight, config.maxConcurrentChunks);
+    XCTAssertLessThanOrEqual(recorder.maxInFlightPerSession, config.maxConcurrentChunksPerFile);
+    XCTAssertGreaterThan(recorder.maxInFlight, (NSUInteger)1);
+    XCTAssertFalse(recorder.closedWhileInFlight);
+
+    NSMutableDictionary<NSString *, NSMutableIndexSet *> *sessionRanges = [NSMutableDictionary new];
+    NSMutableDictionary<NSString *, TestAppend *> *sessionCloses = [NSMutableDictionary new];
+    for (TestAppend *append in recorder.appends) {
+        XCTAssertEqual(append.offset % kChunkAlignment, (NSUInteger)0);
+        if (append.close) {
+            XCTAssertNil(sessionCloses[append.sessionId]);
+            sessionCloses[append.sessionId] = append;
+        } else {
+            XCTAssertEqual(append.length, kChunkAlignment);
+        }
+        NSMutableIndexSet *ranges = sessionRanges[append.sessionId] ?: [NSMutableIndexSet new];
+        XCTAssertFalse([ranges intersectsIndexesInRange:NSMakeRange(append.offset, append.length)]);
+        [ranges addIndexesInRange:NSMakeRange(append.offset, append.length)];
+        sessionRanges[append.sessionId] = ranges;
+    }
+    XCTAssertEqual(sessionRanges.count, files.count);
+    for (NSString *sessionId in sessionRanges) {
+        XCTAssertTrue([sessionRanges[sessionId] containsIndexesInRange:NSMakeRange(0, fileSize)]);
+        XCTAssertEqual(sessionRanges[sessionId].count, fileSize);
+        XCTAssertEqual(sessionCloses[sessionId].offset + sessionCloses[sessionId].length, fileSize);
+    }
+}
+
+#pragma mark - Scheduling
+
+- (void)testFileUploadsStayWithinLimit {
+    NSDictionary<NSURL *, DBFILESCommitInfo *> *files = [self filesWithCount:20 size:1024];
+
+    __block NSUInteger inFlight = 0;
+    __block NSUInteger maxInFlight = 0;
+    __block NSUInteger sessionCount = 0;
+    NSObject *lock = [NSObject new];
+    [DBBenchmarkStubProtocol
+        setDeferredResponder:^(NSURLRequest *request, DBBenchmarkStubRespond respond) {
+#pragma unused(request)
+            NSUInteger sessionNumber;
+            @synchronized(lock) {
+                sessionNumber = ++sessionCount;
+                inFlight++;
+                maxInFlight = MAX(maxInFlight, inFlight);
+            }
+            NSString *sessionId = [NSString stringWithFormat:@"session-%lu", (unsigned long)sessionNumber];
+            NSData *body = [NSJSONSerialization dataWithJSONObject:@{ @"session_id" : sessionId } options:0 error:nil];
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.02 * NSEC_PER_SEC)),
+                           dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+                               @synchronized(lock) {
+                                   inFlight--;
+                               }
+                               respond(200, @{ @"Content-Type" : @"application/json" }, body);
+                           });
+        }
+                     forPath:@"/2/files/upload_session/start"];
+
+    DBBatchUploadConfig *config = [DBBatchUploadConfig new];
+    config.maxConcurrentFileUploads = 3;
+
+    TestBatchResult *result = [self uploadFiles:files config:config];
+    XCTAssertEqual(result.entries.count, files.count);
+    XCTAssertEqual(result.fileErrors.count, (NSUInteger)0);
+    XCTAssertEqual(sessionCount, files.count);
+    XCTAssertLessThanOrEqual(maxInFlight, config.maxConcurrentFileUploads);
+    XCTAssertGreaterThan(maxInFlight, (NSUInteger)1);
+}
+
+#pragma mark - Commits
+
+- (void)testCommitsInShardsSortedByPath {
+    NSDictionary<NSURL *, DBFILESCommitInfo *> *files = [self filesWithCount:5 size:1024];
+    NSMutableArray<NSArray<NSString *> *> *requestPaths = [self stubFinishBatch];
+
+    DBBatchUploadConfig *config = [DBBatchUploadConfig new];
+    config.maxFinishBatchEntries = 2;
+
+    TestBatchResult *result = [self uploadFiles:files config:config];
+    XCTAssertNil(result.requestError);
+    XCTAssertEqual(result.entries.count, files.count);
+    for (NSURL *fileUrl in files) {
+        XCTAssertEqualObjects(result.entries[fileUrl].success.pathDisplay, files[fileUrl].path);
+    }
+
+    // two full shards, and the remainder once every file is uploaded
+    XCTAssertEqual(requestPaths.count, (NSUInteger)3);
+    NSMutableArray<NSString *> *committedPaths = [NSMutableArray new];
+    for (NSArray<NSString *> *paths in requestPaths) {
+        XCTAssertLessThanOrEqual(paths.count, config.maxFinishBatchEntries);
+        XCTAssertEqualObjects(paths, [paths sortedArrayUsingSelector:@selector(compare:)]);
+        [committedPaths addObjectsFromArray:paths];
+    }
+    NSArray<NSString *> *expectedPaths =
+        [[files.allValues valueForKey:@"path"] sortedArrayUsingSelector:@selector(compare:)];
+    XCTAssertEqualObjects([committedPaths sortedArrayUsingSelector:@selector(compare:)], expectedPaths);
+}
+
+- (void)testCommitsSortedByPath {
+    NSDictionary<NSURL *, DBFILESCommitInfo *> *files = [self filesWithCount:20 size:1024];
+    NSMutableArray<NSArray<NSString *> *> *requestPaths = [self stubFinishBatch];
+
+    TestBatchResult *result = [self uploadFiles:files config:nil];
+    XCTAssertEqual(result.entries.count, files.count);
+
+    // files finish uploading in any order, but are committed in path order
+    NSArray<NSString *> *expectedPaths =
+        [[files.allValues valueForKey:@"path"] sortedArrayUsingSelector:@selector(compare:)];
+    XCTAssertEqualObjects(requestPaths, @[ expectedPaths ]);
+}
+
+- (void)testFailedShardReportsErrorForEachFile {
+    NSDictionary<NSURL *, DBFILESCommitInfo *> *files = [self filesWithCount:3 size:1024];
+    [DBBenchmarkStubProtocol
+        setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+#pragma unused(request)
+            *statusCode = 409;
+            *headers = @{ @"Content-Type" : @"application/json" };
+            return [@"{\"error_summary\": \"other/\", \"error\": {\".tag\": \"other\"}}"
+                dataUsingEncoding:NSUTF8StringEncoding];
+        }
+             forPath:@"/2/files/upload_session/finish_batch_v2"];
+
+    TestBatchResult *result = [self uploadFiles:files config:nil];
+    XCTAssertNotNil(result.requestError);
+    XCTAssertEqual(result.entries.count, (NSUInteger)0);
+    XCTAssertEqual(result.fileErrors.count, files.count);
+    for (NSURL *fileUrl in files) {
+        XCTAssertEqual(result.fileErrors[fileUrl], result.requestError);
+    }
+}
+
+- (void)testResumeCommitsFailedEntriesAgain {
+    NSDictionary<NSURL *, DBFILESCommitInfo *> *files = [self filesWithCount:3 size:1024];
+    NSURL *failedUrl = files.allKeys.firstObject;
+    NSString *failedPath = files[failedUrl].path;
+    NSURL *journalUrl = [NSURL fileURLWithPath:[_directory stringByAppendingPathComponent:@"batch.journal"]];
+    [self stubFinishBatchFailingPaths:[NSSet setWithObject:failedPath]];
+
+    DBBatchUploadConfig *config = [DBBatchUploadConfig new];
+    config.journalUrl = journalUrl;
+
+    TestBatchResult *result = [self uploadFiles:files config:config];
+    XCTAssertNil(result.requestError);
+    XCTAssertEqual(result.entries.count, files.count);
+    XCTAssertTrue([result.entries[failedUrl] isFailure]);
+
+    // records are written asynchronously, and only the committed files are finished
+    NSPredicate *journaled = [NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+#pragma unused(object)
+#pragma unused(bindings)
+        NSString *contents = [NSString stringWithContentsOfURL:journalUrl encoding:NSUTF8StringEncoding error:nil];
+        NSUInteger finishedRecords = [contents componentsSeparatedByString:@"\"finished\""].count - 1;
+        return finishedRecords == files.count - 1;
+    }];
+    [self waitForExpectations:@[ [self expectationForPredicate:journaled evaluatedWithObject:self handler:nil] ]
+                      timeout:10];
+
+    NSMutableArray<NSArray<NSString *> *> *requestPaths = [self stubFinishBatch];
+    DBFILESUserAuthRoutes *filesRoutes = _client.filesRoutes;
+    result = [self waitForBatch:^(DBBatchUploadResponseBlock responseBlock) {
+        [filesRoutes resumeBatchUploadWithJournalUrl:journalUrl
+                                               queue:[NSOperationQueue new]
+                                              config:nil
+                                       progressBlock:nil
+                                       responseBlock:responseBlock];
+    }];
+    XCTAssertNil(result.requestError);
+    XCTAssertEqualObjects(requestPaths, @[ @[ failedPath ] ]);
+    XCTAssertEqual(result.entries.count, (NSUInteger)1);
+    XCTAssertTrue([result.entries[failedUrl] isSuccess]);
+}
+
+@end
@@ -0,0 +1,204 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+@interface DBBatchUploadJournalEntry : NSObject
+@property (nonatomic, readonly) NSURL *fileUrl;
+@property (nonatomic, readonly) NSUInteger fileSize;
+@property (nonatomic, readonly) NSDate *modificationDate;
+@property (nonatomic, readonly) DBFILESCommitInfo *commitInfo;
+@property (nonatomic, readonly, copy) NSString *sessionId;
+@property (nonatomic, readonly) BOOL concurrent;
+@property (nonatomic, readonly) NSIndexSet *committedRanges;
+@property (nonatomic, readonly) BOOL closed;
+@property (nonatomic, readonly) BOOL finished;
+- (BOOL)isResumableWithFileSize:(NSUInteger)fileSize modificationDate:(NSDate *)modificationDate;
+@end
+
+@interface DBBatchUploadJournal : NSObject
+@property (nonatomic, readonly) NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *entries;
++ (NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *)entriesWithContents:(NSData *)contents;
+- (instancetype)initWithNewJournalUrl:(NSURL *)journalUrl error:(NSError **)error;
+- (instancetype)initWithExistingJournalUrl:(NSURL *)journalUrl error:(NSError **)error;
+- (void)recordFileUrl:(NSURL *)fileUrl
+             fileSize:(NSUInteger)fileSize
+     modificationDate:(NSDate *)modificationDate
+           commitInfo:(DBFILESCommitInfo *)commitInfo;
+- (void)recordSessionId:(NSString *)sessionId concurrent:(BOOL)concurrent fileUrl:(NSURL *)fileUrl;
+- (void)recordCommittedRangeWithStartBytes:(NSUInteger)startBytes
+                                  endBytes:(NSUInteger)endBytes
+                                   fileUrl:(NSURL *)fileUrl;
+- (void)recordSessionClosedForFileUrl:(NSURL *)fileUrl;
+- (void)recordSessionFinishedForFileUrl:(NSURL *)fileUrl;
+@end
+
+static NSString *const kFileUrl = @"file:///tmp/photo.jpg";
+static NSString *const kFileRecord =
+    @"{\"type\":\"file\",\"url\":\"file:///tmp/photo.jpg\",\"size\":100,\"commit\":{\"path\":\"/photo.jpg\"}}";
+
+@interface TestBatchUploadJournal : XCTestCase
+
+@end
+
+@implementation TestBatchUploadJournal
+
++ (NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *)entriesWithLines:(NSArray<NSString *> *)lines {
+    NSString *contents = [[lines componentsJoinedByString:@"\n"] stringByAppendingString:@"\n"];
+    return [DBBatchUploadJournal entriesWithContents:[contents dataUsingEncoding:NSUTF8StringEncoding]];
+}
+
+- (void)testReadsFileSessionRangesAndClose {
+    NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *entries = [TestBatchUploadJournal entriesWithLines:@[
+        kFileRecord,
+        @"{\"type\":\"session\",\"url\":\"file:///tmp/photo.jpg\",\"session_id\":\"session-1\",\"concurrent\":true}",
+        @"{\"type\":\"range\",\"url\":\"file:///tmp/photo.jpg\",\"start\":0,\"end\":40}",
+        @"{\"type\":\"range\",\"url\":\"file:///tmp/photo.jpg\",\"start\":60,\"end\":100}",
+        @"{\"type\":\"closed\",\"url\":\"file:///tmp/photo.jpg\"}",
+    ]];
+
+    DBBatchUploadJournalEntry *entry = entries[[NSURL URLWithString:kFileUrl]];
+    XCTAssertEqual(entries.count, (NSUInteger)1);
+    XCTAssertEqual(entry.fileSize, (NSUInteger)100);
+    XCTAssertEqualObjects(entry.commitInfo.path, @"/photo.jpg");
+    XCTAssertEqualObjects(entry.sessionId, @"session-1");
+    XCTAssertTrue(entry.concurrent);
+    XCTAssertEqual(entry.committedRanges.count, (NSUInteger)80);
+    XCTAssertFalse([entry.committedRanges containsIndexesInRange:NSMakeRange(40, 20)]);
+    XCTAssertTrue(entry.closed);
+    XCTAssertFalse(entry.finished);
+    XCTAssertEqualWithAccuracy(entry.modificationDate.timeIntervalSince1970, 1431445838.123456, 0.001);
+    XCTAssertTrue([entry isResumableWithFileSize:100 modificationDate:modificationDate]);
+}
+
+- (void)testSkipsTruncatedLastLine {
+    NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *entries = [TestBatchUploadJournal entriesWithLines:@[
+        kFileRecord,
+        @"{\"type\":\"session\",\"url\":\"file:///tmp/photo.jpg\",\"session_id\":\"session-1\",\"concurrent\":true}",
+        @"{\"type\":\"range\",\"url\":\"file:///tmp/photo.jpg\",\"start\":0,\"end\":40}",
+        @"{\"type\":\"range\",\"url\":\"file:///tmp/pho",
+    ]];
+
+    DBBatchUploadJournalEntry *entry = entries[[NSURL URLWithString:kFileUrl]];
+    XCTAssertEqualObjects(entry.sessionId, @"session-1");
+    XCTAssertEqual(entry.committedRanges.count, (NSUInteger)40);
+}
+
+- (void)testIgnoresRangesOutsideTheFile {
+    NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *entries = [TestBatchUploadJournal entriesWithLines:@[
+        kFileRecord,
+        @"{\"type\":\"session\",\"url\":\"file:///tmp/photo.jpg\",\"session_id\":\"session-1\",\"concurrent\":true}",
+        @"{\"type\":\"range\",\"url\":\"file:///tmp/photo.jpg\",\"start\":60,\"end\":120}",
+        @"{\"type\":\"range\",\"url\":\"file:///tmp/photo.jpg\",\"start\":40,\"end\":40}",
+        @"{\"type\":\"range\",\"url\":\"file:///tmp/other.jpg\",\"start\":0,\"end\":40}",
+    ]];
+
+    XCTAssertEqual(entries.count, (NSUInteger)1);
+    XCTAssertEqual(entries[[NSURL URLWithString:kFileUrl]].committedRanges.count, (NSUInteger)0);
+}
+
+- (void)testNewSessionResetsProgress {
+    NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *entries = [TestBatchUploadJournal entriesWithLines:@[
+        kFileRecord,
+        @"{\"type\":\"session\",\"url\":\"file:///tmp/photo.jpg\",\"session_id\":\"session-1\",\"concurrent\":true}",
+        @"{\"type\":\"range\",\"url\":\"file:///tmp/photo.jpg\",\"start\":0,\"end\":40}",
+        @"{\"type\":\"closed\",\"url\":\"file:///tmp/photo.jpg\"}",
+        @"{\"type\":\"session\",\"url\":\"file:///tmp/photo.jpg\",\"session_id\":\"session-2\",\"concurrent\":false}",
+    ]];
+
+    DBBatchUploadJournalEntry *entry = entries[[NSURL URLWithString:kFileUrl]];
+    XCTAssertEqualObjects(entry.sessionId, @"session-2");
+    XCTAssertFalse(entry.concurrent);
+    XCTAssertEqual(entry.committedRanges.count, (NSUInteger)0);
+    XCTAssertFalse(entry.closed);
+}
+
+- (void)testFinishedOnlyAfterClose {
+    NSDictionary<NSURL *, DBBatchUploadJournalEntry *> *entries = [TestBatchUploadJournal entriesWithLines:@[
+        kFileRecord,
+        @"{\"type\":\"session\",\"url\":\"file:///tmp/photo.jpg\",\"session_id\":\"session-1\",\"concurrent\":true}",
+        @"{\"type\":\"finished\",\"url\":\"file:///tmp/photo.jpg\"}",
+    ]];
+    XCTAssertFalse(entries[[NSURL URLWithString:kFileUrl]].finished);
+
+    entries = [TestBatchUploadJournal entriesWithLines:@[
+        kFileRecord,
+        @"{\"type\":\"session\",\"url\":\"file:///tmp/photo.jpg\",\"session_id\":\"session-1\",\"concurrent\":true}",
+        @"{\"type\":\"closed\",\"url\":\"file:///tmp/photo.jpg\"}",
+        @"{\"type\":\"finished\",\"url\":\"file:///tmp/photo.jpg\"}",
+    ]];
+    XCTAssertTrue(entries[[NSURL URLWithString:kFileUrl]].finished);
+}
+
+- (void)testModifiedFileOfSameSizeIsNotResumed {
+    NSString *fileRecord = @"{\"type\":\"file\",\"url\":\"file:///tmp/photo.jpg\",\"size\":100,"
+                            "\"modified\":1431445838.5,\"commit\":{\"path\":\"/photo.jpg\"}}";
+    DBBatchUploadJournalEntry *entry = [TestBatchUploadJournal entriesWithLines:@[
+        fileRecord,
+        @"{\"type\":\"session\",\"url\":\"file:///tmp/photo.jpg\",\"session_id\":\"s1\",\"concurrent\":false}",
+        @"{\"type\":\"range\",\"url\":\"file:///tmp/photo.jpg\",\"start\":0,\"end\":40}",
+    ]][[NSURL URLWithString:kFileUrl]];
+    NSDate *journaledDate = [NSDate dateWithTimeIntervalSince1970:1431445838.5];
+
+    XCTAssertTrue([entry isResumableWithFileSize:100 modificationDate:journaledDate]);
+    // edited in place, keeping its size
+    XCTAssertFalse([entry isResumableWithFileSize:100 modificationDate:[journaledDate dateByAddingTimeInterval:1]]);
+    XCTAssertFalse([entry isResumableWithFileSize:120 modificationDate:journaledDate]);
+}
+
+- (void)testEntryWithoutSessionOrDateIsNotResumed {
+    NSDate *date = [NSDate date];
+    DBBatchUploadJournalEntry *entry = [TestBatchUploadJournal entriesWithLines:@[
+        kFileRecord,
+        @"{\"type\":\"session\",\"url\":\"file:///tmp/photo.jpg\",\"session_id\":\"s1\",\"concurrent\":false}",
+    ]][[NSURL URLWithString:kFileUrl]];
+    // journaled without a modification date, so a change can't be ruled out
+    XCTAssertNil(entry.modificationDate);
+    XCTAssertFalse([entry isResumableWithFileSize:100 modificationDate:date]);
+}
+
+- (void)testWrittenRecordsReadBack {
+    NSURL *journalUrl = [NSURL fileURLWithPath:[NSTemporaryDirectory()
+                                                   stringByAppendingPathComponent:[NSUUID UUID].UUIDString]];
+    NSURL *fileUrl = [NSURL URLWithString:kFileUrl];
+    DBBatchUploadJournal *journal = [[DBBatchUploadJournal alloc] initWithNewJournalUrl:journalUrl error:nil];
+    XCTAssertNotNil(journal);
+    XCTAssertEqual(journal.entries.count, (NSUInteger)0);
+
+    NSDate *modificationDate = [NSDate dateWithTimeIntervalSince1970:1431445838.123456];
+    [journal recordFileUrl:fileUrl
+                  fileSize:100
+          modificationDate:modificationDate
+                commitInfo:[[DBFILESCommitInfo alloc] initWithPath:@"/photo.jpg"]];
+    [journal recordSessionId:@"session-1" concurrent:YES fileUrl:fileUrl];
+    [journal recordCommittedRangeWithStartBytes:0 endBytes:40 fileUrl:fileUrl];
+    [journal recordCommittedRangeWithStartBytes:40 endBytes:100 fileUrl:fileUrl];
+    [journal recordSessionClosedForFileUrl:fileUrl];
+
+    // records are written asynchronously
+    NSPredicate *written = [NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+#pragma unused(object)
+#pragma unused(bindings)
+        NSString *contents = [NSString stringWithContentsOfURL:journalUrl encoding:NSUTF8StringEncoding error:nil];
+        return [contents componentsSeparatedByString:@"\n"].count == 6;
+    }];
+    [self waitForExpectations:@[ [self expectationForPredicate:written evaluatedWithObject:self handler:nil] ]
+                      timeout:10];
+
+    // as if the process was terminated while writing another record
+    NSFileHandle *fileHandle = [NSFileHandle fileHandleForWritingToURL:journalUrl error:nil];
+    [fileHandle seekToEndOfFile];
+    [fileHandle writeData:[@"{\"type\":\"fin" dataUsingEncoding:NSUTF8StringEncoding]];
+    [fileHandle closeFile];
+
+    DBBatchUploadJournal *resumed = [[DBBatchUploadJournal alloc] initWithExistingJournalUrl:journalUrl error:nil];
+    DBBatchUploadJournalEntry *entry = resumed.entries[fileUrl];
+    XCTAssertEqual(resumed.entries.count, (NSUInteger)1);
+    XCTAssertEqualObjects(entry.commitInfo.path, @"/photo.jpg");
+    XCTAssertEqualObjects(entry.sessionId, @"session-1");
+    XCTAssertTrue([entry.committedRanges containsIndexesInRange:NSMakeRange(0, 100)]);
+    XCTAssertTrue(entry.closed);
+    XCTAssertFalse(entry.finished);
+
+    [[NSFileManager defaultManager] removeItemAtURL:journalUrl error:nil];
+}
+
+@end
@@ -0,0 +1,294 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkPayloads.h"
+#import "DBBenchmarkReporter.h"
+#import "DBBenchmarkStubProtocol.h"
+#import "DBBenchmarkTestCase.h"
+
+@interface DBTransportBaseClient (Benchmarks)
+- (NSDictionary *)headersWithRoute:(DBRoute *)route
+                     serializedArg:(NSString *)serializedArg
+                   byteOffsetStart:(NSNumber *)byteOffsetStart
+                     byteOffsetEnd:(NSNumber *)byteOffsetEnd;
++ (NSData *)serializeDataWithRoute:(DBRoute *)route routeArg:(id<DBSerializable>)arg;
++ (id)routeResultWithRoute:(DBRoute *)route data:(NSData *)data serializationError:(NSError **)serializationError;
+@end
+
+// entries per response page, the default page size of the listing routes
+static const NSUInteger kPageEntryCount = 1000;
+static const NSUInteger kRequestCount = 1000;
+static const NSUInteger kRoundTripCount = 200;
+static const NSUInteger kMemberCount = 200;
+static const NSUInteger kBatchFileCount = 100;
+static const NSUInteger kBatchFileSize = 64 * 1024;
+
+static NSString *const kFileMetadataJSON =
+    @"{\".tag\": \"file\", \"name\": \"Prime_Numbers.txt\", \"id\": \"id:a4ayc_80_OEAAAAAAAAAXw\", "
+     "\"client_modified\": \"2015-05-12T15:50:38Z\", \"server_modified\": \"2015-05-12T15:50:38Z\", "
+     "\"rev\": \"a1c10ce0dd78\", \"size\": 7212, \"path_lower\": \"/homework/math/prime_numbers.txt\", "
+     "\"path_display\": \"/Homework/math/Prime_Numbers.txt\", \"is_downloadable\": true, \"content_hash\": "
+     "\"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855\"}";
+
+///
+/// Benchmarks of the SDK's own overhead, against a local stand-in for the API servers.
+///
+/// Each case is recorded by `DBBenchmarkReporter`, which writes all results as JSON for comparison between releases.
+/// Run headless with `run_benchmarks.sh`; the default test run skips them.
+///
+@interface TestBenchmarks : DBBenchmarkTestCase
+
+@end
+
+@implementation TestBenchmarks {
+    DBTransportDefaultClient *_transportClient;
+    DBUserClient *_client;
+    NSOperationQueue *_responseQueue;
+}
+
++ (void)setUp {
+    [super setUp];
+    // before any client creates its sessions
+    [DBBenchmarkStubProtocol install];
+}
+
+- (void)setUp {
+    [super setUp];
+    DBTransportDefaultConfig *config = [[DBTransportDefaultConfig alloc] initWithAppKey:@"app-key"
+                                                                              appSecret:@"app-secret"
+                                                                              userAgent:@"DBBenchmarks"
+                                                                          delegateQueue:nil
+                                                                 forceForegroundSession:YES];
+    _transportClient = [[DBTransportDefaultClient alloc] initWithAccessToken:@"sl.benchmark-token"
+                                                                    tokenUid:nil
+                                                             transportConfig:config];
+    _client = [[DBUserClient alloc] initWithTransportClient:_transportClient];
+    // the test waits on the main thread, so responses are handled elsewhere
+    _responseQueue = [NSOperationQueue new];
+
+    [DBBenchmarkStubProtocol setJSONResponse:[kFileMetadataJSON dataUsingEncoding:NSUTF8StringEncoding]
+                                     forPath:@"/2/files/get_metadata"];
+}
+
+- (void)tearDown {
+    [DBBenchmarkStubProtocol removeAllResponders];
+    [super tearDown];
+}
+
+- (BOOL)isBenchmark {
+    return YES;
+}
+
+#pragma mark - Request construction
+
+- (void)testRequestRpcBuild {
+    DBRoute *route = [DBFILESRouteObjects DBFILESGetMetadata];
+    DBFILESGetMetadataArg *arg = [[DBFILESGetMetadataArg alloc] initWithPath:@"/Homework/math/Prime_Numbers.txt"];
+    NSMutableArray<DBRpcTask *> *tasks = [NSMutableArray arrayWithCapacity:kRequestCount];
+    [[DBBenchmarkReporter sharedReporter] measure:@"request.rpc.build"
+                                       operations:kRequestCount
+                                            block:^{
+                                                for (NSUInteger i = 0; i < kRequestCount; i++) {
+                                                    [tasks addObject:[self->_transportClient requestRpc:route arg:arg]];
+                                                }
+                                            }];
+    for (DBRpcTask *task in tasks) {
+        [task cancel];
+    }
+}
+
+- (void)testHeaderConstruction {
+    DBRoute *route = [DBFILESRouteObjects DBFILESGetMetadata];
+    NSString *serializedArg = @"{\"path\":\"/Homework/math/Prime_Numbers.txt\"}";
+    [[DBBenchmarkReporter sharedReporter] measure:@"request.headers"
+                                       operations:kRequestCount * 10
+                                            block:^{
+                                                for (NSUInteger i = 0; i < kRequestCount * 10; i++) {
+                                                    [self->_transportClient headersWithRoute:route
+                                                                               serializedArg:serializedArg
+                                                                             byteOffsetStart:nil
+                                                                               byteOffsetEnd:nil];
+                                                }
+                                            }];
+}
+
+#pragma mark - Serialization
+
+- (void)measureSerializationOfPayload:(NSData *)payload
+                                route:(DBRoute *)route
+                           entryCount:(NSUInteger)entryCount
+                                 name:(NSString *)name {
+    DBBenchmarkReporter *reporter = [DBBenchmarkReporter sharedReporter];
+    Class<DBSerializable> resultType = route.resultType;
+
+    NSError *error;
+    id result = [DBTransportBaseClient routeResultWithRoute:route data:payload serializationError:&error];
+    XCTAssertNotNil(result, @"%@: %@", name, error);
+    id json = [NSJSONSerialization JSONObjectWithData:payload options:0 error:nil];
+
+    // bytes to API object, the way a response is decoded
+    [reporter measure:[NSString stringWithFormat:@"serialization.%@.decode", name]
+           operations:entryCount
+                block:^{
+                    [DBTransportBaseClient routeResultWithRoute:route data:payload serializationError:nil];
+                }];
+    [reporter measure:[NSString stringWithFormat:@"serialization.%@.deserialize", name]
+           operations:entryCount
+                block:^{
+                    [resultType deserialize:json];
+                }];
+    [reporter measure:[NSString stringWithFormat:@"serialization.%@.serialize", name]
+           operations:entryCount
+                block:^{
+                    [DBTransportBaseClient serializeDataWithRoute:nil routeArg:result];
+                }];
+}
+
+- (void)testSerializationThroughput {
+    [self measureSerializationOfPayload:DBBenchmarkListFolderPayload(kPageEntryCount)
+                                  route:[DBFILESRouteObjects DBFILESListFolder]
+                             entryCount:kPageEntryCount
+                                   name:@"files.list_folder"];
+    [self measureSerializationOfPayload:DBBenchmarkMembersListPayload(kPageEntryCount)
+                                  route:[DBTEAMRouteObjects DBTEAMMembersList]
+                             entryCount:kPageEntryCount
+                                   name:@"team.members_list"];
+    [self measureSerializationOfPayload:DBBenchmarkGetEventsPayload(kPageEntryCount)
+                                  route:[DBTEAMLOGRouteObjects DBTEAMLOGGetEvents]
+                             entryCount:kPageEntryCount
+                                   name:@"team_log.get_events"];
+    [self measureSerializationOfPayload:DBBenchmarkFullAccountPayload()
+                                  route:[DBUSERSRouteObjects DBUSERSGetCurrentAccount]
+                             entryCount:1
+                                   name:@"users.get_current_account"];
+}
+
+#pragma mark - Dispatch
+
+- (void)testRpcRoundTrip {
+    // request setup, the stubbed exchange, `DBDelegate` dispatch, decoding and the hop to the response queue
+    DBFILESUserAuthRoutes *filesRoutes = _client.filesRoutes;
+    NSOperationQueue *responseQueue = _responseQueue;
+    [[DBBenchmarkReporter sharedReporter]
+        measureAsync:@"dispatch.rpc.round_trip"
+          operations:kRoundTripCount
+               block:^(dispatch_block_t completion) {
+                   dispatch_group_t group = dispatch_group_create();
+                   for (NSUInteger i = 0; i < kRoundTripCount; i++) {
+                       dispatch_group_enter(group);
+                       [[filesRoutes getMetadata:@"/Homework/math/Prime_Numbers.txt"]
+                           setResponseBlock:^(DBFILESMetadata *result, DBFILESGetMetadataError *routeError,
+                                              DBRequestError *networkError) {
+#pragma unused(result)
+#pragma unused(routeError)
+#pragma unused(networkError)
+                               dispatch_group_leave(group);
+                           }
+                                      queue:responseQueue];
+                   }
+                   dispatch_group_notify(group, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), completion);
+               }];
+}
+
+#pragma mark - Team member clients
+
+- (void)measureMemberClientCreationWithSharedSessions:(BOOL)sharesSessions name:(NSString *)name {
+    DBTeamClient *teamClient = [[DBTeamClient alloc] initWithTransportClient:_transportClient];
+    teamClient.sharesSessionsWithMemberClients = sharesSessions;
+    NSMutableArray<DBUserClient *> *clients = [NSMutableArray arrayWithCapacity:kMemberCount];
+    [[DBBenchmarkReporter sharedReporter] measure:name
+                                       operations:kMemberCount
+                                            block:^{
+                                                for (NSUInteger i = 0; i < kMemberCount; i++) {
+                                                    NSString *memberId =
+                                                        [NSString stringWithFormat:@"dbmid:%lu", (unsigned long)i];
+                                                    // kept alive, as a job working through the members would
+                                                    [clients addObject:[teamClient userClientWithMemberId:memberId]];
+                                                }
+                                                [clients removeAllObjects];
+                                            }];
+}
+
+- (void)testMemberClientCreation {
+    [self measureMemberClientCreationWithSharedSessions:NO name:@"client.team_member.create"];
+    [self measureMemberClientCreationWithSharedSessions:YES name:@"client.team_member.create_shared"];
+}
+
+#pragma mark - Batch upload
+
++ (NSDictionary<NSURL *, DBFILESCommitInfo *> *)batchFiles {
+    NSString *directory = [NSTemporaryDirectory() stringByAppendingPathComponent:@"DBBenchmarks"];
+    [[NSFileManager defaultManager] createDirectoryAtPath:directory
+                              withIntermediateDirectories:YES
+                                               attributes:nil
+                                                    error:nil];
+    NSData *contents = [NSMutableData dataWithLength:kBatchFileSize];
+    NSMutableDictionary<NSURL *, DBFILESCommitInfo *> *files = [NSMutableDictionary new];
+    for (NSUInteger i = 0; i < kBatchFileCount; i++) {
+        NSString *name = [NSString stringWithFormat:@"IMG_%04lu.jpg", (unsigned long)i];
+        NSURL *url = [NSURL fileURLWithPath:[directory stringByAppendingPathComponent:name]];
+        [contents writeToURL:url atomically:NO];
+        files[url] = [[DBFILESCommitInfo alloc] initWithPath:[@"/Camera Uploads/" stringByAppendingString:name]];
+    }
+    return files;
+}
+
+- (void)stubUploadSessions {
+    [DBBenchmarkStubProtocol setJSONResponse:[@"{\"session_id\": \"pid_upload_session:ABIJVGHD\"}"
+                                                 dataUsingEncoding:NSUTF8StringEncoding]
+                                     forPath:@"/2/files/upload_session/start"];
+    [DBBenchmarkStubProtocol
+        setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+#pragma unused(statusCode)
+            // commit every entry of the request, in order
+            NSDictionary *arg = [NSJSONSerialization JSONObjectWithData:request.HTTPBody options:0 error:nil];
+            NSMutableArray *entries = [NSMutableArray new];
+            for (NSDictionary *entry in arg[@"entries"]) {
+                NSString *path = entry[@"commit"][@"path"];
+                [entries addObject:@{
+                    @".tag" : @"success",
+                    @"name" : path.lastPathComponent,
+                    @"id" : @"id:a4ayc_80_OEAAAAAAAAAXw",
+                    @"client_modified" : @"2015-05-12T15:50:38Z",
+                    @"server_modified" : @"2015-05-12T15:50:38Z",
+                    @"rev" : @"a1c10ce0dd78",
+                    @"size" : entry[@"cursor"][@"offset"],
+                    @"path_lower" : path.lowercaseString,
+                    @"path_display" : path,
+                }];
+            }
+            *headers = @{ @"Content-Type" : @"application/json" };
+            return [NSJSONSerialization dataWithJSONObject:@{ @"entries" : entries } options:0 error:nil];
+        }
+             forPath:@"/2/files/upload_session/finish_batch_v2"];
+}
+
+- (void)testBatchUploadThroughput {
+    [self stubUploadSessions];
+    NSDictionary<NSURL *, DBFILESCommitInfo *> *files = [TestBenchmarks batchFiles];
+    DBFILESUserAuthRoutes *filesRoutes = _client.filesRoutes;
+    NSOperationQueue *responseQueue = _responseQueue;
+    __block NSUInteger committed = 0;
+    [[DBBenchmarkReporter sharedReporter]
+        measureAsync:@"batch_upload.small_files"
+          operations:kBatchFileCount
+               block:^(dispatch_block_t completion) {
+                   [filesRoutes batchUploadFiles:files
+                                           queue:responseQueue
+                                   progressBlock:nil
+                                   responseBlock:^(NSDictionary<NSURL *, DBFILESUploadSessionFinishBatchResultEntry *>
+                                                       *fileUrlsToBatchResultEntries,
+                                                   DBASYNCPollError *finishBatchRouteError,
+                                                   DBRequestError *finishBatchRequestError,
+                                                   NSDictionary<NSURL *, DBRequestError *> *fileUrlsToRequestErrors) {
+#pragma unused(finishBatchRouteError)
+#pragma unused(finishBatchRequestError)
+#pragma unused(fileUrlsToRequestErrors)
+                                       committed = fileUrlsToBatchResultEntries.count;
+                                       completion();
+                                   }];
+               }];
+    XCTAssertEqual(committed, kBatchFileCount);
+}
+
+@end
@@ -0,0 +1,120 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+static const NSUInteger kMB = 1024 * 1024;
+
+@interface TestChunkSizePolicy : XCTestCase
+
+@end
+
+@implementation TestChunkSizePolicy
+
+- (DBAdaptiveChunkSizePolicy *)policy {
+    // one second per chunk keeps the expected sizes easy to work out
+    return [[DBAdaptiveChunkSizePolicy alloc] initWithMinChunkSize:4 * kMB
+                                                      maxChunkSize:148 * kMB
+                                               targetChunkDuration:1];
+}
+
+- (void)testAdaptiveStartsAtEightMegabytes {
+    XCTAssertEqual([[DBAdaptiveChunkSizePolicy new] chunkSize], 8 * kMB);
+    XCTAssertEqual([[self policy] chunkSize], 8 * kMB);
+}
+
+- (void)testAdaptiveGrowsAtMostTwofoldPerSample {
+    DBAdaptiveChunkSizePolicy *policy = [self policy];
+
+    // far faster than any chunk size needs
+    [policy recordChunkUploadOfSize:8 * kMB duration:0.001];
+    XCTAssertEqual([policy chunkSize], 16 * kMB);
+    [policy recordChunkUploadOfSize:16 * kMB duration:0.001];
+    XCTAssertEqual([policy chunkSize], 32 * kMB);
+    [policy recordChunkUploadOfSize:32 * kMB duration:0.001];
+    XCTAssertEqual([policy chunkSize], 64 * kMB);
+    [policy recordChunkUploadOfSize:64 * kMB duration:0.001];
+    XCTAssertEqual([policy chunkSize], 128 * kMB);
+    [policy recordChunkUploadOfSize:128 * kMB duration:0.001];
+    XCTAssertEqual([policy chunkSize], 148 * kMB);
+}
+
+- (void)testAdaptiveShrinksToThroughput {
+    DBAdaptiveChunkSizePolicy *policy = [self policy];
+
+    // 0.8 MB/s, which is below the smallest chunk size
+    [policy recordChunkUploadOfSize:8 * kMB duration:10];
+    XCTAssertEqual([policy chunkSize], 4 * kMB);
+}
+
+- (void)testAdaptiveIgnoresEmptySamples {
+    DBAdaptiveChunkSizePolicy *policy = [self policy];
+
+    [policy recordChunkUploadOfSize:0 duration:1];
+    [policy recordChunkUploadOfSize:8 * kMB duration:0];
+    XCTAssertEqual([policy chunkSize], 8 * kMB);
+}
+
+- (void)testAdaptiveHalvesOnFailure {
+    DBAdaptiveChunkSizePolicy *policy = [self policy];
+    [policy recordChunkUploadOfSize:8 * kMB duration:0.1];
+    [policy recordChunkUploadOfSize:16 * kMB duration:0.2];
+    XCTAssertEqual([policy chunkSize], 32 * kMB);
+
+    [policy recordChunkUploadFailureOfSize:32 * kMB];
+    XCTAssertEqual([policy chunkSize], 16 * kMB);
+    [policy recordChunkUploadFailureOfSize:16 * kMB];
+    XCTAssertEqual([policy chunkSize], 8 * kMB);
+    [policy recordChunkUploadFailureOfSize:8 * kMB];
+    XCTAssertEqual([policy chunkSize], 4 * kMB);
+    [policy recordChunkUploadFailureOfSize:4 * kMB];
+    XCTAssertEqual([policy chunkSize], 4 * kMB);
+}
+
+- (void)testAdaptiveHoldsGrowthWhileErrorRateIsHigh {
+    DBAdaptiveChunkSizePolicy *policy = [self policy];
+    [policy recordChunkUploadFailureOfSize:8 * kMB];
+    XCTAssertEqual([policy chunkSize], 4 * kMB);
+
+    // the error rate of 0.3 decays by 0.7 per success: 0.21, 0.147, 0.103, then 0.072 lets the size grow again
+    for (NSUInteger i = 0; i < 3; i++) {
+        [policy recordChunkUploadOfSize:4 * kMB duration:0.01];
+        XCTAssertEqual([policy chunkSize], 4 * kMB);
+    }
+    [policy recordChunkUploadOfSize:4 * kMB duration:0.01];
+    XCTAssertEqual([policy chunkSize], 8 * kMB);
+}
+
+- (void)testAdaptiveClampsToLimits {
+    DBAdaptiveChunkSizePolicy *policy = [[DBAdaptiveChunkSizePolicy alloc] initWithMinChunkSize:6 * kMB
+                                                                                   maxChunkSize:1024 * kMB
+                                                                            targetChunkDuration:1];
+    XCTAssertEqual(policy.minChunkSize, 4 * kMB);
+    XCTAssertEqual(policy.maxChunkSize, 148 * kMB);
+
+    policy = [[DBAdaptiveChunkSizePolicy alloc] initWithMinChunkSize:0 maxChunkSize:0 targetChunkDuration:1];
+    XCTAssertEqual(policy.minChunkSize, 4 * kMB);
+    XCTAssertEqual(policy.maxChunkSize, 4 * kMB);
+    XCTAssertEqual([policy chunkSize], 4 * kMB);
+
+    policy = [[DBAdaptiveChunkSizePolicy alloc] initWithMinChunkSize:12 * kMB
+                                                        maxChunkSize:18 * kMB
+                                                 targetChunkDuration:1];
+    XCTAssertEqual([policy chunkSize], 12 * kMB);
+    [policy recordChunkUploadOfSize:12 * kMB duration:0.01];
+    XCTAssertEqual([policy chunkSize], 16 * kMB);
+    [policy recordChunkUploadFailureOfSize:16 * kMB];
+    XCTAssertEqual([policy chunkSize], 12 * kMB);
+}
+
+- (void)testFixedKeepsItsSize {
+    DBFixedChunkSizePolicy *policy = [[DBFixedChunkSizePolicy alloc] initWithChunkSize:10 * kMB];
+    [policy recordChunkUploadOfSize:10 * kMB duration:0.01];
+    XCTAssertEqual([policy chunkSize], 10 * kMB);
+    [policy recordChunkUploadFailureOfSize:10 * kMB];
+    XCTAssertEqual([policy chunkSize], 10 * kMB);
+}
+
+- (void)testFixedCapsAtServerLimit {
+    XCTAssertEqual([[[DBFixedChunkSizePolicy alloc] initWithChunkSize:200 * kMB] chunkSize], 148 * kMB);
+}
+
+@end
@@ -0,0 +1,206 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+@interface DBClientRegistry<ClientType> : NSObject
+- (instancetype)initWithClientFactory:(ClientType (^)(DBAccessToken *token))clientFactory;
+@property (atomic) NSUInteger maxActiveClients;
+@property (atomic, copy) NSString *defaultTokenUid;
+@property (nonatomic, readonly) NSArray<NSString *> *tokenUids;
+- (void)registerToken:(DBAccessToken *)token;
+- (void)removeTokenUid:(NSString *)tokenUid;
+- (ClientType)clientForTokenUid:(NSString *)tokenUid;
+- (ClientType)defaultClient;
+- (NSDictionary<NSString *, ClientType> *)allClients;
+@end
+
+@interface DBLongLivedAccessTokenProvider : NSObject <DBAccessTokenProvider>
+- (instancetype)initWithTokenString:(NSString *)tokenString;
+@end
+
+@interface DBTransportDefaultClient ()
+- (instancetype)initSharingSessionsOfClient:(DBTransportDefaultClient *)client
+                        accessTokenProvider:(id<DBAccessTokenProvider>)accessTokenProvider
+                                   tokenUid:(NSString *)tokenUid
+                            transportConfig:(DBTransportDefaultConfig *)transportConfig;
+@end
+
+// linked accounts of a multi-account app, and threads looking up their clients
+static const NSUInteger kAccountCount = 100;
+static const NSUInteger kThreadCount = 8;
+static const NSUInteger kLookupCount = 20000;
+
+@interface TestClientRegistry : DBBenchmarkTestCase
+
+@end
+
+@implementation TestClientRegistry
+
++ (NSArray<DBAccessToken *> *)tokens {
+    NSMutableArray<DBAccessToken *> *tokens = [NSMutableArray new];
+    for (NSUInteger i = 0; i < kAccountCount; i++) {
+        NSString *uid = [NSString stringWithFormat:@"%lu", (unsigned long)(100000 + i)];
+        [tokens addObject:[DBAccessToken createWithLongLivedAccessToken:[@"token-" stringByAppendingString:uid]
+                                                                    uid:uid]];
+    }
+    return tokens;
+}
+
+// Creates an object per client, recording the uids of the clients created in `created`.
++ (DBClientRegistry<NSObject *> *)registryCountingCreatedClients:(NSMutableArray<NSString *> *)created {
+    DBClientRegistry<NSObject *> *registry = [[DBClientRegistry alloc] initWithClientFactory:^(DBAccessToken *token) {
+        @synchronized(created) {
+            [created addObject:token.uid];
+        }
+        return [NSObject new];
+    }];
+    for (DBAccessToken *token in [TestClientRegistry tokens]) {
+        [registry registerToken:token];
+    }
+    return registry;
+}
+
+- (void)testCreatesClientsOnFirstLookup {
+    NSMutableArray<NSString *> *created = [NSMutableArray new];
+    DBClientRegistry<NSObject *> *registry = [TestClientRegistry registryCountingCreatedClients:created];
+    XCTAssertEqual(registry.tokenUids.count, kAccountCount);
+    XCTAssertEqual(created.count, (NSUInteger)0);
+
+    NSObject *client = [registry clientForTokenUid:@"100001"];
+    XCTAssertNotNil(client);
+    XCTAssertEqual([registry clientForTokenUid:@"100001"], client);
+    XCTAssertEqualObjects(created, @[ @"100001" ]);
+    XCTAssertNil([registry clientForTokenUid:@"unknown"]);
+
+    XCTAssertEqual([registry allClients].count, kAccountCount);
+    XCTAssertEqual(created.count, kAccountCount);
+
+    [registry removeTokenUid:@"100001"];
+    XCTAssertNil([registry clientForTokenUid:@"100001"]);
+}
+
+- (void)testCreatesEachClientOnceUnderContention {
+    NSMutableArray<NSString *> *created = [NSMutableArray new];
+    DBClientRegistry<NSObject *> *registry = [TestClientRegistry registryCountingCreatedClients:created];
+    dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+        for (DBAccessToken *token in [TestClientRegistry tokens]) {
+            XCTAssertNotNil([registry clientForTokenUid:token.uid]);
+        }
+    });
+    XCTAssertEqual(created.count, kAccountCount);
+}
+
+- (void)testReleasesLeastRecentlyUsedClients {
+    NSMutableArray<NSString *> *created = [NSMutableArray new];
+    DBClientRegistry<NSObject *> *registry = [TestClientRegistry registryCountingCreatedClients:created];
+    registry.maxActiveClients = 2;
+    registry.defaultTokenUid = @"100000";
+
+    NSObject *defaultClient = [registry defaultClient];
+    // nothing else holds on to the clients once the pool drains
+    @autoreleasepool {
+        [registry clientForTokenUid:@"100001"];
+        [registry clientForTokenUid:@"100002"];
+        // 100001 is the one used least recently after this
+        [registry clientForTokenUid:@"100002"];
+        [registry clientForTokenUid:@"100003"];
+        XCTAssertEqual(created.count, (NSUInteger)4);
+
+        // still there
+        [registry clientForTokenUid:@"100002"];
+        [registry clientForTokenUid:@"100003"];
+        XCTAssertEqual([registry defaultClient], defaultClient);
+        XCTAssertEqual(created.count, (NSUInteger)4);
+    }
+
+    // released, so created again
+    [registry clientForTokenUid:@"100001"];
+    XCTAssertEqual(created.count, (NSUInteger)5);
+    XCTAssertEqualObjects(created.lastObject, @"100001");
+    XCTAssertEqual([registry defaultClient], defaultClient);
+}
+
+- (void)testHandsOutReleasedClientStillInUse {
+    NSMutableArray<NSString *> *created = [NSMutableArray new];
+    DBClientRegistry<NSObject *> *registry = [TestClientRegistry registryCountingCreatedClients:created];
+    registry.maxActiveClients = 1;
+
+    NSObject *client = [registry clientForTokenUid:@"100001"];
+    @autoreleasepool {
+        // releases 100001, which is still held here
+        [registry clientForTokenUid:@"100002"];
+        XCTAssertEqual(created.count, (NSUInteger)2);
+
+        // the same client, rather than a second one refreshing the same token
+        XCTAssertEqual([registry clientForTokenUid:@"100001"], client);
+        XCTAssertEqual(created.count, (NSUInteger)2);
+    }
+
+    // which released 100002, held by nothing else, so it is created again
+    [registry clientForTokenUid:@"100002"];
+    XCTAssertEqual(created.count, (NSUInteger)3);
+    XCTAssertEqualObjects(created.lastObject, @"100002");
+}
+
+- (void)testSharedSessionClientsAuthorizeAsTheirAccount {
+    DBTransportDefaultConfig *config = [[DBTransportDefaultConfig alloc] initWithAppKey:@"app-key"
+                                                                              appSecret:@"app-secret"
+                                                                              userAgent:nil
+                                                                          delegateQueue:nil
+                                                                 forceForegroundSession:YES];
+    DBTransportDefaultClient *owner = [[DBTransportDefaultClient alloc] initWithAccessTokenProvider:nil
+                                                                                          tokenUid:nil
+                                                                                   transportConfig:config];
+    NSMutableArray<DBTransportDefaultClient *> *clients = [NSMutableArray new];
+    for (DBAccessToken *token in [[TestClientRegistry tokens] subarrayWithRange:NSMakeRange(0, 2)]) {
+        id<DBAccessTokenProvider> provider =
+            [[DBLongLivedAccessTokenProvider alloc] initWithTokenString:token.accessToken];
+        [clients addObject:[[DBTransportDefaultClient alloc] initSharingSessionsOfClient:owner
+                                                                     accessTokenProvider:provider
+                                                                                tokenUid:token.uid
+                                                                         transportConfig:config]];
+    }
+    for (DBTransportDefaultClient *client in clients) {
+        XCTAssertEqual(client.session, owner.session);
+        XCTAssertEqual(client.longpollSession, owner.longpollSession);
+    }
+    XCTAssertEqualObjects(clients[0].tokenUid, @"100000");
+    XCTAssertEqualObjects(clients[0].accessTokenProvider.accessToken, @"token-100000");
+    XCTAssertEqualObjects(clients[1].accessTokenProvider.accessToken, @"token-100001");
+}
+
+// This was the prior lookup, for comparison purposes: every access to the clients takes a class-wide lock, and
+// listing them copies the dictionary.
+- (void)testOldLookupPerformance {
+    NSMutableDictionary<NSString *, NSObject *> *clients = [NSMutableDictionary new];
+    for (DBAccessToken *token in [TestClientRegistry tokens]) {
+        clients[token.uid] = [NSObject new];
+    }
+    NSArray<NSString *> *uids = clients.allKeys;
+    [self measureBlock:^{
+        dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+            for (NSUInteger i = 0; i < kLookupCount; i++) {
+                @synchronized([TestClientRegistry class]) {
+                    [clients objectForKey:uids[(thread + i) % uids.count]];
+                }
+            }
+        });
+    }];
+}
+
+- (void)testLookupPerformance {
+    DBClientRegistry<NSObject *> *registry = [TestClientRegistry registryCountingCreatedClients:[NSMutableArray new]];
+    NSArray<NSString *> *uids = registry.tokenUids;
+    [registry allClients];
+    [self measureBlock:^{
+        dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+            for (NSUInteger i = 0; i < kLookupCount; i++) {
+                [registry clientForTokenUid:uids[(thread + i) % uids.count]];
+            }
+        });
+    }];
+}
+
+@end
@@ -0,0 +1,132 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+static NSString *const kTimestampFormat = @"%Y-%m-%dT%H:%M:%SZ";
+
+// two timestamps per file in a 1000-entry `list_folder` page, decoded by a few pages at once
+static const NSUInteger kDateCount = 2000;
+static const NSUInteger kThreadCount = 8;
+
+@interface TestDateSerializerPerformance : DBBenchmarkTestCase
+
+@end
+
+@implementation TestDateSerializerPerformance
+
+// This was the prior implementation, for comparison purposes: one formatter shared behind a lock.
++ (NSDateFormatter *)old_formatter {
+    static NSDateFormatter *formatter;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        formatter = [[NSDateFormatter alloc] init];
+        [formatter setTimeZone:[NSTimeZone timeZoneWithName:@"UTC"]];
+        [formatter setLocale:[NSLocale localeWithLocaleIdentifier:@"en_US_POSIX"]];
+        [formatter setDateFormat:@"yyyy'-'MM'-'dd'T'HH':'mm':'ss'Z'"];
+    });
+    return formatter;
+}
+
++ (NSDate *)old_deserialize:(NSString *)value {
+    NSDateFormatter *formatter = [self old_formatter];
+    @synchronized(formatter) {
+        return [formatter dateFromString:value];
+    }
+}
+
++ (NSString *)old_serialize:(NSDate *)value {
+    NSDateFormatter *formatter = [self old_formatter];
+    @synchronized(formatter) {
+        return [formatter stringFromDate:value];
+    }
+}
+
++ (NSArray<NSDate *> *)dates {
+    NSMutableArray<NSDate *> *dates = [NSMutableArray new];
+    srand48(42);
+    for (NSUInteger i = 0; i < kDateCount; i++) {
+        // anywhere between 1900 and 2100, with fractional seconds
+        NSTimeInterval interval = -2208988800.0 + drand48() * 6311433600.0;
+        [dates addObject:[NSDate dateWithTimeIntervalSince1970:interval]];
+    }
+    return dates;
+}
+
+- (void)testMatchesFormatter {
+    NSArray<NSDate *> *dates = [TestDateSerializerPerformance dates];
+    for (NSDate *date in dates) {
+        NSString *expected = [TestDateSerializerPerformance old_serialize:date];
+        NSString *string = [DBNSDateSerializer serialize:date dateFormat:kTimestampFormat];
+        XCTAssertEqualObjects(string, expected);
+        XCTAssertEqualObjects([DBNSDateSerializer deserialize:string dateFormat:kTimestampFormat],
+                              [TestDateSerializerPerformance old_deserialize:expected]);
+    }
+
+    for (NSString *malformed in @[ @"2021-02-29T00:00:00Z", @"2021-04-28T24:00:00Z", @"2021-04-28 09:12:31Z" ]) {
+        XCTAssertEqualObjects([DBNSDateSerializer deserialize:malformed dateFormat:kTimestampFormat],
+                              [TestDateSerializerPerformance old_deserialize:malformed]);
+    }
+
+    // other formats still go through a formatter
+    NSDate *date = [DBNSDateSerializer deserialize:@"2020-02-29" dateFormat:@"%Y-%m-%d"];
+    XCTAssertEqualObjects([DBNSDateSerializer serialize:date dateFormat:@"%Y-%m-%d"], @"2020-02-29");
+}
+
+- (void)testOldDeserializePerformance {
+    NSArray<NSString *> *strings = [self timestampStrings];
+    [self measureBlock:^{
+        dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+            for (NSString *string in strings) {
+                [TestDateSerializerPerformance old_deserialize:string];
+            }
+        });
+    }];
+}
+
+- (void)testDeserializePerformance {
+    NSArray<NSString *> *strings = [self timestampStrings];
+    [self measureBlock:^{
+        dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+            for (NSString *string in strings) {
+                [DBNSDateSerializer deserialize:string dateFormat:kTimestampFormat];
+            }
+        });
+    }];
+}
+
+- (void)testOldSerializePerformance {
+    NSArray<NSDate *> *dates = [TestDateSerializerPerformance dates];
+    [self measureBlock:^{
+        dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+            for (NSDate *date in dates) {
+                [TestDateSerializerPerformance old_serialize:date];
+            }
+        });
+    }];
+}
+
+- (void)testSerializePerformance {
+    NSArray<NSDate *> *dates = [TestDateSerializerPerformance dates];
+    [self measureBlock:^{
+        dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+            for (NSDate *date in dates) {
+                [DBNSDateSerializer serialize:date dateFormat:kTimestampFormat];
+            }
+        });
+    }];
+}
+
+- (NSArray<NSString *> *)timestampStrings {
+    NSMutableArray<NSString *> *strings = [NSMutableArray new];
+    for (NSDate *date in [TestDateSerializerPerformance dates]) {
+        [strings addObject:[TestDateSerializerPerformance old_serialize:date]];
+    }
+    return strings;
+}
+
+@end
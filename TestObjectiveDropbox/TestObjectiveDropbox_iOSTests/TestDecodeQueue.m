@@ -0,0 +1,165 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkStubProtocol.h"
+
+static const NSUInteger kRequestCount = 8;
+
+@interface TestDecodeQueue : XCTestCase
+
+@end
+
+@implementation TestDecodeQueue {
+    DBUserClient *_client;
+}
+
++ (void)setUp {
+    [super setUp];
+    [DBBenchmarkStubProtocol install];
+}
+
+- (void)setUp {
+    [super setUp];
+    DBTransportDefaultConfig *config = [[DBTransportDefaultConfig alloc] initWithAppKey:@"app-key"
+                                                                              appSecret:@"app-secret"
+                                                                              userAgent:nil
+                                                                          delegateQueue:nil
+                                                                 forceForegroundSession:YES];
+    _client = [[DBUserClient alloc] initWithAccessToken:@"token" transportConfig:config];
+}
+
+- (void)tearDown {
+    [DBBenchmarkStubProtocol removeAllResponders];
+    [super tearDown];
+}
+
+- (NSData *)folderMetadata {
+    NSDictionary *metadata = @{
+        @".tag" : @"folder",
+        @"name" : @"folder",
+        @"id" : @"id:a4ayc_80_OEAAAAAAAAAXw",
+        @"path_lower" : @"/folder",
+        @"path_display" : @"/folder",
+    };
+    return [NSJSONSerialization dataWithJSONObject:metadata options:0 error:nil];
+}
+
+// Answers metadata requests with the metadata of the requested path. Once all `kRequestCount` requests have arrived,
+// they are answered one after the other in reverse, so that they complete in a known order. Returns the answered
+// paths, in order.
+- (NSMutableArray<NSString *> *)stubGetMetadataAnsweringInReverse {
+    NSMutableArray<NSString *> *answeredPaths = [NSMutableArray new];
+    NSMutableArray *pendingRequests = [NSMutableArray new];
+    [DBBenchmarkStubProtocol setDeferredResponder:^(NSURLRequest *request, DBBenchmarkStubRespond respond) {
+        NSString *path = [NSJSONSerialization JSONObjectWithData:request.HTTPBody options:0 error:nil][@"path"];
+        NSArray *requests = nil;
+        @synchronized(pendingRequests) {
+            [pendingRequests addObject:@[ path, respond ]];
+            if (pendingRequests.count == kRequestCount) {
+                requests = [[pendingRequests reverseObjectEnumerator] allObjects];
+            }
+        }
+        if (!requests) {
+            return;
+        }
+        dispatch_async(dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+            for (NSArray *pendingRequest in requests) {
+                NSString *answeredPath = pendingRequest[0];
+                DBBenchmarkStubRespond answer = pendingRequest[1];
+                NSDictionary *metadata = @{
+                    @".tag" : @"folder",
+                    @"name" : answeredPath.lastPathComponent,
+                    @"id" : @"id:a4ayc_80_OEAAAAAAAAAXw",
+                    @"path_lower" : answeredPath,
+                    @"path_display" : answeredPath,
+                };
+                @synchronized(answeredPaths) {
+                    [answeredPaths addObject:answeredPath];
+                }
+                answer(200, @{ @"Content-Type" : @"application/json" },
+                       [NSJSONSerialization dataWithJSONObject:metadata options:0 error:nil]);
+                // leaves the session time to complete the request before the next one
+                [NSThread sleepForTimeInterval:0.05];
+            }
+        });
+    }
+                                          forPath:@"/2/files/get_metadata"];
+    return answeredPaths;
+}
+
+- (void)testDecodingIsOptIn {
+    XCTAssertNil(DBTask.defaultDecodeQueue);
+    [DBBenchmarkStubProtocol setJSONResponse:[self folderMetadata] forPath:@"/2/files/get_metadata"];
+    DBRpcTask *task = [_client.filesRoutes getMetadata:@"/folder"];
+    XCTAssertNil(task.decodeQueue);
+    [task cancel];
+}
+
+- (void)testResponsesReachSerialQueueInCompletionOrder {
+    NSMutableArray<NSString *> *answeredPaths = [self stubGetMetadataAnsweringInReverse];
+    NSOperationQueue *responseQueue = [NSOperationQueue new];
+    responseQueue.maxConcurrentOperationCount = 1;
+    NSMutableArray<NSString *> *respondedPaths = [NSMutableArray new];
+
+    NSMutableArray<XCTestExpectation *> *expectations = [NSMutableArray new];
+    for (NSUInteger i = 0; i < kRequestCount; i++) {
+        NSString *path = [NSString stringWithFormat:@"/folder-%lu", (unsigned long)i];
+        XCTestExpectation *expectation = [self expectationWithDescription:path];
+        [expectations addObject:expectation];
+        [[_client.filesRoutes getMetadata:path]
+            setResponseBlock:^(DBFILESMetadata *result, DBFILESGetMetadataError *routeError,
+                               DBRequestError *networkError) {
+#pragma unused(routeError)
+                XCTAssertNil(networkError);
+                XCTAssertEqual([NSOperationQueue currentQueue], responseQueue);
+                [respondedPaths addObject:result.pathLower];
+                [expectation fulfill];
+            }
+                       queue:responseQueue];
+    }
+    [self waitForExpectations:expectations timeout:30];
+
+    XCTAssertEqual(respondedPaths.count, kRequestCount);
+    XCTAssertEqualObjects(respondedPaths, answeredPaths);
+}
+
+- (void)testDecodesOnDecodeQueueAndKeepsTaskUntilDelivered {
+    [DBBenchmarkStubProtocol setJSONResponse:[self folderMetadata] forPath:@"/2/files/get_metadata"];
+    NSOperationQueue *decodeQueue = [NSOperationQueue new];
+    decodeQueue.maxConcurrentOperationCount = 1;
+    NSOperationQueue *responseQueue = [NSOperationQueue new];
+    responseQueue.suspended = YES;
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"response"];
+    __block __weak DBRpcTask *weakTask = nil;
+    @autoreleasepool {
+        DBRpcTask *task = [_client.filesRoutes getMetadata:@"/folder"];
+        task.decodeQueue = decodeQueue;
+        [task setResponseBlock:^(DBFILESMetadata *result, DBFILESGetMetadataError *routeError,
+                                 DBRequestError *networkError) {
+#pragma unused(routeError)
+            XCTAssertNil(networkError);
+            XCTAssertEqualObjects(result.pathLower, @"/folder");
+            XCTAssertEqual([NSOperationQueue currentQueue], responseQueue);
+            // the task is only let go once its response has been delivered
+            XCTAssertNotNil(weakTask);
+            [expectation fulfill];
+        }
+                         queue:responseQueue];
+        weakTask = task;
+    }
+
+    // the response is decoded, and the decoded result waits for the response queue
+    NSPredicate *decoded = [NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+#pragma unused(object)
+#pragma unused(bindings)
+        return responseQueue.operationCount == 1 && decodeQueue.operationCount == 0;
+    }];
+    [self waitForExpectations:@[ [self expectationForPredicate:decoded evaluatedWithObject:self handler:nil] ]
+                      timeout:10];
+
+    responseQueue.suspended = NO;
+    [self waitForExpectations:@[ expectation ] timeout:10];
+}
+
+@end
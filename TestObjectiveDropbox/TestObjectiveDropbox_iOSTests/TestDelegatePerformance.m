@@ -0,0 +1,149 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+typedef BOOL (^RpcResponseBlock)(NSData *, NSURLResponse *, NSError *);
+
+// Internal SDK classes, declared here with just what the benchmarks need.
+@interface DBDelegate : NSObject <NSURLSessionDataDelegate>
+- (instancetype)initWithQueue:(NSOperationQueue *)delegateQueue;
+- (void)addRpcResponseHandlerForTaskWithIdentifier:(NSUInteger)identifier
+                                           session:(NSURLSession *)session
+                                   responseHandler:(RpcResponseBlock)handler
+                              responseHandlerQueue:(NSOperationQueue *)handlerQueue;
+@end
+
+@interface DBTaskData : NSObject
+@property (nonatomic, strong) NSMutableData *responseData;
+@property (nonatomic, copy) RpcResponseBlock rpcHandler;
+@property (nonatomic, strong) NSOperationQueue *responseHandlerQueue;
+@end
+
+@interface DBSessionData : NSObject
+- (instancetype)initWithSessionId:(NSString *)sessionid;
+- (DBTaskData *)taskDataForTaskId:(NSUInteger)taskId;
+- (DBTaskData *)ensureTaskDataForTaskId:(NSUInteger)taskId;
+- (void)removeTaskDataForTaskId:(NSUInteger)taskId;
+@end
+
+static const NSUInteger kRequestCount = 10000;
+
+@interface TestDelegatePerformance : DBBenchmarkTestCase
+
+@end
+
+@implementation TestDelegatePerformance
+
+// This was the prior per-task bookkeeping of `DBSessionData`, for comparison purposes: one map per kind of state,
+// keyed by boxed task ids.
+- (void)testParallelMapsBookkeepingPerformance {
+    NSData *chunk = [NSMutableData dataWithLength:256];
+    NSOperationQueue *handlerQueue = [NSOperationQueue new];
+    RpcResponseBlock handler = ^BOOL(NSData *data, NSURLResponse *response, NSError *error) {
+        return data != nil && response == nil && error == nil;
+    };
+
+    [self measureBlock:^{
+        NSMutableDictionary<NSNumber *, NSMutableData *> *responsesData = [NSMutableDictionary new];
+        NSMutableDictionary<NSNumber *, id> *progressHandlers = [NSMutableDictionary new];
+        NSMutableDictionary<NSNumber *, id> *rpcHandlers = [NSMutableDictionary new];
+        NSMutableDictionary<NSNumber *, id> *progressData = [NSMutableDictionary new];
+        NSMutableDictionary<NSNumber *, NSOperationQueue *> *progressHandlerQueues = [NSMutableDictionary new];
+        NSMutableDictionary<NSNumber *, NSOperationQueue *> *responseHandlerQueues = [NSMutableDictionary new];
+
+        for (NSUInteger i = 0; i < kRequestCount; i++) {
+            rpcHandlers[@(i)] = handler;
+            responseHandlerQueues[@(i)] = handlerQueue;
+            if (responsesData[@(i)]) {
+                [responsesData[@(i)] appendData:chunk];
+            } else {
+                responsesData[@(i)] = [NSMutableData dataWithData:chunk];
+            }
+        }
+        for (NSUInteger i = 0; i < kRequestCount; i++) {
+            NSNumber *taskId = @(i);
+            XCTAssertTrue(((RpcResponseBlock)rpcHandlers[taskId])(responsesData[taskId], nil, nil));
+            XCTAssertNotNil(responseHandlerQueues[taskId]);
+
+            [rpcHandlers removeObjectForKey:taskId];
+            [progressHandlers removeObjectForKey:taskId];
+            [progressData removeObjectForKey:taskId];
+            [responsesData removeObjectForKey:taskId];
+            [responseHandlerQueues removeObjectForKey:taskId];
+            [progressHandlerQueues removeObjectForKey:taskId];
+        }
+    }];
+}
+
+- (void)testTaskRecordBookkeepingPerformance {
+    NSData *chunk = [NSMutableData dataWithLength:256];
+    NSOperationQueue *handlerQueue = [NSOperationQueue new];
+    RpcResponseBlock handler = ^BOOL(NSData *data, NSURLResponse *response, NSError *error) {
+        return data != nil && response == nil && error == nil;
+    };
+
+    [self measureBlock:^{
+        DBSessionData *sessionData = [[DBSessionData alloc] initWithSessionId:@"benchmark"];
+
+        for (NSUInteger i = 0; i < kRequestCount; i++) {
+            DBTaskData *taskData = [sessionData ensureTaskDataForTaskId:i];
+            taskData.rpcHandler = handler;
+            taskData.responseHandlerQueue = handlerQueue;
+            if (taskData.responseData) {
+                [taskData.responseData appendData:chunk];
+            } else {
+                taskData.responseData = [NSMutableData dataWithData:chunk];
+            }
+        }
+        for (NSUInteger i = 0; i < kRequestCount; i++) {
+            DBTaskData *taskData = [sessionData taskDataForTaskId:i];
+            XCTAssertTrue(taskData.rpcHandler(taskData.responseData, nil, nil));
+            XCTAssertNotNil(taskData.responseHandlerQueue);
+
+            [sessionData removeTaskDataForTaskId:i];
+        }
+    }];
+}
+
+// Per-request overhead of the delegate itself: installing the handler, buffering the body and completing the task.
+- (void)testDelegateRequestOverheadPerformance {
+    NSURLSessionConfiguration *sessionConfig = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+    NSURLSession *session = [NSURLSession sessionWithConfiguration:sessionConfig];
+    NSURL *url = [NSURL URLWithString:@"https://api.dropboxapi.com/2/check/user"];
+    NSMutableArray<NSURLSessionDataTask *> *tasks = [NSMutableArray new];
+    for (NSUInteger i = 0; i < kRequestCount / 10; i++) {
+        // never resumed, the tasks only provide identifiers and types to the delegate
+        [tasks addObject:[session dataTaskWithURL:url]];
+    }
+    NSData *chunk = [NSMutableData dataWithLength:256];
+    NSOperationQueue *handlerQueue = [NSOperationQueue new];
+
+    [self measureBlock:^{
+        DBDelegate *delegate = [[DBDelegate alloc] initWithQueue:nil];
+        dispatch_group_t group = dispatch_group_create();
+
+        for (NSURLSessionDataTask *task in tasks) {
+            dispatch_group_enter(group);
+            [delegate addRpcResponseHandlerForTaskWithIdentifier:task.taskIdentifier
+                                                         session:session
+                                                 responseHandler:^BOOL(NSData *data, NSURLResponse *response,
+                                                                       NSError *error) {
+#pragma unused(response)
+#pragma unused(error)
+                                                     XCTAssertEqual(data.length, chunk.length);
+                                                     dispatch_group_leave(group);
+                                                     return YES;
+                                                 }
+                                            responseHandlerQueue:handlerQueue];
+            [delegate URLSession:session dataTask:task didReceiveData:chunk];
+            [delegate URLSession:session task:task didCompleteWithError:nil];
+        }
+
+        XCTAssertEqual(dispatch_group_wait(group, dispatch_time(DISPATCH_TIME_NOW, 10 * NSEC_PER_SEC)), 0L);
+    }];
+
+    [session invalidateAndCancel];
+}
+
+@end
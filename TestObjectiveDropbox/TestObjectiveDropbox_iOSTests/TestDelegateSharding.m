@@ -0,0 +1,140 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkStubProtocol.h"
+
+static const NSUInteger kClientCount = 3;
+static const NSUInteger kDownloadsPerClient = 4;
+static const NSUInteger kFileSize = 256 * 1024;
+
+@interface TestDelegateSharding : XCTestCase
+
+@end
+
+@implementation TestDelegateSharding {
+    NSArray<DBTransportDefaultClient *> *_transportClients;
+}
+
++ (void)setUp {
+    [super setUp];
+    [DBBenchmarkStubProtocol install];
+}
+
+- (void)setUp {
+    [super setUp];
+    NSMutableArray<DBTransportDefaultClient *> *transportClients = [NSMutableArray new];
+    for (NSUInteger i = 0; i < kClientCount; i++) {
+        DBTransportDefaultConfig *config = [[DBTransportDefaultConfig alloc] initWithAppKey:@"app-key"
+                                                                                  appSecret:@"app-secret"
+                                                                                  userAgent:nil
+                                                                              delegateQueue:nil
+                                                                     forceForegroundSession:YES];
+        [transportClients addObject:[[DBTransportDefaultClient alloc] initWithAccessToken:@"token"
+                                                                                 tokenUid:nil
+                                                                          transportConfig:config]];
+    }
+    _transportClients = transportClients;
+}
+
+- (void)tearDown {
+    [DBBenchmarkStubProtocol removeAllResponders];
+    [super tearDown];
+}
+
+// The content of the file at `path`, in which every piece differs from the others, so that a misplaced piece shows up.
++ (NSData *)contentsWithPath:(NSString *)path {
+    NSMutableData *contents = [NSMutableData dataWithLength:kFileSize];
+    uint8_t *bytes = contents.mutableBytes;
+    NSUInteger seed = [path hash];
+    for (NSUInteger i = 0; i < kFileSize; i++) {
+        bytes[i] = (uint8_t)(seed + i * 7 + i / 251);
+    }
+    return contents;
+}
+
+- (void)testSessionsDeliverOnShards {
+    NSMutableSet<NSOperationQueue *> *sessionQueues = [NSMutableSet new];
+    for (DBTransportDefaultClient *transportClient in _transportClients) {
+        NSOperationQueue *sessionQueue = transportClient.session.delegateQueue;
+        XCTAssertEqual(sessionQueue.maxConcurrentOperationCount, 1);
+        XCTAssertEqual(transportClient.delegateQueue, sessionQueue);
+        XCTAssertNotEqual(transportClient.longpollSession.delegateQueue, sessionQueue);
+        [sessionQueues addObject:sessionQueue];
+    }
+    // every client has its own shards
+    XCTAssertEqual(sessionQueues.count, kClientCount);
+}
+
+- (void)testSuppliedQueueIsTheOnlyDelegateQueue {
+    NSOperationQueue *delegateQueue = [NSOperationQueue new];
+    DBTransportDefaultConfig *config = [[DBTransportDefaultConfig alloc] initWithAppKey:@"app-key"
+                                                                              appSecret:@"app-secret"
+                                                                              userAgent:nil
+                                                                          delegateQueue:delegateQueue
+                                                                 forceForegroundSession:YES];
+    DBTransportDefaultClient *transportClient =
+        [[DBTransportDefaultClient alloc] initWithAccessToken:@"token" tokenUid:nil transportConfig:config];
+    XCTAssertEqual(transportClient.delegateQueue, delegateQueue);
+    XCTAssertNotEqual(transportClient.session.delegateQueue, delegateQueue);
+}
+
+- (void)testStreamedPiecesStayInOrderPerTask {
+    [DBBenchmarkStubProtocol setBodyPieceSize:4 * 1024];
+    [DBBenchmarkStubProtocol
+        setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+#pragma unused(statusCode)
+            NSString *argString = [request valueForHTTPHeaderField:@"Dropbox-API-Arg"];
+            NSData *argData = [argString dataUsingEncoding:NSUTF8StringEncoding];
+            NSString *path = [NSJSONSerialization JSONObjectWithData:argData options:0 error:nil][@"path"];
+            NSDictionary *metadata = @{
+                @".tag" : @"file",
+                @"name" : path.lastPathComponent,
+                @"id" : @"id:a4ayc_80_OEAAAAAAAAAXw",
+                @"client_modified" : @"2015-05-12T15:50:38Z",
+                @"server_modified" : @"2015-05-12T15:50:38Z",
+                @"rev" : @"a1c10ce0dd78",
+                @"size" : @(kFileSize),
+                @"path_lower" : path,
+                @"path_display" : path,
+            };
+            NSData *result = [NSJSONSerialization dataWithJSONObject:metadata options:0 error:nil];
+            *headers = @{
+                @"Content-Type" : @"application/octet-stream",
+                @"Dropbox-API-Result" : [[NSString alloc] initWithData:result encoding:NSUTF8StringEncoding],
+            };
+            return [TestDelegateSharding contentsWithPath:path];
+        }
+             forPath:@"/2/files/download"];
+
+    // every client has its own shards, and all downloads run at once
+    NSMutableArray<DBUserClient *> *clients = [NSMutableArray new];
+    NSMutableArray<XCTestExpectation *> *expectations = [NSMutableArray new];
+    for (NSUInteger i = 0; i < kClientCount; i++) {
+        DBUserClient *client = [[DBUserClient alloc] initWithTransportClient:_transportClients[i]];
+        [clients addObject:client];
+        for (NSUInteger j = 0; j < kDownloadsPerClient; j++) {
+            NSString *path = [NSString stringWithFormat:@"/file-%lu-%lu.bin", (unsigned long)i, (unsigned long)j];
+            NSMutableData *streamed = [NSMutableData new];
+            XCTestExpectation *expectation = [self expectationWithDescription:path];
+            [expectations addObject:expectation];
+            [[client.filesRoutes downloadStream:path
+                                  consumerBlock:^BOOL(NSData *data) {
+                                      [streamed appendData:data];
+                                      return YES;
+                                  }
+                                  consumerQueue:nil]
+                setResponseBlock:^(DBFILESFileMetadata *result, DBFILESDownloadError *routeError,
+                                   DBRequestError *networkError, NSData *fileData) {
+#pragma unused(routeError)
+#pragma unused(fileData)
+                    XCTAssertNil(networkError);
+                    XCTAssertEqualObjects(result.pathLower, path);
+                    XCTAssertEqualObjects(streamed, [TestDelegateSharding contentsWithPath:path]);
+                    [expectation fulfill];
+                }];
+        }
+    }
+    [self waitForExpectations:expectations timeout:30];
+}
+
+@end
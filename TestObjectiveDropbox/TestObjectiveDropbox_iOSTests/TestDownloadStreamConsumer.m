@@ -0,0 +1,118 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+@interface DBDownloadStreamConsumer : NSObject
+- (instancetype)initWithConsumerBlock:(DBDownloadStreamConsumerBlock)consumerBlock
+                                queue:(NSOperationQueue *)queue
+                      maxPendingBytes:(NSUInteger)maxPendingBytes;
+- (void)consumeData:(NSData *)data task:(NSURLSessionTask *)task;
+@end
+
+static const NSUInteger kMB = 1024 * 1024;
+
+// Stands in for the task receiving the response body, counting how it is paused and stopped.
+@interface TestStreamTask : NSObject
+@property (atomic) NSUInteger suspendCount;
+@property (atomic) NSUInteger resumeCount;
+@property (atomic) NSUInteger cancelCount;
+@end
+
+@implementation TestStreamTask
+
+- (void)suspend {
+    self.suspendCount++;
+}
+
+- (void)resume {
+    self.resumeCount++;
+}
+
+- (void)cancel {
+    self.cancelCount++;
+}
+
+@end
+
+@interface TestDownloadStreamConsumer : XCTestCase
+
+@end
+
+@implementation TestDownloadStreamConsumer
+
+- (void)testSuspendsAbovePendingLimitAndResumesAtHalf {
+    TestStreamTask *task = [TestStreamTask new];
+    NSOperationQueue *queue = [NSOperationQueue new];
+    NSMutableArray<NSNumber *> *resumeCounts = [NSMutableArray new];
+    DBDownloadStreamConsumer *consumer =
+        [[DBDownloadStreamConsumer alloc] initWithConsumerBlock:^BOOL(NSData *data) {
+#pragma unused(data)
+            [resumeCounts addObject:@(task.resumeCount)];
+            return YES;
+        }
+                                                          queue:queue
+                                                maxPendingBytes:4 * kMB];
+
+    // the consumer falls behind until its queue runs again
+    queue.suspended = YES;
+    for (NSUInteger i = 0; i < 4; i++) {
+        [consumer consumeData:[NSMutableData dataWithLength:kMB] task:(NSURLSessionTask *)task];
+    }
+    XCTAssertEqual(task.suspendCount, (NSUInteger)0);
+    [consumer consumeData:[NSMutableData dataWithLength:kMB] task:(NSURLSessionTask *)task];
+    XCTAssertEqual(task.suspendCount, (NSUInteger)1);
+    [consumer consumeData:[NSMutableData dataWithLength:kMB] task:(NSURLSessionTask *)task];
+    XCTAssertEqual(task.suspendCount, (NSUInteger)1);
+
+    queue.suspended = NO;
+    [queue waitUntilAllOperationsAreFinished];
+
+    // resumed once the fourth piece is consumed, leaving 2 MB pending
+    NSArray<NSNumber *> *expectedResumeCounts = @[ @0, @0, @0, @0, @1, @1 ];
+    XCTAssertEqualObjects(resumeCounts, expectedResumeCounts);
+    XCTAssertEqual(task.resumeCount, (NSUInteger)1);
+    XCTAssertEqual(task.cancelCount, (NSUInteger)0);
+}
+
+- (void)testDoesNotSuspendWhileKeepingUp {
+    TestStreamTask *task = [TestStreamTask new];
+    NSOperationQueue *queue = [NSOperationQueue new];
+    __block NSUInteger consumedBytes = 0;
+    DBDownloadStreamConsumer *consumer = [[DBDownloadStreamConsumer alloc] initWithConsumerBlock:^BOOL(NSData *data) {
+        consumedBytes += data.length;
+        return YES;
+    }
+                                                                                           queue:queue
+                                                                                 maxPendingBytes:4 * kMB];
+
+    for (NSUInteger i = 0; i < 16; i++) {
+        [consumer consumeData:[NSMutableData dataWithLength:kMB] task:(NSURLSessionTask *)task];
+        [queue waitUntilAllOperationsAreFinished];
+    }
+    XCTAssertEqual(consumedBytes, 16 * kMB);
+    XCTAssertEqual(task.suspendCount, (NSUInteger)0);
+    XCTAssertEqual(task.resumeCount, (NSUInteger)0);
+}
+
+- (void)testCancelsWhenConsumerRejectsData {
+    TestStreamTask *task = [TestStreamTask new];
+    NSOperationQueue *queue = [NSOperationQueue new];
+    __block NSUInteger consumerCalls = 0;
+    DBDownloadStreamConsumer *consumer = [[DBDownloadStreamConsumer alloc] initWithConsumerBlock:^BOOL(NSData *data) {
+#pragma unused(data)
+        consumerCalls++;
+        return consumerCalls < 2;
+    }
+                                                                                           queue:queue
+                                                                                 maxPendingBytes:4 * kMB];
+
+    for (NSUInteger i = 0; i < 4; i++) {
+        [consumer consumeData:[NSMutableData dataWithLength:kMB] task:(NSURLSessionTask *)task];
+    }
+    [queue waitUntilAllOperationsAreFinished];
+
+    // nothing is handed over after the rejected piece
+    XCTAssertEqual(consumerCalls, (NSUInteger)2);
+    XCTAssertEqual(task.cancelCount, (NSUInteger)1);
+}
+
+@end
@@ -0,0 +1,93 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+@interface DBTransportBaseClient (Tests)
++ (NSData *)errorDataWithContentsOfFile:(NSURL *)location;
++ (DBRequestError *)dBRequestErrorWithErrorData:(NSData *)errorData
+                                    clientError:(NSError *)clientError
+                                     statusCode:(int)statusCode
+                                    httpHeaders:(NSDictionary *)httpHeaders;
+@end
+
+@interface TestErrorBodyReads : XCTestCase
++ (NSURL *)fileWithData:(NSData *)data;
++ (NSData *)htmlErrorPage;
+@end
+
+@implementation TestErrorBodyReads
+
++ (NSURL *)fileWithData:(NSData *)data {
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    [data writeToFile:path atomically:NO];
+    return [NSURL fileURLWithPath:path];
+}
+
+// what a misbehaving proxy might send instead of an API error
++ (NSData *)htmlErrorPage {
+    NSMutableString *page = [NSMutableString stringWithString:@"<html><body><h1>502 Bad Gateway</h1>"];
+    while (page.length < 8 * 1024 * 1024) {
+        [page appendString:@"<p>Überlastung – bitte später erneut versuchen</p>"];
+    }
+    [page appendString:@"</body></html>"];
+    return [page dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)testApiErrorIsReadWhole {
+    NSData *body = [@"  {\"error_summary\": \"path/not_found/..\", \"error\": {\".tag\": \"path\", \"path\": "
+                    @"{\".tag\": \"not_found\"}}}" dataUsingEncoding:NSUTF8StringEncoding];
+    NSURL *url = [TestErrorBodyReads fileWithData:body];
+    XCTAssertEqualObjects([DBTransportBaseClient errorDataWithContentsOfFile:url], body);
+
+    // locations handed over by the delegate have no scheme
+    NSURL *schemeless = [NSURL URLWithString:url.path];
+    XCTAssertEqualObjects([DBTransportBaseClient errorDataWithContentsOfFile:schemeless], body);
+
+    DBRequestError *error = [DBTransportBaseClient dBRequestErrorWithErrorData:body
+                                                                   clientError:nil
+                                                                    statusCode:409
+                                                                   httpHeaders:@{}];
+    XCTAssertEqualObjects(error.errorContent, @"path/not_found/..");
+}
+
+- (void)testLargeErrorPageIsBounded {
+    NSURL *url = [TestErrorBodyReads fileWithData:[TestErrorBodyReads htmlErrorPage]];
+    NSData *errorData = [DBTransportBaseClient errorDataWithContentsOfFile:url];
+    XCTAssertLessThanOrEqual(errorData.length, (NSUInteger)4096);
+
+    // the kept prefix doesn't end inside a multi-byte character
+    NSString *errorContent = [[NSString alloc] initWithData:errorData encoding:NSUTF8StringEncoding];
+    XCTAssertTrue([errorContent hasPrefix:@"<html><body><h1>502 Bad Gateway</h1>"]);
+}
+
+- (void)testMissingFile {
+    XCTAssertNil([DBTransportBaseClient errorDataWithContentsOfFile:nil]);
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    XCTAssertNil([DBTransportBaseClient errorDataWithContentsOfFile:[NSURL fileURLWithPath:path]]);
+}
+
+@end
+
+@interface TestErrorBodyReadsPerformance : DBBenchmarkTestCase
+
+@end
+
+@implementation TestErrorBodyReadsPerformance
+
+- (void)testOldLargeErrorPageReadPerformance {
+    NSURL *url = [TestErrorBodyReads fileWithData:[TestErrorBodyReads htmlErrorPage]];
+    [self measureBlock:^{
+        // This was the prior read, for comparison purposes: the whole body, whatever its size.
+        [NSData dataWithContentsOfFile:url.path];
+    }];
+}
+
+- (void)testLargeErrorPageReadPerformance {
+    NSURL *url = [TestErrorBodyReads fileWithData:[TestErrorBodyReads htmlErrorPage]];
+    [self measureBlock:^{
+        [DBTransportBaseClient errorDataWithContentsOfFile:url];
+    }];
+}
+
+@end
@@ -0,0 +1,538 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+#import <malloc/malloc.h>
+
+#import "DBBenchmarkPayloads.h"
+#import "DBBenchmarkReporter.h"
+#import "DBBenchmarkTestCase.h"
+
+@interface DBJSONReader : NSObject
+@property (nonatomic, readonly) NSError *error;
+- (instancetype)initWithData:(NSData *)data;
+- (BOOL)beginObject;
+- (BOOL)nextKey;
+- (BOOL)keyEquals:(const char *)key;
+- (BOOL)beginArray;
+- (BOOL)nextElement;
+- (NSString *)readString;
+- (NSNumber *)readNumber;
+- (NSNumber *)readBool;
+- (id)readValue;
+- (void)skipValue;
+- (BOOL)finish;
+@end
+
+typedef id (*StreamDeserializer)(DBJSONReader *);
+
+static NSString *const kDateFormat = @"%Y-%m-%dT%H:%M:%SZ";
+
+// entries per page, the largest page `list_folder`, `get_events` and `members/list` return by default
+static const NSUInteger kEntryCount = 1000;
+
+#pragma mark - Streaming deserializers
+
+// Written the way the generated serializers would implement `DBStreamDeserializable`: scalar fields are streamed,
+// while fields this benchmark doesn't cover yet go through `readValue` and the generated dictionary deserializers.
+
+static NSDate *StreamDate(DBJSONReader *reader) {
+    NSString *value = [reader readString];
+    return value ? [DBNSDateSerializer deserialize:value dateFormat:kDateFormat] : nil;
+}
+
+static NSArray<NSString *> *StreamStringArray(DBJSONReader *reader) {
+    NSMutableArray<NSString *> *array = [NSMutableArray new];
+    if ([reader beginArray]) {
+        while ([reader nextElement]) {
+            NSString *value = [reader readString];
+            if (value) {
+                [array addObject:value];
+            }
+        }
+    }
+    return array;
+}
+
+static DBFILESMetadata *StreamMetadata(DBJSONReader *reader) {
+    NSString *tag = nil;
+    NSString *name = nil;
+    NSString *id_ = nil;
+    NSString *pathLower = nil;
+    NSString *pathDisplay = nil;
+    NSDate *clientModified = nil;
+    NSDate *serverModified = nil;
+    NSString *rev = nil;
+    NSNumber *size = nil;
+    NSNumber *isDownloadable = nil;
+    NSString *contentHash = nil;
+
+    if (![reader beginObject]) {
+        return nil;
+    }
+    while ([reader nextKey]) {
+        if ([reader keyEquals:".tag"]) {
+            tag = [reader readString];
+        } else if ([reader keyEquals:"name"]) {
+            name = [reader readString];
+        } else if ([reader keyEquals:"id"]) {
+            id_ = [reader readString];
+        } else if ([reader keyEquals:"path_lower"]) {
+            pathLower = [reader readString];
+        } else if ([reader keyEquals:"path_display"]) {
+            pathDisplay = [reader readString];
+        } else if ([reader keyEquals:"client_modified"]) {
+            clientModified = StreamDate(reader);
+        } else if ([reader keyEquals:"server_modified"]) {
+            serverModified = StreamDate(reader);
+        } else if ([reader keyEquals:"rev"]) {
+            rev = [reader readString];
+        } else if ([reader keyEquals:"size"]) {
+            size = [reader readNumber];
+        } else if ([reader keyEquals:"is_downloadable"]) {
+            isDownloadable = [reader readBool];
+        } else if ([reader keyEquals:"content_hash"]) {
+            contentHash = [reader readString];
+        } else {
+            [reader skipValue];
+        }
+    }
+    if (reader.error) {
+        return nil;
+    }
+
+    if ([tag isEqualToString:@"file"]) {
+        return [[DBFILESFileMetadata alloc] initWithName:name
+                                                     id_:id_
+                                          clientModified:clientModified
+                                          serverModified:serverModified
+                                                     rev:rev
+                                                    size:size
+                                               pathLower:pathLower
+                                             pathDisplay:pathDisplay
+                                    parentSharedFolderId:nil
+                                              previewUrl:nil
+                                               mediaInfo:nil
+                                             symlinkInfo:nil
+                                             sharingInfo:nil
+                                          isDownloadable:isDownloadable
+                                              exportInfo:nil
+                                          propertyGroups:nil
+                                hasExplicitSharedMembers:nil
+                                             contentHash:contentHash
+                                            fileLockInfo:nil];
+    }
+    if ([tag isEqualToString:@"folder"]) {
+        return [[DBFILESFolderMetadata alloc] initWithName:name
+                                                       id_:id_
+                                                 pathLower:pathLower
+                                               pathDisplay:pathDisplay
+                                      parentSharedFolderId:nil
+                                                previewUrl:nil
+                                            sharedFolderId:nil
+                                               sharingInfo:nil
+                                            propertyGroups:nil];
+    }
+    return nil;
+}
+
+static DBFILESListFolderResult *StreamListFolderResult(DBJSONReader *reader) {
+    NSMutableArray<DBFILESMetadata *> *entries = [NSMutableArray new];
+    NSString *cursor = nil;
+    NSNumber *hasMore = nil;
+
+    if (![reader beginObject]) {
+        return nil;
+    }
+    while ([reader nextKey]) {
+        if ([reader keyEquals:"entries"] && [reader beginArray]) {
+            while ([reader nextElement]) {
+                DBFILESMetadata *entry = StreamMetadata(reader);
+                if (entry) {
+                    [entries addObject:entry];
+                }
+            }
+        } else if ([reader keyEquals:"cursor"]) {
+            cursor = [reader readString];
+        } else if ([reader keyEquals:"has_more"]) {
+            hasMore = [reader readBool];
+        } else {
+            [reader skipValue];
+        }
+    }
+    return reader.error ? nil : [[DBFILESListFolderResult alloc] initWithEntries:entries cursor:cursor hasMore:hasMore];
+}
+
+static DBTEAMLOGTeamEvent *StreamTeamEvent(DBJSONReader *reader) {
+    NSDate *timestamp = nil;
+    DBTEAMLOGEventCategory *eventCategory = nil;
+    DBTEAMLOGEventType *eventType = nil;
+    DBTEAMLOGEventDetails *details = nil;
+    DBTEAMLOGActorLogInfo *actor = nil;
+    DBTEAMLOGOriginLogInfo *origin = nil;
+    NSNumber *involveNonTeamMember = nil;
+    DBTEAMLOGContextLogInfo *context = nil;
+
+    if (![reader beginObject]) {
+        return nil;
+    }
+    while ([reader nextKey]) {
+        if ([reader keyEquals:"timestamp"]) {
+            timestamp = StreamDate(reader);
+        } else if ([reader keyEquals:"event_category"]) {
+            eventCategory = [DBTEAMLOGEventCategorySerializer deserialize:[reader readValue]];
+        } else if ([reader keyEquals:"event_type"]) {
+            eventType = [DBTEAMLOGEventTypeSerializer deserialize:[reader readValue]];
+        } else if ([reader keyEquals:"details"]) {
+            details = [DBTEAMLOGEventDetailsSerializer deserialize:[reader readValue]];
+        } else if ([reader keyEquals:"actor"]) {
+            actor = [DBTEAMLOGActorLogInfoSerializer deserialize:[reader readValue]];
+        } else if ([reader keyEquals:"origin"]) {
+            origin = [DBTEAMLOGOriginLogInfoSerializer deserialize:[reader readValue]];
+        } else if ([reader keyEquals:"involve_non_team_member"]) {
+            involveNonTeamMember = [reader readBool];
+        } else if ([reader keyEquals:"context"]) {
+            context = [DBTEAMLOGContextLogInfoSerializer deserialize:[reader readValue]];
+        } else {
+            // participants and assets are empty in the recorded page
+            [reader skipValue];
+        }
+    }
+    if (reader.error) {
+        return nil;
+    }
+    return [[DBTEAMLOGTeamEvent alloc] initWithTimestamp:timestamp
+                                           eventCategory:eventCategory
+                                               eventType:eventType
+                                                 details:details
+                                                   actor:actor
+                                                  origin:origin
+                                    involveNonTeamMember:involveNonTeamMember
+                                                 context:context
+                                            participants:@[]
+                                                  assets:@[]];
+}
+
+static DBTEAMLOGGetTeamEventsResult *StreamGetTeamEventsResult(DBJSONReader *reader) {
+    NSMutableArray<DBTEAMLOGTeamEvent *> *events = [NSMutableArray new];
+    NSString *cursor = nil;
+    NSNumber *hasMore = nil;
+
+    if (![reader beginObject]) {
+        return nil;
+    }
+    while ([reader nextKey]) {
+        if ([reader keyEquals:"events"] && [reader beginArray]) {
+            while ([reader nextElement]) {
+                DBTEAMLOGTeamEvent *event = StreamTeamEvent(reader);
+                if (event) {
+                    [events addObject:event];
+                }
+            }
+        } else if ([reader keyEquals:"cursor"]) {
+            cursor = [reader readString];
+        } else if ([reader keyEquals:"has_more"]) {
+            hasMore = [reader readBool];
+        } else {
+            [reader skipValue];
+        }
+    }
+    return reader.error ? nil
+                        : [[DBTEAMLOGGetTeamEventsResult alloc] initWithEvents:events cursor:cursor hasMore:hasMore];
+}
+
+static DBUSERSName *StreamName(DBJSONReader *reader) {
+    NSString *givenName = nil;
+    NSString *surname = nil;
+    NSString *familiarName = nil;
+    NSString *displayName = nil;
+    NSString *abbreviatedName = nil;
+
+    if (![reader beginObject]) {
+        return nil;
+    }
+    while ([reader nextKey]) {
+        if ([reader keyEquals:"given_name"]) {
+            givenName = [reader readString];
+        } else if ([reader keyEquals:"surname"]) {
+            surname = [reader readString];
+        } else if ([reader keyEquals:"familiar_name"]) {
+            familiarName = [reader readString];
+        } else if ([reader keyEquals:"display_name"]) {
+            displayName = [reader readString];
+        } else if ([reader keyEquals:"abbreviated_name"]) {
+            abbreviatedName = [reader readString];
+        } else {
+            [reader skipValue];
+        }
+    }
+    if (reader.error) {
+        return nil;
+    }
+    return [[DBUSERSName alloc] initWithGivenName:givenName
+                                          surname:surname
+                                     familiarName:familiarName
+                                      displayName:displayName
+                                  abbreviatedName:abbreviatedName];
+}
+
+static DBTEAMTeamMemberProfile *StreamTeamMemberProfile(DBJSONReader *reader) {
+    NSString *teamMemberId = nil;
+    NSString *email = nil;
+    NSNumber *emailVerified = nil;
+    DBTEAMTeamMemberStatus *status = nil;
+    DBUSERSName *name = nil;
+    DBTEAMTeamMembershipType *membershipType = nil;
+    NSArray<NSString *> *groups = nil;
+    NSString *memberFolderId = nil;
+    NSString *accountId = nil;
+    NSArray<DBSECONDARYEMAILSSecondaryEmail *> *secondaryEmails = nil;
+    NSDate *joinedOn = nil;
+    NSString *profilePhotoUrl = nil;
+
+    if (![reader beginObject]) {
+        return nil;
+    }
+    while ([reader nextKey]) {
+        if ([reader keyEquals:"team_member_id"]) {
+            teamMemberId = [reader readString];
+        } else if ([reader keyEquals:"email"]) {
+            email = [reader readString];
+        } else if ([reader keyEquals:"email_verified"]) {
+            emailVerified = [reader readBool];
+        } else if ([reader keyEquals:"status"]) {
+            status = [DBTEAMTeamMemberStatusSerializer deserialize:[reader readValue]];
+        } else if ([reader keyEquals:"name"]) {
+            name = StreamName(reader);
+        } else if ([reader keyEquals:"membership_type"]) {
+            membershipType = [DBTEAMTeamMembershipTypeSerializer deserialize:[reader readValue]];
+        } else if ([reader keyEquals:"groups"]) {
+            groups = StreamStringArray(reader);
+        } else if ([reader keyEquals:"member_folder_id"]) {
+            memberFolderId = [reader readString];
+        } else if ([reader keyEquals:"account_id"]) {
+            accountId = [reader readString];
+        } else if ([reader keyEquals:"secondary_emails"]) {
+            secondaryEmails = [DBArraySerializer deserialize:[reader readValue]
+                                                   withBlock:^id(id elem0) {
+                                                       return [DBSECONDARYEMAILSSecondaryEmailSerializer
+                                                           deserialize:elem0];
+                                                   }];
+        } else if ([reader keyEquals:"joined_on"]) {
+            joinedOn = StreamDate(reader);
+        } else if ([reader keyEquals:"profile_photo_url"]) {
+            profilePhotoUrl = [reader readString];
+        } else {
+            [reader skipValue];
+        }
+    }
+    if (reader.error) {
+        return nil;
+    }
+    return [[DBTEAMTeamMemberProfile alloc] initWithTeamMemberId:teamMemberId
+                                                           email:email
+                                                   emailVerified:emailVerified
+                                                          status:status
+                                                            name:name
+                                                  membershipType:membershipType
+                                                          groups:groups
+                                                  memberFolderId:memberFolderId
+                                                      externalId:nil
+                                                       accountId:accountId
+                                                 secondaryEmails:secondaryEmails
+                                                       invitedOn:nil
+                                                        joinedOn:joinedOn
+                                                     suspendedOn:nil
+                                                    persistentId:nil
+                                           isDirectoryRestricted:nil
+                                                 profilePhotoUrl:profilePhotoUrl];
+}
+
+static DBTEAMMembersListResult *StreamMembersListResult(DBJSONReader *reader) {
+    NSMutableArray<DBTEAMTeamMemberInfo *> *members = [NSMutableArray new];
+    NSString *cursor = nil;
+    NSNumber *hasMore = nil;
+
+    if (![reader beginObject]) {
+        return nil;
+    }
+    while ([reader nextKey]) {
+        if ([reader keyEquals:"members"] && [reader beginArray]) {
+            while ([reader nextElement]) {
+                DBTEAMTeamMemberProfile *profile = nil;
+                DBTEAMAdminTier *role = nil;
+                if (![reader beginObject]) {
+                    break;
+                }
+                while ([reader nextKey]) {
+                    if ([reader keyEquals:"profile"]) {
+                        profile = StreamTeamMemberProfile(reader);
+                    } else if ([reader keyEquals:"role"]) {
+                        role = [DBTEAMAdminTierSerializer deserialize:[reader readValue]];
+                    } else {
+                        [reader skipValue];
+                    }
+                }
+                if (profile && role) {
+                    [members addObject:[[DBTEAMTeamMemberInfo alloc] initWithProfile:profile role:role]];
+                }
+            }
+        } else if ([reader keyEquals:"cursor"]) {
+            cursor = [reader readString];
+        } else if ([reader keyEquals:"has_more"]) {
+            hasMore = [reader readBool];
+        } else {
+            [reader skipValue];
+        }
+    }
+    return reader.error ? nil
+                        : [[DBTEAMMembersListResult alloc] initWithMembers:members cursor:cursor hasMore:hasMore];
+}
+
+#pragma mark - Tests
+
+@interface TestJSONDecoderPerformance : DBBenchmarkTestCase
+
+@end
+
+@implementation TestJSONDecoderPerformance
+
+// The way responses are decoded today: a mutable container tree from `NSJSONSerialization`, then the generated
+// dictionary deserializer.
+- (id)dictionaryDecode:(NSData *)data type:(Class<DBSerializable>)type {
+    NSError *error;
+    id json = [NSJSONSerialization JSONObjectWithData:data options:NSJSONReadingMutableContainers error:&error];
+    XCTAssertNil(error);
+    return [type deserialize:json];
+}
+
+- (id)streamDecode:(NSData *)data with:(StreamDeserializer)deserializer {
+    DBJSONReader *reader = [[DBJSONReader alloc] initWithData:data];
+    id result = deserializer(reader);
+    XCTAssertTrue([reader finish], @"%@", reader.error);
+    return result;
+}
+
+// Runs `block` and records how many allocations it left live, and how many bytes they add up to, under `name`, so
+// that the benchmark shows the intermediate tree each path allocates and not just its time.
+- (void)measureAllocationsOfBlock:(void (^)(void))block name:(NSString *)name {
+    malloc_statistics_t before;
+    malloc_statistics_t after;
+    malloc_zone_statistics(NULL, &before);
+    @autoreleasepool {
+        block();
+        malloc_zone_statistics(NULL, &after);
+    }
+    DBBenchmarkReporter *reporter = [DBBenchmarkReporter sharedReporter];
+    [reporter record:[name stringByAppendingString:@".live_allocations"]
+               value:(double)((long)after.blocks_in_use - (long)before.blocks_in_use)
+                unit:@"allocations"];
+    [reporter record:[name stringByAppendingString:@".live_bytes"]
+               value:(double)((long)after.size_in_use - (long)before.size_in_use)
+                unit:@"bytes"];
+}
+
+- (void)testStreamDecodingMatchesDictionaryDecoding {
+    NSData *listFolder = DBBenchmarkListFolderPayload(kEntryCount);
+    DBFILESListFolderResult *listFolderResult = [self streamDecode:listFolder
+                                                              with:(StreamDeserializer)StreamListFolderResult];
+    XCTAssertEqual(listFolderResult.entries.count, kEntryCount);
+    XCTAssertEqualObjects(listFolderResult,
+                          [self dictionaryDecode:listFolder type:[DBFILESListFolderResult class]]);
+
+    NSData *getEvents = DBBenchmarkGetEventsPayload(kEntryCount);
+    DBTEAMLOGGetTeamEventsResult *getEventsResult = [self streamDecode:getEvents
+                                                                  with:(StreamDeserializer)StreamGetTeamEventsResult];
+    XCTAssertEqual(getEventsResult.events.count, kEntryCount);
+    XCTAssertEqualObjects(getEventsResult,
+                          [self dictionaryDecode:getEvents type:[DBTEAMLOGGetTeamEventsResult class]]);
+
+    NSData *membersList = DBBenchmarkMembersListPayload(kEntryCount);
+    DBTEAMMembersListResult *membersListResult = [self streamDecode:membersList
+                                                               with:(StreamDeserializer)StreamMembersListResult];
+    XCTAssertEqual(membersListResult.members.count, kEntryCount);
+    XCTAssertEqualObjects(membersListResult,
+                          [self dictionaryDecode:membersList type:[DBTEAMMembersListResult class]]);
+}
+
+- (void)testReaderValues {
+    NSData *data = [@"{\"s\": \"a\\\"\\u00e9\\ud83d\\ude00\", \"n\": [-12, 4294967296, 1.5e3], "
+                    @"\"b\": true, \"z\": null, \"o\": {}}" dataUsingEncoding:NSUTF8StringEncoding];
+    DBJSONReader *reader = [[DBJSONReader alloc] initWithData:data];
+    NSDictionary *value = [reader readValue];
+    XCTAssertTrue([reader finish]);
+    XCTAssertEqualObjects(value, [NSJSONSerialization JSONObjectWithData:data options:0 error:nil]);
+
+    for (NSString *malformed in @[ @"{\"a\": 1,}", @"[1 2]", @"{\"a\" 1}", @"\"\\x\"", @"[1]]", @"[" ]) {
+        reader = [[DBJSONReader alloc] initWithData:[malformed dataUsingEncoding:NSUTF8StringEncoding]];
+        [reader skipValue];
+        XCTAssertFalse([reader finish], @"%@", malformed);
+        XCTAssertNotNil(reader.error, @"%@", malformed);
+    }
+}
+
+- (void)testListFolderDictionaryDecodePerformance {
+    NSData *data = DBBenchmarkListFolderPayload(kEntryCount);
+    [self measureAllocationsOfBlock:^{
+        [self dictionaryDecode:data type:[DBFILESListFolderResult class]];
+    }
+                               name:@"decode.files.list_folder.dictionary"];
+    [self measureBlock:^{
+        [self dictionaryDecode:data type:[DBFILESListFolderResult class]];
+    }];
+}
+
+- (void)testListFolderStreamDecodePerformance {
+    NSData *data = DBBenchmarkListFolderPayload(kEntryCount);
+    [self measureAllocationsOfBlock:^{
+        [self streamDecode:data with:(StreamDeserializer)StreamListFolderResult];
+    }
+                               name:@"decode.files.list_folder.stream"];
+    [self measureBlock:^{
+        [self streamDecode:data with:(StreamDeserializer)StreamListFolderResult];
+    }];
+}
+
+- (void)testGetEventsDictionaryDecodePerformance {
+    NSData *data = DBBenchmarkGetEventsPayload(kEntryCount);
+    [self measureAllocationsOfBlock:^{
+        [self dictionaryDecode:data type:[DBTEAMLOGGetTeamEventsResult class]];
+    }
+                               name:@"decode.team_log.get_events.dictionary"];
+    [self measureBlock:^{
+        [self dictionaryDecode:data type:[DBTEAMLOGGetTeamEventsResult class]];
+    }];
+}
+
+- (void)testGetEventsStreamDecodePerformance {
+    NSData *data = DBBenchmarkGetEventsPayload(kEntryCount);
+    [self measureAllocationsOfBlock:^{
+        [self streamDecode:data with:(StreamDeserializer)StreamGetTeamEventsResult];
+    }
+                               name:@"decode.team_log.get_events.stream"];
+    [self measureBlock:^{
+        [self streamDecode:data with:(StreamDeserializer)StreamGetTeamEventsResult];
+    }];
+}
+
+- (void)testMembersListDictionaryDecodePerformance {
+    NSData *data = DBBenchmarkMembersListPayload(kEntryCount);
+    [self measureAllocationsOfBlock:^{
+        [self dictionaryDecode:data type:[DBTEAMMembersListResult class]];
+    }
+                               name:@"decode.team.members_list.dictionary"];
+    [self measureBlock:^{
+        [self dictionaryDecode:data type:[DBTEAMMembersListResult class]];
+    }];
+}
+
+- (void)testMembersListStreamDecodePerformance {
+    NSData *data = DBBenchmarkMembersListPayload(kEntryCount);
+    [self measureAllocationsOfBlock:^{
+        [self streamDecode:data with:(StreamDeserializer)StreamMembersListResult];
+    }
+                               name:@"decode.team.members_list.stream"];
+    [self measureBlock:^{
+        [self streamDecode:data with:(StreamDeserializer)StreamMembersListResult];
+    }];
+}
+
+@end
@@ -0,0 +1,131 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+@interface DBTransportBaseClient (Tests)
++ (NSString *)asciiEscapeWithString:(NSString *)string;
++ (NSData *)serializeDataWithRoute:(DBRoute *)route routeArg:(id<DBSerializable>)arg;
++ (NSString *)serializedStringWithData:(NSData *)serializedData;
+@end
+
+@interface DBJSONWriter : NSObject
++ (NSData *)asciiDataWithJSONObject:(id)jsonObject;
+@end
+
+// the most entries the batch routes accept
+static const NSUInteger kBatchEntryCount = 1000;
+
+@interface TestJSONWriterPerformance : DBBenchmarkTestCase
+
+@end
+
+@implementation TestJSONWriterPerformance
+
++ (DBFILESUploadSessionFinishBatchArg *)finishBatchArg {
+    NSMutableArray<DBFILESUploadSessionFinishArg *> *entries = [NSMutableArray new];
+    for (NSUInteger i = 0; i < kBatchEntryCount; i++) {
+        NSString *sessionId = [NSString stringWithFormat:@"AAAAAAAAAQ%lu", (unsigned long)i];
+        NSString *path = [NSString stringWithFormat:@"/Fotos/Café/写真 %04lu.jpg", (unsigned long)i];
+        DBFILESUploadSessionCursor *cursor =
+            [[DBFILESUploadSessionCursor alloc] initWithSessionId:sessionId offset:@(150 * 1024 * 1024)];
+        DBFILESCommitInfo *commit = [[DBFILESCommitInfo alloc] initWithPath:path];
+        [entries addObject:[[DBFILESUploadSessionFinishArg alloc] initWithCursor:cursor commit:commit]];
+    }
+    return [[DBFILESUploadSessionFinishBatchArg alloc] initWithEntries:entries];
+}
+
++ (DBFILESDeleteBatchArg *)deleteBatchArg {
+    NSMutableArray<DBFILESDeleteArg *> *entries = [NSMutableArray new];
+    for (NSUInteger i = 0; i < kBatchEntryCount; i++) {
+        NSString *path = [NSString stringWithFormat:@"/Archive/2019/Report \"%lu\" 🗂.pdf", (unsigned long)i];
+        [entries addObject:[[DBFILESDeleteArg alloc] initWithPath:path]];
+    }
+    return [[DBFILESDeleteBatchArg alloc] initWithEntries:entries];
+}
+
+// This was the prior request serialization, for comparison purposes: the body and the header string were each
+// produced from their own `NSJSONSerialization` run, and the header string was then escaped and filtered.
++ (NSString *)old_serializeStringWithArg:(id<DBSerializable>)arg {
+    NSData *jsonData = [NSJSONSerialization dataWithJSONObject:[[arg class] serialize:arg] options:0 error:nil];
+    NSString *utf8String = [[NSString alloc] initWithData:jsonData encoding:NSUTF8StringEncoding];
+    NSString *asciiEscapedStr = [DBTransportBaseClient asciiEscapeWithString:utf8String];
+    NSMutableString *filteredStr = [[NSMutableString alloc] initWithString:asciiEscapedStr];
+    [filteredStr replaceOccurrencesOfString:@"\\/"
+                                 withString:@"/"
+                                    options:NSLiteralSearch
+                                      range:NSMakeRange(0, [filteredStr length])];
+    return filteredStr;
+}
+
++ (NSData *)old_serializeDataWithArg:(id<DBSerializable>)arg {
+    return [NSJSONSerialization dataWithJSONObject:[[arg class] serialize:arg] options:0 error:nil];
+}
+
+- (void)assertSerializationOfArg:(id<DBSerializable>)arg route:(DBRoute *)route {
+    NSData *data = [DBTransportBaseClient serializeDataWithRoute:route routeArg:arg];
+    NSString *string = [DBTransportBaseClient serializedStringWithData:data];
+    XCTAssertNotNil(string);
+    XCTAssertTrue([string canBeConvertedToEncoding:NSASCIIStringEncoding]);
+
+    id expected = [[arg class] serialize:arg];
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:data options:0 error:nil], expected);
+    NSString *oldString = [TestJSONWriterPerformance old_serializeStringWithArg:arg];
+    NSData *oldData = [oldString dataUsingEncoding:NSASCIIStringEncoding];
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:oldData options:0 error:nil], expected);
+}
+
+- (void)testSerializationMatchesOldImplementation {
+    [self assertSerializationOfArg:[TestJSONWriterPerformance finishBatchArg]
+                             route:[DBFILESRouteObjects DBFILESUploadSessionFinishBatch]];
+    [self assertSerializationOfArg:[TestJSONWriterPerformance deleteBatchArg]
+                             route:[DBFILESRouteObjects DBFILESDeleteBatch]];
+}
+
+- (void)testEscapes {
+    NSDictionary *value = @{
+        @"s" : @"a/b\"c\\d\né🍺\x7f",
+        @"n" : @[ @(-1), @(1LL << 40), @0.5, @YES, [NSNull null] ],
+    };
+    NSData *data = [DBJSONWriter asciiDataWithJSONObject:value];
+    NSString *string = [DBTransportBaseClient serializedStringWithData:data];
+    XCTAssertTrue([string containsString:@"\"a/b\\\"c\\\\d\\n\\u00e9\\ud83c\\udf7a\\u007f\""]);
+    XCTAssertEqualObjects([NSJSONSerialization JSONObjectWithData:data options:0 error:nil], value);
+}
+
+- (void)testFinishBatchOldSerializationPerformance {
+    DBFILESUploadSessionFinishBatchArg *arg = [TestJSONWriterPerformance finishBatchArg];
+    [self measureBlock:^{
+        // RPC requests used to serialize the argument for the header check and again for the body
+        [TestJSONWriterPerformance old_serializeStringWithArg:arg];
+        [TestJSONWriterPerformance old_serializeDataWithArg:arg];
+    }];
+}
+
+- (void)testFinishBatchSerializationPerformance {
+    DBFILESUploadSessionFinishBatchArg *arg = [TestJSONWriterPerformance finishBatchArg];
+    DBRoute *route = [DBFILESRouteObjects DBFILESUploadSessionFinishBatch];
+    [self measureBlock:^{
+        NSData *data = [DBTransportBaseClient serializeDataWithRoute:route routeArg:arg];
+        [DBTransportBaseClient serializedStringWithData:data];
+    }];
+}
+
+- (void)testDeleteBatchOldSerializationPerformance {
+    DBFILESDeleteBatchArg *arg = [TestJSONWriterPerformance deleteBatchArg];
+    [self measureBlock:^{
+        [TestJSONWriterPerformance old_serializeStringWithArg:arg];
+        [TestJSONWriterPerformance old_serializeDataWithArg:arg];
+    }];
+}
+
+- (void)testDeleteBatchSerializationPerformance {
+    DBFILESDeleteBatchArg *arg = [TestJSONWriterPerformance deleteBatchArg];
+    DBRoute *route = [DBFILESRouteObjects DBFILESDeleteBatch];
+    [self measureBlock:^{
+        NSData *data = [DBTransportBaseClient serializeDataWithRoute:route routeArg:arg];
+        [DBTransportBaseClient serializedStringWithData:data];
+    }];
+}
+
+@end
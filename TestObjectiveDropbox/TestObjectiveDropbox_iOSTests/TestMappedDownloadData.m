@@ -0,0 +1,65 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+#import <malloc/malloc.h>
+
+#import "DBBenchmarkReporter.h"
+
+@interface DBDownloadDataTask (Tests)
++ (NSData *)mappedDataWithContentsOfURL:(NSURL *)location;
+@end
+
+// a large download, as handed over by `DBDelegate` in the temporary directory
+static const NSUInteger kDownloadLength = 64 * 1024 * 1024;
+
+@interface TestMappedDownloadData : XCTestCase
+
+@end
+
+@implementation TestMappedDownloadData
+
++ (NSURL *)downloadedFile {
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    NSURL *url = [NSURL fileURLWithPath:path];
+    NSMutableData *data = [NSMutableData dataWithLength:kDownloadLength];
+    uint8_t *bytes = data.mutableBytes;
+    for (NSUInteger i = 0; i < kDownloadLength; i += 4096) {
+        bytes[i] = (uint8_t)(i >> 12);
+    }
+    [data writeToURL:url atomically:NO];
+    return url;
+}
+
+- (NSInteger)heapBytesInUseAfterBlock:(NSData * (^)(void))block {
+    malloc_statistics_t before;
+    malloc_statistics_t after;
+    malloc_zone_statistics(NULL, &before);
+    NSData *data = block();
+    malloc_zone_statistics(NULL, &after);
+    XCTAssertEqual(data.length, kDownloadLength);
+    return (NSInteger)after.size_in_use - (NSInteger)before.size_in_use;
+}
+
+- (void)testMappedDataMatchesFileAndRemovesIt {
+    NSURL *url = [TestMappedDownloadData downloadedFile];
+    NSData *expected = [NSData dataWithContentsOfURL:url];
+
+    NSData *mapped = [DBDownloadDataTask mappedDataWithContentsOfURL:url];
+    XCTAssertFalse([[NSFileManager defaultManager] fileExistsAtPath:url.path]);
+    XCTAssertEqualObjects(mapped, expected);
+}
+
+- (void)testMappedDataStaysOffTheHeap {
+    NSURL *url = [TestMappedDownloadData downloadedFile];
+    NSInteger copied = [self heapBytesInUseAfterBlock:^NSData * {
+        return [NSData dataWithContentsOfURL:url];
+    }];
+    NSInteger mapped = [self heapBytesInUseAfterBlock:^NSData * {
+        return [DBDownloadDataTask mappedDataWithContentsOfURL:url];
+    }];
+    DBBenchmarkReporter *reporter = [DBBenchmarkReporter sharedReporter];
+    [reporter record:@"download.data.copied.heap_bytes" value:copied unit:@"bytes"];
+    [reporter record:@"download.data.mapped.heap_bytes" value:mapped unit:@"bytes"];
+    XCTAssertLessThan(mapped, (NSInteger)kDownloadLength / 2);
+}
+
+@end
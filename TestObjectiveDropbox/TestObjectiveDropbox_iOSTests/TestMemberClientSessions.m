@@ -0,0 +1,104 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkStubProtocol.h"
+
+@interface TestMemberClientSessions : XCTestCase
+
+@end
+
+@implementation TestMemberClientSessions {
+    DBTransportDefaultClient *_transportClient;
+    DBTeamClient *_teamClient;
+}
+
++ (void)setUp {
+    [super setUp];
+    [DBBenchmarkStubProtocol install];
+}
+
+- (void)setUp {
+    [super setUp];
+    DBTransportDefaultConfig *config = [[DBTransportDefaultConfig alloc] initWithAppKey:@"app-key"
+                                                                              appSecret:@"app-secret"
+                                                                              userAgent:nil
+                                                                          delegateQueue:[NSOperationQueue new]
+                                                                 forceForegroundSession:YES];
+    _transportClient = [[DBTransportDefaultClient alloc] initWithAccessToken:@"team-token"
+                                                                    tokenUid:@"team-uid"
+                                                             transportConfig:config];
+    _teamClient = [[DBTeamClient alloc] initWithTransportClient:_transportClient];
+}
+
+- (void)tearDown {
+    [DBBenchmarkStubProtocol removeAllResponders];
+    [super tearDown];
+}
+
+// the client's transport isn't exposed, but its instance variable is reachable through key-value coding
+- (DBTransportDefaultClient *)transportClientForMemberId:(NSString *)memberId {
+    return [[_teamClient userClientWithMemberId:memberId] valueForKey:@"transportClient"];
+}
+
+- (void)testSharedMemberClientsUseTeamSessions {
+    _teamClient.sharesSessionsWithMemberClients = YES;
+    DBTransportDefaultClient *first = [self transportClientForMemberId:@"dbmid:1"];
+    DBTransportDefaultClient *second = [self transportClientForMemberId:@"dbmid:2"];
+
+    for (DBTransportDefaultClient *client in @[ first, second ]) {
+        XCTAssertEqual(client.session, _transportClient.session);
+        XCTAssertEqual(client.secondarySession, _transportClient.secondarySession);
+        XCTAssertEqual(client.longpollSession, _transportClient.longpollSession);
+        XCTAssertEqual(client.delegateQueue, _transportClient.delegateQueue);
+        XCTAssertEqual(client.accessTokenProvider, _transportClient.accessTokenProvider);
+        XCTAssertEqualObjects(client.tokenUid, @"team-uid");
+    }
+    XCTAssertEqualObjects(first.asMemberId, @"dbmid:1");
+    XCTAssertEqualObjects(second.asMemberId, @"dbmid:2");
+}
+
+- (void)testMemberClientsWithoutSharingSetUpSessions {
+    DBTransportDefaultClient *client = [self transportClientForMemberId:@"dbmid:1"];
+    XCTAssertNotEqual(client.session, _transportClient.session);
+    XCTAssertEqualObjects(client.asMemberId, @"dbmid:1");
+}
+
+- (void)testSharedMemberClientsSelectTheirMember {
+    _teamClient.sharesSessionsWithMemberClients = YES;
+    NSMutableDictionary<NSString *, NSString *> *authorizations = [NSMutableDictionary new];
+    [DBBenchmarkStubProtocol
+        setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+#pragma unused(statusCode)
+            @synchronized(authorizations) {
+                authorizations[[request valueForHTTPHeaderField:@"Dropbox-Api-Select-User"]] =
+                    [request valueForHTTPHeaderField:@"Authorization"];
+            }
+            *headers = @{ @"Content-Type" : @"application/json" };
+            return [@"{\"account_id\": \"dbid:AAH4f99T0taONIb-OurWxbNQ6ywGRopQngc\", \"name\": {\"given_name\": "
+                     "\"Franz\", \"surname\": \"Ferdinand\", \"familiar_name\": \"Franz\", \"display_name\": "
+                     "\"Franz Ferdinand (Personal)\", \"abbreviated_name\": \"FF\"}, \"email\": "
+                     "\"franz@gmail.com\", \"email_verified\": true, \"disabled\": false, \"is_teammate\": true}"
+                dataUsingEncoding:NSUTF8StringEncoding];
+        }
+             forPath:@"/2/users/get_account"];
+
+    NSArray<NSString *> *memberIds = @[ @"dbmid:1", @"dbmid:2", @"dbmid:3" ];
+    for (NSString *memberId in memberIds) {
+        XCTestExpectation *expectation = [self expectationWithDescription:memberId];
+        DBUserClient *client = [_teamClient userClientWithMemberId:memberId];
+        [[client.usersRoutes getAccount:@"dbid:AAH4f99T0taONIb-OurWxbNQ6ywGRopQngc"]
+            setResponseBlock:^(DBUSERSBasicAccount *result, DBUSERSGetAccountError *routeError,
+                               DBRequestError *networkError) {
+#pragma unused(routeError)
+                XCTAssertNotNil(result, @"%@", networkError);
+                [expectation fulfill];
+            }];
+    }
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    for (NSString *memberId in memberIds) {
+        XCTAssertEqualObjects(authorizations[memberId], @"Bearer team-token");
+    }
+}
+
+@end
@@ -0,0 +1,110 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+@interface DBShortLivedAccessTokenProvider : NSObject <DBAccessTokenProvider>
+- (instancetype)initWithToken:(DBAccessToken *)token tokenRefresher:(id<DBAccessTokenRefreshing>)tokenRefresher;
+- (void)startProactiveRefresh;
+@end
+
+// Hands out a new token an hour from expiry for every refresh, or fails them all.
+@interface TestTokenRefresher : NSObject <DBAccessTokenRefreshing>
+@property (nonatomic) BOOL fails;
+@property (atomic) NSUInteger refreshCount;
+@property (nonatomic, copy) void (^onRefresh)(void);
+@end
+
+@implementation TestTokenRefresher
+
+- (void)refreshAccessToken:(DBAccessToken *)accessToken
+                    scopes:(NSArray<NSString *> *)scopes
+                     queue:(dispatch_queue_t)queue
+                completion:(DBOAuthCompletion)completion {
+#pragma unused(scopes)
+    self.refreshCount++;
+    DBOAuthResult *result;
+    if (_fails) {
+        result = [[DBOAuthResult alloc] initWithError:@"invalid_grant" errorDescription:nil];
+    } else {
+        NSString *tokenString = [NSString stringWithFormat:@"token-%lu", (unsigned long)self.refreshCount];
+        NSTimeInterval expiration = [[NSDate date] timeIntervalSince1970] + 3600;
+        result = [[DBOAuthResult alloc] initWithSuccess:[DBAccessToken createWithShortLivedAccessToken:tokenString
+                                                                                                   uid:accessToken.uid
+                                                                                          refreshToken:@"refresh"
+                                                                              tokenExpirationTimestamp:expiration]];
+    }
+    dispatch_async(queue ?: dispatch_get_main_queue(), ^{
+        completion(result);
+        if (self->_onRefresh) {
+            self->_onRefresh();
+        }
+    });
+}
+
+@end
+
+@interface TestProactiveTokenRefresh : XCTestCase
+
+@end
+
+@implementation TestProactiveTokenRefresh
+
++ (DBAccessToken *)tokenExpiringIn:(NSTimeInterval)interval {
+    return [DBAccessToken createWithShortLivedAccessToken:@"token-0"
+                                                      uid:@"uid"
+                                             refreshToken:@"refresh"
+                                 tokenExpirationTimestamp:[[NSDate date] timeIntervalSince1970] + interval];
+}
+
+- (void)testRefreshesBeforeExpiryWithoutRequests {
+    TestTokenRefresher *refresher = [TestTokenRefresher new];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"refreshed"];
+    refresher.onRefresh = ^{
+        [expectation fulfill];
+    };
+    // already inside the window in which proactive refreshes are scheduled
+    DBShortLivedAccessTokenProvider *provider =
+        [[DBShortLivedAccessTokenProvider alloc] initWithToken:[TestProactiveTokenRefresh tokenExpiringIn:301]
+                                                tokenRefresher:refresher];
+    [provider startProactiveRefresh];
+    [self waitForExpectationsWithTimeout:20 handler:nil];
+
+    XCTAssertEqualObjects(provider.accessToken, @"token-1");
+    // the new token is good for another hour, so requests go ahead without waiting
+    XCTestExpectation *requestExpectation = [self expectationWithDescription:@"request"];
+    [provider refreshAccessTokenIfNecessary:^(DBOAuthResult *result) {
+        XCTAssertNil(result);
+        [requestExpectation fulfill];
+    }];
+    [self waitForExpectationsWithTimeout:1 handler:nil];
+    XCTAssertEqual(refresher.refreshCount, (NSUInteger)1);
+}
+
+- (void)testDoesNotRefreshEarly {
+    TestTokenRefresher *refresher = [TestTokenRefresher new];
+    DBShortLivedAccessTokenProvider *provider =
+        [[DBShortLivedAccessTokenProvider alloc] initWithToken:[TestProactiveTokenRefresh tokenExpiringIn:3600]
+                                                tokenRefresher:refresher];
+    [provider startProactiveRefresh];
+    [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:1]];
+    XCTAssertEqual(refresher.refreshCount, (NSUInteger)0);
+    XCTAssertEqualObjects(provider.accessToken, @"token-0");
+}
+
+- (void)testRevokedRefreshTokenIsNotRetried {
+    TestTokenRefresher *refresher = [TestTokenRefresher new];
+    refresher.fails = YES;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"refresh failed"];
+    refresher.onRefresh = ^{
+        [expectation fulfill];
+    };
+    DBShortLivedAccessTokenProvider *provider =
+        [[DBShortLivedAccessTokenProvider alloc] initWithToken:[TestProactiveTokenRefresh tokenExpiringIn:301]
+                                                tokenRefresher:refresher];
+    [provider startProactiveRefresh];
+    [self waitForExpectationsWithTimeout:20 handler:nil];
+    [[NSRunLoop mainRunLoop] runUntilDate:[NSDate dateWithTimeIntervalSinceNow:1]];
+    XCTAssertEqual(refresher.refreshCount, (NSUInteger)1);
+    XCTAssertEqualObjects(provider.accessToken, @"token-0");
+}
+
+@end
@@ -0,0 +1,129 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+@interface DBProgressCoalescer : NSObject
+- (instancetype)initWithProgressBlock:(DBProgressBlock)progressBlock
+                                queue:(NSOperationQueue *)queue
+                      minimumInterval:(NSTimeInterval)minimumInterval
+                     minimumByteDelta:(int64_t)minimumByteDelta;
+- (void)reportProgress:(int64_t)committed
+        totalCommitted:(int64_t)totalCommitted
+      expectedToCommit:(int64_t)expectedToCommit;
+- (void)flush;
+@end
+
+@interface TestProgressCoalescer : XCTestCase
+
+@end
+
+@implementation TestProgressCoalescer {
+    NSOperationQueue *_queue;
+    NSMutableArray<NSArray<NSNumber *> *> *_updates;
+}
+
+- (void)setUp {
+    [super setUp];
+    _queue = [NSOperationQueue new];
+    _queue.maxConcurrentOperationCount = 1;
+    _updates = [NSMutableArray new];
+}
+
+- (DBProgressCoalescer *)coalescerWithMinimumInterval:(NSTimeInterval)minimumInterval
+                                     minimumByteDelta:(int64_t)minimumByteDelta {
+    NSMutableArray<NSArray<NSNumber *> *> *updates = _updates;
+    return [[DBProgressCoalescer alloc]
+        initWithProgressBlock:^(int64_t committed, int64_t totalCommitted, int64_t expectedToCommit) {
+            [updates addObject:@[ @(committed), @(totalCommitted), @(expectedToCommit) ]];
+        }
+                        queue:_queue
+              minimumInterval:minimumInterval
+             minimumByteDelta:minimumByteDelta];
+}
+
+// The updates handed to the progress block so far, as committed, total committed and expected to commit.
+- (NSArray<NSArray<NSNumber *> *> *)updates {
+    [_queue waitUntilAllOperationsAreFinished];
+    return [_updates copy];
+}
+
+- (void)testSumsHeldBackUpdates {
+    DBProgressCoalescer *coalescer = [self coalescerWithMinimumInterval:60 minimumByteDelta:0];
+
+    // the first update goes through right away
+    [coalescer reportProgress:10 totalCommitted:10 expectedToCommit:1000];
+    [coalescer reportProgress:20 totalCommitted:30 expectedToCommit:1000];
+    [coalescer reportProgress:30 totalCommitted:60 expectedToCommit:1000];
+    NSArray *expectedUpdates = @[ @[ @10, @10, @1000 ] ];
+    XCTAssertEqualObjects([self updates], expectedUpdates);
+
+    [coalescer flush];
+    expectedUpdates = @[ @[ @10, @10, @1000 ], @[ @50, @60, @1000 ] ];
+    XCTAssertEqualObjects([self updates], expectedUpdates);
+
+    // nothing is left to hand over
+    [coalescer flush];
+    XCTAssertEqualObjects([self updates], expectedUpdates);
+}
+
+- (void)testNoIntervalLetsEveryUpdateThrough {
+    DBProgressCoalescer *coalescer = [self coalescerWithMinimumInterval:0 minimumByteDelta:0];
+
+    [coalescer reportProgress:10 totalCommitted:10 expectedToCommit:1000];
+    [coalescer reportProgress:20 totalCommitted:30 expectedToCommit:1000];
+    NSArray *expectedUpdates = @[ @[ @10, @10, @1000 ], @[ @20, @30, @1000 ] ];
+    XCTAssertEqualObjects([self updates], expectedUpdates);
+}
+
+- (void)testByteDeltaLetsUpdateThroughBeforeInterval {
+    DBProgressCoalescer *coalescer = [self coalescerWithMinimumInterval:60 minimumByteDelta:100];
+
+    [coalescer reportProgress:10 totalCommitted:10 expectedToCommit:1000];
+    [coalescer reportProgress:60 totalCommitted:70 expectedToCommit:1000];
+    XCTAssertEqual([self updates].count, (NSUInteger)1);
+
+    [coalescer reportProgress:50 totalCommitted:120 expectedToCommit:1000];
+    NSArray *expectedUpdates = @[ @[ @10, @10, @1000 ], @[ @110, @120, @1000 ] ];
+    XCTAssertEqualObjects([self updates], expectedUpdates);
+}
+
+- (void)testCompletionLetsUpdateThrough {
+    DBProgressCoalescer *coalescer = [self coalescerWithMinimumInterval:60 minimumByteDelta:0];
+
+    [coalescer reportProgress:10 totalCommitted:10 expectedToCommit:100];
+    [coalescer reportProgress:40 totalCommitted:50 expectedToCommit:100];
+    [coalescer reportProgress:50 totalCommitted:100 expectedToCommit:100];
+    NSArray *expectedUpdates = @[ @[ @10, @10, @100 ], @[ @90, @100, @100 ] ];
+    XCTAssertEqualObjects([self updates], expectedUpdates);
+}
+
+- (void)testUnknownSizeIsHeldBackUntilFlush {
+    DBProgressCoalescer *coalescer = [self coalescerWithMinimumInterval:60 minimumByteDelta:0];
+
+    // without an expected size, the end of the transfer can't be told from the updates
+    [coalescer reportProgress:10 totalCommitted:10 expectedToCommit:-1];
+    [coalescer reportProgress:90 totalCommitted:100 expectedToCommit:-1];
+    XCTAssertEqual([self updates].count, (NSUInteger)1);
+
+    [coalescer flush];
+    NSArray *expectedUpdates = @[ @[ @10, @10, @-1 ], @[ @90, @100, @-1 ] ];
+    XCTAssertEqualObjects([self updates], expectedUpdates);
+}
+
+- (void)testHeldBackUpdateIsHandedOverOnceIntervalElapses {
+    DBProgressCoalescer *coalescer = [self coalescerWithMinimumInterval:0.05 minimumByteDelta:0];
+
+    [coalescer reportProgress:10 totalCommitted:10 expectedToCommit:1000];
+    [coalescer reportProgress:20 totalCommitted:30 expectedToCommit:1000];
+
+    // the transfer goes quiet
+    NSArray *expectedUpdates = @[ @[ @10, @10, @1000 ], @[ @20, @30, @1000 ] ];
+    NSPredicate *flushed = [NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+#pragma unused(object)
+#pragma unused(bindings)
+        return [[self updates] isEqualToArray:expectedUpdates];
+    }];
+    [self waitForExpectations:@[ [self expectationForPredicate:flushed evaluatedWithObject:self handler:nil] ]
+                      timeout:10];
+}
+
+@end
@@ -0,0 +1,144 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+@interface DBTransportBaseClient (Tests)
+- (NSDictionary *)headersWithRoute:(DBRoute *)route
+                     serializedArg:(NSString *)serializedArg
+                   byteOffsetStart:(NSNumber *)byteOffsetStart
+                     byteOffsetEnd:(NSNumber *)byteOffsetEnd;
++ (NSString *)serializeStringWithRoute:(DBRoute *)route routeArg:(id<DBSerializable>)arg;
+@end
+
+static const NSUInteger kRequestCount = 10000;
+
+@interface TestRequestHeadersPerformance : DBBenchmarkTestCase
+
+@end
+
+@implementation TestRequestHeadersPerformance
+
++ (DBTransportBaseClient *)client {
+    DBCOMMONPathRoot *pathRoot = [[DBCOMMONPathRoot alloc] initWithRoot:@"3235641"];
+    DBTransportBaseConfig *config = [[DBTransportBaseConfig alloc] initWithAppKey:@"app-key"
+                                                                        appSecret:@"app-secret"
+                                                                   hostnameConfig:nil
+                                                                      redirectURL:nil
+                                                                        userAgent:@"TestApp"
+                                                                       asMemberId:@"dbmid:AAHhy7WsR0x"
+                                                                         pathRoot:pathRoot
+                                                                additionalHeaders:@{ @"X-Trace" : @"1" }];
+    return [[DBTransportBaseClient alloc] initWithAccessToken:@"sl.access-token" tokenUid:nil transportConfig:config];
+}
+
++ (NSArray<DBRoute *> *)routes {
+    return @[
+        [DBFILESRouteObjects DBFILESListFolder], [DBFILESRouteObjects DBFILESListFolderLongpoll],
+        [DBFILESRouteObjects DBFILESDownload], [DBFILESRouteObjects DBFILESUpload], [DBCHECKRouteObjects DBCHECKApp],
+        [DBTEAMRouteObjects DBTEAMMembersList]
+    ];
+}
+
+// This was the prior header construction, for comparison purposes: route attributes were parsed, and the fixed
+// headers built, for every request.
++ (NSDictionary *)old_headersWithClient:(DBTransportBaseClient *)client
+                              routeInfo:(NSDictionary<NSString *, NSString *> *)routeAttributes
+                          serializedArg:(NSString *)serializedArg {
+    NSString *routeStyle = routeAttributes[@"style"];
+    NSString *routeAuthStr = routeAttributes[@"auth"];
+    NSArray *routeAuthsSplit = [routeAuthStr componentsSeparatedByString:@","];
+    NSMutableArray<NSString *> *routeAuths = [NSMutableArray array];
+    for (NSString *obj in routeAuthsSplit) {
+        [routeAuths addObject:[obj stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]]];
+    }
+
+    NSMutableDictionary<NSString *, NSString *> *headers = [[NSMutableDictionary alloc] init];
+    [headers setObject:client.userAgent forKey:@"User-Agent"];
+
+    if (![routeAuths containsObject:@"noauth"]) {
+        if (client.asMemberId) {
+            [headers setObject:client.asMemberId forKey:@"Dropbox-Api-Select-User"];
+        }
+        if (client.pathRoot) {
+            [headers setObject:[DBTransportBaseClient serializeStringWithRoute:nil routeArg:client.pathRoot]
+                        forKey:@"Dropbox-Api-Path-Root"];
+        }
+        if (([routeAuths containsObject:@"user"] || [routeAuths containsObject:@"team"]) &&
+            (client.accessTokenProvider != nil)) {
+            [headers setObject:[NSString stringWithFormat:@"Bearer %@", client.accessTokenProvider.accessToken]
+                        forKey:@"Authorization"];
+        } else if ([routeAuths containsObject:@"app"] && (client.appKey != nil) && (client.appSecret != nil)) {
+            NSString *authString = [NSString stringWithFormat:@"%@:%@", client.appKey, client.appSecret];
+            NSData *authData = [authString dataUsingEncoding:NSUTF8StringEncoding];
+            [headers setObject:[NSString stringWithFormat:@"Basic %@", [authData base64EncodedStringWithOptions:0]]
+                        forKey:@"Authorization"];
+        }
+    }
+
+    if ([routeStyle isEqualToString:@"rpc"]) {
+        if (serializedArg) {
+            [headers setObject:@"application/json" forKey:@"Content-Type"];
+        }
+    } else if ([routeStyle isEqualToString:@"upload"]) {
+        [headers setObject:@"application/octet-stream" forKey:@"Content-Type"];
+        if (serializedArg) {
+            [headers setObject:serializedArg forKey:@"Dropbox-API-Arg"];
+        }
+    } else if ([routeStyle isEqualToString:@"download"]) {
+        if (serializedArg) {
+            [headers setObject:serializedArg forKey:@"Dropbox-API-Arg"];
+        }
+    }
+
+    if (client.additionalHeaders != nil) {
+        [headers addEntriesFromDictionary:client.additionalHeaders];
+    }
+    return headers;
+}
+
+- (void)testHeadersMatchOldImplementation {
+    DBTransportBaseClient *client = [TestRequestHeadersPerformance client];
+    for (DBRoute *route in [TestRequestHeadersPerformance routes]) {
+        // with and without an argument
+        NSString *args[] = { @"{\"path\":\"/a\"}", nil };
+        for (NSUInteger i = 0; i < 2; i++) {
+            NSDictionary *expected = [TestRequestHeadersPerformance old_headersWithClient:client
+                                                                                routeInfo:route.attrs
+                                                                            serializedArg:args[i]];
+            NSDictionary *headers = [client headersWithRoute:route
+                                               serializedArg:args[i]
+                                             byteOffsetStart:nil
+                                               byteOffsetEnd:nil];
+            XCTAssertEqualObjects(headers, expected, @"%@", route.name);
+        }
+    }
+
+    NSDictionary *ranged = [client headersWithRoute:[DBFILESRouteObjects DBFILESDownload]
+                                      serializedArg:@"{}"
+                                    byteOffsetStart:@0
+                                      byteOffsetEnd:@1023];
+    XCTAssertEqualObjects(ranged[@"Range"], @"bytes=0-1023");
+}
+
+- (void)testOldHeadersPerformance {
+    DBTransportBaseClient *client = [TestRequestHeadersPerformance client];
+    NSDictionary *attrs = [DBFILESRouteObjects DBFILESListFolder].attrs;
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < kRequestCount; i++) {
+            [TestRequestHeadersPerformance old_headersWithClient:client routeInfo:attrs serializedArg:@"{}"];
+        }
+    }];
+}
+
+- (void)testHeadersPerformance {
+    DBTransportBaseClient *client = [TestRequestHeadersPerformance client];
+    DBRoute *route = [DBFILESRouteObjects DBFILESListFolder];
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < kRequestCount; i++) {
+            [client headersWithRoute:route serializedArg:@"{}" byteOffsetStart:nil byteOffsetEnd:nil];
+        }
+    }];
+}
+
+@end
@@ -0,0 +1,99 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+@interface DBTransportBaseClient (Tests)
++ (NSData *)serializeDataWithRoute:(DBRoute *)route routeArg:(id<DBSerializable>)arg;
+@end
+
+static const NSUInteger kThreadCount = 16;
+static const NSUInteger kLookupsPerThread = 10000;
+
+@interface TestRouteObjectsPerformance : DBBenchmarkTestCase
+
+@end
+
+@implementation TestRouteObjectsPerformance
+
+// This was the prior accessor, for comparison purposes: every lookup in a namespace took the same lock.
+static DBRoute *old_DBFILESListFolder;
+static DBRoute *old_DBFILESGetMetadata;
+static NSObject *old_lockObj;
+
++ (DBRoute *)old_DBFILESListFolder {
+    @synchronized(old_lockObj) {
+        if (!old_DBFILESListFolder) {
+            old_DBFILESListFolder = [DBFILESRouteObjects DBFILESListFolder];
+        }
+        return old_DBFILESListFolder;
+    }
+}
+
++ (DBRoute *)old_DBFILESGetMetadata {
+    @synchronized(old_lockObj) {
+        if (!old_DBFILESGetMetadata) {
+            old_DBFILESGetMetadata = [DBFILESRouteObjects DBFILESGetMetadata];
+        }
+        return old_DBFILESGetMetadata;
+    }
+}
+
++ (void)setUp {
+    [super setUp];
+    old_lockObj = [NSObject new];
+}
+
+- (void)testConcurrentAccessReturnsOneInstance {
+    NSMutableSet *routes = [NSMutableSet new];
+    dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+        DBRoute *route = [DBSHARINGRouteObjects DBSHARINGListFolders];
+        @synchronized(routes) {
+            [routes addObject:[NSValue valueWithNonretainedObject:route]];
+        }
+    });
+    XCTAssertEqual(routes.count, (NSUInteger)1);
+    XCTAssertEqualObjects([DBSHARINGRouteObjects DBSHARINGListFolders].name, @"list_folders");
+}
+
+- (void)testOldLookupContentionPerformance {
+    [self measureBlock:^{
+        dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+            for (NSUInteger i = 0; i < kLookupsPerThread; i++) {
+                // what issuing a `list_folder` and a `get_metadata` RPC looks up
+                [TestRouteObjectsPerformance old_DBFILESListFolder];
+                [TestRouteObjectsPerformance old_DBFILESGetMetadata];
+            }
+        });
+    }];
+}
+
+- (void)testLookupContentionPerformance {
+    [self measureBlock:^{
+        dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+            for (NSUInteger i = 0; i < kLookupsPerThread; i++) {
+                [DBFILESRouteObjects DBFILESListFolder];
+                [DBFILESRouteObjects DBFILESGetMetadata];
+            }
+        });
+    }];
+}
+
+- (void)testRpcSetupContentionPerformance {
+    DBFILESListFolderArg *arg = [[DBFILESListFolderArg alloc] initWithPath:@"/camera uploads"];
+    [self measureBlock:^{
+        dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+            for (NSUInteger i = 0; i < kLookupsPerThread / 10; i++) {
+                // everything an RPC does before it reaches the session: route lookup and argument serialization
+                DBRoute *route = [DBFILESRouteObjects DBFILESListFolder];
+                [DBTransportBaseClient serializeDataWithRoute:route routeArg:arg];
+            }
+        });
+    }];
+}
+
+@end
@@ -0,0 +1,239 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkStubProtocol.h"
+
+static const NSUInteger kFileSize = 20 * 1024;
+static const NSUInteger kSegmentSize = 8 * 1024;
+static NSString *const kRev = @"a1c10ce0dd78";
+
+// The arguments the response block of a segmented download was called with.
+@interface TestDownloadResult : NSObject
+@property (nonatomic) DBFILESFileMetadata *metadata;
+@property (nonatomic) DBRequestError *networkError;
+@property (nonatomic) NSURL *destination;
+@end
+
+@implementation TestDownloadResult
+@end
+
+@interface TestSegmentedDownload : XCTestCase
+
+@end
+
+@implementation TestSegmentedDownload {
+    DBUserClient *_client;
+    NSData *_contents;
+    NSURL *_destination;
+}
+
++ (void)setUp {
+    [super setUp];
+    [DBBenchmarkStubProtocol install];
+}
+
+- (void)setUp {
+    [super setUp];
+    DBTransportDefaultConfig *config = [[DBTransportDefaultConfig alloc] initWithAppKey:@"app-key"
+                                                                              appSecret:@"app-secret"
+                                                                              userAgent:nil
+                                                                          delegateQueue:nil
+                                                                 forceForegroundSession:YES];
+    _client = [[DBUserClient alloc] initWithAccessToken:@"token" transportConfig:config];
+    NSString *destinationPath = [NSTemporaryDirectory() stringByAppendingPathComponent:[NSUUID UUID].UUIDString];
+    _destination = [NSURL fileURLWithPath:destinationPath];
+
+    // every byte differs from its neighbours, so that a misplaced range shows up
+    NSMutableData *contents = [NSMutableData dataWithLength:kFileSize];
+    uint8_t *bytes = contents.mutableBytes;
+    for (NSUInteger i = 0; i < kFileSize; i++) {
+        bytes[i] = (uint8_t)(i * 7 + i / 251);
+    }
+    _contents = contents;
+
+    [DBBenchmarkStubProtocol setJSONResponse:[NSJSONSerialization dataWithJSONObject:[self metadataJSON]
+                                                                             options:0
+                                                                               error:nil]
+                                     forPath:@"/2/files/get_metadata"];
+}
+
+- (void)tearDown {
+    [DBBenchmarkStubProtocol removeAllResponders];
+    [[NSFileManager defaultManager] removeItemAtURL:_destination error:nil];
+    [super tearDown];
+}
+
+- (NSDictionary *)metadataJSON {
+    return @{
+        @".tag" : @"file",
+        @"name" : @"video.mp4",
+        @"id" : @"id:a4ayc_80_OEAAAAAAAAAXw",
+        @"client_modified" : @"2015-05-12T15:50:38Z",
+        @"server_modified" : @"2015-05-12T15:50:38Z",
+        @"rev" : kRev,
+        @"size" : @(kFileSize),
+        @"path_lower" : @"/video.mp4",
+        @"path_display" : @"/video.mp4",
+    };
+}
+
+// Answers ranged downloads of the file, cut short to `truncatedLength` bytes the first time `truncatedOffset` is
+// requested. Returns the requested ranges, in order.
+- (NSMutableArray<NSValue *> *)stubDownloadTruncatingOffset:(NSUInteger)truncatedOffset
+                                                   toLength:(NSUInteger)truncatedLength {
+    NSMutableArray<NSValue *> *requestedRanges = [NSMutableArray new];
+    NSData *contents = _contents;
+    NSString *result = [[NSString alloc] initWithData:[NSJSONSerialization dataWithJSONObject:[self metadataJSON]
+                                                                                      options:0
+                                                                                        error:nil]
+                                             encoding:NSUTF8StringEncoding];
+    __block BOOL truncated = NO;
+    [DBBenchmarkStubProtocol
+        setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+            NSString *argString = [request valueForHTTPHeaderField:@"Dropbox-API-Arg"];
+            NSData *argData = [argString dataUsingEncoding:NSUTF8StringEncoding];
+            NSDictionary *arg = [NSJSONSerialization JSONObjectWithData:argData options:0 error:nil];
+            if (![arg[@"path"] isEqualToString:[@"rev:" stringByAppendingString:kRev]]) {
+                *statusCode = 400;
+                return nil;
+            }
+
+            unsigned long startBytes = 0;
+            unsigned long endBytes = 0;
+            NSString *range = [request valueForHTTPHeaderField:@"Range"];
+            if (sscanf(range.UTF8String, "bytes=%lu-%lu", &startBytes, &endBytes) != 2) {
+                *statusCode = 400;
+                return nil;
+            }
+            NSRange requestedRange = NSMakeRange(startBytes, endBytes + 1 - startBytes);
+            BOOL truncate = NO;
+            @synchronized(requestedRanges) {
+                [requestedRanges addObject:[NSValue valueWithRange:requestedRange]];
+                truncate = !truncated && startBytes == truncatedOffset;
+                truncated = truncated || truncate;
+            }
+            if (truncate) {
+                // the connection dropped mid-response
+                requestedRange.length = truncatedLength;
+            }
+
+            *statusCode = 206;
+            *headers = @{ @"Content-Type" : @"application/octet-stream", @"Dropbox-API-Result" : result };
+            return [contents subdataWithRange:requestedRange];
+        }
+             forPath:@"/2/files/download"];
+    return requestedRanges;
+}
+
+- (TestDownloadResult *)downloadWithConfig:(DBSegmentedDownloadConfig *)config {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"download"];
+    TestDownloadResult *downloadResult = [TestDownloadResult new];
+    [_client.filesRoutes segmentedDownloadFile:@"/video.mp4"
+                                   destination:_destination
+                                        config:config
+                                         queue:[NSOperationQueue new]
+                                 progressBlock:nil
+                                 responseBlock:^(DBFILESFileMetadata *result, DBFILESDownloadError *routeError,
+                                                 DBRequestError *networkError, NSURL *destination) {
+#pragma unused(routeError)
+                                     downloadResult.metadata = result;
+                                     downloadResult.networkError = networkError;
+                                     downloadResult.destination = destination;
+                                     [expectation fulfill];
+                                 }];
+    [self waitForExpectationsWithTimeout:30 handler:nil];
+    return downloadResult;
+}
+
+- (DBSegmentedDownloadConfig *)config {
+    DBSegmentedDownloadConfig *config = [DBSegmentedDownloadConfig new];
+    config.segmentSize = kSegmentSize;
+    config.maxConcurrentSegments = 2;
+    return config;
+}
+
+- (void)testSplitsIntoSegmentsAndReassembles {
+    NSMutableArray<NSValue *> *requestedRanges = [self stubDownloadTruncatingOffset:NSNotFound toLength:0];
+
+    TestDownloadResult *result = [self downloadWithConfig:[self config]];
+    XCTAssertNil(result.networkError);
+    XCTAssertEqualObjects(result.metadata.rev, kRev);
+    XCTAssertEqualObjects(result.destination, _destination);
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:_destination], _contents);
+
+    // the last segment holds the remainder
+    NSSet<NSValue *> *expectedRanges = [NSSet setWithArray:@[
+        [NSValue valueWithRange:NSMakeRange(0, kSegmentSize)],
+        [NSValue valueWithRange:NSMakeRange(kSegmentSize, kSegmentSize)],
+        [NSValue valueWithRange:NSMakeRange(2 * kSegmentSize, kFileSize - 2 * kSegmentSize)],
+    ]];
+    XCTAssertEqual(requestedRanges.count, (NSUInteger)3);
+    XCTAssertEqualObjects([NSSet setWithArray:requestedRanges], expectedRanges);
+}
+
+- (void)testRetriesSegmentFromFirstMissingByte {
+    NSMutableArray<NSValue *> *requestedRanges = [self stubDownloadTruncatingOffset:kSegmentSize toLength:3000];
+
+    TestDownloadResult *result = [self downloadWithConfig:[self config]];
+    XCTAssertNil(result.networkError);
+    XCTAssertEqualObjects([NSData dataWithContentsOfURL:_destination], _contents);
+
+    NSRange retriedRange = NSMakeRange(kSegmentSize + 3000, kSegmentSize - 3000);
+    XCTAssertEqual(requestedRanges.count, (NSUInteger)4);
+    XCTAssertTrue([requestedRanges containsObject:[NSValue valueWithRange:retriedRange]]);
+    NSUInteger truncatedIndex =
+        [requestedRanges indexOfObject:[NSValue valueWithRange:NSMakeRange(kSegmentSize, kSegmentSize)]];
+    XCTAssertLessThan(truncatedIndex, [requestedRanges indexOfObject:[NSValue valueWithRange:retriedRange]]);
+}
+
+- (void)testFailsWithoutRetryWhenServerIgnoresRange {
+    NSMutableArray<NSString *> *ranges = [NSMutableArray new];
+    NSData *contents = _contents;
+    NSString *result = [[NSString alloc] initWithData:[NSJSONSerialization dataWithJSONObject:[self metadataJSON]
+                                                                                      options:0
+                                                                                        error:nil]
+                                             encoding:NSUTF8StringEncoding];
+    [DBBenchmarkStubProtocol
+        setResponder:^NSData *(NSURLRequest *request, NSInteger *statusCode, NSDictionary **headers) {
+            @synchronized(ranges) {
+                [ranges addObject:[request valueForHTTPHeaderField:@"Range"]];
+            }
+            // the whole file, rather than the requested range
+            *statusCode = 200;
+            *headers = @{ @"Content-Type" : @"application/octet-stream", @"Dropbox-API-Result" : result };
+            return contents;
+        }
+             forPath:@"/2/files/download"];
+
+    TestDownloadResult *downloadResult = [self downloadWithConfig:[self config]];
+    XCTAssertNil(downloadResult.metadata);
+    XCTAssertTrue([downloadResult.networkError isClientError]);
+    XCTAssertEqualObjects(downloadResult.networkError.nsError.domain, NSURLErrorDomain);
+    XCTAssertEqual(downloadResult.networkError.nsError.code, NSURLErrorBadServerResponse);
+    // no segment is requested twice
+    @synchronized(ranges) {
+        XCTAssertEqual([NSSet setWithArray:ranges].count, ranges.count);
+    }
+}
+
+- (void)testRemovesDestinationWhenRetriesRunOut {
+    [self stubDownloadTruncatingOffset:kSegmentSize toLength:3000];
+    DBSegmentedDownloadConfig *config = [self config];
+    config.maxSegmentRetries = 0;
+
+    TestDownloadResult *result = [self downloadWithConfig:config];
+    XCTAssertNotNil(result.networkError);
+    XCTAssertNil(result.metadata);
+    XCTAssertNil(result.destination);
+
+    // the incomplete file is closed and removed once the other segments have returned
+    NSPredicate *removed = [NSPredicate predicateWithBlock:^BOOL(id object, NSDictionary *bindings) {
+#pragma unused(object)
+#pragma unused(bindings)
+        return ![[NSFileManager defaultManager] fileExistsAtPath:self->_destination.path];
+    }];
+    [self waitForExpectations:@[ [self expectationForPredicate:removed evaluatedWithObject:self handler:nil] ]
+                      timeout:10];
+}
+
+@end
@@ -0,0 +1,183 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+@interface DBShortLivedAccessTokenProvider : NSObject <DBAccessTokenProvider>
+- (instancetype)initWithToken:(DBAccessToken *)token tokenRefresher:(id<DBAccessTokenRefreshing>)tokenRefresher;
+@end
+
+// request-building threads, each reading the token for this many headers
+static const NSUInteger kThreadCount = 8;
+static const NSUInteger kReadCount = 20000;
+
+// Completes every refresh right away with a token that is about to expire again, so that each request check starts
+// another refresh and the provider's queue sees a steady stream of barrier blocks.
+@interface TestStormTokenRefresher : NSObject <DBAccessTokenRefreshing>
+@property (atomic) NSUInteger refreshCount;
+@end
+
+@implementation TestStormTokenRefresher
+
+- (void)refreshAccessToken:(DBAccessToken *)accessToken
+                    scopes:(NSArray<NSString *> *)scopes
+                     queue:(dispatch_queue_t)queue
+                completion:(DBOAuthCompletion)completion {
+#pragma unused(scopes)
+#pragma unused(queue)
+    NSUInteger count = ++self.refreshCount;
+    DBAccessToken *token =
+        [DBAccessToken createWithShortLivedAccessToken:[NSString stringWithFormat:@"token-%lu", (unsigned long)count]
+                                                   uid:accessToken.uid
+                                          refreshToken:@"refresh"
+                              tokenExpirationTimestamp:[[NSDate date] timeIntervalSince1970] + 60];
+    DBOAuthResult *result = [[DBOAuthResult alloc] initWithSuccess:token];
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+        completion(result);
+    });
+}
+
+@end
+
+// This was the prior implementation, for comparison purposes: every read waited its turn on the queue that also runs
+// the refresh bookkeeping as barrier blocks.
+@interface TestOldShortLivedAccessTokenProvider : NSObject <DBAccessTokenProvider>
+@end
+
+@implementation TestOldShortLivedAccessTokenProvider {
+    DBAccessToken *_token;
+    id<DBAccessTokenRefreshing> _tokenRefresher;
+    dispatch_queue_t _queue;
+    NSMutableArray<DBOAuthCompletion> *_completionBlocks;
+}
+
+- (instancetype)initWithToken:(DBAccessToken *)token tokenRefresher:(id<DBAccessTokenRefreshing>)tokenRefresher {
+    self = [super init];
+    if (self) {
+        _token = token;
+        _tokenRefresher = tokenRefresher;
+        _queue = dispatch_queue_create("TestOldShortLivedAccessTokenProvider", DISPATCH_QUEUE_CONCURRENT);
+        _completionBlocks = [NSMutableArray new];
+    }
+    return self;
+}
+
+- (NSString *)accessToken {
+    __block NSString *tokenString = nil;
+    dispatch_sync(_queue, ^{
+        tokenString = self->_token.accessToken;
+    });
+    return tokenString;
+}
+
+- (void)refreshAccessTokenIfNecessary:(DBOAuthCompletion)completion {
+    dispatch_barrier_async(_queue, ^{
+        if (self->_token.tokenExpirationTimestamp - 300 > [[NSDate date] timeIntervalSince1970]) {
+            completion(nil);
+            return;
+        }
+        BOOL refreshInProgress = self->_completionBlocks.count > 0;
+        [self->_completionBlocks addObject:completion];
+        if (!refreshInProgress) {
+            __weak typeof(self) weakSelf = self;
+            [self->_tokenRefresher refreshAccessToken:self->_token
+                                               scopes:@[]
+                                                queue:nil
+                                           completion:^(DBOAuthResult *result) {
+                                               [weakSelf handleRefreshResult:result];
+                                           }];
+        }
+    });
+}
+
+- (void)handleRefreshResult:(DBOAuthResult *)result {
+    dispatch_barrier_async(_queue, ^{
+        self->_token = result.accessToken;
+        for (DBOAuthCompletion block in self->_completionBlocks) {
+            block(result);
+        }
+        [self->_completionBlocks removeAllObjects];
+    });
+}
+
+@end
+
+@interface TestTokenProviderContention : DBBenchmarkTestCase
+
+@end
+
+@implementation TestTokenProviderContention
+
++ (DBAccessToken *)expiringToken {
+    return [DBAccessToken createWithShortLivedAccessToken:@"token-0"
+                                                      uid:@"uid"
+                                             refreshToken:@"refresh"
+                                 tokenExpirationTimestamp:[[NSDate date] timeIntervalSince1970] + 60];
+}
+
+// Reads the token for every request on `kThreadCount` threads, while one more thread keeps the provider refreshing.
+// Returns the tokens read.
+- (NSSet<NSString *> *)readTokensDuringRefreshStorm:(id<DBAccessTokenProvider>)provider {
+    __block BOOL reading = YES;
+    dispatch_group_t stormGroup = dispatch_group_create();
+    dispatch_group_async(stormGroup, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^{
+        while (reading) {
+            [provider refreshAccessTokenIfNecessary:^(DBOAuthResult *result) {
+#pragma unused(result)
+            }];
+            usleep(10);
+        }
+    });
+
+    NSMutableSet<NSString *> *tokens = [NSMutableSet new];
+    dispatch_apply(kThreadCount, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t thread) {
+#pragma unused(thread)
+        NSMutableSet<NSString *> *threadTokens = [NSMutableSet new];
+        for (NSUInteger i = 0; i < kReadCount; i++) {
+            NSString *token = provider.accessToken;
+            [threadTokens addObject:token ?: @"(nil)"];
+        }
+        @synchronized(tokens) {
+            [tokens unionSet:threadTokens];
+        }
+    });
+    reading = NO;
+    dispatch_group_wait(stormGroup, DISPATCH_TIME_FOREVER);
+    return tokens;
+}
+
+- (void)testReadsSeeWholeTokensDuringRefreshes {
+    TestStormTokenRefresher *refresher = [TestStormTokenRefresher new];
+    DBShortLivedAccessTokenProvider *provider =
+        [[DBShortLivedAccessTokenProvider alloc] initWithToken:[TestTokenProviderContention expiringToken]
+                                                tokenRefresher:refresher];
+    NSSet<NSString *> *tokens = [self readTokensDuringRefreshStorm:provider];
+
+    XCTAssertGreaterThan(refresher.refreshCount, (NSUInteger)0);
+    XCTAssertFalse([tokens containsObject:@"(nil)"]);
+    for (NSString *token in tokens) {
+        XCTAssertTrue([token hasPrefix:@"token-"], @"%@", token);
+    }
+}
+
+- (void)testOldReadDuringRefreshesPerformance {
+    TestStormTokenRefresher *refresher = [TestStormTokenRefresher new];
+    TestOldShortLivedAccessTokenProvider *provider =
+        [[TestOldShortLivedAccessTokenProvider alloc] initWithToken:[TestTokenProviderContention expiringToken]
+                                                     tokenRefresher:refresher];
+    [self measureBlock:^{
+        [self readTokensDuringRefreshStorm:provider];
+    }];
+}
+
+- (void)testReadDuringRefreshesPerformance {
+    TestStormTokenRefresher *refresher = [TestStormTokenRefresher new];
+    DBShortLivedAccessTokenProvider *provider =
+        [[DBShortLivedAccessTokenProvider alloc] initWithToken:[TestTokenProviderContention expiringToken]
+                                                tokenRefresher:refresher];
+    [self measureBlock:^{
+        [self readTokensDuringRefreshStorm:provider];
+    }];
+}
+
+@end
@@ -0,0 +1,262 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+// linked accounts of a multi-account app
+static const NSUInteger kAccountCount = 20;
+
+// Keeps tokens in a property list file, reading and rewriting all of it for every call, and counts the calls.
+@interface TestFileAccessTokenStore : NSObject <DBAccessTokenStore>
+@property (nonatomic, readonly) NSURL *url;
+@property (atomic) NSUInteger readCount;
+@property (atomic) NSUInteger writeCount;
+@end
+
+@implementation TestFileAccessTokenStore
+
+- (instancetype)initWithURL:(NSURL *)url {
+    self = [super init];
+    if (self) {
+        _url = url;
+    }
+    return self;
+}
+
+- (NSMutableDictionary<NSString *, DBAccessToken *> *)readTokens {
+    self.readCount++;
+    NSData *data = [NSData dataWithContentsOfURL:_url];
+    if (!data) {
+        return [NSMutableDictionary new];
+    }
+    NSSet *classes = [NSSet setWithObjects:[NSDictionary class], [NSString class], [DBAccessToken class], nil];
+    NSDictionary *tokens = [NSKeyedUnarchiver unarchivedObjectOfClasses:classes fromData:data error:nil];
+    return [tokens mutableCopy] ?: [NSMutableDictionary new];
+}
+
+- (BOOL)writeTokens:(NSDictionary<NSString *, DBAccessToken *> *)tokens {
+    self.writeCount++;
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:tokens requiringSecureCoding:YES error:nil];
+    return [data writeToURL:_url atomically:YES];
+}
+
+- (BOOL)storeAccessToken:(DBAccessToken *)accessToken {
+    @synchronized(self) {
+        NSMutableDictionary<NSString *, DBAccessToken *> *tokens = [self readTokens];
+        tokens[accessToken.uid] = accessToken;
+        return [self writeTokens:tokens];
+    }
+}
+
+- (DBAccessToken *)retrieveAccessToken:(NSString *)uid {
+    @synchronized(self) {
+        return [self readTokens][uid];
+    }
+}
+
+- (NSDictionary<NSString *, DBAccessToken *> *)retrieveAllAccessTokens {
+    @synchronized(self) {
+        return [self readTokens];
+    }
+}
+
+- (BOOL)deleteAccessToken:(NSString *)uid {
+    @synchronized(self) {
+        NSMutableDictionary<NSString *, DBAccessToken *> *tokens = [self readTokens];
+        [tokens removeObjectForKey:uid];
+        return [self writeTokens:tokens];
+    }
+}
+
+- (BOOL)deleteAllAccessTokens {
+    @synchronized(self) {
+        return [self writeTokens:@{}];
+    }
+}
+
+@end
+
+// Passes every call on to another store.
+@interface TestForwardingAccessTokenStore : NSObject <DBAccessTokenStore>
+@end
+
+@implementation TestForwardingAccessTokenStore {
+    id<DBAccessTokenStore> _store;
+}
+
+- (instancetype)initWithStore:(id<DBAccessTokenStore>)store {
+    self = [super init];
+    if (self) {
+        _store = store;
+    }
+    return self;
+}
+
+- (BOOL)storeAccessToken:(DBAccessToken *)accessToken {
+    return [_store storeAccessToken:accessToken];
+}
+
+- (DBAccessToken *)retrieveAccessToken:(NSString *)uid {
+    return [_store retrieveAccessToken:uid];
+}
+
+- (NSDictionary<NSString *, DBAccessToken *> *)retrieveAllAccessTokens {
+    return [_store retrieveAllAccessTokens];
+}
+
+- (BOOL)deleteAccessToken:(NSString *)uid {
+    return [_store deleteAccessToken:uid];
+}
+
+- (BOOL)deleteAllAccessTokens {
+    return [_store deleteAllAccessTokens];
+}
+
+@end
+
+@interface TestTokenStorePerformance : DBBenchmarkTestCase
+
+@end
+
+@implementation TestTokenStorePerformance {
+    NSString *_keychainService;
+}
+
+- (void)setUp {
+    [super setUp];
+    _keychainService = [NSString stringWithFormat:@"TestTokenStorePerformance.%@", [NSUUID UUID].UUIDString];
+}
+
+- (void)tearDown {
+    [DBSDKKeychain clearAllTokensAtService:_keychainService];
+    [super tearDown];
+}
+
++ (NSArray<DBAccessToken *> *)tokens {
+    NSMutableArray<DBAccessToken *> *tokens = [NSMutableArray new];
+    for (NSUInteger i = 0; i < kAccountCount; i++) {
+        NSString *uid = [NSString stringWithFormat:@"%lu", (unsigned long)(100000 + i)];
+        [tokens addObject:[DBAccessToken createWithShortLivedAccessToken:[@"sl.token-" stringByAppendingString:uid]
+                                                                     uid:uid
+                                                            refreshToken:[@"refresh-" stringByAppendingString:uid]
+                                                tokenExpirationTimestamp:1700000000 + i]];
+    }
+    return tokens;
+}
+
++ (TestFileAccessTokenStore *)fileStore {
+    NSString *name = [NSString stringWithFormat:@"tokens-%@.plist", [NSUUID UUID].UUIDString];
+    NSURL *url = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:name]];
+    return [[TestFileAccessTokenStore alloc] initWithURL:url];
+}
+
+// What an app with several linked accounts does at launch: check for tokens, list them, and look up each account
+// to create its client.
++ (void)launchWithOAuthManager:(DBOAuthManager *)manager {
+    if (![manager hasStoredAccessTokens]) {
+        return;
+    }
+    [manager retrieveFirstAccessToken];
+    for (NSString *uid in [manager retrieveAllAccessTokens]) {
+        [manager retrieveAccessToken:uid];
+    }
+}
+
+// This was the prior keychain lookup, for comparison purposes: a query for the uids, then one query per token, for
+// every call.
++ (NSDictionary<NSString *, DBAccessToken *> *)old_retrieveAllTokensAtService:(NSString *)service {
+    NSMutableDictionary<NSString *, DBAccessToken *> *result = [NSMutableDictionary new];
+    for (NSString *uid in [DBSDKKeychain retrieveAllTokenIdsAtService:service]) {
+        DBAccessToken *token = [DBSDKKeychain retrieveTokenWithUid:uid service:service];
+        if (token) {
+            result[uid] = token;
+        }
+    }
+    return result;
+}
+
++ (void)old_launchWithService:(NSString *)service {
+    if ([self old_retrieveAllTokensAtService:service].count == 0) {
+        return;
+    }
+    [self old_retrieveAllTokensAtService:service];
+    for (NSString *uid in [self old_retrieveAllTokensAtService:service]) {
+        [DBSDKKeychain retrieveTokenWithUid:uid service:service];
+    }
+}
+
+- (void)testCacheWritesThrough {
+    TestFileAccessTokenStore *store = [TestTokenStorePerformance fileStore];
+    DBOAuthManager *manager = [[DBOAuthManager alloc] initWithAppKey:@"app-key"];
+    manager.accessTokenStore = store;
+    XCTAssertEqual(manager.accessTokenStore, store);
+
+    NSArray<DBAccessToken *> *tokens = [TestTokenStorePerformance tokens];
+    for (DBAccessToken *token in tokens) {
+        XCTAssertTrue([manager storeAccessToken:token]);
+    }
+    XCTAssertEqual(store.writeCount, kAccountCount);
+
+    [TestTokenStorePerformance launchWithOAuthManager:manager];
+    [TestTokenStorePerformance launchWithOAuthManager:manager];
+    // one read per store above, as the file is rewritten whole; after that, only the first launch reads the file
+    XCTAssertEqual(store.readCount, kAccountCount + 1);
+
+    XCTAssertTrue([manager clearStoredAccessToken:tokens[0].uid]);
+    XCTAssertNil([manager retrieveAccessToken:tokens[0].uid]);
+    XCTAssertEqual([manager retrieveAllAccessTokens].count, kAccountCount - 1);
+
+    // a second manager on the same store sees what the first one wrote
+    DBOAuthManager *otherManager = [[DBOAuthManager alloc] initWithAppKey:@"app-key"];
+    otherManager.accessTokenStore = store;
+    NSDictionary<NSString *, DBAccessToken *> *stored = [otherManager retrieveAllAccessTokens];
+    XCTAssertEqual(stored.count, kAccountCount - 1);
+    XCTAssertEqualObjects(stored[tokens[1].uid].accessToken, tokens[1].accessToken);
+    XCTAssertEqualObjects(stored[tokens[1].uid].refreshToken, tokens[1].refreshToken);
+
+    XCTAssertTrue([manager clearStoredAccessTokens]);
+    XCTAssertFalse([manager hasStoredAccessTokens]);
+    XCTAssertEqual([store retrieveAllAccessTokens].count, (NSUInteger)0);
+}
+
+- (void)testKeychainBulkRetrievalMatchesLookups {
+    for (DBAccessToken *token in [TestTokenStorePerformance tokens]) {
+        XCTAssertTrue([DBSDKKeychain storeAccessToken:token service:_keychainService]);
+    }
+    NSDictionary<NSString *, DBAccessToken *> *expected =
+        [TestTokenStorePerformance old_retrieveAllTokensAtService:_keychainService];
+    NSDictionary<NSString *, DBAccessToken *> *tokens = [DBSDKKeychain retrieveAllTokensAtService:_keychainService];
+    XCTAssertEqual(tokens.count, kAccountCount);
+    XCTAssertEqualObjects([NSSet setWithArray:tokens.allKeys], [NSSet setWithArray:expected.allKeys]);
+    for (NSString *uid in expected) {
+        XCTAssertEqualObjects(tokens[uid].accessToken, expected[uid].accessToken);
+        XCTAssertEqual(tokens[uid].tokenExpirationTimestamp, expected[uid].tokenExpirationTimestamp);
+    }
+}
+
+- (void)testOldKeychainLaunchPerformance {
+    for (DBAccessToken *token in [TestTokenStorePerformance tokens]) {
+        [DBSDKKeychain storeAccessToken:token service:_keychainService];
+    }
+    NSString *service = _keychainService;
+    [self measureBlock:^{
+        [TestTokenStorePerformance old_launchWithService:service];
+    }];
+}
+
+- (void)testKeychainLaunchPerformance {
+    for (DBAccessToken *token in [TestTokenStorePerformance tokens]) {
+        [DBSDKKeychain storeAccessToken:token service:_keychainService];
+    }
+    NSString *service = _keychainService;
+    [self measureBlock:^{
+        // keychain stores share one cache per service for the life of the process, so each launch goes through a
+        // store of its own to start cold
+        DBOAuthManager *manager = [[DBOAuthManager alloc] initWithAppKey:@"app-key"];
+        manager.accessTokenStore = [[TestForwardingAccessTokenStore alloc]
+            initWithStore:[[DBKeychainAccessTokenStore alloc] initWithService:service]];
+        [TestTokenStorePerformance launchWithOAuthManager:manager];
+    }];
+}
+
+@end
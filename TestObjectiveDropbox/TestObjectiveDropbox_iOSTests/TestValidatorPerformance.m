@@ -0,0 +1,152 @@
+#import <XCTest/XCTest.h>
+#import <ObjectiveDropboxOfficial/ObjectiveDropboxOfficial.h>
+
+#import "DBBenchmarkTestCase.h"
+
+// a full `list_folder` page
+static const NSUInteger kEntryCount = 1000;
+
+@interface DBStoneValidators (Tests)
++ (NSRegularExpression *)regularExpressionWithPattern:(NSString *)pattern;
+@end
+
+@interface TestValidatorPerformance : DBBenchmarkTestCase
+
+@end
+
+@implementation TestValidatorPerformance
+
+- (void)tearDown {
+    DBStoneValidators.validatesServerResponses = YES;
+    [super tearDown];
+}
+
++ (NSDictionary *)listFolderJSON {
+    NSMutableArray<DBFILESMetadata *> *entries = [NSMutableArray new];
+    NSDate *date = [NSDate dateWithTimeIntervalSince1970:1600000000];
+    NSString *contentHash = [@"" stringByPaddingToLength:64 withString:@"e3b0c442" startingAtIndex:0];
+    for (NSUInteger i = 0; i < kEntryCount; i++) {
+        NSString *name = [NSString stringWithFormat:@"IMG_%04lu.jpg", (unsigned long)i];
+        NSString *path = [NSString stringWithFormat:@"/camera uploads/%@", name];
+        NSString *fileId = [NSString stringWithFormat:@"id:a4ayc_80_OEAAAAAAAA%lu", (unsigned long)i];
+        NSString *rev = [NSString stringWithFormat:@"5a4e%011lx", (unsigned long)i];
+        [entries addObject:[[DBFILESFileMetadata alloc] initWithName:name
+                                                                  id_:fileId
+                                                       clientModified:date
+                                                       serverModified:date
+                                                                  rev:rev
+                                                                 size:@(2 * 1024 * 1024 + i)
+                                                            pathLower:path
+                                                          pathDisplay:path
+                                                 parentSharedFolderId:@"84528192421"
+                                                           previewUrl:nil
+                                                            mediaInfo:nil
+                                                          symlinkInfo:nil
+                                                          sharingInfo:nil
+                                                       isDownloadable:@YES
+                                                           exportInfo:nil
+                                                       propertyGroups:nil
+                                             hasExplicitSharedMembers:nil
+                                                          contentHash:contentHash
+                                                         fileLockInfo:nil]];
+    }
+    DBFILESListFolderResult *result = [[DBFILESListFolderResult alloc] initWithEntries:entries
+                                                                                cursor:@"ZtkX9_EHj3x7PMkVuFIhwKYX"
+                                                                               hasMore:@YES];
+    return [DBFILESListFolderResultSerializer serialize:result];
+}
+
+// This was the prior pattern check, for comparison purposes: compiled on every call, collecting every match.
++ (void (^)(NSString *))old_patternValidator:(NSString *)pattern {
+    return ^(NSString *value) {
+        NSError *error;
+        NSRegularExpression *re = [NSRegularExpression regularExpressionWithPattern:pattern options:0 error:&error];
+        NSArray *matches = [re matchesInString:value options:0 range:NSMakeRange(0, [value length])];
+        if ([matches count] == 0) {
+            NSString *exceptionMessage = [NSString stringWithFormat:@"value must match pattern \"%@\"", [re pattern]];
+            [DBStoneValidators raiseIllegalStateErrorWithMessage:exceptionMessage];
+        }
+    };
+}
+
++ (NSArray<NSString *> *)revs {
+    NSMutableArray<NSString *> *revs = [NSMutableArray new];
+    for (NSDictionary *entry in [self listFolderJSON][@"entries"]) {
+        [revs addObject:entry[@"rev"]];
+    }
+    return revs;
+}
+
+- (void)testPatternValidation {
+    void (^validator)(NSString *) = [DBStoneValidators stringValidator:@(9) maxLength:nil pattern:@"[0-9a-f]+"];
+    XCTAssertNoThrow(validator(@"015a4e0000001"));
+    // not anchored: any match is enough, as before
+    XCTAssertNoThrow(validator(@"zz015a4e0zz"));
+    XCTAssertThrows(validator(@"zzzzzzzzzzz"));
+    XCTAssertThrows(validator(@"0a"));
+
+    XCTAssertEqual([DBStoneValidators regularExpressionWithPattern:@"[0-9a-f]+"],
+                   [DBStoneValidators regularExpressionWithPattern:@"[0-9a-f]+"]);
+    XCTAssertThrows([DBStoneValidators stringValidator:nil maxLength:nil pattern:@"(unclosed"](@"value"));
+}
+
+- (void)testTrustedDeserialization {
+    NSDictionary *json = [TestValidatorPerformance listFolderJSON];
+    DBFILESListFolderResult *validated = [DBFILESListFolderResultSerializer deserialize:json];
+
+    DBStoneValidators.validatesServerResponses = NO;
+    DBFILESListFolderResult *trusted = [DBStoneValidators deserializeTrustedValue:^id {
+        return [DBFILESListFolderResultSerializer deserialize:json];
+    }];
+    XCTAssertEqualObjects(trusted, validated);
+
+    // skipped inside the trusted scope only, and only while the option is off
+    void (^validator)(NSString *) = [DBStoneValidators stringValidator:@(9) maxLength:nil pattern:@"[0-9a-f]+"];
+    XCTAssertNoThrow([DBStoneValidators deserializeTrustedValue:^id {
+        validator(@"zz");
+        return nil;
+    }]);
+    XCTAssertThrows(validator(@"zz"));
+    DBStoneValidators.validatesServerResponses = YES;
+    XCTAssertThrows([DBStoneValidators deserializeTrustedValue:^id {
+        validator(@"zz");
+        return nil;
+    }]);
+}
+
+- (void)testOldPatternValidationPerformance {
+    NSArray<NSString *> *revs = [TestValidatorPerformance revs];
+    [self measureBlock:^{
+        for (NSString *rev in revs) {
+            [TestValidatorPerformance old_patternValidator:@"[0-9a-f]+"](rev);
+        }
+    }];
+}
+
+- (void)testPatternValidationPerformance {
+    NSArray<NSString *> *revs = [TestValidatorPerformance revs];
+    [self measureBlock:^{
+        for (NSString *rev in revs) {
+            [DBStoneValidators stringValidator:@(9) maxLength:nil pattern:@"[0-9a-f]+"](rev);
+        }
+    }];
+}
+
+- (void)testListingDecodePerformance {
+    NSDictionary *json = [TestValidatorPerformance listFolderJSON];
+    [self measureBlock:^{
+        [DBFILESListFolderResultSerializer deserialize:json];
+    }];
+}
+
+- (void)testTrustedListingDecodePerformance {
+    NSDictionary *json = [TestValidatorPerformance listFolderJSON];
+    DBStoneValidators.validatesServerResponses = NO;
+    [self measureBlock:^{
+        [DBStoneValidators deserializeTrustedValue:^id {
+            return [DBFILESListFolderResultSerializer deserialize:json];
+        }];
+    }];
+}
+
+@end
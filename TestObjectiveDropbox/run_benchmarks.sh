@@ -0,0 +1,38 @@
+#!/bin/sh
+
+# Runs the SDK benchmarks headless against the in-process API stub and writes their results as JSON. The default test
+# run skips them, see `DBBenchmarkTestCase`; every class with benchmark cases is listed below.
+#
+# Usage: ./run_benchmarks.sh [output.json] [destination]
+#
+# The destination defaults to an iPhone 14 simulator. Compare the output of two releases case by case on
+# `median_ns_per_op`.
+
+set -e
+
+cd "$(dirname "$0")"
+
+OUTPUT="${1:-$(pwd)/DBBenchmarks.json}"
+DESTINATION="${2:-platform=iOS Simulator,name=iPhone 14}"
+
+pod install
+
+TEST_RUNNER_DB_RUN_BENCHMARKS=1 TEST_RUNNER_DB_BENCHMARK_OUTPUT="$OUTPUT" xcodebuild test \
+  -workspace TestObjectiveDropbox.xcworkspace \
+  -scheme TestObjectiveDropbox_iOS \
+  -configuration Release \
+  -destination "$DESTINATION" \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestBenchmarks \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestClientRegistry \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestDateSerializerPerformance \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestDelegatePerformance \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestErrorBodyReadsPerformance \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestJSONDecoderPerformance \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestJSONWriterPerformance \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestRequestHeadersPerformance \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestRouteObjectsPerformance \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestTokenProviderContention \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestTokenStorePerformance \
+  -only-testing:TestObjectiveDropbox_iOSTests/TestValidatorPerformance
+
+echo "Benchmark results written to $OUTPUT"